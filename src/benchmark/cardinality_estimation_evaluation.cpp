@@ -0,0 +1,259 @@
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <cxxopts.hpp>
+#include <magic_enum.hpp>
+
+#include "benchmark_config.hpp"
+#include "file_based_benchmark_item_runner.hpp"
+#include "file_based_table_generator.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/pqp_utils.hpp"
+#include "resolve_type.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+#include "tpch/tpch_benchmark_item_runner.hpp"
+#include "tpch/tpch_table_generator.hpp"
+#include "utils/assert.hpp"
+
+/**
+ * Compares the cardinality estimates of the CardinalityEstimator with and without distinct count sketches (see
+ * HyperLogLogSketch) on the queries of TPC-H or the Join Order Benchmark.
+ *
+ * Each query is optimized and executed once. For each LQP node of the executed plans, the actual output row count
+ * (taken from the performance data of the operator translated from the node) is compared to the node's estimated
+ * cardinality. Afterwards, the sketches are removed from all statistics and the same plans are estimated again. Note
+ * that the plans were chosen based on the estimates with sketches.
+ *
+ * The error of an estimate is given as its q-error, i.e., max(estimate / actual, actual / estimate), where both counts
+ * are at least one. The median, 90th percentile, and maximum q-error are reported per node type.
+ */
+
+using namespace opossum;  // NOLINT
+
+namespace {
+
+// Provides access to the SQL strings of the queries, which the item runners usually execute themselves.
+class TPCHQueries : public TPCHBenchmarkItemRunner {
+ public:
+  TPCHQueries(const std::shared_ptr<BenchmarkConfig>& config, const float scale_factor)
+      : TPCHBenchmarkItemRunner(config, false, scale_factor, ClusteringConfiguration::None) {}
+
+  std::string sql(const BenchmarkItemID item_id) { return _build_deterministic_query(item_id); }
+};
+
+class FileBasedQueries : public FileBasedBenchmarkItemRunner {
+ public:
+  using FileBasedBenchmarkItemRunner::FileBasedBenchmarkItemRunner;
+
+  std::string sql(const BenchmarkItemID item_id) const { return _queries[item_id].sql; }
+};
+
+struct Sample {
+  std::shared_ptr<const AbstractLQPNode> node;
+  Cardinality actual_row_count;
+};
+
+struct ExecutedQuery {
+  std::string name;
+  std::vector<std::shared_ptr<AbstractLQPNode>> optimized_plans;
+  std::vector<Sample> samples;
+};
+
+ExecutedQuery execute_query(const std::string& name, const std::string& sql) {
+  auto executed_query = ExecutedQuery{name, {}, {}};
+
+  auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+  const auto [pipeline_status, result_tables] = pipeline.get_result_tables();
+  Assert(pipeline_status == SQLPipelineStatus::Success, "Query " + name + " failed");
+
+  executed_query.optimized_plans = pipeline.get_optimized_logical_plans();
+
+  // Statements that do not return rows (e.g., the CREATE VIEW of TPC-H 15) are not of interest.
+  const auto ignored_node_types = std::unordered_set<LQPNodeType>{
+      LQPNodeType::ChangeMetaTable, LQPNodeType::CreateTable, LQPNodeType::CreatePreparedPlan, LQPNodeType::CreateView,
+      LQPNodeType::Delete,          LQPNodeType::DropView,    LQPNodeType::DropTable,          LQPNodeType::Export,
+      LQPNodeType::Import,          LQPNodeType::Insert,      LQPNodeType::Update};
+
+  // Multiple operators can be translated from the same node. The plans are visited top-down, so that the topmost of
+  // these operators, which produces the node's output, is sampled.
+  auto sampled_nodes = std::unordered_set<std::shared_ptr<const AbstractLQPNode>>{};
+  for (const auto& pqp : pipeline.get_physical_plans()) {
+    visit_pqp(pqp, [&](const auto& op) {
+      const auto& node = op->lqp_node;
+      if (!node || ignored_node_types.count(node->type) || !op->performance_data->has_output) {
+        return PQPVisitation::VisitInputs;
+      }
+
+      if (sampled_nodes.emplace(node).second) {
+        executed_query.samples.emplace_back(
+            Sample{node, static_cast<Cardinality>(op->performance_data->output_row_count)});
+      }
+      return PQPVisitation::VisitInputs;
+    });
+  }
+
+  return executed_query;
+}
+
+std::shared_ptr<TableStatistics> without_sketches(const std::shared_ptr<TableStatistics>& table_statistics) {
+  auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>{};
+  column_statistics.reserve(table_statistics->column_statistics.size());
+
+  for (const auto& base_attribute_statistics : table_statistics->column_statistics) {
+    resolve_data_type(base_attribute_statistics->data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      // Scaling with a selectivity of one copies the statistics objects.
+      const auto attribute_statistics =
+          std::dynamic_pointer_cast<AttributeStatistics<ColumnDataType>>(base_attribute_statistics->scaled(1.0f));
+      Assert(attribute_statistics, "Unexpected type of attribute statistics");
+      attribute_statistics->distinct_count_sketch = nullptr;
+      column_statistics.emplace_back(attribute_statistics);
+    });
+  }
+
+  return std::make_shared<TableStatistics>(std::move(column_statistics), table_statistics->row_count);
+}
+
+void remove_sketches(const std::vector<ExecutedQuery>& executed_queries) {
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    table->set_table_statistics(without_sketches(table->table_statistics()));
+  }
+
+  // Rules like the ChunkPruningRule store modified statistics in the StoredTableNodes.
+  for (const auto& executed_query : executed_queries) {
+    for (const auto& plan : executed_query.optimized_plans) {
+      visit_lqp(plan, [&](const auto& node) {
+        if (const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node)) {
+          if (stored_table_node->table_statistics) {
+            stored_table_node->table_statistics = without_sketches(stored_table_node->table_statistics);
+          }
+        }
+        return LQPVisitation::VisitInputs;
+      });
+    }
+  }
+}
+
+// Returns the q-errors per node type.
+std::map<std::string, std::vector<double>> estimate(const std::vector<ExecutedQuery>& executed_queries) {
+  auto q_errors = std::map<std::string, std::vector<double>>{};
+
+  for (const auto& executed_query : executed_queries) {
+    const auto estimator = CardinalityEstimator{};
+    for (const auto& sample : executed_query.samples) {
+      const auto estimated_row_count = std::max(double{estimator.estimate_cardinality(sample.node)}, 1.0);
+      const auto actual_row_count = std::max(double{sample.actual_row_count}, 1.0);
+      const auto q_error = std::max(estimated_row_count / actual_row_count, actual_row_count / estimated_row_count);
+
+      q_errors[std::string{magic_enum::enum_name(sample.node->type)}].emplace_back(q_error);
+    }
+  }
+
+  return q_errors;
+}
+
+double quantile(std::vector<double> values, const double fraction) {
+  std::sort(values.begin(), values.end());
+  const auto index = static_cast<size_t>(fraction * static_cast<double>(values.size() - 1) + 0.5);
+  return values[index];
+}
+
+void print_q_errors(const std::map<std::string, std::vector<double>>& q_errors_with_sketches,
+                    const std::map<std::string, std::vector<double>>& q_errors_without_sketches) {
+  std::cout << std::left << std::setw(12) << "Node type" << std::right << std::setw(8) << "Count";
+  for (const auto& configuration : {"Sketches", "No sketches"}) {
+    std::cout << " | " << std::setw(36) << std::string{configuration} + " (median / p90 / max)";
+  }
+  std::cout << std::endl;
+
+  std::cout << std::fixed << std::setprecision(2);
+  for (const auto& [node_type, q_errors] : q_errors_with_sketches) {
+    std::cout << std::left << std::setw(12) << node_type << std::right << std::setw(8) << q_errors.size();
+    for (const auto& configuration_q_errors : {q_errors, q_errors_without_sketches.at(node_type)}) {
+      std::cout << " | " << std::setw(10) << quantile(configuration_q_errors, 0.5) << " / " << std::setw(10)
+                << quantile(configuration_q_errors, 0.9) << " / " << std::setw(10)
+                << *std::max_element(configuration_q_errors.begin(), configuration_q_errors.end());
+    }
+    std::cout << std::endl;
+  }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto cli_options = cxxopts::Options{"./hyriseCardinalityEstimationEvaluation",
+                                      "Compares the q-errors of cardinality estimates with and without sketches"};
+
+  // clang-format off
+  cli_options.add_options()
+    ("help", "print a summary of CLI options")
+    ("b,benchmark", "tpch or job", cxxopts::value<std::string>()->default_value("tpch"))
+    ("s,scale", "Scale factor for TPC-H", cxxopts::value<float>()->default_value("0.1"))
+    ("table_path", "Directory containing the JOB tables", cxxopts::value<std::string>()->default_value("imdb_data")) // NOLINT
+    ("query_path", "Directory containing the .sql files of the JOB", cxxopts::value<std::string>()->default_value("third_party/join-order-benchmark")); // NOLINT
+  // clang-format on
+
+  const auto cli_parse_result = cli_options.parse(argc, argv);
+  if (cli_parse_result.count("help")) {
+    std::cout << cli_options.help() << std::endl;
+    return 0;
+  }
+
+  const auto benchmark = cli_parse_result["benchmark"].as<std::string>();
+  const auto config = std::make_shared<BenchmarkConfig>(BenchmarkConfig::get_default_config());
+
+  auto executed_queries = std::vector<ExecutedQuery>{};
+
+  if (benchmark == "tpch") {
+    const auto scale_factor = cli_parse_result["scale"].as<float>();
+    std::cout << "- Evaluating TPC-H with scale factor " << scale_factor << std::endl;
+
+    TPCHTableGenerator{scale_factor, ClusteringConfiguration::None, config}.generate_and_store();
+
+    auto queries = TPCHQueries{config, scale_factor};
+    for (const auto item_id : queries.items()) {
+      executed_queries.emplace_back(execute_query(queries.item_name(item_id), queries.sql(item_id)));
+    }
+  } else if (benchmark == "job") {
+    const auto table_path = cli_parse_result["table_path"].as<std::string>();
+    const auto query_path = cli_parse_result["query_path"].as<std::string>();
+    std::cout << "- Evaluating the Join Order Benchmark on tables from " << table_path << std::endl;
+
+    const auto setup_imdb_command = "python3 scripts/setup_imdb.py " + table_path;
+    const auto setup_imdb_return_code = system(setup_imdb_command.c_str());
+    Assert(setup_imdb_return_code == 0, "setup_imdb.py failed. Did you run the evaluation from the project root dir?");
+
+    FileBasedTableGenerator{config, table_path}.generate_and_store();
+
+    const auto non_query_file_names = std::unordered_set<std::string>{"fkindexes.sql", "schema.sql"};
+    auto queries = FileBasedQueries{config, query_path, non_query_file_names};
+    for (const auto item_id : queries.items()) {
+      executed_queries.emplace_back(execute_query(queries.item_name(item_id), queries.sql(item_id)));
+    }
+  } else {
+    Fail("Unknown benchmark '" + benchmark + "', expected tpch or job");
+  }
+
+  const auto q_errors_with_sketches = estimate(executed_queries);
+  remove_sketches(executed_queries);
+  const auto q_errors_without_sketches = estimate(executed_queries);
+
+  print_q_errors(q_errors_with_sketches, q_errors_without_sketches);
+
+  return 0;
+}
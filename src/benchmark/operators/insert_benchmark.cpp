@@ -0,0 +1,76 @@
+#include <memory>
+
+#include "benchmark/benchmark.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+/**
+ * Measures the throughput of concurrent Inserts into the same table. Each thread repeatedly inserts and commits a
+ * small number of rows (given as the argument), similar to the Inserts of TPC-C's NewOrder transaction into
+ * ORDER_LINE and NEW_ORDER. Rows are reserved without locking the table, so the throughput should scale with the
+ * number of threads.
+ */
+static void BM_ConcurrentInsert(benchmark::State& state) {  // NOLINT
+  const auto column_definitions = TableColumnDefinitions{
+      {"a", DataType::Int, false}, {"b", DataType::Long, false}, {"c", DataType::Double, true}};
+
+  // The table is shared by all threads and all runs of the benchmark. Static initialization is thread-safe.
+  static const auto target_table = [&]() {
+    const auto table =
+        std::make_shared<Table>(column_definitions, TableType::Data, Chunk::DEFAULT_SIZE, UseMvcc::Yes);
+    Hyrise::get().storage_manager.add_table("insert_benchmark_target", table);
+    return table;
+  }();
+
+  const auto values_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (auto row = int64_t{0}; row < state.range(0); ++row) {
+    values_table->append({static_cast<int32_t>(row), row, static_cast<double>(row)});
+  }
+  const auto values = std::make_shared<TableWrapper>(values_table);
+  values->execute();
+
+  for (auto _ : state) {
+    const auto insert = std::make_shared<Insert>("insert_benchmark_target", values);
+    const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    insert->set_transaction_context(context);
+    insert->execute();
+    context->commit();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConcurrentInsert)->Arg(1)->Arg(10)->ThreadRange(1, 16)->UseRealTime();
+
+/**
+ * Measures the throughput of auto-commit single-row INSERT statements issued by many threads. Each statement is a
+ * transaction of its own, so that commit ids are requested and published at a high rate. Commits that become pending
+ * while another thread publishes are made visible together with the publisher's next group.
+ */
+static void BM_AutoCommitInsert(benchmark::State& state) {  // NOLINT
+  static const auto target_table = []() {
+    const auto table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Long, false}}, TableType::Data,
+        Chunk::DEFAULT_SIZE, UseMvcc::Yes);
+    Hyrise::get().storage_manager.add_table("auto_commit_insert_benchmark_target", table);
+    return table;
+  }();
+
+  for (auto _ : state) {
+    auto pipeline =
+        SQLPipelineBuilder{"INSERT INTO auto_commit_insert_benchmark_target VALUES (1, 2)"}.create_pipeline();
+    const auto [pipeline_status, table] = pipeline.get_result_table();
+    if (pipeline_status != SQLPipelineStatus::Success) state.SkipWithError("INSERT failed");
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AutoCommitInsert)->Threads(1)->Threads(64)->UseRealTime();
+
+}  // namespace opossum
@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <memory>
+#include <thread>
 
 #include "benchmark/benchmark.h"
 #include "hyrise.hpp"
@@ -7,6 +9,7 @@
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk.hpp"
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "synthetic_table_generator.hpp"
@@ -58,6 +61,20 @@ std::shared_ptr<TableWrapper> generate_table(const size_t number_of_rows) {
   return table_wrapper;
 }
 
+// Generates a single-column table with uniformly distributed values in [0, max_value).
+std::shared_ptr<TableWrapper> generate_uniform_table(const size_t number_of_rows, const double max_value) {
+  const auto column_specification =
+      ColumnSpecification{ColumnDataDistribution::make_uniform_config(0.0, max_value), DataType::Int,
+                          SegmentEncodingSpec{EncodingType::Dictionary}};
+  const auto chunk_size = static_cast<ChunkOffset>(number_of_rows / NUMBER_OF_CHUNKS);
+  const auto table = SyntheticTableGenerator::generate_table({column_specification}, number_of_rows, chunk_size);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  return table_wrapper;
+}
+
 template <class C>
 void bm_join_impl(benchmark::State& state, std::shared_ptr<TableWrapper> table_wrapper_left,
                   std::shared_ptr<TableWrapper> table_wrapper_right) {
@@ -99,6 +116,41 @@ void BM_Join_MediumAndMedium(benchmark::State& state) {  // NOLINT 100,000 x 100
   bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
 }
 
+// The following benchmarks join a medium-sized build side with a big probe side. In the selective case, only about 1%
+// of the probe side values find a join partner and the Bloom filters of the hash join can skip most of them. In the
+// non-selective case, every value finds a join partner and checking the Bloom filters does not pay off.
+void BM_JoinHash_Selective(benchmark::State& state) {  // NOLINT 100,000 x 10,000,000, 1% matches
+  auto table_wrapper_left = generate_uniform_table(TABLE_SIZE_MEDIUM, TABLE_SIZE_MEDIUM);
+  auto table_wrapper_right = generate_uniform_table(TABLE_SIZE_BIG, 100 * TABLE_SIZE_MEDIUM);
+
+  bm_join_impl<JoinHash>(state, table_wrapper_left, table_wrapper_right);
+}
+
+void BM_JoinHash_NonSelective(benchmark::State& state) {  // NOLINT 100,000 x 10,000,000, 100% matches
+  auto table_wrapper_left = generate_uniform_table(TABLE_SIZE_MEDIUM, TABLE_SIZE_MEDIUM);
+  auto table_wrapper_right = generate_uniform_table(TABLE_SIZE_BIG, TABLE_SIZE_MEDIUM);
+
+  bm_join_impl<JoinHash>(state, table_wrapper_left, table_wrapper_right);
+}
+
+// Runs the hash join on the NodeQueueScheduler so that the radix partitions are placed on different NUMA nodes. With the
+// fake NUMA topology (four nodes), the placement logic can be exercised on non-NUMA machines. Note that the fake
+// topology allocates all partitions from the default memory resource.
+template <bool use_fake_numa_topology>
+void BM_JoinHash_NUMA(benchmark::State& state) {  // NOLINT 100,000 x 10,000,000
+  if constexpr (use_fake_numa_topology) {
+    Hyrise::get().topology.use_fake_numa_topology(0, std::max(1u, std::thread::hardware_concurrency() / 4));
+  } else {
+    Hyrise::get().topology.use_numa_topology();
+  }
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto table_wrapper_left = generate_uniform_table(TABLE_SIZE_MEDIUM, TABLE_SIZE_MEDIUM);
+  auto table_wrapper_right = generate_uniform_table(TABLE_SIZE_BIG, TABLE_SIZE_MEDIUM);
+
+  bm_join_impl<JoinHash>(state, table_wrapper_left, table_wrapper_right);
+}
+
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinNestedLoop);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinIndex);
@@ -108,6 +160,10 @@ BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinIndex);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinHash);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinHash);
 BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinHash);
+BENCHMARK(BM_JoinHash_Selective);
+BENCHMARK(BM_JoinHash_NonSelective);
+BENCHMARK_TEMPLATE(BM_JoinHash_NUMA, true);
+BENCHMARK_TEMPLATE(BM_JoinHash_NUMA, false);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinSortMerge);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinSortMerge);
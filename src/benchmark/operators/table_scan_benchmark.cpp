@@ -6,6 +6,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/table.hpp"
+#include "synthetic_table_generator.hpp"
 #include "utils/load_table.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -83,4 +84,34 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScan_Like)(benchmark::State& sta
   }
 }
 
+// Scans on dictionary segments with the given vector compression for the attribute vector. The predicates are
+// evaluated on the value ids, i.e., without looking at the dictionary for each row. state.range(0) selects the
+// predicate.
+template <VectorCompressionType vector_compression_type>
+void BM_TableScan_OnDictCodes(benchmark::State& state) {
+  const auto column_specification =
+      ColumnSpecification{ColumnDataDistribution::make_uniform_config(0.0, 1'000.0), DataType::Int,
+                          SegmentEncodingSpec{EncodingType::Dictionary, vector_compression_type}};
+  const auto table = SyntheticTableGenerator::generate_table({column_specification}, 1'000'000);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto column = pqp_column_(ColumnID{0}, DataType::Int, false, "");
+  const auto predicates = std::vector<std::shared_ptr<AbstractExpression>>{
+      equals_(column, 500), less_than_(column, 10), between_inclusive_(column, 100, 900),
+      in_(column, list_(1, 10, 100, 250, 500, 750))};
+  const auto& predicate = predicates[state.range(0)];
+
+  auto warm_up = std::make_shared<TableScan>(table_wrapper, predicate);
+  warm_up->execute();
+  for (auto _ : state) {
+    auto table_scan = std::make_shared<TableScan>(table_wrapper, predicate);
+    table_scan->execute();
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_TableScan_OnDictCodes, VectorCompressionType::FixedWidthInteger)->DenseRange(0, 3);
+BENCHMARK_TEMPLATE(BM_TableScan_OnDictCodes, VectorCompressionType::BitPacking)->DenseRange(0, 3);
+
 }  // namespace opossum
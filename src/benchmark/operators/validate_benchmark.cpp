@@ -0,0 +1,91 @@
+#include <memory>
+#include <random>
+#include <utility>
+
+#include "benchmark/benchmark.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto SEED = 42;
+constexpr auto CHUNK_COUNT = ChunkID{16};
+
+// Creates a table of committed rows (begin_cid 0) of which the given percentage has been updated, i.e., the old
+// versions have been invalidated by a transaction that committed with CommitID 1.
+std::shared_ptr<TableWrapper> create_table_wrapper(const int64_t updated_percentage) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             Chunk::DEFAULT_SIZE, UseMvcc::Yes);
+
+  auto random_engine = std::default_random_engine{SEED};
+  auto distribution = std::uniform_int_distribution<int64_t>{0, 99};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < CHUNK_COUNT; ++chunk_id) {
+    auto values = pmr_vector<int32_t>(Chunk::DEFAULT_SIZE);
+    const auto mvcc_data = std::make_shared<MvccData>(Chunk::DEFAULT_SIZE, CommitID{0});
+    auto invalid_row_count = ChunkOffset{0};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < Chunk::DEFAULT_SIZE; ++chunk_offset) {
+      values[chunk_offset] = static_cast<int32_t>(chunk_offset);
+      if (distribution(random_engine) < updated_percentage) {
+        mvcc_data->set_end_cid(chunk_offset, CommitID{1});
+        ++invalid_row_count;
+      }
+    }
+
+    table->append_chunk(Segments{std::make_shared<ValueSegment<int32_t>>(std::move(values))}, mvcc_data);
+    const auto chunk = table->last_chunk();
+    chunk->increase_invalid_row_count(invalid_row_count);
+    chunk->finalize();
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+  return table_wrapper;
+}
+
+void validate_table(benchmark::State& state, const CommitID snapshot_commit_id) {
+  const auto table_wrapper = create_table_wrapper(state.range(0));
+  const auto transaction_context =
+      std::make_shared<TransactionContext>(TransactionID{1}, snapshot_commit_id, AutoCommit::No);
+
+  for (auto _ : state) {
+    const auto validate = std::make_shared<Validate>(table_wrapper);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+  }
+
+  state.SetItemsProcessed(state.iterations() * CHUNK_COUNT * Chunk::DEFAULT_SIZE);
+}
+
+}  // namespace
+
+namespace opossum {
+
+/**
+ * Measures Validate on data chunks in which the given percentage of rows has been updated. The transaction's snapshot
+ * includes the updates, so that chunks with updated rows have to be checked row by row (or rather, block by block).
+ */
+static void BM_ValidateUpdatedRows(benchmark::State& state) {  // NOLINT
+  validate_table(state, CommitID{1});
+}
+BENCHMARK(BM_ValidateUpdatedRows)->Arg(0)->Arg(1)->Arg(30);
+
+/**
+ * Same as above, but the transaction's snapshot was taken before the updates. All rows are visible, which the chunks'
+ * lowest end_cids tell without looking at the individual rows.
+ */
+static void BM_ValidateRowsUpdatedAfterSnapshot(benchmark::State& state) {  // NOLINT
+  validate_table(state, CommitID{0});
+}
+BENCHMARK(BM_ValidateRowsUpdatedAfterSnapshot)->Arg(0)->Arg(1)->Arg(30);
+
+}  // namespace opossum
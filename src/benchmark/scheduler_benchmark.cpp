@@ -0,0 +1,49 @@
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "hyrise.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+
+namespace opossum {
+
+/**
+ * Measures the scheduling overhead of many short tasks. Each client task mimics a query that spawns a number of small
+ * jobs (e.g., one per chunk) and waits for them. As the client tasks run on workers, stealable jobs are pushed to the
+ * worker's work-stealing deque, while non-stealable jobs go through the node's TaskQueue. Comparing both variants for
+ * increasing numbers of concurrent clients shows the cost of the contended TaskQueue.
+ */
+template <bool stealable>
+void BM_Scheduler_ShortTasks(benchmark::State& state) {  // NOLINT
+  const auto client_count = static_cast<size_t>(state.range(0));
+  constexpr auto JOBS_PER_CLIENT = size_t{256};
+
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  for (auto _ : state) {
+    auto clients = std::vector<std::shared_ptr<AbstractTask>>{};
+    clients.reserve(client_count);
+    for (auto client_id = size_t{0}; client_id < client_count; ++client_id) {
+      clients.emplace_back(std::make_shared<JobTask>([]() {
+        auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+        jobs.reserve(JOBS_PER_CLIENT);
+        for (auto job_id = size_t{0}; job_id < JOBS_PER_CLIENT; ++job_id) {
+          jobs.emplace_back(std::make_shared<JobTask>([job_id]() { benchmark::DoNotOptimize(job_id); },
+                                                      SchedulePriority::Default, stealable));
+        }
+        Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(clients);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * client_count * JOBS_PER_CLIENT));
+
+  Hyrise::reset();
+}
+
+BENCHMARK_TEMPLATE(BM_Scheduler_ShortTasks, true)->RangeMultiplier(4)->Range(1, 256)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Scheduler_ShortTasks, false)->RangeMultiplier(4)->Range(1, 256)->UseRealTime();
+
+}  // namespace opossum
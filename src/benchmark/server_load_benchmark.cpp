@@ -0,0 +1,326 @@
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <boost/endian/conversion.hpp>
+#include <cxxopts.hpp>
+
+#include "hyrise.hpp"
+#include "server/server.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+/**
+ * Load generator for the Hyrise server. It opens a large number of concurrent connections and sends the same query
+ * over each of them in a closed loop, i.e., a connection sends its next query as soon as it has received the result of
+ * the previous one. The throughput in queries per second as well as the latency distribution are reported.
+ *
+ * By default, a server with a single generated table ("load_table", column "a" with the values 0..n-1) is started
+ * in-process. Pass --port to benchmark an externally started hyriseServer instead.
+ *
+ * The client implements the minimal subset of the PostgreSQL protocol (startup and simple queries) using
+ * asynchronous I/O, so that thousands of connections can be served by a handful of client threads. Using libpqxx
+ * would require one thread per connection, which would dominate the measurement.
+ */
+
+using namespace opossum;  // NOLINT
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct LoadStatistics {
+  std::atomic_uint64_t query_count{0};
+  std::atomic_uint64_t error_count{0};
+};
+
+class LoadConnection : public std::enable_shared_from_this<LoadConnection> {
+ public:
+  LoadConnection(boost::asio::io_service& io_service, const std::string& query, const std::atomic_bool& measuring,
+                 const std::atomic_bool& stop, LoadStatistics& statistics)
+      : _socket(io_service), _measuring(measuring), _stop(stop), _statistics(statistics) {
+    // Simple query message: type, length (including itself), null-terminated query string
+    _query_message.push_back('Q');
+    _append_uint32(_query_message, static_cast<uint32_t>(sizeof(uint32_t) + query.size() + 1));
+    _query_message.append(query);
+    _query_message.push_back('\0');
+  }
+
+  void connect(const boost::asio::ip::tcp::endpoint& endpoint, const std::function<void()>& on_ready) {
+    _on_ready = on_ready;
+    _socket.async_connect(endpoint, [connection = shared_from_this()](const boost::system::error_code& error) {
+      Assert(!error, "Could not connect to server: " + error.message());
+      connection->_socket.set_option(boost::asio::ip::tcp::no_delay(true));
+      connection->_send_startup_message();
+    });
+  }
+
+  // Sends queries until stop is set.
+  void start() { _send_query(); }
+
+  void terminate() {
+    // Terminate message, so that the server closes the session. Blocking is fine as the load has ended already.
+    auto message = std::string{'X'};
+    _append_uint32(message, sizeof(uint32_t));
+    auto error = boost::system::error_code{};
+    boost::asio::write(_socket, boost::asio::buffer(message), error);
+    _socket.close(error);
+  }
+
+  const std::vector<uint32_t>& latencies_us() const { return _latencies_us; }
+
+ private:
+  static void _append_uint32(std::string& message, const uint32_t value) {
+    const auto network_value = boost::endian::native_to_big(value);
+    message.append(reinterpret_cast<const char*>(&network_value), sizeof(network_value));
+  }
+
+  void _send_startup_message() {
+    constexpr auto PROTOCOL_VERSION_3 = uint32_t{196608};
+    const auto parameters = std::string{"user\0hyrise\0database\0hyrise\0\0", 30};
+
+    _startup_message.clear();
+    _append_uint32(_startup_message, static_cast<uint32_t>(2 * sizeof(uint32_t) + parameters.size()));
+    _append_uint32(_startup_message, PROTOCOL_VERSION_3);
+    _startup_message.append(parameters);
+
+    _write(_startup_message, [](LoadConnection& connection) {
+      connection._read_until_ready_for_query([](LoadConnection& ready_connection) { ready_connection._on_ready(); });
+    });
+  }
+
+  void _send_query() {
+    if (_stop) return;
+
+    _query_start = Clock::now();
+    _write(_query_message, [](LoadConnection& connection) {
+      connection._read_until_ready_for_query([](LoadConnection& ready_connection) {
+        if (ready_connection._measuring) {
+          const auto latency = Clock::now() - ready_connection._query_start;
+          ready_connection._latencies_us.emplace_back(
+              static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(latency).count()));
+          ++ready_connection._statistics.query_count;
+        }
+        ready_connection._send_query();
+      });
+    });
+  }
+
+  // @param message must stay alive until the write has finished.
+  template <typename Continuation>
+  void _write(const std::string& message, const Continuation& continuation) {
+    boost::asio::async_write(_socket, boost::asio::buffer(message),
+                             [connection = shared_from_this(), continuation](const boost::system::error_code& error,
+                                                                             size_t /* bytes_transferred */) {
+                               Assert(!error, "Could not send message: " + error.message());
+                               continuation(*connection);
+                             });
+  }
+
+  // Reads and discards the messages of the server until it sends ReadyForQuery.
+  template <typename Continuation>
+  void _read_until_ready_for_query(const Continuation& continuation) {
+    // Message header: type and length (including the length field itself)
+    boost::asio::async_read(
+        _socket, boost::asio::buffer(_header),
+        [connection = shared_from_this(), continuation](const boost::system::error_code& error,
+                                                        size_t /* bytes_transferred */) {
+          Assert(!error, "Could not read message: " + error.message());
+          const auto message_type = connection->_header[0];
+          auto length = uint32_t{0};
+          std::copy_n(&connection->_header[1], sizeof(length), reinterpret_cast<char*>(&length));
+          length = boost::endian::big_to_native(length);
+
+          connection->_body.resize(length - sizeof(length));
+          boost::asio::async_read(connection->_socket, boost::asio::buffer(connection->_body),
+                                  [connection, continuation, message_type](const boost::system::error_code& body_error,
+                                                                           size_t /* bytes_transferred */) {
+                                    Assert(!body_error, "Could not read message: " + body_error.message());
+                                    if (message_type == 'E' && connection->_measuring) {
+                                      ++connection->_statistics.error_count;
+                                    }
+                                    if (message_type == 'Z') {
+                                      continuation(*connection);
+                                    } else {
+                                      connection->_read_until_ready_for_query(continuation);
+                                    }
+                                  });
+        });
+  }
+
+  boost::asio::ip::tcp::socket _socket;
+  const std::atomic_bool& _measuring;
+  const std::atomic_bool& _stop;
+  LoadStatistics& _statistics;
+  std::function<void()> _on_ready;
+
+  std::string _startup_message;
+  std::string _query_message;
+  std::array<char, 5> _header{};
+  std::vector<char> _body;
+
+  Clock::time_point _query_start;
+  std::vector<uint32_t> _latencies_us;
+};
+
+// Each connection requires a file descriptor on both the client and the (in-process) server side.
+void raise_file_descriptor_limit() {
+  auto limit = rlimit{};
+  if (getrlimit(RLIMIT_NOFILE, &limit) != 0) return;
+  limit.rlim_cur = limit.rlim_max;
+  setrlimit(RLIMIT_NOFILE, &limit);
+}
+
+void generate_table(const size_t row_count) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             Chunk::DEFAULT_SIZE, UseMvcc::Yes);
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    table->append({static_cast<int32_t>(row_id)});
+  }
+  Hyrise::get().storage_manager.add_table("load_table", table);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  cxxopts::Options cli_options("./hyriseBenchmarkServerLoad",
+                               "Measures the throughput of the Hyrise server with many concurrent connections.");
+
+  // clang-format off
+  cli_options.add_options()
+    ("help", "Display this help and exit") // NOLINT
+    ("c,connections", "Number of concurrent client connections", cxxopts::value<size_t>()->default_value("1000")) // NOLINT
+    ("t,time", "Duration of the measurement in seconds", cxxopts::value<uint64_t>()->default_value("10")) // NOLINT
+    ("warmup", "Duration before the measurement starts in seconds", cxxopts::value<uint64_t>()->default_value("1")) // NOLINT
+    ("q,query", "Query sent by all connections", cxxopts::value<std::string>()->default_value("SELECT COUNT(*) FROM load_table WHERE a < 1000;")) // NOLINT
+    ("client_threads", "Number of threads that drive the client connections", cxxopts::value<uint32_t>()->default_value("4")) // NOLINT
+    ("address", "Address of the server", cxxopts::value<std::string>()->default_value("127.0.0.1")) // NOLINT
+    ("p,port", "Port of an already running server. If not specified, a server is started in-process", cxxopts::value<uint16_t>()) // NOLINT
+    ("rows", "Number of rows of load_table (in-process server only)", cxxopts::value<size_t>()->default_value("100000")) // NOLINT
+    ("network_threads", "Number of network threads (in-process server only)", cxxopts::value<uint32_t>()->default_value("4")) // NOLINT
+    ("max_concurrent_requests", "Maximum number of concurrently processed requests, defaults to the number of hardware threads, 0 means unlimited (in-process server only)", cxxopts::value<size_t>()->default_value(std::to_string(Server::default_max_concurrent_requests()))) // NOLINT
+    ;  // NOLINT
+  // clang-format on
+
+  const auto parsed_options = cli_options.parse(argc, argv);
+  if (parsed_options.count("help")) {
+    std::cout << cli_options.help() << std::endl;
+    return 0;
+  }
+
+  const auto connection_count = parsed_options["connections"].as<size_t>();
+  const auto client_thread_count = parsed_options["client_threads"].as<uint32_t>();
+  Assert(connection_count > 0 && client_thread_count > 0, "At least one connection and client thread are required");
+
+  raise_file_descriptor_limit();
+
+  // Start the in-process server
+  auto server = std::unique_ptr<Server>{};
+  auto server_thread = std::thread{};
+  auto port = uint16_t{0};
+  if (parsed_options.count("port")) {
+    port = parsed_options["port"].as<uint16_t>();
+  } else {
+    generate_table(parsed_options["rows"].as<size_t>());
+
+    const auto max_concurrent_requests_option = parsed_options["max_concurrent_requests"].as<size_t>();
+    const auto max_concurrent_requests =
+        max_concurrent_requests_option > 0 ? std::optional<size_t>{max_concurrent_requests_option} : std::nullopt;
+    server = std::make_unique<Server>(boost::asio::ip::make_address("127.0.0.1"), 0, SendExecutionInfo::No,
+                                      parsed_options["network_threads"].as<uint32_t>(), max_concurrent_requests);
+    port = server->server_port();
+    server_thread = std::thread{[&]() { server->run(); }};
+    while (!server->is_initialized()) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+
+  // Open all connections before the load starts
+  auto io_service = boost::asio::io_service{};
+  auto work_guard = boost::asio::make_work_guard(io_service);
+  auto client_threads = std::vector<std::thread>{};
+  for (auto thread_id = uint32_t{0}; thread_id < client_thread_count; ++thread_id) {
+    client_threads.emplace_back([&]() { io_service.run(); });
+  }
+
+  const auto endpoint = boost::asio::ip::tcp::endpoint{
+      boost::asio::ip::make_address(parsed_options["address"].as<std::string>()), port};
+  const auto query = parsed_options["query"].as<std::string>();
+  auto measuring = std::atomic_bool{false};
+  auto stop = std::atomic_bool{false};
+  auto statistics = LoadStatistics{};
+  auto ready_connection_count = std::atomic_size_t{0};
+
+  auto connections = std::vector<std::shared_ptr<LoadConnection>>{};
+  connections.reserve(connection_count);
+  for (auto connection_id = size_t{0}; connection_id < connection_count; ++connection_id) {
+    connections.emplace_back(std::make_shared<LoadConnection>(io_service, query, measuring, stop, statistics));
+    connections.back()->connect(endpoint, [&]() { ++ready_connection_count; });
+  }
+  while (ready_connection_count < connection_count) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  std::cout << "- " << connection_count << " connections established" << std::endl;
+
+  // Closed-loop load: the measurement starts after the warmup
+  for (const auto& connection : connections) {
+    boost::asio::post(io_service, [connection]() { connection->start(); });
+  }
+  std::this_thread::sleep_for(std::chrono::seconds(parsed_options["warmup"].as<uint64_t>()));
+
+  measuring = true;
+  const auto measurement_begin = Clock::now();
+  std::this_thread::sleep_for(std::chrono::seconds(parsed_options["time"].as<uint64_t>()));
+  measuring = false;
+  const auto measurement_duration = std::chrono::duration<double>(Clock::now() - measurement_begin).count();
+
+  // Let the connections finish their running queries before terminating them
+  stop = true;
+  work_guard.reset();
+  for (auto& client_thread : client_threads) {
+    client_thread.join();
+  }
+  for (const auto& connection : connections) {
+    connection->terminate();
+  }
+
+  auto latencies_us = std::vector<uint32_t>{};
+  for (const auto& connection : connections) {
+    latencies_us.insert(latencies_us.end(), connection->latencies_us().begin(), connection->latencies_us().end());
+  }
+  connections.clear();
+
+  if (server) {
+    server->shutdown();
+    server_thread.join();
+  }
+
+  const auto query_count = statistics.query_count.load();
+  std::cout << "- Queries: " << query_count << " (" << statistics.error_count.load() << " errors)" << std::endl;
+  std::cout << "- Throughput: " << static_cast<double>(query_count) / measurement_duration << " queries/s"
+            << std::endl;
+
+  if (!latencies_us.empty()) {
+    std::sort(latencies_us.begin(), latencies_us.end());
+    const auto percentile = [&](const double fraction) {
+      return latencies_us[static_cast<size_t>(fraction * static_cast<double>(latencies_us.size() - 1))];
+    };
+    const auto mean = std::accumulate(latencies_us.begin(), latencies_us.end(), uint64_t{0}) / latencies_us.size();
+    std::cout << "- Latency [us]: mean " << mean << ", p50 " << percentile(0.5) << ", p99 " << percentile(0.99)
+              << ", max " << latencies_us.back() << std::endl;
+  }
+
+  return 0;
+}
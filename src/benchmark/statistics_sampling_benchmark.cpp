@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+#include "tpch/tpch_constants.hpp"
+#include "tpch/tpch_table_generator.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// lineitem with 10'000 rows per chunk (i.e., 60 chunks), so that chunks can be sampled at a fine granularity.
+std::shared_ptr<Table> lineitem_table() {
+  static auto table = std::shared_ptr<Table>{};
+  if (!table) {
+    table = TPCHTableGenerator(0.1f, ClusteringConfiguration::None, ChunkOffset{10'000}).generate().at("lineitem").table;
+  }
+  return table;
+}
+
+std::shared_ptr<TableStatistics> full_lineitem_statistics() {
+  static const auto table_statistics = TableStatistics::from_table(*lineitem_table());
+  return table_statistics;
+}
+
+double q_error(const Cardinality estimate, const Cardinality actual) {
+  const auto clamped_estimate = std::max(double{estimate}, 1.0);
+  const auto clamped_actual = std::max(double{actual}, 1.0);
+  return std::max(clamped_estimate / clamped_actual, clamped_actual / clamped_estimate);
+}
+
+/**
+ * Compares the histograms of @param table_statistics to those of the full statistics. Returns the mean q-error of
+ * (1) the distinct counts of the columns and (2) the estimated cardinalities of `column <= value`, where the values
+ * are the bin maxima of the full histograms. The latter are estimated exactly by the full histograms.
+ */
+std::pair<double, double> mean_q_errors(const TableStatistics& table_statistics) {
+  const auto& full_statistics = *full_lineitem_statistics();
+
+  auto distinct_count_q_error_sum = 0.0;
+  auto cardinality_q_error_sum = 0.0;
+  auto cardinality_estimation_count = size_t{0};
+
+  const auto column_count = full_statistics.column_statistics.size();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(full_statistics.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto& full_histogram =
+          std::dynamic_pointer_cast<AttributeStatistics<ColumnDataType>>(full_statistics.column_statistics[column_id])
+              ->histogram;
+      const auto& histogram =
+          std::dynamic_pointer_cast<AttributeStatistics<ColumnDataType>>(table_statistics.column_statistics[column_id])
+              ->histogram;
+
+      distinct_count_q_error_sum += q_error(histogram->total_distinct_count(), full_histogram->total_distinct_count());
+
+      for (auto bin_id = BinID{0}; bin_id < full_histogram->bin_count(); ++bin_id) {
+        const auto value = AllTypeVariant{full_histogram->bin_maximum(bin_id)};
+        cardinality_q_error_sum +=
+            q_error(histogram->estimate_cardinality(PredicateCondition::LessThanEquals, value),
+                    full_histogram->estimate_cardinality(PredicateCondition::LessThanEquals, value));
+        ++cardinality_estimation_count;
+      }
+    });
+  }
+
+  return {distinct_count_q_error_sum / static_cast<double>(column_count),
+          cardinality_q_error_sum / static_cast<double>(cardinality_estimation_count)};
+}
+
+}  // namespace
+
+namespace opossum {
+
+/**
+ * Measures the time to build the statistics of lineitem (SF 0.1, unencoded) from a sample of the given percentage of
+ * chunks and reports the resulting estimation errors as counters. 100% builds the statistics from all values.
+ */
+static void BM_StatisticsSampling(benchmark::State& state) {  // NOLINT
+  const auto table = lineitem_table();
+
+  auto sampling_config = std::optional<StatisticsSamplingConfig>{};
+  if (state.range(0) < 100) {
+    sampling_config.emplace();
+    sampling_config->min_row_count = 0;
+    sampling_config->chunk_sample_ratio = static_cast<float>(state.range(0)) / 100.0f;
+  }
+
+  auto table_statistics = std::shared_ptr<TableStatistics>{};
+  for (auto _ : state) {
+    table_statistics = TableStatistics::from_table(*table, sampling_config);
+  }
+
+  const auto [distinct_count_q_error, cardinality_q_error] = mean_q_errors(*table_statistics);
+  state.counters["distinct_count_q_error"] = distinct_count_q_error;
+  state.counters["cardinality_q_error"] = cardinality_q_error;
+}
+BENCHMARK(BM_StatisticsSampling)->Arg(100)->Arg(50)->Arg(20)->Arg(10)->Arg(5)->Unit(benchmark::kMillisecond);
+
+}  // namespace opossum
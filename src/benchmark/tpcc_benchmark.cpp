@@ -1,9 +1,11 @@
 #include "tpcc/tpcc_table_generator.hpp"
 
 #include <algorithm>
+#include <filesystem>
 
 #include "benchmark_runner.hpp"
 #include "cli_config_parser.hpp"
+#include "hyrise.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "tpcc/constants.hpp"
 #include "tpcc/tpcc_benchmark_item_runner.hpp"
@@ -19,7 +21,7 @@ using namespace opossum;  // NOLINT
  * Other limitations (that may be removed in the future):
  *  - No primary / foreign keys are used as they are currently unsupported
  *  - Values that are "retrieved" by the terminal are just selected, but not necessarily materialized
- *  - Data is not persisted as logging is currently unsupported; this means that the durability tests are not executed
+ *  - Logging is disabled by default (see --redo_log); the durability tests are not executed
  *  - As decimals are not supported, we use floats instead
  *  - The delivery transaction is not executed in a "deferred" mode; as such, no delivery result file is written
  *  - We do not execute the isolation tests, as we consider our MVCC tests to be sufficient
@@ -41,12 +43,16 @@ int main(int argc, char* argv[]) {
   cli_options.add_options()
     // We use -s instead of -w for consistency with the options of our other TPC-x binaries.
     ("s,scale", "Scale factor (warehouses)", cxxopts::value<size_t>()->default_value("1")) // NOLINT
-    ("consistency_checks", "Run TPC-C consistency checks after benchmark (included with --verify)", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("consistency_checks", "Run TPC-C consistency checks after benchmark (included with --verify)", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("redo_log", "Write committed transactions to a redo log at the given path (an existing file is overwritten)", cxxopts::value<std::string>()->default_value("")) // NOLINT
+    ("garbage_collection", "Run the garbage collector in the background to compact chunks with many invalidated rows", cxxopts::value<bool>()->default_value("false")); // NOLINT
   // clang-format on
 
   std::shared_ptr<BenchmarkConfig> config;
   size_t num_warehouses;
   bool consistency_checks;
+  std::string redo_log_path;
+  bool garbage_collection;
 
   // Parse command line args
   const auto cli_parse_result = cli_options.parse(argc, argv);
@@ -55,6 +61,8 @@ int main(int argc, char* argv[]) {
 
   num_warehouses = cli_parse_result["scale"].as<size_t>();
   consistency_checks = cli_parse_result["consistency_checks"].as<bool>();
+  redo_log_path = cli_parse_result["redo_log"].as<std::string>();
+  garbage_collection = cli_parse_result["garbage_collection"].as<bool>();
 
   config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_cli_options(cli_parse_result));
 
@@ -66,8 +74,25 @@ int main(int argc, char* argv[]) {
 
   std::cout << "- TPC-C scale factor (number of warehouses) is " << num_warehouses << std::endl;
 
+  if (!redo_log_path.empty()) {
+    std::cout << "- Writing redo log to " << redo_log_path << std::endl;
+    std::filesystem::remove(redo_log_path);
+    Hyrise::get().redo_log.enable(redo_log_path);
+  } else {
+    std::cout << "- Redo logging is disabled" << std::endl;
+  }
+
+  if (garbage_collection) {
+    std::cout << "- Running the garbage collector in the background" << std::endl;
+    Hyrise::get().garbage_collector.start();
+  } else {
+    std::cout << "- Garbage collection is disabled" << std::endl;
+  }
+
   // Add TPC-C-specific information
   context.emplace("scale_factor", num_warehouses);
+  context.emplace("redo_log", !redo_log_path.empty());
+  context.emplace("garbage_collection", garbage_collection);
 
   // Run the benchmark
   auto item_runner = std::make_unique<TPCCBenchmarkItemRunner>(config, num_warehouses);
@@ -75,6 +100,27 @@ int main(int argc, char* argv[]) {
                   context)
       .run();
 
+  if (!redo_log_path.empty()) {
+    auto& redo_log = Hyrise::get().redo_log;
+    redo_log.flush();
+    const auto record_count = redo_log.record_count();
+    const auto sync_count = redo_log.sync_count();
+    std::cout << "- Redo log contains " << record_count << " commits written with " << sync_count << " syncs ("
+              << (sync_count > 0 ? static_cast<double>(record_count) / static_cast<double>(sync_count) : 0.0)
+              << " commits per sync)" << std::endl;
+    redo_log.disable();
+  }
+
+  if (garbage_collection) {
+    auto& garbage_collector = Hyrise::get().garbage_collector;
+    garbage_collector.stop();
+    for (const auto& [table_name, statistics] : garbage_collector.statistics()) {
+      std::cout << "- Garbage collector compacted " << statistics.compacted_chunk_count << " chunks of " << table_name
+                << " (" << statistics.moved_row_count << " rows moved) and reclaimed "
+                << statistics.reclaimed_chunk_count << " chunks" << std::endl;
+    }
+  }
+
   if (consistency_checks || config->verify) {
     std::cout << "- Running consistency checks at the end of the benchmark" << std::endl;
     check_consistency(num_warehouses);
@@ -361,12 +361,15 @@ std::unordered_map<std::string, BenchmarkTableInfo> AbstractTableGenerator::_loa
   std::unordered_map<std::string, BenchmarkTableInfo> table_info_by_name;
 
   for (const auto& table_file : list_directory(cache_directory)) {
+    // Skip leftovers of interrupted writes, see BinaryWriter::write.
+    if (table_file.extension() != ".bin") continue;
+
     const auto table_name = table_file.stem();
     std::cout << "-  Loading table '" << table_name.string() << "' from cached binary " << table_file.relative_path();
 
     Timer timer;
     BenchmarkTableInfo table_info;
-    table_info.table = BinaryParser::parse(table_file);
+    table_info.table = BinaryParser::parse(table_file, BinaryParserMode::MemoryMapped);
     table_info.loaded_from_binary = true;
     table_info.binary_file_path = table_file;
     table_info_by_name[table_name] = table_info;
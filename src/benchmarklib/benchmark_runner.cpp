@@ -392,7 +392,8 @@ void BenchmarkRunner::write_report_to_file() const {
                                {"optimizer_rule_durations", rule_metrics_json},
                                {"lqp_translation_duration", sql_statement_metrics->lqp_translation_duration.count()},
                                {"plan_execution_duration", sql_statement_metrics->plan_execution_duration.count()},
-                               {"query_plan_cache_hit", sql_statement_metrics->query_plan_cache_hit}};
+                               {"query_plan_cache_hit", sql_statement_metrics->query_plan_cache_hit},
+                               {"result_cache_hit", sql_statement_metrics->result_cache_hit}};
 
             pipeline_metrics_json["statements"].push_back(sql_statement_metrics_json);
           }
@@ -55,11 +55,9 @@ bool is_chunk_encoding_spec_satisfied(const ChunkEncodingSpec& expected_chunk_en
 
 namespace opossum {
 
-bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::shared_ptr<Table>& table,
-                                   const EncodingConfig& encoding_config) {
-  /**
-   * 1. Build the ChunkEncodingSpec, i.e. the Encoding to be used
-   */
+ChunkEncodingSpec BenchmarkTableEncoder::create_chunk_encoding_spec(const std::string& table_name,
+                                                                    const std::shared_ptr<Table>& table,
+                                                                    const EncodingConfig& encoding_config) {
   const auto& type_mapping = encoding_config.type_encoding_mapping;
   const auto& custom_mapping = encoding_config.custom_encoding_mapping;
 
@@ -103,6 +101,16 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
     }
   }
 
+  return chunk_encoding_spec;
+}
+
+bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::shared_ptr<Table>& table,
+                                   const EncodingConfig& encoding_config) {
+  /**
+   * 1. Build the ChunkEncodingSpec, i.e. the Encoding to be used
+   */
+  const auto chunk_encoding_spec = create_chunk_encoding_spec(table_name, table, encoding_config);
+
   /**
    * 2. Actually encode chunks
    */
@@ -3,6 +3,8 @@
 #include <memory>
 #include <string>
 
+#include "storage/encoding_type.hpp"
+
 namespace opossum {
 
 class EncodingConfig;
@@ -10,6 +12,11 @@ class Table;
 
 class BenchmarkTableEncoder {
  public:
+  // @return      the ChunkEncodingSpec that @param encoding_config requests for the columns of @param table
+  static ChunkEncodingSpec create_chunk_encoding_spec(const std::string& table_name,
+                                                      const std::shared_ptr<Table>& table,
+                                                      const EncodingConfig& encoding_config);
+
   // @param out   stream for logging info
   // @return      true, if any encoding operation was performed.
   //              false, if the @param table was already encoded as required by @param encoding_config
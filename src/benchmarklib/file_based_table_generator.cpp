@@ -84,7 +84,7 @@ std::unordered_map<std::string, BenchmarkTableInfo> FileBasedTableGenerator::gen
     // Pick a source file to load a table from, prefer the binary version
     if (table_info.binary_file_path && !table_info.binary_file_out_of_date) {
       std::cout << "from " << *table_info.binary_file_path << std::flush;
-      table_info.table = BinaryParser::parse(*table_info.binary_file_path);
+      table_info.table = BinaryParser::parse(*table_info.binary_file_path, BinaryParserMode::MemoryMapped);
       table_info.loaded_from_binary = true;
     } else {
       std::cout << "from " << *table_info.text_file_path << std::flush;
@@ -92,7 +92,15 @@ std::unordered_map<std::string, BenchmarkTableInfo> FileBasedTableGenerator::gen
       if (extension == ".tbl") {
         table_info.table = load_table(*table_info.text_file_path, _benchmark_config->chunk_size);
       } else if (extension == ".csv") {
-        table_info.table = CsvParser::parse(*table_info.text_file_path, _benchmark_config->chunk_size);
+        // Encode the chunks while the remaining file is still being parsed. The encoding step of the
+        // AbstractTableGenerator then finds the table already encoded as requested.
+        const auto& csv_file_path = table_info.text_file_path->string();
+        const auto empty_table = CsvParser::create_table_from_meta_file(csv_file_path + CsvMeta::META_FILE_EXTENSION,
+                                                                        _benchmark_config->chunk_size);
+        const auto chunk_encoding_spec = BenchmarkTableEncoder::create_chunk_encoding_spec(
+            table_name, empty_table, _benchmark_config->encoding_config);
+        table_info.table =
+            CsvParser::parse(csv_file_path, _benchmark_config->chunk_size, std::nullopt, chunk_encoding_spec);
       } else {
         Fail("Unknown textual file format. This should have been caught earlier.");
       }
@@ -587,6 +587,14 @@ void TPCCTableGenerator::_add_constraints(
   stock_table->add_soft_key_constraint(
       {{stock_table->column_id_by_name("S_W_ID"), stock_table->column_id_by_name("S_I_ID")},
        KeyConstraintType::PRIMARY_KEY});
+
+  // The transactions mostly access single rows by their primary keys. Key indexes turn these accesses into lookups and
+  // enforce the primary keys on insert.
+  for (const auto& [table_name, table_info] : table_info_by_name) {
+    for (const auto& key_constraint : table_info.table->soft_key_constraints()) {
+      table_info.table->create_key_index(key_constraint);
+    }
+  }
 }
 
 thread_local TPCCRandomGenerator TPCCTableGenerator::_random_gen;  // NOLINT
@@ -5,7 +5,9 @@
 
 #include "benchmark_config.hpp"
 #include "cli_config_parser.hpp"
+#include "hyrise.hpp"
 #include "server/server.hpp"
+#include "statistics/statistics_refresher.hpp"
 #include "tpcc/tpcc_table_generator.hpp"
 #include "tpcds/tpcds_table_generator.hpp"
 #include "tpch/tpch_constants.hpp"
@@ -63,6 +65,10 @@ cxxopts::Options get_server_cli_options() {
                        "TPC-DS, and TPC-H. The sizing factor determines the scale factor in TPC-DS and TPC-H, and the "
                        "warehouse count in TPC-C.", cxxopts::value<std::string>()) // NOLINT
     ("execution_info", "Send execution information after statement execution", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("network_threads", "Number of threads that accept connections and wait for client messages", cxxopts::value<uint32_t>()->default_value("1")) // NOLINT
+    ("max_concurrent_requests", "Maximum number of client messages (e.g., queries) that are processed concurrently. Further messages are queued. Defaults to the number of hardware threads, 0 means unlimited", cxxopts::value<size_t>()->default_value(std::to_string(opossum::Server::default_max_concurrent_requests()))) // NOLINT
+    ("garbage_collection", "Run the garbage collector in the background to compact chunks with many invalidated rows", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("statistics_refresh_interval", "Interval in milliseconds in which the rows committed by inserts are merged into the table statistics, 0 disables the refreshes", cxxopts::value<uint32_t>()->default_value("1000")) // NOLINT
     ;  // NOLINT
   // clang-format on
 
@@ -93,13 +99,28 @@ int main(int argc, char* argv[]) {
 
   const auto execution_info = parsed_options["execution_info"].as<bool>();
   const auto port = parsed_options["port"].as<uint16_t>();
+  const auto network_thread_count = parsed_options["network_threads"].as<uint32_t>();
+  const auto max_concurrent_requests_option = parsed_options["max_concurrent_requests"].as<size_t>();
+  const auto max_concurrent_requests =
+      max_concurrent_requests_option > 0 ? std::optional<size_t>{max_concurrent_requests_option} : std::nullopt;
 
   boost::system::error_code error;
   const auto address = boost::asio::ip::make_address(parsed_options["address"].as<std::string>(), error);
 
   Assert(!error, "Not a valid IPv4 address: " + parsed_options["address"].as<std::string>() + ", terminating...");
 
-  auto server = opossum::Server{address, port, static_cast<opossum::SendExecutionInfo>(execution_info)};
+  if (parsed_options["garbage_collection"].as<bool>()) {
+    opossum::Hyrise::get().garbage_collector.start();
+  }
+
+  auto statistics_refresher = opossum::StatisticsRefresher{};
+  const auto statistics_refresh_interval = parsed_options["statistics_refresh_interval"].as<uint32_t>();
+  if (statistics_refresh_interval > 0) {
+    statistics_refresher.start_background(std::chrono::milliseconds{statistics_refresh_interval});
+  }
+
+  auto server = opossum::Server{address, port, static_cast<opossum::SendExecutionInfo>(execution_info),
+                                network_thread_count, max_concurrent_requests};
   server.run();
 
   return 0;
@@ -0,0 +1,209 @@
+#include "result_cache.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "expression/abstract_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns false for nodes that modify data or whose output is not determined by the LQP and the table versions.
+bool is_cacheable_node_type(const LQPNodeType type) {
+  switch (type) {
+    case LQPNodeType::Aggregate:
+    case LQPNodeType::Alias:
+    case LQPNodeType::DummyTable:
+    case LQPNodeType::Except:
+    case LQPNodeType::Intersect:
+    case LQPNodeType::Join:
+    case LQPNodeType::Limit:
+    case LQPNodeType::Predicate:
+    case LQPNodeType::Projection:
+    case LQPNodeType::Root:
+    case LQPNodeType::Sort:
+    case LQPNodeType::StoredTable:
+    case LQPNodeType::Union:
+    case LQPNodeType::Validate:
+    case LQPNodeType::Window:
+      return true;
+
+    // StaticTableNodes (used, e.g., for meta tables) are compared by their column definitions only, not by their data.
+    case LQPNodeType::StaticTable:
+    case LQPNodeType::Mock:
+    case LQPNodeType::ChangeMetaTable:
+    case LQPNodeType::CreateTable:
+    case LQPNodeType::CreatePreparedPlan:
+    case LQPNodeType::CreateView:
+    case LQPNodeType::Delete:
+    case LQPNodeType::DropView:
+    case LQPNodeType::DropTable:
+    case LQPNodeType::Export:
+    case LQPNodeType::Import:
+    case LQPNodeType::Insert:
+    case LQPNodeType::Update:
+      return false;
+  }
+  Fail("Invalid enum value");
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool ResultCache::Key::operator==(const Key& other) const {
+  if (hash != other.hash || table_versions.size() != other.table_versions.size()) return false;
+
+  const auto table_version_count = table_versions.size();
+  for (auto table_version_idx = size_t{0}; table_version_idx < table_version_count; ++table_version_idx) {
+    const auto& table_version = table_versions[table_version_idx];
+    const auto& other_table_version = other.table_versions[table_version_idx];
+    if (table_version.last_modification_commit_id != other_table_version.last_modification_commit_id) return false;
+
+    // Compare the identity of the tables even if they no longer exist.
+    if (table_version.table.owner_before(other_table_version.table) ||
+        other_table_version.table.owner_before(table_version.table)) {
+      return false;
+    }
+  }
+
+  return *lqp == *other.lqp;
+}
+
+ResultCache::ResultCache(const size_t capacity_bytes) : _capacity_bytes(capacity_bytes) {}
+
+std::optional<ResultCache::Key> ResultCache::create_key(const std::shared_ptr<const AbstractLQPNode>& lqp,
+                                                        const CommitID snapshot_commit_id) {
+  auto key = Key{lqp, {}, lqp->hash()};
+  auto cacheable = true;
+
+  // lqp_find_subplan_roots does not modify the LQP, but takes a non-const pointer.
+  for (const auto& subplan_root : lqp_find_subplan_roots(std::const_pointer_cast<AbstractLQPNode>(lqp))) {
+    visit_lqp(subplan_root, [&](const auto& node) {
+      if (!is_cacheable_node_type(node->type)) {
+        cacheable = false;
+        return LQPVisitation::DoNotVisitInputs;
+      }
+
+      for (const auto& expression : node->node_expressions) {
+        visit_expression(expression, [&](const auto& sub_expression) {
+          if (sub_expression->type == ExpressionType::Placeholder) cacheable = false;
+          return cacheable ? ExpressionVisitation::VisitArguments : ExpressionVisitation::DoNotVisitArguments;
+        });
+      }
+
+      if (node->type == LQPNodeType::StoredTable) {
+        const auto& table_name = static_cast<const StoredTableNode&>(*node).table_name;
+        const auto table = Hyrise::get().storage_manager.get_table(table_name);
+        const auto last_modification_commit_id = table->last_modification_commit_id();
+
+        // The snapshot does not see all modifications of the table yet, so the result does not match the table version.
+        if (last_modification_commit_id > snapshot_commit_id) cacheable = false;
+
+        key.table_versions.emplace_back(TableVersion{table, last_modification_commit_id});
+        boost::hash_combine(key.hash, last_modification_commit_id);
+      }
+
+      return cacheable ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+    });
+
+    if (!cacheable) return std::nullopt;
+  }
+
+  return key;
+}
+
+std::shared_ptr<const Table> ResultCache::try_get(const Key& key) {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  const auto iter = _map.find(key);
+  if (iter == _map.end()) {
+    ++_miss_count;
+    return nullptr;
+  }
+
+  ++_hit_count;
+  const auto handle = iter->second;
+  auto& entry = *handle;
+  ++entry.frequency;
+  entry.priority = _priority(entry);
+  _queue.update(handle);
+  return entry.result_table;
+}
+
+void ResultCache::set(const Key& key, const std::shared_ptr<const Table>& result_table) {
+  const auto size_bytes = result_table->memory_usage(MemoryUsageCalculationMode::Sampled);
+
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  if (size_bytes > _capacity_bytes || _map.contains(key)) return;
+
+  while (_size_bytes + size_bytes > _capacity_bytes) {
+    _evict();
+  }
+
+  auto entry = Entry{key, result_table, 1, size_bytes, 0.0};
+  entry.priority = _priority(entry);
+  _map.emplace(key, _queue.push(entry));
+  _size_bytes += size_bytes;
+}
+
+void ResultCache::clear() {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  _map.clear();
+  _queue.clear();
+  _size_bytes = 0;
+}
+
+void ResultCache::resize(const size_t capacity_bytes) {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  while (_size_bytes > capacity_bytes) {
+    _evict();
+  }
+  _capacity_bytes = capacity_bytes;
+}
+
+size_t ResultCache::capacity() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _capacity_bytes;
+}
+
+size_t ResultCache::size() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _map.size();
+}
+
+size_t ResultCache::memory_usage() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _size_bytes;
+}
+
+size_t ResultCache::hit_count() const { return _hit_count.load(); }
+
+size_t ResultCache::miss_count() const { return _miss_count.load(); }
+
+double ResultCache::_priority(const Entry& entry) const {
+  // Avoid a division by zero for (theoretical) empty entries.
+  return _inflation + static_cast<double>(entry.frequency) / static_cast<double>(std::max(entry.size_bytes, size_t{1}));
+}
+
+void ResultCache::_evict() {
+  DebugAssert(!_queue.empty(), "Cannot evict from an empty cache");
+  const auto& top = _queue.top();
+
+  _inflation = top.priority;
+  _size_bytes -= top.size_bytes;
+  _map.erase(top.key);
+  _queue.pop();
+}
+
+}  // namespace opossum
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/heap/fibonacci_heap.hpp>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class Table;
+
+/**
+ * Caches the results of deterministic, read-only queries. An entry is identified by the optimized LQP of the query and
+ * the commit id of the last modification (see Table::last_modification_commit_id) of every stored table that the LQP
+ * reads. Once a transaction that inserted, updated, or deleted rows of one of these tables commits, the commit ids no
+ * longer match, so that the entry is not hit anymore and is eventually evicted.
+ *
+ * A result is only cached (and looked up) if all tables were last modified by transactions visible to the snapshot of
+ * the executing transaction. Thus, the cached result reflects exactly the modifications that the key states.
+ *
+ * As results vary widely in size, the capacity is given in bytes. Entries are evicted according to the GDFS policy
+ * (see GDFSCache), using the memory usage of the result table as the entry size.
+ */
+class ResultCache : public Noncopyable {
+ public:
+  struct TableVersion {
+    // The table itself is only used to tell apart different tables of the same name (e.g., after DROP and CREATE).
+    // Holding a weak_ptr does not keep the table alive.
+    std::weak_ptr<const Table> table;
+    CommitID last_modification_commit_id;
+  };
+
+  struct Key {
+    std::shared_ptr<const AbstractLQPNode> lqp;
+    std::vector<TableVersion> table_versions;
+    size_t hash;
+
+    bool operator==(const Key& other) const;
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const { return key.hash; }
+  };
+
+  static constexpr auto DEFAULT_CAPACITY_BYTES = size_t{256} * 1024 * 1024;
+
+  explicit ResultCache(const size_t capacity_bytes = DEFAULT_CAPACITY_BYTES);
+
+  // Returns the key for the result of @param lqp when executed with the snapshot @param snapshot_commit_id, or
+  // std::nullopt if the result must not be cached. This is the case if the LQP modifies data, reads data that is not
+  // covered by the table versions (e.g., meta tables), has unbound placeholders, or if a table was modified by a
+  // transaction that is not visible to the snapshot.
+  static std::optional<Key> create_key(const std::shared_ptr<const AbstractLQPNode>& lqp,
+                                       const CommitID snapshot_commit_id);
+
+  std::shared_ptr<const Table> try_get(const Key& key);
+
+  // Does not cache results that would exceed the entire capacity.
+  void set(const Key& key, const std::shared_ptr<const Table>& result_table);
+
+  void clear();
+  void resize(const size_t capacity_bytes);
+
+  size_t capacity() const;
+  size_t size() const;
+  size_t memory_usage() const;
+  size_t hit_count() const;
+  size_t miss_count() const;
+
+ protected:
+  friend class ResultCacheTest;
+
+  struct Entry {
+    Key key;
+    std::shared_ptr<const Table> result_table;
+    size_t frequency;
+    size_t size_bytes;
+    double priority;
+
+    // As in GDFSCache, the inverted comparison puts the entry with the lowest priority at the top of the max-heap.
+    bool operator<(const Entry& other) const { return priority > other.priority; }
+  };
+
+  using Handle = typename boost::heap::fibonacci_heap<Entry>::handle_type;
+
+  double _priority(const Entry& entry) const;
+  void _evict();
+
+  size_t _capacity_bytes;
+  size_t _size_bytes{0};
+
+  boost::heap::fibonacci_heap<Entry> _queue;
+  std::unordered_map<Key, Handle, KeyHash> _map;
+  mutable std::shared_mutex _mutex;
+
+  // Inflation value that will be updated whenever an item is evicted.
+  double _inflation{0.0};
+
+  std::atomic<size_t> _hit_count{0};
+  std::atomic<size_t> _miss_count{0};
+};
+
+}  // namespace opossum
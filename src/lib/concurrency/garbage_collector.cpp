@@ -0,0 +1,259 @@
+#include "garbage_collector.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/update.hpp"
+#include "operators/validate.hpp"
+#include "storage/base_value_segment.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+GarbageCollector::GarbageCollector() = default;
+
+GarbageCollector::~GarbageCollector() { stop(); }
+
+GarbageCollector& GarbageCollector::operator=(GarbageCollector&& garbage_collector) noexcept {
+  // The loop thread cannot be moved as it references its GarbageCollector instance. As Hyrise::reset() only assigns
+  // freshly constructed (and thus stopped) instances, stopping the current one and dropping its state is sufficient.
+  stop();
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _config = garbage_collector._config;
+  _statistics.clear();
+  _retired_chunks.clear();
+  return *this;
+}
+
+void GarbageCollector::start(const std::chrono::milliseconds interval) {
+  Assert(!is_running(), "GarbageCollector is already running");
+  _loop_thread = std::make_unique<PausableLoopThread>(interval, [&](size_t) { run(); });
+}
+
+void GarbageCollector::stop() {
+  // Destroying the PausableLoopThread waits for the current pass to finish.
+  _loop_thread.reset();
+}
+
+bool GarbageCollector::is_running() const { return _loop_thread != nullptr; }
+
+void GarbageCollector::run() {
+  const auto run_lock = std::lock_guard<std::mutex>{_run_mutex};
+
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    if (table->uses_mvcc() != UseMvcc::Yes || table->empty()) continue;
+
+    _compact_chunks(table_name, table);
+    _encode_completed_chunks(table_name, table);
+  }
+
+  _reclaim_retired_chunks();
+}
+
+void GarbageCollector::set_config(const GarbageCollectorConfig& config) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _config = config;
+}
+
+GarbageCollectorConfig GarbageCollector::config() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _config;
+}
+
+std::map<std::string, GarbageCollectionStatistics> GarbageCollector::statistics() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _statistics;
+}
+
+size_t GarbageCollector::retired_chunk_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _retired_chunks.size();
+}
+
+void GarbageCollector::_compact_chunks(const std::string& table_name, const std::shared_ptr<Table>& table) {
+  const auto config = this->config();
+  const auto last_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+
+  // The last chunk is skipped, as it is usually the one that Inserts append to.
+  const auto chunk_count = table->chunk_count();
+  auto compacted_chunk_ids = std::vector<ChunkID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+
+    const auto is_candidate = [&]() {
+      if (!chunk || chunk_id == chunk_count - 1 || chunk->is_mutable() || chunk->get_cleanup_commit_id()) return false;
+
+      const auto chunk_size = chunk->size();
+      if (chunk_size == 0) return false;
+
+      const auto invalid_row_ratio = static_cast<double>(chunk->invalid_row_count()) / static_cast<double>(chunk_size);
+      if (invalid_row_ratio < config.min_invalid_row_ratio) return false;
+
+      const auto& mvcc_data = chunk->mvcc_data();
+      auto highest_end_cid = CommitID{0};
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        const auto end_cid = mvcc_data->get_end_cid(chunk_offset);
+        if (end_cid != MvccData::MAX_COMMIT_ID) highest_end_cid = std::max(highest_end_cid, end_cid);
+      }
+      return highest_end_cid + config.min_commits_since_invalidation <= last_commit_id;
+    }();
+
+    if (is_candidate) compacted_chunk_ids.emplace_back(chunk_id);
+  }
+
+  if (compacted_chunk_ids.empty()) return;
+
+  // Move the valid rows of all candidates to the end of the table. Passing the validated rows as both the rows to
+  // update and the new values re-inserts them unchanged. The rows are read from a reference table that references
+  // exactly the candidates of the stored table. Thus, chunks that are appended to the stored table in the meantime are
+  // not moved. As the Update sees the stored table and its chunk ids, the deletes are logged for (and invalidate the
+  // cached results of) the stored table, just like for any other Update.
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  const auto column_count = table->column_count();
+  auto candidate_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  candidate_chunks.reserve(compacted_chunk_ids.size());
+  for (const auto chunk_id : compacted_chunk_ids) {
+    // The candidates are immutable, so their size does not change.
+    const auto pos_list = std::make_shared<EntireChunkPosList>(chunk_id, table->get_chunk(chunk_id)->size());
+    auto segments = Segments{};
+    segments.reserve(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+    }
+    candidate_chunks.emplace_back(std::make_shared<Chunk>(std::move(segments)));
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(
+      std::make_shared<Table>(table->column_definitions(), TableType::References, std::move(candidate_chunks)));
+  table_wrapper->execute();
+
+  const auto validate = std::make_shared<Validate>(table_wrapper);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+
+  const auto update = std::make_shared<Update>(table_name, validate, validate);
+  update->set_transaction_context(transaction_context);
+  update->execute();
+
+  if (update->execute_failed()) {
+    // As the Update is not executed as part of an OperatorTask, rolling back is our job.
+    transaction_context->rollback(RollbackReason::Conflict);
+    return;
+  }
+
+  const auto moved_row_count = validate->get_output()->row_count();
+  transaction_context->commit();
+
+  // From here on, transactions do not need to look at the chunks anymore (see GetTable).
+  const auto cleanup_commit_id = transaction_context->commit_id();
+  for (const auto chunk_id : compacted_chunk_ids) {
+    table->get_chunk(chunk_id)->set_cleanup_commit_id(cleanup_commit_id);
+  }
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  for (const auto chunk_id : compacted_chunk_ids) {
+    _retired_chunks.emplace_back(RetiredChunk{table_name, table, chunk_id, cleanup_commit_id});
+  }
+
+  auto& statistics = _statistics[table_name];
+  statistics.compacted_chunk_count += compacted_chunk_ids.size();
+  statistics.moved_row_count += moved_row_count;
+}
+
+void GarbageCollector::_encode_completed_chunks(const std::string& table_name, const std::shared_ptr<Table>& table) {
+  const auto is_unencoded = [](const Chunk& chunk) {
+    const auto column_count = chunk.column_count();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      if (!std::dynamic_pointer_cast<const BaseValueSegment>(chunk.get_segment(column_id))) return false;
+    }
+    return true;
+  };
+
+  // Use the encoding of the most recent encoded chunk, which reflects the table's current encoding configuration.
+  const auto chunk_count = table->chunk_count();
+  auto chunk_encoding_spec = std::optional<ChunkEncodingSpec>{};
+  for (auto chunk_id = static_cast<ChunkID>(chunk_count); chunk_id > 0; --chunk_id) {
+    const auto chunk = table->get_chunk(ChunkID{chunk_id - 1});
+    if (!chunk || chunk->is_mutable() || is_unencoded(*chunk)) continue;
+
+    chunk_encoding_spec.emplace();
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      chunk_encoding_spec->emplace_back(get_segment_encoding_spec(chunk->get_segment(column_id)));
+    }
+    break;
+  }
+
+  if (!chunk_encoding_spec) return;
+
+  const auto column_data_types = table->column_data_types();
+  auto encoded_chunk_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk || chunk->is_mutable() || chunk->get_cleanup_commit_id() || !is_unencoded(*chunk)) continue;
+
+    ChunkEncoder::encode_chunk(chunk, column_data_types, *chunk_encoding_spec);
+    ++encoded_chunk_count;
+  }
+
+  if (encoded_chunk_count == 0) return;
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _statistics[table_name].encoded_chunk_count += encoded_chunk_count;
+}
+
+void GarbageCollector::_reclaim_retired_chunks() {
+  // Chunks are retired in the order of their cleanup commit ids. As long as there is an active transaction with a
+  // snapshot older than a chunk's cleanup commit id, it might still see (and need) the chunk's rows.
+  const auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_active_snapshot_commit_id();
+
+  auto reclaimed = std::map<std::string, GarbageCollectionStatistics>{};
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    while (!_retired_chunks.empty()) {
+      const auto& retired_chunk = _retired_chunks.front();
+      if (lowest_snapshot_commit_id && retired_chunk.cleanup_commit_id > *lowest_snapshot_commit_id) break;
+
+      // The table might have been dropped in the meantime.
+      const auto table = retired_chunk.table.lock();
+      const auto chunk = table ? table->get_chunk(retired_chunk.chunk_id) : nullptr;
+      if (chunk) {
+        auto& table_reclaimed = reclaimed[retired_chunk.table_name];
+        ++table_reclaimed.reclaimed_chunk_count;
+        table_reclaimed.reclaimed_bytes += chunk->memory_usage(MemoryUsageCalculationMode::Sampled);
+        table->remove_chunk(retired_chunk.chunk_id);
+      }
+
+      _retired_chunks.pop_front();
+    }
+
+    for (const auto& [table_name, table_reclaimed] : reclaimed) {
+      auto& statistics = _statistics[table_name];
+      statistics.reclaimed_chunk_count += table_reclaimed.reclaimed_chunk_count;
+      statistics.reclaimed_bytes += table_reclaimed.reclaimed_bytes;
+    }
+  }
+
+  for (const auto& [table_name, table_reclaimed] : reclaimed) {
+    auto message = std::ostringstream{};
+    message << "Reclaimed " << table_reclaimed.reclaimed_chunk_count << " chunk(s) of " << table_name << " ("
+            << table_reclaimed.reclaimed_bytes << " bytes)";
+    Hyrise::get().log_manager.add_message("GarbageCollector", message.str(), LogLevel::Info);
+  }
+}
+
+}  // namespace opossum
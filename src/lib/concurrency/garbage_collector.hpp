@@ -0,0 +1,113 @@
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class PausableLoopThread;
+class Table;
+
+struct GarbageCollectorConfig {
+  // Minimum share of invalid rows for a chunk to be compacted
+  double min_invalid_row_ratio{0.5};
+
+  // Number of commits that must have passed since the last invalidation in a chunk. Recently updated rows are likely
+  // to be updated again soon, so moving them would be wasted effort (and could conflict with these updates).
+  CommitID min_commits_since_invalidation{100};
+};
+
+// Work done by the GarbageCollector on a table since it was started, reported in the meta table garbage_collection
+struct GarbageCollectionStatistics {
+  size_t compacted_chunk_count{0};
+  size_t moved_row_count{0};
+  size_t encoded_chunk_count{0};
+  size_t reclaimed_chunk_count{0};
+  size_t reclaimed_bytes{0};
+};
+
+/**
+ * Removes rows that were invalidated (i.e., deleted or updated) from MVCC tables. Without it, long-running update
+ * workloads accumulate invalid rows spread over many chunks, which cost memory and have to be filtered by every scan.
+ *
+ * Each pass (see run()) does the following for every table that uses MVCC:
+ *
+ *   1. Compaction: All immutable chunks with at least min_invalid_row_ratio invalid rows that have not been modified
+ *      recently are compacted in a single transaction. Their valid rows are deleted and inserted again at the end of
+ *      the table (like an Update), where they fill up new chunks. Thus, many sparsely valid chunks are merged into few
+ *      dense ones. The compacted chunks are retired, i.e., marked with the commit id of the transaction as their
+ *      cleanup commit id, from which on GetTable skips them. If the transaction conflicts with a concurrent update,
+ *      it is rolled back and the chunks are tried again in the next pass.
+ *   2. Encoding: Chunks that are completed but still consist of ValueSegments (e.g., the chunks that compacted rows
+ *      were moved to) are encoded like the most recent encoded chunk of the table. Tables without encoded chunks are
+ *      left unencoded.
+ *   3. Reclamation: Retired chunks are removed from their table once no active transaction has a snapshot older than
+ *      their cleanup commit id (i.e., once their epoch is over), as no transaction can see their rows anymore. Their
+ *      memory is freed once the last operator that still references them is gone.
+ *
+ * Passes are either triggered explicitly or run periodically by a background thread (see start()). Hyrise does not
+ * start that thread itself; the server and the TPC-C benchmark do so if --garbage_collection is passed.
+ */
+class GarbageCollector : public Noncopyable {
+ public:
+  static constexpr auto DEFAULT_INTERVAL = std::chrono::milliseconds{1000};
+
+  GarbageCollector();
+  ~GarbageCollector();
+
+  // Starts a background thread that runs a pass every `interval`.
+  void start(const std::chrono::milliseconds interval = DEFAULT_INTERVAL);
+
+  // Stops the background thread. Chunks that have been retired but not reclaimed yet are reclaimed by later passes.
+  void stop();
+
+  bool is_running() const;
+
+  // Runs a single pass. Passes do not run concurrently.
+  void run();
+
+  void set_config(const GarbageCollectorConfig& config);
+  GarbageCollectorConfig config() const;
+
+  // Statistics per table name
+  std::map<std::string, GarbageCollectionStatistics> statistics() const;
+
+  // Number of chunks that have been retired but not yet reclaimed
+  size_t retired_chunk_count() const;
+
+ protected:
+  friend class Hyrise;
+
+  GarbageCollector& operator=(GarbageCollector&& garbage_collector) noexcept;
+
+ private:
+  struct RetiredChunk {
+    std::string table_name;
+    std::weak_ptr<Table> table;
+    ChunkID chunk_id;
+    CommitID cleanup_commit_id;
+  };
+
+  void _compact_chunks(const std::string& table_name, const std::shared_ptr<Table>& table);
+  void _encode_completed_chunks(const std::string& table_name, const std::shared_ptr<Table>& table);
+  void _reclaim_retired_chunks();
+
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+
+  // Held during a pass
+  std::mutex _run_mutex;
+
+  // Protects the config, the statistics, and the retired chunks
+  mutable std::mutex _mutex;
+  GarbageCollectorConfig _config;
+  std::map<std::string, GarbageCollectionStatistics> _statistics;
+  std::deque<RetiredChunk> _retired_chunks;
+};
+
+}  // namespace opossum
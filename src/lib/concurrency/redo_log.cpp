@@ -0,0 +1,485 @@
+#include "redo_log.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/crc.hpp>
+
+#include "hyrise.hpp"
+#include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/checkpoint.hpp"
+#include "resolve_type.hpp"
+#include "storage/pos_lists/abstract_pos_list.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/list_directory.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto RECORD_HEADER_SIZE = sizeof(uint32_t) + sizeof(uint32_t);
+
+uint32_t checksum(const char* data, const size_t size) {
+  auto crc = boost::crc_32_type{};
+  crc.process_bytes(data, size);
+  return crc.checksum();
+}
+
+// Calls `functor(payload, payload_checksum)` for all complete records of the log file. Stops at the first incomplete
+// or corrupted record, which is the expected state if the system crashed while writing.
+template <typename Functor>
+void for_each_record(const std::string& file_path, const Functor& functor) {
+  auto file = std::ifstream{file_path, std::ios::binary};
+  Assert(file.is_open(), "Could not open redo log file '" + file_path + "'");
+  auto remaining_bytes = static_cast<size_t>(std::filesystem::file_size(file_path));
+
+  auto payload = std::vector<char>{};
+  while (remaining_bytes >= RECORD_HEADER_SIZE) {
+    auto payload_size = uint32_t{0};
+    auto payload_checksum = uint32_t{0};
+    file.read(reinterpret_cast<char*>(&payload_size), sizeof(uint32_t));
+    file.read(reinterpret_cast<char*>(&payload_checksum), sizeof(uint32_t));
+    remaining_bytes -= RECORD_HEADER_SIZE;
+
+    // A record that was not completely written before the crash has never been acknowledged. We can stop here.
+    if (payload_size > remaining_bytes) return;
+
+    payload.resize(payload_size);
+    file.read(payload.data(), payload_size);
+    remaining_bytes -= payload_size;
+
+    if (checksum(payload.data(), payload_size) != payload_checksum) return;
+
+    functor(payload, payload_checksum);
+  }
+}
+
+// Reads the payload of a single record. Values are read in the same order in which RedoLogRecordBuilder wrote them.
+class RecordReader {
+ public:
+  explicit RecordReader(const std::vector<char>& payload) : _payload{payload} {}
+
+  template <typename T>
+  T read() {
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      const auto size = read<uint32_t>();
+      Assert(_offset + size <= _payload.size(), "Redo log record is truncated");
+      auto string = pmr_string{_payload.data() + _offset, size};
+      _offset += size;
+      return string;
+    } else {
+      static_assert(std::is_trivially_copyable_v<T>, "Can only read trivially copyable types");
+      Assert(_offset + sizeof(T) <= _payload.size(), "Redo log record is truncated");
+      auto value = T{};
+      std::memcpy(&value, _payload.data() + _offset, sizeof(T));
+      _offset += sizeof(T);
+      return value;
+    }
+  }
+
+ private:
+  const std::vector<char>& _payload;
+  size_t _offset{0};
+};
+
+// Maps the RowIDs of rows inserted before the crash to the RowIDs they were assigned during the replay.
+using RowIDMapping = std::unordered_map<uint64_t, RowID>;
+
+uint64_t row_id_key(const RowID& row_id) {
+  return (static_cast<uint64_t>(row_id.chunk_id) << 32u) | static_cast<uint64_t>(row_id.chunk_offset);
+}
+
+void replay_insert(RecordReader& reader, std::unordered_map<std::string, RowIDMapping>& row_id_mappings) {
+  const auto table_name = std::string{reader.read<pmr_string>()};
+  const auto table = Hyrise::get().storage_manager.get_table(table_name);
+  auto& row_id_mapping = row_id_mappings[table_name];
+
+  const auto first_row_id = RowID{reader.read<ChunkID>(), reader.read<ChunkOffset>()};
+  const auto row_count = reader.read<ChunkOffset>();
+  const auto column_count = table->column_count();
+
+  // Values are logged column by column, but appended row by row.
+  auto rows = std::vector<std::vector<AllTypeVariant>>(row_count, std::vector<AllTypeVariant>(column_count));
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      for (auto row_offset = ChunkOffset{0}; row_offset < row_count; ++row_offset) {
+        const auto is_null = reader.read<bool>();
+        if (is_null) {
+          rows[row_offset][column_id] = NULL_VALUE;
+        } else {
+          rows[row_offset][column_id] = reader.read<ColumnDataType>();
+        }
+      }
+    });
+  }
+
+  for (auto row_offset = ChunkOffset{0}; row_offset < row_count; ++row_offset) {
+    table->append(rows[row_offset]);
+
+    const auto last_chunk_id = static_cast<ChunkID>(table->chunk_count() - 1);
+    const auto replayed_row_id =
+        RowID{last_chunk_id, static_cast<ChunkOffset>(table->get_chunk(last_chunk_id)->size() - 1)};
+    const auto logged_row_id = RowID{first_row_id.chunk_id, first_row_id.chunk_offset + row_offset};
+    row_id_mapping[row_id_key(logged_row_id)] = replayed_row_id;
+  }
+}
+
+void replay_delete(RecordReader& reader, std::unordered_map<std::string, RowIDMapping>& row_id_mappings) {
+  const auto table_name = std::string{reader.read<pmr_string>()};
+  const auto table = Hyrise::get().storage_manager.get_table(table_name);
+  const auto& row_id_mapping = row_id_mappings[table_name];
+
+  const auto row_count = reader.read<uint32_t>();
+  for (auto row_index = uint32_t{0}; row_index < row_count; ++row_index) {
+    auto row_id = RowID{reader.read<ChunkID>(), reader.read<ChunkOffset>()};
+
+    // Rows that are not part of the mapping have been part of the checkpoint and kept their RowID.
+    const auto mapping_iter = row_id_mapping.find(row_id_key(row_id));
+    if (mapping_iter != row_id_mapping.end()) row_id = mapping_iter->second;
+
+    const auto chunk = table->get_chunk(row_id.chunk_id);
+    Assert(chunk && row_id.chunk_offset < chunk->size(), "Redo log references a row that does not exist");
+
+    // Invalidate the row for all transactions, similar to rows that have been there "from the beginning of time".
+    chunk->mvcc_data()->set_end_cid(row_id.chunk_offset, CommitID{0});
+    chunk->increase_invalid_row_count(1);
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+RedoLogRecordBuilder::RedoLogRecordBuilder(const CommitID commit_id) {
+  // Reserve space for the header and the entry count, both are written in finish().
+  _buffer.resize(RECORD_HEADER_SIZE);
+  _write(commit_id);
+  _write(uint32_t{0});
+}
+
+void RedoLogRecordBuilder::add_insert(const std::string& table_name, const Table& table, const RowID first_row_id,
+                                      const ChunkOffset row_count) {
+  const auto chunk = table.get_chunk(first_row_id.chunk_id);
+  Assert(chunk, "Cannot log rows of a physically deleted chunk");
+
+  _write(RedoLogEntryType::Insert);
+  _write_string(table_name);
+  _write(first_row_id.chunk_id);
+  _write(first_row_id.chunk_offset);
+  _write(row_count);
+
+  const auto end_chunk_offset = first_row_id.chunk_offset + row_count;
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(chunk->get_segment(column_id));
+      Assert(value_segment, "Uncommitted rows are expected to be stored in ValueSegments");
+
+      const auto& values = value_segment->values();
+      for (auto chunk_offset = first_row_id.chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+        const auto is_null = value_segment->is_null(chunk_offset);
+        _write(is_null);
+        if (is_null) continue;
+
+        if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+          _write_string(values[chunk_offset]);
+        } else {
+          _write(values[chunk_offset]);
+        }
+      }
+    });
+  }
+
+  ++_entry_count;
+}
+
+void RedoLogRecordBuilder::add_delete(const std::shared_ptr<const Table>& table, const AbstractPosList& row_ids) {
+  _write(RedoLogEntryType::Delete);
+  _write_string(Hyrise::get().storage_manager.table_name(*table));
+  _write(static_cast<uint32_t>(row_ids.size()));
+  for (const auto& row_id : row_ids) {
+    _write(row_id.chunk_id);
+    _write(row_id.chunk_offset);
+  }
+
+  ++_entry_count;
+}
+
+bool RedoLogRecordBuilder::empty() const { return _entry_count == 0; }
+
+std::vector<char> RedoLogRecordBuilder::finish() {
+  const auto payload_size = static_cast<uint32_t>(_buffer.size() - RECORD_HEADER_SIZE);
+  std::memcpy(_buffer.data() + RECORD_HEADER_SIZE + sizeof(CommitID), &_entry_count, sizeof(uint32_t));
+
+  const auto payload_checksum = checksum(_buffer.data() + RECORD_HEADER_SIZE, payload_size);
+  std::memcpy(_buffer.data(), &payload_size, sizeof(uint32_t));
+  std::memcpy(_buffer.data() + sizeof(uint32_t), &payload_checksum, sizeof(uint32_t));
+
+  return std::move(_buffer);
+}
+
+template <typename T>
+void RedoLogRecordBuilder::_write(const T& value) {
+  static_assert(std::is_trivially_copyable_v<T>, "Can only write trivially copyable types");
+  const auto offset = _buffer.size();
+  _buffer.resize(offset + sizeof(T));
+  std::memcpy(_buffer.data() + offset, &value, sizeof(T));
+}
+
+void RedoLogRecordBuilder::_write_string(const std::string_view& string) {
+  _write(static_cast<uint32_t>(string.size()));
+  _buffer.insert(_buffer.end(), string.begin(), string.end());
+}
+
+RedoLog::~RedoLog() { disable(); }
+
+RedoLog& RedoLog::operator=(RedoLog&& redo_log) noexcept {
+  // The writer thread cannot be moved as it references its RedoLog instance. As Hyrise::reset() only assigns freshly
+  // constructed (and thus disabled) instances, stopping the current log is sufficient.
+  disable();
+  return *this;
+}
+
+void RedoLog::enable(const std::string& file_path) {
+  Assert(!is_enabled(), "RedoLog is already enabled");
+
+  _file_path = file_path;
+  _file_descriptor = open(file_path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  Assert(_file_descriptor != -1, "Could not open redo log file '" + file_path + "': " + std::strerror(errno));
+
+  _shutdown_requested = false;
+  _appended_record_count = 0;
+  _durable_record_count = 0;
+  _sync_count = 0;
+  _writer_thread = std::thread{&RedoLog::_write_loop, this};
+}
+
+void RedoLog::disable() {
+  if (!is_enabled()) return;
+
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _shutdown_requested = true;
+  }
+  _records_available.notify_one();
+  _writer_thread.join();
+
+  close(_file_descriptor);
+  _file_descriptor = -1;
+}
+
+bool RedoLog::is_enabled() const { return _file_descriptor != -1; }
+
+void RedoLog::append(std::vector<char>&& record, std::function<void()>&& on_durable) {
+  DebugAssert(is_enabled(), "Cannot append to a disabled RedoLog");
+
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    if (_pending_buffer.empty()) {
+      _pending_buffer = std::move(record);
+    } else {
+      _pending_buffer.insert(_pending_buffer.end(), record.begin(), record.end());
+    }
+    _pending_callbacks.emplace_back(std::move(on_durable));
+    ++_appended_record_count;
+  }
+  _records_available.notify_one();
+}
+
+void RedoLog::flush() {
+  auto lock = std::unique_lock<std::mutex>{_mutex};
+  const auto target_record_count = _appended_record_count;
+  _records_durable.wait(lock, [&]() { return _durable_record_count >= target_record_count; });
+}
+
+size_t RedoLog::record_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _durable_record_count;
+}
+
+size_t RedoLog::sync_count() const { return _sync_count; }
+
+void RedoLog::truncate(const CommitID commit_id) {
+  Assert(is_enabled(), "Cannot truncate a disabled RedoLog");
+
+  auto lock = std::unique_lock<std::mutex>{_mutex};
+  _records_durable.wait(lock, [&]() { return !_truncation_commit_id; });
+  _truncation_commit_id = commit_id;
+  _records_available.notify_one();
+  _records_durable.wait(lock, [&]() { return !_truncation_commit_id; });
+}
+
+void RedoLog::_write_loop() {
+  auto buffer = std::vector<char>{};
+  auto callbacks = std::vector<std::function<void()>>{};
+
+  while (true) {
+    auto truncation_commit_id = std::optional<CommitID>{};
+    {
+      auto lock = std::unique_lock<std::mutex>{_mutex};
+      _records_available.wait(lock, [&]() {
+        return !_pending_callbacks.empty() || _truncation_commit_id || _shutdown_requested;
+      });
+
+      if (_truncation_commit_id) {
+        truncation_commit_id = _truncation_commit_id;
+      } else {
+        // Even when a shutdown is requested, all pending records are persisted first.
+        if (_pending_callbacks.empty()) return;
+
+        // Take all records that have accumulated while the previous batch was being synced. Swapping the buffers
+        // (instead of copying them) means that committing threads do not wait for the I/O.
+        std::swap(buffer, _pending_buffer);
+        std::swap(callbacks, _pending_callbacks);
+      }
+    }
+
+    if (truncation_commit_id) {
+      _truncate_file(*truncation_commit_id);
+      {
+        const auto lock = std::lock_guard<std::mutex>{_mutex};
+        _truncation_commit_id.reset();
+      }
+      _records_durable.notify_all();
+      continue;
+    }
+
+    auto bytes_written = size_t{0};
+    while (bytes_written < buffer.size()) {
+      const auto result = write(_file_descriptor, buffer.data() + bytes_written, buffer.size() - bytes_written);
+      if (result == -1 && errno == EINTR) continue;
+      Assert(result != -1, std::string{"Could not write to redo log: "} + std::strerror(errno));
+      bytes_written += static_cast<size_t>(result);
+    }
+
+#ifdef __linux__
+    // The file's metadata (e.g., its modification time) is not needed for recovery, fdatasync() suffices.
+    const auto sync_result = fdatasync(_file_descriptor);
+#else
+    const auto sync_result = fsync(_file_descriptor);
+#endif
+    Assert(sync_result == 0, std::string{"Could not sync redo log: "} + std::strerror(errno));
+    ++_sync_count;
+
+    for (const auto& callback : callbacks) {
+      if (callback) callback();
+    }
+
+    {
+      const auto lock = std::lock_guard<std::mutex>{_mutex};
+      _durable_record_count += callbacks.size();
+    }
+    _records_durable.notify_all();
+
+    buffer.clear();
+    callbacks.clear();
+  }
+}
+
+void RedoLog::_truncate_file(const CommitID commit_id) {
+  // The remaining records are copied to a new file, which then replaces the log. Committing transactions can continue
+  // to append records in the meantime, these are written to the new file once the truncation is complete.
+  const auto temporary_file_path = _file_path + ".tmp";
+  {
+    auto file = std::ofstream{temporary_file_path, std::ios::binary | std::ios::trunc};
+    Assert(file.is_open(), "Could not open '" + temporary_file_path + "'");
+
+    for_each_record(_file_path, [&](const std::vector<char>& payload, const uint32_t payload_checksum) {
+      if (RecordReader{payload}.read<CommitID>() <= commit_id) return;
+
+      const auto payload_size = static_cast<uint32_t>(payload.size());
+      file.write(reinterpret_cast<const char*>(&payload_size), sizeof(uint32_t));
+      file.write(reinterpret_cast<const char*>(&payload_checksum), sizeof(uint32_t));
+      file.write(payload.data(), payload_size);
+    });
+  }
+
+  const auto temporary_file_descriptor = open(temporary_file_path.c_str(), O_WRONLY | O_APPEND);
+  Assert(temporary_file_descriptor != -1,
+         "Could not open '" + temporary_file_path + "': " + std::strerror(errno));
+  Assert(fsync(temporary_file_descriptor) == 0, std::string{"Could not sync redo log: "} + std::strerror(errno));
+
+  std::filesystem::rename(temporary_file_path, _file_path);
+
+  // Make the rename durable before records are appended to the new file.
+  auto directory_path = std::filesystem::path{_file_path}.parent_path();
+  if (directory_path.empty()) directory_path = ".";
+  const auto directory_file_descriptor = open(directory_path.c_str(), O_RDONLY);
+  Assert(directory_file_descriptor != -1, "Could not open '" + directory_path.string() + "': " + std::strerror(errno));
+  const auto sync_result = fsync(directory_file_descriptor);
+  close(directory_file_descriptor);
+  Assert(sync_result == 0, std::string{"Could not sync redo log directory: "} + std::strerror(errno));
+
+  close(_file_descriptor);
+  _file_descriptor = temporary_file_descriptor;
+}
+
+size_t RedoLog::recover(const std::string& log_file_path, const std::string& checkpoint_directory) {
+  auto& storage_manager = Hyrise::get().storage_manager;
+  auto checkpoint_commit_id = CommitID{0};
+
+  if (!checkpoint_directory.empty()) {
+    if (Checkpoint::exists(checkpoint_directory)) {
+      checkpoint_commit_id = Checkpoint::load(checkpoint_directory);
+    } else {
+      for (const auto& path : list_directory(checkpoint_directory)) {
+        if (path.extension() != ".bin") continue;
+
+        const auto table_name = path.stem().string();
+        if (storage_manager.has_table(table_name)) continue;
+
+        storage_manager.add_table(table_name, BinaryParser::parse(path.string(), BinaryParserMode::MemoryMapped));
+      }
+    }
+  }
+
+  auto last_commit_id = checkpoint_commit_id;
+  auto replayed_record_count = size_t{0};
+
+  if (std::filesystem::exists(log_file_path)) {
+    auto row_id_mappings = std::unordered_map<std::string, RowIDMapping>{};
+
+    for_each_record(log_file_path, [&](const std::vector<char>& payload, const uint32_t /*payload_checksum*/) {
+      auto reader = RecordReader{payload};
+      const auto commit_id = reader.read<CommitID>();
+
+      // The record's changes are already part of the checkpoint. This happens if the system crashed after writing the
+      // checkpoint, but before truncating the log.
+      if (commit_id <= checkpoint_commit_id) return;
+      last_commit_id = std::max(last_commit_id, commit_id);
+
+      const auto entry_count = reader.read<uint32_t>();
+      for (auto entry_index = uint32_t{0}; entry_index < entry_count; ++entry_index) {
+        const auto entry_type = reader.read<RedoLogEntryType>();
+        switch (entry_type) {
+          case RedoLogEntryType::Insert:
+            replay_insert(reader, row_id_mappings);
+            break;
+          case RedoLogEntryType::Delete:
+            replay_delete(reader, row_id_mappings);
+            break;
+        }
+      }
+
+      ++replayed_record_count;
+    });
+  }
+
+  Hyrise::get().transaction_manager._initialize_last_commit_id(last_commit_id);
+
+  return replayed_record_count;
+}
+
+}  // namespace opossum
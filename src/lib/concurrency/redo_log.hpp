@@ -0,0 +1,157 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractPosList;
+class Table;
+
+/**
+ * Serializes the modifications of a single committing transaction into one redo log record. The read/write operators
+ * add their changes through AbstractReadWriteOperator::log_records(), the TransactionContext hands the finished record
+ * to the RedoLog.
+ *
+ * A record has the following layout (all integers in native byte order):
+ *
+ *   | payload size (uint32_t) | checksum of payload (uint32_t) | payload |
+ *
+ * with the payload being
+ *
+ *   | commit id (CommitID) | entry count (uint32_t) | entries |
+ *
+ * Each entry starts with its RedoLogEntryType. Insert entries contain the target table's name, the RowID of the first
+ * inserted row, the number of rows and the values column by column (a null flag followed by the value). Delete entries
+ * contain the table's name and the RowIDs of the invalidated rows.
+ */
+enum class RedoLogEntryType : uint8_t { Insert, Delete };
+
+class RedoLogRecordBuilder : private Noncopyable {
+ public:
+  explicit RedoLogRecordBuilder(const CommitID commit_id);
+
+  // Logs the rows [first_row_id.chunk_offset, first_row_id.chunk_offset + row_count) of the given chunk. Expects the
+  // rows to be stored in ValueSegments, which is guaranteed as long as they have not been committed.
+  void add_insert(const std::string& table_name, const Table& table, const RowID first_row_id,
+                  const ChunkOffset row_count);
+
+  // Logs the invalidation of the given rows. The table's name is looked up in the StorageManager.
+  void add_delete(const std::shared_ptr<const Table>& table, const AbstractPosList& row_ids);
+
+  bool empty() const;
+
+  // Returns the serialized record, including the header. The builder must not be used afterwards.
+  std::vector<char> finish();
+
+ private:
+  template <typename T>
+  void _write(const T& value);
+
+  void _write_string(const std::string_view& string);
+
+  std::vector<char> _buffer;
+  uint32_t _entry_count{0};
+};
+
+/**
+ * Write-ahead redo log for committed transactions.
+ *
+ * When enabled, TransactionContext::commit_async serializes the changes of the committing transaction and passes them
+ * to append(). The commit is only made visible (and its callback fired) once the record has been written and synced
+ * to disk. A dedicated writer thread collects all records that arrive while the previous batch is being synced and
+ * persists them with a single write/fsync (group commit). Thus, under load, the cost of a sync is shared by all
+ * concurrently committing transactions.
+ *
+ * Records are appended in the order in which they become durable, which is not necessarily the commit id order. This
+ * is not an issue, as a transaction can only depend on the changes of transactions that were already visible (and
+ * therefore durable) when it took its snapshot.
+ *
+ * After a crash, the state is restored by loading the last checkpoint and replaying the log on top of it (see
+ * recover()). Tables that are created after the checkpoint are not covered by the log. Once a Checkpoint has been
+ * written, it truncates the records that it covers.
+ */
+class RedoLog : public Noncopyable {
+ public:
+  ~RedoLog();
+
+  // Opens (or creates) the log file and starts the writer thread. New records are appended to existing ones.
+  void enable(const std::string& file_path);
+
+  // Waits until all pending records are durable and stops the writer thread.
+  void disable();
+
+  bool is_enabled() const;
+
+  // Appends a serialized record to the log. `on_durable` is called from the writer thread once the record has been
+  // synced to disk. Hence, it should not block on other commits.
+  void append(std::vector<char>&& record, std::function<void()>&& on_durable);
+
+  // Blocks until all records appended so far are durable.
+  void flush();
+
+  // Number of records written and number of syncs issued since the log was enabled. The ratio of both denotes how
+  // many commits share a sync on average.
+  size_t record_count() const;
+  size_t sync_count() const;
+
+  // Removes all records of transactions with a commit id of at most `commit_id` from the log, i.e., the records
+  // covered by a checkpoint with that snapshot commit id. Blocks until the shortened log has replaced the old one.
+  void truncate(const CommitID commit_id);
+
+  /**
+   * Restores the database state after a restart. First, the checkpoint in checkpoint_directory is loaded (see
+   * Checkpoint::load). If the directory does not contain a Checkpoint, all binary table files (*.bin) found in it are
+   * loaded into the StorageManager instead, using the file name without extension as the table name. Tables that
+   * already exist are kept. Then, all complete records of the log that are not covered by the checkpoint are replayed.
+   * Replay stops at the first incomplete or corrupted record, which is the expected state if the system crashed while
+   * writing. Returns the number of replayed records.
+   *
+   * The checkpoint has to preserve the physical layout (i.e., the RowIDs) of the rows it contains, which is the case
+   * for Checkpoints and tables written by the BinaryWriter. Rows inserted by the log are appended to the tables. As
+   * their RowIDs may differ from the ones they had before the crash, deletes of these rows are translated accordingly.
+   * Finally, the TransactionManager continues with the highest recovered commit id, so that records written after the
+   * recovery are not mistaken for records covered by the checkpoint.
+   */
+  static size_t recover(const std::string& log_file_path, const std::string& checkpoint_directory = "");
+
+ protected:
+  friend class Hyrise;
+
+  RedoLog& operator=(RedoLog&& redo_log) noexcept;
+
+ private:
+  void _write_loop();
+  void _truncate_file(const CommitID commit_id);
+
+  std::string _file_path;
+  int _file_descriptor{-1};
+  std::thread _writer_thread;
+
+  mutable std::mutex _mutex;
+  std::condition_variable _records_available;
+  std::condition_variable _records_durable;
+  bool _shutdown_requested{false};
+
+  // Set by truncate(), executed (and reset) by the writer thread, which owns the file descriptor.
+  std::optional<CommitID> _truncation_commit_id;
+
+  // Records (and their callbacks) that have been appended, but not yet been picked up by the writer thread.
+  std::vector<char> _pending_buffer;
+  std::vector<std::function<void()>> _pending_callbacks;
+
+  size_t _appended_record_count{0};
+  size_t _durable_record_count{0};
+  std::atomic<size_t> _sync_count{0};
+};
+
+}  // namespace opossum
@@ -6,6 +6,7 @@
 #include "commit_context.hpp"
 #include "hyrise.hpp"
 #include "operators/abstract_read_write_operator.hpp"
+#include "redo_log.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -89,11 +90,39 @@ void TransactionContext::rollback(RollbackReason rollback_reason) {
 void TransactionContext::commit_async(const std::function<void(TransactionID)>& callback) {
   _prepare_commit();
 
+  auto& redo_log = Hyrise::get().redo_log;
+  if (!redo_log.is_enabled()) {
+    for (const auto& op : _read_write_operators) {
+      op->commit_records(commit_id());
+    }
+
+    _mark_as_pending_and_try_commit(callback);
+    return;
+  }
+
+  // The changes are logged before commit_records is called. Until then, the modified rows are still locked by this
+  // transaction, which guarantees that they have not been encoded yet.
+  auto record_builder = RedoLogRecordBuilder{commit_id()};
+  for (const auto& op : _read_write_operators) {
+    op->log_records(record_builder);
+  }
+
   for (const auto& op : _read_write_operators) {
     op->commit_records(commit_id());
   }
 
-  _mark_as_pending_and_try_commit(callback);
+  // Without modified rows (e.g., an Update or Delete that matched no rows), there is nothing to make durable. Still,
+  // the commit only becomes visible after all previous ones, including the ones whose records are not durable yet.
+  if (record_builder.empty()) {
+    _mark_as_pending_and_try_commit(callback);
+    return;
+  }
+
+  // The commit context is only marked as pending once the record is durable. As commits become visible in the order
+  // of their commit ids, this also holds back all following transactions until then.
+  redo_log.append(record_builder.finish(), [context = shared_from_this(), callback]() {
+    context->_mark_as_pending_and_try_commit(callback);
+  });
 }
 
 void TransactionContext::commit() {
@@ -172,7 +201,7 @@ void TransactionContext::_mark_as_pending_and_try_commit(const std::function<voi
     if (callback) callback(transaction_id);
   });
 
-  Hyrise::get().transaction_manager._try_increment_last_commit_id(_commit_context);
+  Hyrise::get().transaction_manager._publish_pending_commits();
 }
 
 void TransactionContext::on_operator_started() { ++_num_active_operators; }
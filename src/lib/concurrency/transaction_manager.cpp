@@ -1,5 +1,8 @@
 #include "transaction_manager.hpp"
 
+#include <memory>
+#include <vector>
+
 #include "commit_context.hpp"
 #include "storage/mvcc_data.hpp"
 #include "transaction_context.hpp"
@@ -10,7 +13,8 @@ namespace opossum {
 TransactionManager::TransactionManager()
     : _next_transaction_id{INITIAL_TRANSACTION_ID},
       _last_commit_id{INITIAL_COMMIT_ID},
-      _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)} {}
+      _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)},
+      _last_published_commit_context{_last_commit_context} {}
 
 TransactionManager::~TransactionManager() {
   Assert(_active_snapshot_commit_ids.empty(),
@@ -21,6 +25,7 @@ TransactionManager& TransactionManager::operator=(TransactionManager&& transacti
   _next_transaction_id = transaction_manager._next_transaction_id.load();
   _last_commit_id = transaction_manager._last_commit_id.load();
   _last_commit_context = transaction_manager._last_commit_context;
+  _last_published_commit_context = transaction_manager._last_published_commit_context;
   _active_snapshot_commit_ids = transaction_manager._active_snapshot_commit_ids;
   return *this;
 }
@@ -32,6 +37,19 @@ std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context(
   return std::make_shared<TransactionContext>(_next_transaction_id++, snapshot_commit_id, auto_commit);
 }
 
+void TransactionManager::_initialize_last_commit_id(const CommitID commit_id) {
+  {
+    std::lock_guard<std::mutex> lock(_active_snapshot_commit_ids_mutex);
+    Assert(_active_snapshot_commit_ids.empty(), "Cannot change the last commit id while transactions are active");
+  }
+
+  if (commit_id <= _last_commit_id) return;
+
+  _last_commit_id = commit_id;
+  _last_commit_context = std::make_shared<CommitContext>(commit_id);
+  _last_published_commit_context = _last_commit_context;
+}
+
 void TransactionManager::_register_transaction(const CommitID snapshot_commit_id) {
   std::lock_guard<std::mutex> lock(_active_snapshot_commit_ids_mutex);
   _active_snapshot_commit_ids.insert(snapshot_commit_id);
@@ -104,19 +122,52 @@ std::shared_ptr<CommitContext> TransactionManager::_new_commit_context() {
   return next_context;
 }
 
-void TransactionManager::_try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context) {
-  auto current_context = context;
+/**
+ * Logic of the group commit
+ *
+ * Commits become visible in the order of their commit ids. When a transaction has written its commit ids (and, if
+ * enabled, its redo log record is durable), its commit context is marked as pending and this method is called. If no
+ * other thread is currently publishing, the calling thread becomes the publisher: It collects the chain of pending
+ * contexts that directly follows the last published one, makes all of them visible with a single update of
+ * _last_commit_id, and then fires their callbacks in commit id order. Threads whose contexts become pending in the
+ * meantime do not wait for the publisher but return immediately, leaving their commits to the publisher's next round.
+ * Under load, many commits are thus published together instead of advancing _last_commit_id one by one.
+ *
+ * A context might become pending after the publisher has looked at it, but before the publisher has released
+ * _is_publishing. Its thread then fails to become the publisher. As both threads use sequentially consistent
+ * operations, the publisher is guaranteed to see the pending context when it checks for further work after releasing
+ * _is_publishing.
+ *
+ * Callbacks are fired while _is_publishing is held. Thus, they must not wait for other commits to become visible.
+ */
+void TransactionManager::_publish_pending_commits() {
+  auto published_contexts = std::vector<std::shared_ptr<CommitContext>>{};
+
+  while (true) {
+    auto is_publishing = false;
+    if (!_is_publishing.compare_exchange_strong(is_publishing, true)) return;
 
-  while (current_context->is_pending()) {
-    auto expected_last_commit_id = current_context->commit_id() - 1;
+    auto next_context = _last_published_commit_context->next();
+    while (next_context && next_context->is_pending()) {
+      published_contexts.emplace_back(next_context);
+      next_context = next_context->next();
+    }
 
-    if (!_last_commit_id.compare_exchange_strong(expected_last_commit_id, current_context->commit_id())) return;
+    if (!published_contexts.empty()) {
+      _last_published_commit_context = published_contexts.back();
+      _last_commit_id = _last_published_commit_context->commit_id();
 
-    current_context->fire_callback();
+      for (const auto& context : published_contexts) {
+        context->fire_callback();
+      }
+      published_contexts.clear();
+    }
 
-    if (!current_context->has_next()) return;
+    const auto last_published_context = _last_published_commit_context;
+    _is_publishing = false;
 
-    current_context = current_context->next();
+    next_context = last_published_context->next();
+    if (!next_context || !next_context->is_pending()) return;
   }
 }
 
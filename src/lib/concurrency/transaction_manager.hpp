@@ -71,12 +71,19 @@ class TransactionManager : public Noncopyable {
   ~TransactionManager();
 
   friend class Hyrise;
+  friend class RedoLog;
   friend class TransactionContext;
 
   TransactionManager& operator=(TransactionManager&& transaction_manager) noexcept;
 
   std::shared_ptr<CommitContext> _new_commit_context();
-  void _try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context);
+
+  // Publishes all pending commit contexts that directly follow the last published one as a group (see the .cpp).
+  void _publish_pending_commits();
+
+  // Continues with the given commit id after the database state has been recovered (see RedoLog::recover). Does
+  // nothing if the current last commit id is already higher.
+  void _initialize_last_commit_id(const CommitID commit_id);
 
   /**
    * The TransactionManager keeps track of issued snapshot-commit-ids,
@@ -94,8 +101,15 @@ class TransactionManager : public Noncopyable {
   // been there "from the beginning of time".
   static constexpr auto INITIAL_COMMIT_ID = CommitID{1};
 
+  // The most recently created commit context, i.e., the end of the chain of commit contexts
   std::shared_ptr<CommitContext> _last_commit_context;
 
+  // The commit context with the commit id _last_commit_id. Its successors are the commits that are not visible yet.
+  std::shared_ptr<CommitContext> _last_published_commit_context;
+
+  // Set while a thread publishes pending commits
+  std::atomic_bool _is_publishing{false};
+
   mutable std::mutex _active_snapshot_commit_ids_mutex;
   std::unordered_multiset<CommitID> _active_snapshot_commit_ids;
 };
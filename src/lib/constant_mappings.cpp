@@ -7,6 +7,7 @@
 
 #include "expression/abstract_expression.hpp"
 #include "expression/aggregate_expression.hpp"
+#include "expression/window_function_expression.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
 #include "utils/make_bimap.hpp"
 
@@ -39,6 +40,7 @@ const boost::bimap<EncodingType, std::string> encoding_type_to_string = make_bim
     {EncodingType::FixedStringDictionary, "FixedStringDictionary"},
     {EncodingType::FrameOfReference, "FrameOfReference"},
     {EncodingType::LZ4, "LZ4"},
+    {EncodingType::FSST, "FSST"},
     {EncodingType::Unencoded, "Unencoded"},
 });
 
@@ -54,6 +56,18 @@ const boost::bimap<VectorCompressionType, std::string> vector_compression_type_t
         {VectorCompressionType::BitPacking, "Bit-packing"},
     });
 
+const boost::bimap<WindowFunction, std::string> window_function_to_string =
+    make_bimap<WindowFunction, std::string>({
+        {WindowFunction::RowNumber, "ROW_NUMBER"},
+        {WindowFunction::Rank, "RANK"},
+        {WindowFunction::DenseRank, "DENSE_RANK"},
+        {WindowFunction::Min, "MIN"},
+        {WindowFunction::Max, "MAX"},
+        {WindowFunction::Sum, "SUM"},
+        {WindowFunction::Avg, "AVG"},
+        {WindowFunction::Count, "COUNT"},
+    });
+
 std::ostream& operator<<(std::ostream& stream, const AggregateFunction aggregate_function) {
   return stream << aggregate_function_to_string.left.at(aggregate_function);
 }
@@ -106,4 +120,8 @@ std::ostream& operator<<(std::ostream& stream, const CompressedVectorType compre
   return stream;
 }
 
+std::ostream& operator<<(std::ostream& stream, const WindowFunction window_function) {
+  return stream << window_function_to_string.left.at(window_function);
+}
+
 }  // namespace opossum
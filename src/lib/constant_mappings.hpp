@@ -21,6 +21,7 @@ enum class VectorCompressionType : uint8_t;
 enum class AggregateFunction;
 enum class ExpressionType;
 enum class FileType;
+enum class WindowFunction;
 
 extern const boost::bimap<AggregateFunction, std::string> aggregate_function_to_string;
 extern const boost::bimap<FunctionType, std::string> function_type_to_string;
@@ -29,6 +30,7 @@ extern const boost::bimap<EncodingType, std::string> encoding_type_to_string;
 extern const boost::bimap<FileType, std::string> file_type_to_string;
 extern const boost::bimap<LogLevel, std::string> log_level_to_string;
 extern const boost::bimap<VectorCompressionType, std::string> vector_compression_type_to_string;
+extern const boost::bimap<WindowFunction, std::string> window_function_to_string;
 
 std::ostream& operator<<(std::ostream& stream, const AggregateFunction aggregate_function);
 std::ostream& operator<<(std::ostream& stream, const FunctionType function_type);
@@ -38,5 +40,6 @@ std::ostream& operator<<(std::ostream& stream, const FileType file_type);
 std::ostream& operator<<(std::ostream& stream, const LogLevel log_level);
 std::ostream& operator<<(std::ostream& stream, const VectorCompressionType vector_compression_type);
 std::ostream& operator<<(std::ostream& stream, const CompressedVectorType compressed_vector_type);
+std::ostream& operator<<(std::ostream& stream, const WindowFunction window_function);
 
 }  // namespace opossum
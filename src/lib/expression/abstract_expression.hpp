@@ -32,7 +32,8 @@ enum class ExpressionType {
   PQPSubquery,
   LQPSubquery,
   UnaryMinus,
-  Value
+  Value,
+  WindowFunction
 };
 
 /**
@@ -216,6 +216,9 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::evaluate_expressi
     case ExpressionType::Aggregate:
       Fail("ExpressionEvaluator doesn't support Aggregates, use the Aggregate Operator to compute them");
 
+    case ExpressionType::WindowFunction:
+      Fail("ExpressionEvaluator doesn't support window functions, use the Window operator to compute them");
+
     case ExpressionType::List:
       Fail("Can't evaluate a ListExpression, lists should only appear as the right operand of an InExpression");
 
@@ -1,15 +1,63 @@
 #include "like_matcher.hpp"
 
+#include <cstring>
 #include <optional>
+#include <string_view>
 #include <utility>
 
 #include <boost/algorithm/string/replace.hpp>
 
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+using Segment = LikeMatcher::GeneralPattern::Segment;
+
+// Number of candidate positions that LikeMatcher::find checks at once.
+constexpr auto FIND_BLOCK_SIZE = size_t{64};
+
+// Checks whether @param segment matches @param string at @param position. The caller ensures that the segment fits.
+bool segment_matches_at(const Segment& segment, const std::string_view& string, const size_t position) {
+  const auto length = segment.characters.size();
+  for (auto index = size_t{0}; index < length; ++index) {
+    const auto character = segment.characters[index];
+    if (character != '_' && character != string[position + index]) return false;
+  }
+  return true;
+}
+
+// Returns the leftmost position at which @param segment matches @param string or std::string_view::npos.
+size_t find_segment(const Segment& segment, const std::string_view& string) {
+  const auto length = segment.characters.size();
+  if (string.size() < length) return std::string_view::npos;
+
+  // The segment consists of '_' only and matches any characters.
+  if (segment.anchor_length == 0) return 0;
+
+  const auto anchor = std::string_view{segment.characters}.substr(segment.anchor_offset, segment.anchor_length);
+  const auto last_anchor_position = string.size() - length + segment.anchor_offset;
+
+  auto search_begin = segment.anchor_offset;
+  while (search_begin <= last_anchor_position) {
+    const auto window = string.substr(search_begin, last_anchor_position + segment.anchor_length - search_begin);
+    const auto anchor_position = LikeMatcher::find(window, anchor);
+    if (anchor_position == std::string_view::npos) return std::string_view::npos;
+
+    const auto segment_position = search_begin + anchor_position - segment.anchor_offset;
+    if (segment_matches_at(segment, string, segment_position)) return segment_position;
+    search_begin += anchor_position + 1;
+  }
+
+  return std::string_view::npos;
+}
+
+}  // namespace
+
 namespace opossum {
 
-LikeMatcher::LikeMatcher(const pmr_string& pattern) { _pattern_variant = pattern_string_to_pattern_variant(pattern); }
+LikeMatcher::LikeMatcher(const pmr_string& pattern) : _pattern_variant{pattern_string_to_pattern_variant(pattern)} {}
 
 size_t LikeMatcher::get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset) {
   return pattern.find_first_of("_%", offset);
@@ -116,14 +164,135 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
       expect_any_chars = !expect_any_chars;
     }
 
+    // The pattern also has to end with '%'. Otherwise, e.g., '%hello%world' would match 'hello world!'.
+    if (tokens.empty() || tokens.back() != PatternToken{Wildcard::AnyChars}) {
+      pattern_is_contains_multiple = false;
+    }
+
     if (pattern_is_contains_multiple) {
       return MultipleContainsPattern{strings};
     } else {
-      return std::regex(sql_like_to_regex(pattern));
+      return GeneralPattern{tokens};
     }
   }
 }
 
+LikeMatcher::GeneralPattern::GeneralPattern(const PatternTokens& tokens) {
+  starts_with_any_chars = !tokens.empty() && tokens.front() == PatternToken{Wildcard::AnyChars};
+  ends_with_any_chars = !tokens.empty() && tokens.back() == PatternToken{Wildcard::AnyChars};
+
+  auto characters = pmr_string{};
+  const auto add_segment = [&]() {
+    if (characters.empty()) return;
+
+    auto segment = Segment{characters};
+    auto run_begin = size_t{0};
+    for (auto index = size_t{0}; index <= characters.size(); ++index) {
+      if (index < characters.size() && characters[index] != '_') continue;
+      if (index - run_begin > segment.anchor_length) {
+        segment.anchor_offset = run_begin;
+        segment.anchor_length = index - run_begin;
+      }
+      run_begin = index + 1;
+    }
+
+    min_length += characters.size();
+    segments.emplace_back(std::move(segment));
+    characters.clear();
+  };
+
+  for (const auto& token : tokens) {
+    if (token == PatternToken{Wildcard::AnyChars}) {
+      add_segment();
+    } else if (token == PatternToken{Wildcard::SingleChar}) {
+      characters += '_';
+    } else {
+      characters += std::get<pmr_string>(token);
+    }
+  }
+  add_segment();
+}
+
+bool LikeMatcher::GeneralPattern::matches(const std::string_view& string) const {
+  if (string.size() < min_length) return false;
+
+  // The pattern is empty or consists of '%' only.
+  if (segments.empty()) return starts_with_any_chars || string.empty();
+
+  // Place the segments that are anchored at the beginning and the end of the string, then search for the segments in
+  // between from left to right.
+  auto begin = size_t{0};
+  auto end = string.size();
+  auto first_segment_to_find = size_t{0};
+  auto last_segment_to_find = segments.size();
+
+  if (!starts_with_any_chars) {
+    const auto& prefix = segments.front();
+    if (!segment_matches_at(prefix, string, 0)) return false;
+
+    // Without any '%', the string has to be exactly as long as the pattern.
+    if (!ends_with_any_chars && segments.size() == 1) return string.size() == prefix.characters.size();
+
+    begin = prefix.characters.size();
+    ++first_segment_to_find;
+  }
+
+  if (!ends_with_any_chars) {
+    const auto& suffix = segments.back();
+    if (end - begin < suffix.characters.size()) return false;
+
+    end -= suffix.characters.size();
+    if (!segment_matches_at(suffix, string, end)) return false;
+    --last_segment_to_find;
+  }
+
+  for (auto segment_id = first_segment_to_find; segment_id < last_segment_to_find; ++segment_id) {
+    const auto& segment = segments[segment_id];
+    const auto position = find_segment(segment, string.substr(begin, end - begin));
+    if (position == std::string_view::npos) return false;
+    begin += position + segment.characters.size();
+  }
+
+  return true;
+}
+
+size_t LikeMatcher::find(const std::string_view& haystack, const std::string_view& needle) {
+  const auto needle_size = needle.size();
+  if (needle_size < 2 || haystack.size() < needle_size + FIND_BLOCK_SIZE) return haystack.find(needle);
+
+  const auto* data = haystack.data();
+  const auto first_character = needle.front();
+  const auto last_character = needle.back();
+  const auto candidate_count = haystack.size() - needle_size + 1;
+
+  auto position = size_t{0};
+  for (; position + FIND_BLOCK_SIZE <= candidate_count; position += FIND_BLOCK_SIZE) {
+    const auto* first_characters = data + position;
+    const auto* last_characters = data + position + needle_size - 1;
+    auto mask = uint64_t{0};
+
+    // As in the table scan, the OpenMP pragma makes the compiler try harder to vectorize this loop.
+    // NOLINTNEXTLINE
+    {}  // clang-format off
+    #pragma omp simd reduction(|:mask) safelen(FIND_BLOCK_SIZE)
+    // clang-format on
+    for (auto index = size_t{0}; index < FIND_BLOCK_SIZE; ++index) {
+      mask |= static_cast<uint64_t>((first_characters[index] == first_character) &
+                                    (last_characters[index] == last_character))
+              << index;
+    }
+
+    while (mask != 0) {
+      const auto candidate = position + static_cast<size_t>(__builtin_ctzll(mask));
+      if (std::memcmp(data + candidate + 1, needle.data() + 1, needle_size - 2) == 0) return candidate;
+      mask &= mask - 1;
+    }
+  }
+
+  const auto remainder_position = haystack.substr(position).find(needle);
+  return remainder_position == std::string_view::npos ? std::string_view::npos : position + remainder_position;
+}
+
 std::string LikeMatcher::sql_like_to_regex(pmr_string sql_like) {
   // Do substitution of <backslash> with <backslash><backslash> FIRST, because otherwise it will also replace
   // backslashes introduced by the other substitutions
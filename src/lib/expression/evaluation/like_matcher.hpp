@@ -2,8 +2,8 @@
 
 #include <experimental/functional>
 #include <optional>
-#include <regex>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -17,7 +17,7 @@ namespace opossum {
  * Wraps an SQL LIKE pattern (e.g. "Hello%Wo_ld") which strings can be tested against.
  *
  * Performance optimizations exist for several simple patterns, such as "Hello%" - which is really just a starts_with()
- * check.
+ * check. All other patterns are compiled into a GeneralPattern.
  */
 class LikeMatcher {
   // A faster search algorithm than the typical byte-wise search if we can reuse the searcher
@@ -29,7 +29,8 @@ class LikeMatcher {
 
  public:
   /**
-   * Turn SQL LIKE-pattern into a C++ regex.
+   * Turn SQL LIKE-pattern into a C++ regex. Not used for matching anymore (see GeneralPattern), but still useful for
+   * tools that expect a regex.
    */
   static std::string sql_like_to_regex(pmr_string sql_like);
 
@@ -59,7 +60,7 @@ class LikeMatcher {
 
   /**
    * To speed up LIKE there are special implementations available for simple, common patterns.
-   * Any other pattern will fall back to regex.
+   * Any other pattern is handled by the GeneralPattern.
    */
   // 'hello%'
   struct StartsWithPattern final {
@@ -78,12 +79,48 @@ class LikeMatcher {
     std::vector<pmr_string> strings;
   };
 
+  // Any other pattern, e.g., 'H_llo%W%ld'
+  struct GeneralPattern final {
+    /**
+     * The pattern is compiled into the segments between its '%' wildcards. Each segment has a fixed length and consists
+     * of characters and '_' wildcards. As a segment may be placed anywhere after the previous one, it suffices to find
+     * its leftmost occurrence: this leaves the most room for the following segments. Thus, a string is matched in a
+     * single pass without any backtracking, which is what running a DFA of the pattern comes down to.
+     *
+     * To find the occurrences of a segment, its longest run of characters without '_' (the anchor) is searched for
+     * using a SIMD substring search. Only at the candidate positions, the remaining characters are compared.
+     */
+    struct Segment {
+      // '_' marks the single-character wildcards.
+      pmr_string characters;
+      size_t anchor_offset{0};
+      size_t anchor_length{0};
+    };
+
+    explicit GeneralPattern(const PatternTokens& tokens);
+
+    bool matches(const std::string_view& string) const;
+
+    std::vector<Segment> segments;
+    bool starts_with_any_chars{false};
+    bool ends_with_any_chars{false};
+
+    // Sum of the segment lengths, shorter strings never match.
+    size_t min_length{0};
+  };
+
+  /**
+   * Returns the position of the first occurrence of @param needle in @param haystack or std::string_view::npos. For
+   * longer strings, 64 candidate positions are checked at once by comparing their first and last characters in a
+   * vectorized loop. Full comparisons are only done for the candidates that passed this filter.
+   */
+  static size_t find(const std::string_view& haystack, const std::string_view& needle);
+
   /**
-   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or falls back to std::regex for a
-   * general pattern.
+   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or a GeneralPattern.
    */
   using AllPatternVariant =
-      std::variant<std::regex, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
+      std::variant<GeneralPattern, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
 
   static AllPatternVariant pattern_string_to_pattern_variant(const pmr_string& pattern);
 
@@ -137,11 +174,11 @@ class LikeMatcher {
         return !invert_results;
       });
 
-    } else if (std::holds_alternative<std::regex>(_pattern_variant)) {
-      const auto& regex = std::get<std::regex>(_pattern_variant);
+    } else if (std::holds_alternative<GeneralPattern>(_pattern_variant)) {
+      const auto& general_pattern = std::get<GeneralPattern>(_pattern_variant);
 
       functor([&](const auto& string) -> bool {
-        return std::regex_match(string.cbegin(), string.cend(), regex) ^ invert_results;
+        return general_pattern.matches(std::string_view{string.data(), string.size()}) ^ invert_results;
       });
 
     } else {
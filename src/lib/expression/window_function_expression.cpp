@@ -0,0 +1,230 @@
+#include "window_function_expression.hpp"
+
+#include <sstream>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "aggregate_expression.hpp"
+#include "constant_mappings.hpp"
+#include "expression_utils.hpp"
+#include "operators/aggregate/aggregate_traits.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::vector<std::shared_ptr<AbstractExpression>> concatenate_arguments(
+    const std::shared_ptr<AbstractExpression>& argument,
+    const std::vector<std::shared_ptr<AbstractExpression>>& partition_by_expressions,
+    const std::vector<std::shared_ptr<AbstractExpression>>& order_by_expressions) {
+  auto arguments = std::vector<std::shared_ptr<AbstractExpression>>{};
+  arguments.reserve(1 + partition_by_expressions.size() + order_by_expressions.size());
+  if (argument) arguments.emplace_back(argument);
+  arguments.insert(arguments.end(), partition_by_expressions.begin(), partition_by_expressions.end());
+  arguments.insert(arguments.end(), order_by_expressions.begin(), order_by_expressions.end());
+  return arguments;
+}
+
+FrameDescription default_frame_description(const bool has_order_by) {
+  // With ORDER BY: RANGE BETWEEN UNBOUNDED PRECEDING AND CURRENT ROW. Without: RANGE BETWEEN UNBOUNDED PRECEDING AND
+  // UNBOUNDED FOLLOWING. As all rows of a partition are peers if there is no ORDER BY, both are actually equivalent.
+  auto frame_description = FrameDescription{};
+  if (!has_order_by) frame_description.end = FrameBound{0, FrameBoundType::Following, true};
+  return frame_description;
+}
+
+std::string frame_bound_description(const FrameBound& frame_bound) {
+  if (frame_bound.type == FrameBoundType::CurrentRow) return "CURRENT ROW";
+
+  std::stringstream stream;
+  if (frame_bound.unbounded) {
+    stream << "UNBOUNDED";
+  } else {
+    stream << frame_bound.offset;
+  }
+  stream << (frame_bound.type == FrameBoundType::Preceding ? " PRECEDING" : " FOLLOWING");
+  return stream.str();
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool FrameBound::operator==(const FrameBound& rhs) const {
+  return offset == rhs.offset && type == rhs.type && unbounded == rhs.unbounded;
+}
+
+bool FrameDescription::operator==(const FrameDescription& rhs) const {
+  return type == rhs.type && start == rhs.start && end == rhs.end;
+}
+
+size_t FrameDescription::hash() const {
+  auto hash = boost::hash_value(static_cast<size_t>(type));
+  for (const auto& frame_bound : {start, end}) {
+    boost::hash_combine(hash, frame_bound.offset);
+    boost::hash_combine(hash, static_cast<size_t>(frame_bound.type));
+    boost::hash_combine(hash, frame_bound.unbounded);
+  }
+  return hash;
+}
+
+std::string FrameDescription::description() const {
+  std::stringstream stream;
+  stream << (type == FrameType::Rows ? "ROWS" : "RANGE") << " BETWEEN " << frame_bound_description(start) << " AND "
+         << frame_bound_description(end);
+  return stream.str();
+}
+
+WindowFunctionExpression::WindowFunctionExpression(
+    const WindowFunction init_window_function, const std::shared_ptr<AbstractExpression>& argument,
+    const std::vector<std::shared_ptr<AbstractExpression>>& partition_by_expressions,
+    const std::vector<std::shared_ptr<AbstractExpression>>& order_by_expressions,
+    const std::vector<SortMode>& init_sort_modes, const std::optional<FrameDescription>& init_frame_description)
+    : AbstractExpression(ExpressionType::WindowFunction,
+                         concatenate_arguments(argument, partition_by_expressions, order_by_expressions)),
+      window_function(init_window_function),
+      sort_modes(init_sort_modes),
+      frame_description(init_frame_description ? *init_frame_description
+                                               : default_frame_description(!order_by_expressions.empty())),
+      _has_argument(argument != nullptr),
+      _partition_by_count(partition_by_expressions.size()) {
+  Assert(order_by_expressions.size() == sort_modes.size(), "Expected as many ORDER BY expressions as SortModes");
+
+  if (is_ranking_function(window_function)) {
+    Assert(!argument, "Ranking functions do not take an argument");
+  } else {
+    Assert(argument || window_function == WindowFunction::Count, "Only COUNT can be used without an argument");
+  }
+
+  const auto& start = frame_description.start;
+  const auto& end = frame_description.end;
+  Assert(!(start.unbounded && start.type == FrameBoundType::Following), "Frame cannot start at UNBOUNDED FOLLOWING");
+  Assert(!(end.unbounded && end.type == FrameBoundType::Preceding), "Frame cannot end at UNBOUNDED PRECEDING");
+  if (frame_description.type == FrameType::Range) {
+    Assert((start.unbounded || start.type == FrameBoundType::CurrentRow) &&
+               (end.unbounded || end.type == FrameBoundType::CurrentRow),
+           "RANGE frames with offsets are not supported");
+  }
+}
+
+std::shared_ptr<AbstractExpression> WindowFunctionExpression::argument() const {
+  return _has_argument ? arguments[0] : nullptr;
+}
+
+std::vector<std::shared_ptr<AbstractExpression>> WindowFunctionExpression::partition_by_expressions() const {
+  const auto begin = arguments.begin() + (_has_argument ? 1 : 0);
+  return {begin, begin + _partition_by_count};
+}
+
+std::vector<std::shared_ptr<AbstractExpression>> WindowFunctionExpression::order_by_expressions() const {
+  return {arguments.begin() + (_has_argument ? 1 : 0) + _partition_by_count, arguments.end()};
+}
+
+std::shared_ptr<AbstractExpression> WindowFunctionExpression::_on_deep_copy(
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+  const auto argument = this->argument();
+  return std::make_shared<WindowFunctionExpression>(
+      window_function, argument ? argument->deep_copy(copied_ops) : nullptr,
+      expressions_deep_copy(partition_by_expressions(), copied_ops),
+      expressions_deep_copy(order_by_expressions(), copied_ops), sort_modes, frame_description);
+}
+
+std::string WindowFunctionExpression::description(const DescriptionMode mode) const {
+  std::stringstream stream;
+
+  stream << window_function << "(";
+  if (_has_argument) {
+    stream << argument()->description(mode);
+  } else if (window_function == WindowFunction::Count) {
+    stream << "*";
+  }
+  stream << ") OVER (";
+
+  const auto partition_by_expressions = this->partition_by_expressions();
+  if (!partition_by_expressions.empty()) {
+    stream << "PARTITION BY " << expression_descriptions(partition_by_expressions, mode) << " ";
+  }
+
+  const auto order_by_expressions = this->order_by_expressions();
+  if (!order_by_expressions.empty()) {
+    stream << "ORDER BY ";
+    for (auto expression_idx = size_t{0}; expression_idx < order_by_expressions.size(); ++expression_idx) {
+      stream << order_by_expressions[expression_idx]->description(mode);
+      stream << (sort_modes[expression_idx] == SortMode::Ascending ? " ASC" : " DESC");
+      if (expression_idx + 1 < order_by_expressions.size()) stream << ", ";
+    }
+    stream << " ";
+  }
+
+  stream << frame_description.description() << ")";
+  return stream.str();
+}
+
+DataType WindowFunctionExpression::data_type() const {
+  if (is_ranking_function(window_function) || window_function == WindowFunction::Count) {
+    return AggregateTraits<NullValue, AggregateFunction::Count>::AGGREGATE_DATA_TYPE;
+  }
+
+  auto window_function_data_type = DataType::Null;
+
+  resolve_data_type(argument()->data_type(), [&](const auto data_type_t) {
+    using ArgumentDataType = typename decltype(data_type_t)::type;
+    switch (window_function) {
+      case WindowFunction::Min:
+        window_function_data_type = AggregateTraits<ArgumentDataType, AggregateFunction::Min>::AGGREGATE_DATA_TYPE;
+        break;
+      case WindowFunction::Max:
+        window_function_data_type = AggregateTraits<ArgumentDataType, AggregateFunction::Max>::AGGREGATE_DATA_TYPE;
+        break;
+      case WindowFunction::Sum:
+        window_function_data_type = AggregateTraits<ArgumentDataType, AggregateFunction::Sum>::AGGREGATE_DATA_TYPE;
+        break;
+      case WindowFunction::Avg:
+        window_function_data_type = AggregateTraits<ArgumentDataType, AggregateFunction::Avg>::AGGREGATE_DATA_TYPE;
+        break;
+      case WindowFunction::RowNumber:
+      case WindowFunction::Rank:
+      case WindowFunction::DenseRank:
+      case WindowFunction::Count:
+        break;  // These are handled above
+    }
+  });
+
+  return window_function_data_type;
+}
+
+bool WindowFunctionExpression::is_ranking_function(const WindowFunction window_function) {
+  return window_function == WindowFunction::RowNumber || window_function == WindowFunction::Rank ||
+         window_function == WindowFunction::DenseRank;
+}
+
+bool WindowFunctionExpression::_shallow_equals(const AbstractExpression& expression) const {
+  DebugAssert(dynamic_cast<const WindowFunctionExpression*>(&expression),
+              "Different expression type should have been caught by AbstractExpression::operator==");
+  const auto& window_function_expression = static_cast<const WindowFunctionExpression&>(expression);
+  return window_function == window_function_expression.window_function &&
+         sort_modes == window_function_expression.sort_modes &&
+         frame_description == window_function_expression.frame_description &&
+         _has_argument == window_function_expression._has_argument &&
+         _partition_by_count == window_function_expression._partition_by_count;
+}
+
+size_t WindowFunctionExpression::_shallow_hash() const {
+  auto hash = boost::hash_value(static_cast<size_t>(window_function));
+  for (const auto sort_mode : sort_modes) {
+    boost::hash_combine(hash, static_cast<size_t>(sort_mode));
+  }
+  boost::hash_combine(hash, frame_description.hash());
+  boost::hash_combine(hash, _has_argument);
+  boost::hash_combine(hash, _partition_by_count);
+  return hash;
+}
+
+bool WindowFunctionExpression::_on_is_nullable_on_lqp(const AbstractLQPNode& lqp) const {
+  // Like aggregates, MIN, MAX, SUM, and AVG return NULL for frames without non-NULL values.
+  return !is_ranking_function(window_function) && window_function != WindowFunction::Count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Supported window functions. The ranking functions (ROW_NUMBER(), RANK(), DENSE_RANK()) take no argument and ignore
+ * the frame. The aggregate functions are evaluated over the frame of each row. COUNT without an argument is COUNT(*).
+ */
+enum class WindowFunction { RowNumber, Rank, DenseRank, Min, Max, Sum, Avg, Count };
+
+enum class FrameType { Rows, Range };
+
+enum class FrameBoundType { Preceding, CurrentRow, Following };
+
+/**
+ * A frame bound is either `UNBOUNDED PRECEDING/FOLLOWING`, `<offset> PRECEDING/FOLLOWING`, or `CURRENT ROW`. For
+ * RANGE frames, only unbounded bounds and CURRENT ROW are supported, where CURRENT ROW includes all peers of the
+ * current row (i.e., rows with the same ORDER BY values).
+ */
+struct FrameBound {
+  uint64_t offset{0};
+  FrameBoundType type{FrameBoundType::CurrentRow};
+  bool unbounded{false};
+
+  bool operator==(const FrameBound& rhs) const;
+};
+
+struct FrameDescription {
+  FrameType type{FrameType::Range};
+  FrameBound start{0, FrameBoundType::Preceding, true};
+  FrameBound end{0, FrameBoundType::CurrentRow, false};
+
+  bool operator==(const FrameDescription& rhs) const;
+  size_t hash() const;
+  std::string description() const;
+};
+
+/**
+ * A window function, e.g., `SUM(a) OVER (PARTITION BY b ORDER BY c ROWS BETWEEN 2 PRECEDING AND CURRENT ROW)`.
+ * Unlike an AggregateExpression, it does not reduce the rows of a partition to a single row but produces one value for
+ * every input row. Window functions are computed by the Window operator (see WindowNode).
+ *
+ * The argument, the PARTITION BY expressions, and the ORDER BY expressions are stored (in this order) as the
+ * expression's arguments so that they are visible to the generic expression utilities.
+ *
+ * If no frame is given, the SQL default is used: With an ORDER BY clause, the frame reaches from the start of the
+ * partition up to the last peer of the current row. Without one, the frame is the entire partition.
+ */
+class WindowFunctionExpression : public AbstractExpression {
+ public:
+  WindowFunctionExpression(const WindowFunction init_window_function,
+                           const std::shared_ptr<AbstractExpression>& argument,
+                           const std::vector<std::shared_ptr<AbstractExpression>>& partition_by_expressions,
+                           const std::vector<std::shared_ptr<AbstractExpression>>& order_by_expressions,
+                           const std::vector<SortMode>& init_sort_modes,
+                           const std::optional<FrameDescription>& init_frame_description = std::nullopt);
+
+  // nullptr for the ranking functions and COUNT(*)
+  std::shared_ptr<AbstractExpression> argument() const;
+  std::vector<std::shared_ptr<AbstractExpression>> partition_by_expressions() const;
+  std::vector<std::shared_ptr<AbstractExpression>> order_by_expressions() const;
+
+  std::shared_ptr<AbstractExpression> _on_deep_copy(
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const override;
+  std::string description(const DescriptionMode mode) const override;
+  DataType data_type() const override;
+
+  static bool is_ranking_function(const WindowFunction window_function);
+
+  const WindowFunction window_function;
+  const std::vector<SortMode> sort_modes;
+  const FrameDescription frame_description;
+
+ protected:
+  bool _shallow_equals(const AbstractExpression& expression) const override;
+  size_t _shallow_hash() const override;
+  bool _on_is_nullable_on_lqp(const AbstractLQPNode& lqp) const override;
+
+ private:
+  const bool _has_argument;
+  const size_t _partition_by_count;
+};
+
+}  // namespace opossum
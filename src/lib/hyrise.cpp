@@ -16,10 +16,12 @@ Hyrise::Hyrise() {
   storage_manager = StorageManager{};
   plugin_manager = PluginManager{};
   transaction_manager = TransactionManager{};
+  redo_log = RedoLog{};
   meta_table_manager = MetaTableManager{};
   settings_manager = SettingsManager{};
   log_manager = LogManager{};
   topology = Topology{};
+  garbage_collector = GarbageCollector{};
   _scheduler = std::make_shared<ImmediateExecutionScheduler>();
 }
 
@@ -2,6 +2,9 @@
 
 #include <boost/container/pmr/memory_resource.hpp>
 
+#include "cache/result_cache.hpp"
+#include "concurrency/garbage_collector.hpp"
+#include "concurrency/redo_log.hpp"
 #include "concurrency/transaction_manager.hpp"
 #include "scheduler/immediate_execution_scheduler.hpp"
 #include "scheduler/topology.hpp"
@@ -43,16 +46,24 @@ class Hyrise : public Singleton<Hyrise> {
   StorageManager storage_manager;
   PluginManager plugin_manager;
   TransactionManager transaction_manager;
+  RedoLog redo_log;
   MetaTableManager meta_table_manager;
   SettingsManager settings_manager;
   LogManager log_manager;
   Topology topology;
+  // Not started by default (see GarbageCollector). Declared last so that its background thread, which accesses most
+  // of the above, is stopped first.
+  GarbageCollector garbage_collector;
 
   // Plan caches used by the SQLPipelineBuilder if `with_{l/p}qp_cache()` are not used. Both default caches can be
   // nullptr themselves. If both default_{l/p}qp_cache and _{l/p}qp_cache are nullptr, no plan caching is used.
   std::shared_ptr<SQLPhysicalPlanCache> default_pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> default_lqp_cache;
 
+  // Result cache used by the SQLPipelineBuilder if `with_result_cache()` is not used. Results are only cached if this
+  // is set (it is nullptr by default).
+  std::shared_ptr<ResultCache> default_result_cache;
+
   // The BenchmarkRunner is available here so that non-benchmark components can add information to the benchmark
   // result JSON.
   std::weak_ptr<BenchmarkRunner> benchmark_runner;
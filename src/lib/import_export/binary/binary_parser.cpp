@@ -1,15 +1,19 @@
 #include "binary_parser.hpp"
 
+#include <array>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <memory>
 #include <numeric>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 
 #include "constant_mappings.hpp"
 #include "hyrise.hpp"
+#include "import_export/binary/binary_writer.hpp"
 #include "resolve_type.hpp"
 #include "storage/chunk.hpp"
 #include "storage/encoding_type.hpp"
@@ -17,13 +21,111 @@
 #include "storage/vector_compression/fixed_width_integer/fixed_width_integer_vector.hpp"
 
 #include "utils/assert.hpp"
+#include "utils/memory_mapped_file.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Hands out a range of a memory-mapped file as the memory of a single allocation, so that a compact_vector can be
+// created on top of the mapped values without copying them. Deallocating is a no-op. The vector must not be written.
+class MappedRangeResource : public boost::container::pmr::memory_resource {
+ public:
+  MappedRangeResource(std::shared_ptr<const MemoryMappedFile> mapped_file, const char* data)
+      : _mapped_file{std::move(mapped_file)}, _data{data} {}
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    Assert(!_is_allocated, "MappedRangeResource can only serve a single allocation");
+    Assert(reinterpret_cast<uintptr_t>(_data) % alignment == 0, "Mapped range is not aligned");
+    _is_allocated = true;
+    return const_cast<char*>(_data);  // NOLINT
+  }
+
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override {}
+
+  bool do_is_equal(const memory_resource& other) const noexcept override { return &other == this; }
+
+ private:
+  const std::shared_ptr<const MemoryMappedFile> _mapped_file;
+  const char* const _data;
+  bool _is_allocated{false};
+};
+
+}  // namespace
 
 namespace opossum {
 
-std::shared_ptr<Table> BinaryParser::parse(const std::string& filename) {
-  std::ifstream file;
-  file.open(filename, std::ios::binary);
-  file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+class BinaryParser::Input : private Noncopyable {
+ public:
+  Input(const std::string& filename, const BinaryParserMode mode) {
+    if (mode == BinaryParserMode::MemoryMapped) {
+      // Segments keep referencing the mapping after parsing, so no access pattern is assumed.
+      _mapped_file = std::make_shared<const MemoryMappedFile>(filename);
+      _mapped_data = _mapped_file->view();
+
+      // Empty files cannot be mapped. As they are invalid anyway, they are left to the stream, which reports the error.
+      if (!_mapped_data.empty()) return;
+      _mapped_file.reset();
+    }
+
+    _file.open(filename, std::ios::binary);
+    _file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+  }
+
+  void read(char* destination, const size_t size) {
+    if (!_mapped_file) {
+      _file.read(destination, static_cast<std::streamsize>(size));
+      _position += size;
+      return;
+    }
+
+    std::memcpy(destination, consume(size), size);
+  }
+
+  // Returns a pointer to the next `size` bytes and skips them. Only supported for memory-mapped files, returns nullptr
+  // otherwise.
+  const char* consume(const size_t size) {
+    if (!_mapped_file) return nullptr;
+
+    Assert(size <= _mapped_data.size(), "Unexpected end of binary file");
+    const auto* const data = _mapped_data.data();
+    _mapped_data.remove_prefix(size);
+    _position += size;
+    return data;
+  }
+
+  // Skips the padding that the BinaryWriter inserts in front of buffers of values of type T. Afterwards, the values
+  // can be referenced in place if the file is memory-mapped, as the mapping starts at a page boundary.
+  template <typename T>
+  void skip_padding() {
+    auto padding = std::array<char, alignof(T)>{};
+    read(padding.data(), (alignof(T) - _position % alignof(T)) % alignof(T));
+  }
+
+  // Like consume, but skips the padding first and returns the values of type T.
+  template <typename T>
+  const T* consume_values(const size_t count) {
+    skip_padding<T>();
+    const auto* const values = reinterpret_cast<const T*>(consume(count * sizeof(T)));
+    DebugAssert(reinterpret_cast<uintptr_t>(values) % alignof(T) == 0, "Mapped values are not aligned");
+    return values;
+  }
+
+  const std::shared_ptr<const MemoryMappedFile>& mapped_file() const { return _mapped_file; }
+
+ private:
+  std::ifstream _file;
+
+  std::shared_ptr<const MemoryMappedFile> _mapped_file;
+  std::string_view _mapped_data;
+
+  // Number of bytes read so far.
+  size_t _position{0};
+};
+
+std::shared_ptr<Table> BinaryParser::parse(const std::string& filename, const BinaryParserMode mode) {
+  auto file = Input{filename, mode};
 
   auto [table, chunk_count] = _read_header(file);
   for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
@@ -34,15 +136,12 @@ std::shared_ptr<Table> BinaryParser::parse(const std::string& filename) {
 }
 
 template <typename T>
-pmr_compact_vector BinaryParser::_read_values_compact_vector(std::ifstream& file, const size_t count) {
-  const auto bit_width = _read_value<uint8_t>(file);
-  auto values = pmr_compact_vector(bit_width, count);
-  file.read(reinterpret_cast<char*>(values.get()), values.bytes());
-  return values;
-}
+pmr_vector<T> BinaryParser::_read_values(Input& file, const size_t count) {
+  // For memory-mapped files, the values are copied from the mapping without initializing the vector first.
+  if (const auto* const mapped_values = file.consume_values<T>(count)) {
+    return pmr_vector<T>(mapped_values, mapped_values + count);
+  }
 
-template <typename T>
-pmr_vector<T> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
   pmr_vector<T> values(count);
   file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
   return values;
@@ -50,28 +149,40 @@ pmr_vector<T> BinaryParser::_read_values(std::ifstream& file, const size_t count
 
 // specialized implementation for string values
 template <>
-pmr_vector<pmr_string> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<pmr_string> BinaryParser::_read_values(Input& file, const size_t count) {
   return _read_string_values(file, count);
 }
 
 // specialized implementation for bool values
 template <>
-pmr_vector<bool> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<bool> BinaryParser::_read_values(Input& file, const size_t count) {
+  static_assert(sizeof(BoolAsByteType) == 1, "Mapped bools are expected to be stored as single bytes");
+  if (const auto* const mapped_bools = reinterpret_cast<const BoolAsByteType*>(file.consume(count))) {
+    return pmr_vector<bool>(mapped_bools, mapped_bools + count);
+  }
+
   pmr_vector<BoolAsByteType> readable_bools(count);
   file.read(reinterpret_cast<char*>(readable_bools.data()), readable_bools.size() * sizeof(BoolAsByteType));
   return pmr_vector<bool>(readable_bools.begin(), readable_bools.end());
 }
 
-pmr_vector<pmr_string> BinaryParser::_read_string_values(std::ifstream& file, const size_t count) {
+pmr_vector<pmr_string> BinaryParser::_read_string_values(Input& file, const size_t count) {
   const auto string_lengths = _read_values<size_t>(file, count);
   const auto total_length = std::accumulate(string_lengths.cbegin(), string_lengths.cend(), static_cast<size_t>(0));
-  const auto buffer = _read_values<char>(file, total_length);
+
+  // For memory-mapped files, the strings are created directly from the mapping.
+  auto buffer = pmr_vector<char>{};
+  const auto* characters = file.consume(total_length);
+  if (!characters) {
+    buffer = _read_values<char>(file, total_length);
+    characters = buffer.data();
+  }
 
   pmr_vector<pmr_string> values(count);
   size_t start = 0;
 
   for (size_t i = 0; i < count; ++i) {
-    values[i] = pmr_string(buffer.data() + start, buffer.data() + start + string_lengths[i]);
+    values[i] = pmr_string(characters + start, characters + start + string_lengths[i]);
     start += string_lengths[i];
   }
 
@@ -79,13 +190,17 @@ pmr_vector<pmr_string> BinaryParser::_read_string_values(std::ifstream& file, co
 }
 
 template <typename T>
-T BinaryParser::_read_value(std::ifstream& file) {
+T BinaryParser::_read_value(Input& file) {
   T result;
   file.read(reinterpret_cast<char*>(&result), sizeof(T));
   return result;
 }
 
-std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::ifstream& file) {
+std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(Input& file) {
+  const auto format_version = _read_value<uint32_t>(file);
+  Assert(format_version == BinaryWriter::FORMAT_VERSION,
+         "Unsupported binary file format version " + std::to_string(format_version) + ", the file has to be re-created");
+
   const auto chunk_size = _read_value<ChunkOffset>(file);
   const auto chunk_count = _read_value<ChunkID>(file);
   const auto column_count = _read_value<ColumnID>(file);
@@ -105,7 +220,7 @@ std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::ifstr
   return std::make_pair(table, chunk_count);
 }
 
-void BinaryParser::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& table) {
+void BinaryParser::_import_chunk(Input& file, std::shared_ptr<Table>& table) {
   const auto row_count = _read_value<ChunkOffset>(file);
 
   // Import sort column definitions
@@ -129,7 +244,7 @@ void BinaryParser::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& ta
   if (num_sorted_columns > 0) table->last_chunk()->set_individually_sorted_by(sorted_columns);
 }
 
-std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(Input& file, ChunkOffset row_count,
                                                                DataType data_type, bool column_is_nullable) {
   std::shared_ptr<AbstractSegment> result;
   resolve_data_type(data_type, [&](auto type) {
@@ -141,7 +256,7 @@ std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& fi
 }
 
 template <typename ColumnDataType>
-std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(Input& file, ChunkOffset row_count,
                                                                bool column_is_nullable) {
   const auto column_type = _read_value<EncodingType>(file);
 
@@ -168,13 +283,20 @@ std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& fi
       }
     case EncodingType::LZ4:
       return _import_lz4_segment<ColumnDataType>(file, row_count);
+    case EncodingType::FSST:
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FSST>,
+                                                hana::type_c<ColumnDataType>)) {
+        return _import_fsst_segment(file, row_count);
+      } else {
+        Fail("Unsupported data type for FSST encoding");
+      }
   }
 
   Fail("Invalid EncodingType");
 }
 
 template <typename T>
-std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(Input& file, ChunkOffset row_count,
                                                                      bool column_is_nullable) {
   if (column_is_nullable) {
     const auto segment_is_nullable = _read_value<bool>(file);
@@ -190,8 +312,7 @@ std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::ifstre
 }
 
 template <typename T>
-std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(std::ifstream& file,
-                                                                               ChunkOffset row_count) {
+std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(Input& file, ChunkOffset row_count) {
   const auto compressed_vector_type_id = _read_value<CompressedVectorTypeID>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
   auto dictionary = std::make_shared<pmr_vector<T>>(_read_values<T>(file, dictionary_size));
@@ -202,7 +323,7 @@ std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(s
 }
 
 std::shared_ptr<FixedStringDictionarySegment<pmr_string>> BinaryParser::_import_fixed_string_dictionary_segment(
-    std::ifstream& file, ChunkOffset row_count) {
+    Input& file, ChunkOffset row_count) {
   const auto compressed_vector_type_id = _read_value<CompressedVectorTypeID>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
   auto dictionary = _import_fixed_string_vector(file, dictionary_size);
@@ -212,8 +333,7 @@ std::shared_ptr<FixedStringDictionarySegment<pmr_string>> BinaryParser::_import_
 }
 
 template <typename T>
-std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(std::ifstream& file,
-                                                                              ChunkOffset row_count) {
+std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(Input& file, ChunkOffset row_count) {
   const auto size = _read_value<uint32_t>(file);
   const auto values = std::make_shared<pmr_vector<T>>(_read_values<T>(file, size));
   const auto null_values = std::make_shared<pmr_vector<bool>>(_read_values<bool>(file, size));
@@ -223,7 +343,7 @@ std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(st
 }
 
 template <typename T>
-std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_reference_segment(std::ifstream& file,
+std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_reference_segment(Input& file,
                                                                                              ChunkOffset row_count) {
   const auto compressed_vector_type_id = _read_value<CompressedVectorTypeID>(file);
   const auto block_count = _read_value<uint32_t>(file);
@@ -241,7 +361,7 @@ std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_refer
 }
 
 template <typename T>
-std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream& file, ChunkOffset row_count) {
+std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(Input& file, ChunkOffset row_count) {
   const auto num_elements = _read_value<uint32_t>(file);
   const auto block_count = _read_value<uint32_t>(file);
   const auto block_size = _read_value<uint32_t>(file);
@@ -270,7 +390,7 @@ std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream&
   const auto string_offsets_size = _read_value<uint32_t>(file);
 
   if (string_offsets_size > 0) {
-    auto string_offsets = std::make_unique<BitPackingVector>(_read_values_compact_vector<uint32_t>(file, row_count));
+    auto string_offsets = _import_bitpacking_vector(file, row_count);
     return std::make_shared<LZ4Segment<T>>(std::move(lz4_blocks), std::move(null_values), std::move(dictionary),
                                            std::move(string_offsets), block_size, last_block_size, compressed_size,
                                            num_elements);
@@ -285,43 +405,89 @@ std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream&
   }
 }
 
-std::shared_ptr<BaseCompressedVector> BinaryParser::_import_attribute_vector(
-    std::ifstream& file, const ChunkOffset row_count, const CompressedVectorTypeID compressed_vector_type_id) {
-  const auto compressed_vector_type = static_cast<CompressedVectorType>(compressed_vector_type_id);
-  switch (compressed_vector_type) {
-    case CompressedVectorType::BitPacking:
-      return std::make_shared<BitPackingVector>(_read_values_compact_vector<uint32_t>(file, row_count));
-    case CompressedVectorType::FixedWidthInteger1Byte:
-      return std::make_shared<FixedWidthIntegerVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
-    case CompressedVectorType::FixedWidthInteger2Byte:
-      return std::make_shared<FixedWidthIntegerVector<uint16_t>>(_read_values<uint16_t>(file, row_count));
-    case CompressedVectorType::FixedWidthInteger4Byte:
-      return std::make_shared<FixedWidthIntegerVector<uint32_t>>(_read_values<uint32_t>(file, row_count));
-    default:
-      Fail("Cannot import attribute vector with compressed vector type id: " +
-           std::to_string(compressed_vector_type_id));
+std::shared_ptr<FSSTSegment<pmr_string>> BinaryParser::_import_fsst_segment(Input& file, ChunkOffset row_count) {
+  const auto compressed_vector_type_id = _read_value<CompressedVectorTypeID>(file);
+
+  const auto symbol_count = _read_value<uint32_t>(file);
+  auto symbols = _read_values<uint64_t>(file, symbol_count);
+  auto symbol_lengths = _read_values<uint8_t>(file, symbol_count);
+  auto symbol_table = FSSTSymbolTable{std::move(symbols), std::move(symbol_lengths)};
+
+  const auto compressed_values_size = _read_value<uint32_t>(file);
+  auto compressed_values = _read_values<uint8_t>(file, compressed_values_size);
+
+  const auto null_values_stored = _read_value<BoolAsByteType>(file);
+  std::optional<pmr_vector<bool>> null_values;
+  if (null_values_stored) {
+    null_values = pmr_vector<bool>(_read_values<bool>(file, row_count));
   }
+
+  // The offsets vector holds one additional entry for the end of the last value.
+  auto offsets = _import_offset_value_vector(file, row_count + 1, compressed_vector_type_id);
+
+  return std::make_shared<FSSTSegment<pmr_string>>(std::move(symbol_table), std::move(compressed_values),
+                                                   std::move(offsets), std::move(null_values));
+}
+
+std::shared_ptr<BaseCompressedVector> BinaryParser::_import_attribute_vector(
+    Input& file, const ChunkOffset row_count, const CompressedVectorTypeID compressed_vector_type_id) {
+  return _import_compressed_vector(file, row_count, compressed_vector_type_id);
 }
 
 std::unique_ptr<const BaseCompressedVector> BinaryParser::_import_offset_value_vector(
-    std::ifstream& file, const ChunkOffset row_count, const CompressedVectorTypeID compressed_vector_type_id) {
+    Input& file, const ChunkOffset row_count, const CompressedVectorTypeID compressed_vector_type_id) {
+  return _import_compressed_vector(file, row_count, compressed_vector_type_id);
+}
+
+std::unique_ptr<BaseCompressedVector> BinaryParser::_import_compressed_vector(
+    Input& file, const ChunkOffset row_count, const CompressedVectorTypeID compressed_vector_type_id) {
   const auto compressed_vector_type = static_cast<CompressedVectorType>(compressed_vector_type_id);
   switch (compressed_vector_type) {
     case CompressedVectorType::BitPacking:
-      return std::make_unique<BitPackingVector>(_read_values_compact_vector<uint32_t>(file, row_count));
+      return _import_bitpacking_vector(file, row_count);
     case CompressedVectorType::FixedWidthInteger1Byte:
-      return std::make_unique<FixedWidthIntegerVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
+      return _import_fixed_width_integer_vector<uint8_t>(file, row_count);
     case CompressedVectorType::FixedWidthInteger2Byte:
-      return std::make_unique<FixedWidthIntegerVector<uint16_t>>(_read_values<uint16_t>(file, row_count));
+      return _import_fixed_width_integer_vector<uint16_t>(file, row_count);
     case CompressedVectorType::FixedWidthInteger4Byte:
-      return std::make_unique<FixedWidthIntegerVector<uint32_t>>(_read_values<uint32_t>(file, row_count));
+      return _import_fixed_width_integer_vector<uint32_t>(file, row_count);
     default:
       Fail("Cannot import attribute vector with compressed vector type id: " +
            std::to_string(compressed_vector_type_id));
   }
 }
 
-std::shared_ptr<FixedStringVector> BinaryParser::_import_fixed_string_vector(std::ifstream& file, const size_t count) {
+template <typename T>
+std::unique_ptr<FixedWidthIntegerVector<T>> BinaryParser::_import_fixed_width_integer_vector(Input& file,
+                                                                                             const size_t count) {
+  if (const auto* const values = file.consume_values<T>(count)) {
+    return std::make_unique<FixedWidthIntegerVector<T>>(values, count, file.mapped_file());
+  }
+
+  return std::make_unique<FixedWidthIntegerVector<T>>(_read_values<T>(file, count));
+}
+
+std::unique_ptr<BitPackingVector> BinaryParser::_import_bitpacking_vector(Input& file, const size_t count) {
+  const auto bit_width = _read_value<uint8_t>(file);
+
+  using Word = std::remove_reference_t<decltype(*std::declval<pmr_compact_vector>().get())>;
+  file.skip_padding<Word>();
+  // Consuming zero bytes returns the current position in the mapping.
+  if (const auto* const position = file.consume(0)) {
+    // The compact_vector does not initialize the memory it allocates, so it can be placed on top of the mapped values.
+    const auto resource = std::make_shared<MappedRangeResource>(file.mapped_file(), position);
+    auto values = pmr_compact_vector(bit_width, count, PolymorphicAllocator<Word>{resource.get()});
+    Assert(values.get() == reinterpret_cast<const Word*>(file.consume(values.bytes())),
+           "compact_vector was not allocated from the mapped file");
+    return std::make_unique<BitPackingVector>(std::move(values), resource);
+  }
+
+  auto values = pmr_compact_vector(bit_width, count);
+  file.read(reinterpret_cast<char*>(values.get()), values.bytes());
+  return std::make_unique<BitPackingVector>(std::move(values));
+}
+
+std::shared_ptr<FixedStringVector> BinaryParser::_import_fixed_string_vector(Input& file, const size_t count) {
   const auto string_length = _read_value<uint32_t>(file);
   pmr_vector<char> values(string_length * count);
   file.read(values.data(), values.size());
@@ -12,14 +12,26 @@
 #include "storage/encoding_type.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/run_length_segment.hpp"
 #include "storage/table.hpp"
 #include "storage/value_segment.hpp"
-#include "storage/vector_compression/bitpacking/bitpacking_vector_type.hpp"
+#include "storage/vector_compression/bitpacking/bitpacking_vector.hpp"
+#include "storage/vector_compression/fixed_width_integer/fixed_width_integer_vector.hpp"
 
 namespace opossum {
 
+// Stream reads the file through a std::ifstream. MemoryMapped maps the file into memory. The attribute vectors of
+// dictionary segments and the offset vectors of FOR, LZ4, and FSST segments (i.e., FixedWidthIntegerVectors and
+// BitPackingVectors) reference the mapped file instead of copying it, so that their pages are only loaded when they are
+// accessed and can be dropped by the kernel under memory pressure. The mapping is kept alive by these vectors. The
+// values of ValueSegments, dictionaries, and all other segment data are still copied, as they are stored in pmr_vectors
+// that own their memory (and initialize it on construction). They are copied straight from the mapping, though, which
+// avoids a system call per read as well as intermediate buffers. As with any mapping, the file must not be truncated or
+// overwritten in place while the table is in use (replacing or removing it is fine).
+enum class BinaryParserMode { Stream, MemoryMapped };
+
 /*
  * This parser reads an Opossum binary file and creates a table from that input.
  * Documentation of the file formats can be found in BinaryWriter header file.
@@ -37,15 +49,19 @@ class BinaryParser {
    *
    * ¹ Zero or more chunks
    */
-  static std::shared_ptr<Table> parse(const std::string& filename);
+  static std::shared_ptr<Table> parse(const std::string& filename,
+                                      const BinaryParserMode mode = BinaryParserMode::Stream);
 
  private:
+  // Wraps the input file, either as a std::ifstream or as a read-only memory mapping (see BinaryParserMode).
+  class Input;
+
   /*
    * Reads the header from the given file.
    * Creates an empty table from the extracted information and
    * returns that table and the number of chunks.
    */
-  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(std::ifstream& file);
+  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(Input& file);
 
   /*
    * Creates a chunk from chunk information from the given file and adds it to the given table.
@@ -59,58 +75,65 @@ class BinaryParser {
    *
    * ¹Number of columns is provided in the binary header
    */
-  static void _import_chunk(std::ifstream& file, std::shared_ptr<Table>& table);
+  static void _import_chunk(Input& file, std::shared_ptr<Table>& table);
 
   // Calls the right _import_column<ColumnDataType> depending on the given data_type.
-  static std::shared_ptr<AbstractSegment> _import_segment(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<AbstractSegment> _import_segment(Input& file, ChunkOffset row_count,
                                                           DataType data_type, bool column_is_nullable);
 
   template <typename ColumnDataType>
   // Reads the column type from the given file and chooses a segment import function from it.
-  static std::shared_ptr<AbstractSegment> _import_segment(std::ifstream& file, ChunkOffset row_count,
-                                                          bool column_is_nullable);
+  static std::shared_ptr<AbstractSegment> _import_segment(Input& file, ChunkOffset row_count, bool column_is_nullable);
 
   template <typename T>
-  static std::shared_ptr<ValueSegment<T>> _import_value_segment(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<ValueSegment<T>> _import_value_segment(Input& file, ChunkOffset row_count,
                                                                 bool column_is_nullable);
   template <typename T>
-  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(Input& file, ChunkOffset row_count);
 
   static std::shared_ptr<FixedStringDictionarySegment<pmr_string>> _import_fixed_string_dictionary_segment(
-      std::ifstream& file, ChunkOffset row_count);
+      Input& file, ChunkOffset row_count);
 
   template <typename T>
-  static std::shared_ptr<RunLengthSegment<T>> _import_run_length_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<RunLengthSegment<T>> _import_run_length_segment(Input& file, ChunkOffset row_count);
 
   template <typename T>
-  static std::shared_ptr<FrameOfReferenceSegment<T>> _import_frame_of_reference_segment(std::ifstream& file,
+  static std::shared_ptr<FrameOfReferenceSegment<T>> _import_frame_of_reference_segment(Input& file,
                                                                                         ChunkOffset row_count);
   template <typename T>
-  static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(Input& file, ChunkOffset row_count);
+
+  static std::shared_ptr<FSSTSegment<pmr_string>> _import_fsst_segment(Input& file, ChunkOffset row_count);
 
   // Calls the _import_attribute_vector<uintX_t> function that corresponds to the given compressed_vector_type_id.
   static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(
-      std::ifstream& file, ChunkOffset row_count, CompressedVectorTypeID compressed_vector_type_id);
+      Input& file, ChunkOffset row_count, CompressedVectorTypeID compressed_vector_type_id);
 
   static std::unique_ptr<const BaseCompressedVector> _import_offset_value_vector(
-      std::ifstream& file, ChunkOffset row_count, CompressedVectorTypeID compressed_vector_type_id);
+      Input& file, ChunkOffset row_count, CompressedVectorTypeID compressed_vector_type_id);
+
+  static std::unique_ptr<BaseCompressedVector> _import_compressed_vector(
+      Input& file, ChunkOffset row_count, CompressedVectorTypeID compressed_vector_type_id);
 
-  static std::shared_ptr<FixedStringVector> _import_fixed_string_vector(std::ifstream& file, const size_t count);
+  static std::shared_ptr<FixedStringVector> _import_fixed_string_vector(Input& file, const size_t count);
 
-  // Reads row_count many values from type T and returns them in a vector
+  // For memory-mapped files, both vector types reference the mapped values (see BinaryParserMode), which the
+  // BinaryWriter aligns in the file. Otherwise, the values are copied.
   template <typename T>
-  static pmr_vector<T> _read_values(std::ifstream& file, const size_t count);
+  static std::unique_ptr<FixedWidthIntegerVector<T>> _import_fixed_width_integer_vector(Input& file,
+                                                                                       const size_t count);
+  static std::unique_ptr<BitPackingVector> _import_bitpacking_vector(Input& file, const size_t count);
 
-  // Reads bit width and row_count many values and returns them in a bitpacked compact_vector of type T
+  // Reads row_count many values from type T (skipping the padding in front of them) and returns them in a vector
   template <typename T>
-  static pmr_compact_vector _read_values_compact_vector(std::ifstream& file, const size_t count);
+  static pmr_vector<T> _read_values(Input& file, const size_t count);
 
   // Reads row_count many strings from input file. String lengths are encoded in type T.
-  static pmr_vector<pmr_string> _read_string_values(std::ifstream& file, const size_t count);
+  static pmr_vector<pmr_string> _read_string_values(Input& file, const size_t count);
 
   // Reads a single value of type T from the input file.
   template <typename T>
-  static T _read_value(std::ifstream& file);
+  static T _read_value(Input& file);
 };
 
 }  // namespace opossum
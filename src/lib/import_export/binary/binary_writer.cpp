@@ -1,9 +1,12 @@
 #include "binary_writer.hpp"
 
+#include <array>
 #include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "storage/encoding_type.hpp"
@@ -21,6 +24,15 @@ namespace {
 
 using namespace opossum;  // NOLINT
 
+// Writes zero bytes until the position in the file is a multiple of the alignment of T. As memory mappings start at
+// page boundaries, a buffer of values of type T that follows the padding is aligned when the file is memory-mapped.
+template <typename T>
+void export_padding(std::ofstream& ofstream) {
+  static constexpr auto padding = std::array<char, alignof(T)>{};
+  const auto position = static_cast<size_t>(ofstream.tellp());
+  ofstream.write(padding.data(), static_cast<std::streamsize>((alignof(T) - position % alignof(T)) % alignof(T)));
+}
+
 // Writes the content of the vector to the ofstream
 template <typename T, typename Alloc>
 void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values);
@@ -60,9 +72,16 @@ void export_string_values(std::ofstream& ofstream, const pmr_vector<pmr_string>&
 
 template <typename T, typename Alloc>
 void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values) {
+  export_padding<T>(ofstream);
   ofstream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
 }
 
+template <typename UnsignedIntType>
+void export_fixed_width_integer_vector(std::ofstream& ofstream, const FixedWidthIntegerVector<UnsignedIntType>& vector) {
+  export_padding<UnsignedIntType>(ofstream);
+  ofstream.write(reinterpret_cast<const char*>(vector.data()), vector.size() * sizeof(UnsignedIntType));
+}
+
 void export_values(std::ofstream& ofstream, const FixedStringVector& values) {
   ofstream.write(values.data(), values.size() * values.string_length());
 }
@@ -89,6 +108,7 @@ void export_value(std::ofstream& ofstream, const T& value) {
 
 void export_compact_vector(std::ofstream& ofstream, const pmr_compact_vector& values) {
   export_value(ofstream, static_cast<uint8_t>(values.bits()));
+  export_padding<std::remove_reference_t<decltype(*values.get())>>(ofstream);
   ofstream.write(reinterpret_cast<const char*>(values.get()), values.bytes());
 }
 
@@ -97,18 +117,27 @@ void export_compact_vector(std::ofstream& ofstream, const pmr_compact_vector& va
 namespace opossum {
 
 void BinaryWriter::write(const Table& table, const std::string& filename) {
-  std::ofstream ofstream;
-  ofstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
-  ofstream.open(filename, std::ios::binary);
-
-  _write_header(table, ofstream);
-
-  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); chunk_id++) {
-    _write_chunk(table, ofstream, chunk_id);
+  // The table is written to a temporary file that then replaces the target file. Truncating the target file instead
+  // would break tables that have been parsed from it with BinaryParserMode::MemoryMapped (and might still be in use,
+  // e.g., when a benchmark re-encodes a cached table and writes it back). Renaming leaves their mapping intact.
+  const auto temporary_filename = filename + ".tmp";
+  {
+    std::ofstream ofstream;
+    ofstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    ofstream.open(temporary_filename, std::ios::binary);
+
+    _write_header(table, ofstream);
+
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); chunk_id++) {
+      _write_chunk(table, ofstream, chunk_id);
+    }
   }
+  std::filesystem::rename(temporary_filename, filename);
 }
 
 void BinaryWriter::_write_header(const Table& table, std::ofstream& ofstream) {
+  export_value(ofstream, FORMAT_VERSION);
+
   const auto target_chunk_size = table.type() == TableType::Data ? table.target_chunk_size() : Chunk::DEFAULT_SIZE;
   export_value(ofstream, static_cast<ChunkOffset>(target_chunk_size));
   export_value(ofstream, static_cast<ChunkID::base_type>(table.chunk_count()));
@@ -193,6 +222,7 @@ void BinaryWriter::_write_segment(const ReferenceSegment& reference_segment, boo
     } else {
       // Unfortunately, we have to iterate over all values of the reference segment
       // to materialize its contents. Then we can write them to the file
+      export_padding<SegmentDataType>(ofstream);
       iterable.for_each([&](const auto& value) { export_value(ofstream, value.value()); });
     }
   });
@@ -295,9 +325,12 @@ void BinaryWriter::_write_segment(const LZ4Segment<T>& lz4_segment, bool column_
   export_value(ofstream, static_cast<uint32_t>(lz4_segment.last_block_size()));
 
   // Write compressed size for each LZ4 Block
+  auto lz4_block_sizes = pmr_vector<uint32_t>{};
+  lz4_block_sizes.reserve(lz4_segment.lz4_blocks().size());
   for (const auto& lz4_block : lz4_segment.lz4_blocks()) {
-    export_value(ofstream, static_cast<uint32_t>(lz4_block.size()));
+    lz4_block_sizes.emplace_back(static_cast<uint32_t>(lz4_block.size()));
   }
+  export_values(ofstream, lz4_block_sizes);
 
   // Write LZ4 Blocks
   for (const auto& lz4_block : lz4_segment.lz4_blocks()) {
@@ -331,6 +364,36 @@ void BinaryWriter::_write_segment(const LZ4Segment<T>& lz4_segment, bool column_
   }
 }
 
+template <>
+void BinaryWriter::_write_segment(const FSSTSegment<pmr_string>& fsst_segment, bool column_is_nullable,
+                                  std::ofstream& ofstream) {
+  export_value(ofstream, EncodingType::FSST);
+
+  // Write offsets vector compression id
+  const auto compressed_vector_type_id = _compressed_vector_type_id<pmr_string>(fsst_segment);
+  export_value(ofstream, compressed_vector_type_id);
+
+  // Write symbol table
+  const auto& symbol_table = fsst_segment.symbol_table();
+  export_value(ofstream, static_cast<uint32_t>(symbol_table.symbols().size()));
+  export_values(ofstream, symbol_table.symbols());
+  export_values(ofstream, symbol_table.symbol_lengths());
+
+  // Write compressed values
+  export_value(ofstream, static_cast<uint32_t>(fsst_segment.compressed_values().size()));
+  export_values(ofstream, fsst_segment.compressed_values());
+
+  // Write flag if optional NULL value vector is written
+  export_value(ofstream, static_cast<BoolAsByteType>(fsst_segment.null_values().has_value()));
+  if (fsst_segment.null_values()) {
+    // Write NULL values
+    export_values(ofstream, *fsst_segment.null_values());
+  }
+
+  // Write offsets
+  _export_compressed_vector(ofstream, *fsst_segment.compressed_vector_type(), fsst_segment.offsets());
+}
+
 template <typename T>
 CompressedVectorTypeID BinaryWriter::_compressed_vector_type_id(
     const AbstractEncodedSegment& abstract_encoded_segment) {
@@ -356,13 +419,16 @@ void BinaryWriter::_export_compressed_vector(std::ofstream& ofstream, const Comp
                                              const BaseCompressedVector& compressed_vector) {
   switch (type) {
     case CompressedVectorType::FixedWidthInteger4Byte:
-      export_values(ofstream, dynamic_cast<const FixedWidthIntegerVector<uint32_t>&>(compressed_vector).data());
+      export_fixed_width_integer_vector(ofstream,
+                                        dynamic_cast<const FixedWidthIntegerVector<uint32_t>&>(compressed_vector));
       return;
     case CompressedVectorType::FixedWidthInteger2Byte:
-      export_values(ofstream, dynamic_cast<const FixedWidthIntegerVector<uint16_t>&>(compressed_vector).data());
+      export_fixed_width_integer_vector(ofstream,
+                                        dynamic_cast<const FixedWidthIntegerVector<uint16_t>&>(compressed_vector));
       return;
     case CompressedVectorType::FixedWidthInteger1Byte:
-      export_values(ofstream, dynamic_cast<const FixedWidthIntegerVector<uint8_t>&>(compressed_vector).data());
+      export_fixed_width_integer_vector(ofstream,
+                                        dynamic_cast<const FixedWidthIntegerVector<uint8_t>&>(compressed_vector));
       return;
     case CompressedVectorType::BitPacking:
       export_compact_vector(ofstream, dynamic_cast<const BitPackingVector&>(compressed_vector).data());
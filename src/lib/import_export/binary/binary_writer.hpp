@@ -7,6 +7,7 @@
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/run_length_segment.hpp"
@@ -18,8 +19,18 @@ namespace opossum {
 class BaseCompressedVector;
 enum class CompressedVectorType : uint8_t;
 
+/*
+ * Buffers of values that are wider than one byte (e.g., the values of a segment, string lengths, or compressed vectors)
+ * are preceded by zero padding so that they start at a multiple of their alignment in the file. The padding is not
+ * listed in the layouts below.
+ */
 class BinaryWriter {
  public:
+  // Written at the beginning of the file. Version 2 introduced the padding of buffers.
+  static constexpr auto FORMAT_VERSION = uint32_t{2};
+
+  // Writes @param table to @param filename. An existing file is replaced, not overwritten in place, so that tables
+  // parsed from it with BinaryParserMode::MemoryMapped stay valid.
   static void write(const Table& table, const std::string& filename);
 
  private:
@@ -28,6 +39,7 @@ class BinaryWriter {
    *
    * Description                 | Type                                | Size in bytes
    * --------------------------------------------------------------------------------------------------------
+   * Format version              | uint32_t                            | 4
    * Chunk size                  | ChunkOffset                         | 4
    * Chunk count                 | ChunkID                             | 4
    * Column count                | ColumnID                            | 2
@@ -223,6 +235,35 @@ class BinaryWriter {
   template <typename T>
   static void _write_segment(const LZ4Segment<T>& lz4_segment, bool column_is_nullable, std::ofstream& ofstream);
 
+  /**
+   * FSSTSegments are dumped with the following layout:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Encoding Type               | EncodingType                        | 1
+   * Offsets vector compr. ID    | CompressedVectorTypeID              | 1
+   * Number of Symbols           | uint32_t                            | 4
+   * Symbols                     | uint64_t                            | Number of symbols * 8
+   * Symbol lengths              | uint8_t                             | Number of symbols * 1
+   * Compressed values size      | uint32_t                            | 4
+   * Compressed values           | uint8_t                             | Compressed values size * 1
+   * Stores NULL values          | bool (stored as BoolAsByteType)     | 1
+   * NULL values¹                | vector<bool> (BoolAsByteType)       | size * 1
+   * Vector compress. bit width² | uint8_t                             | 1
+   * Offsets²                    | uint8_t                             | (Rows + 1) * (vector compr. bit width) / 8
+   *                                                                     rounded up to next multiple of word (8 byte)
+   * Offsets³                    | uint(8|16|32)_t                     | (Rows + 1) * width of offset vector
+   *
+   * Please note that the number of rows are written in the header of the chunk.
+   * The type of the column can be found in the global header of the file.
+   *
+   * ¹: This field is only written when the optional NULL values are stored
+   * ²: This field is only written if the vector compression is BitPacking
+   * ³: This field is only written if the vector compression is FixedWidthInteger
+   */
+  template <typename T>
+  static void _write_segment(const FSSTSegment<T>& fsst_segment, bool column_is_nullable, std::ofstream& ofstream);
+
   template <typename T>
   static CompressedVectorTypeID _compressed_vector_type_id(const AbstractEncodedSegment& abstract_encoded_segment);
 
@@ -0,0 +1,436 @@
+#include "checkpoint.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "binary_parser.hpp"
+#include "binary_writer.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/list_directory.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto META_FILE_NAME = "checkpoint.meta";
+constexpr auto META_FORMAT_VERSION = uint32_t{1};
+
+template <typename T>
+void write_value(std::ofstream& ofstream, const T& value) {
+  static_assert(std::is_trivially_copyable_v<T>, "Can only write trivially copyable types");
+  ofstream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void write_string(std::ofstream& ofstream, const std::string& string) {
+  write_value(ofstream, static_cast<uint32_t>(string.size()));
+  ofstream.write(string.data(), static_cast<std::streamsize>(string.size()));
+}
+
+template <typename T>
+T read_value(std::ifstream& ifstream) {
+  static_assert(std::is_trivially_copyable_v<T>, "Can only read trivially copyable types");
+  auto value = T{};
+  ifstream.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+
+std::string read_string(std::ifstream& ifstream) {
+  auto string = std::string(read_value<uint32_t>(ifstream), '\0');
+  ifstream.read(string.data(), static_cast<std::streamsize>(string.size()));
+  return string;
+}
+
+// std::ofstream does not offer a way to sync a file to disk. Thus, the file (or directory) is opened again and synced.
+void sync_path(const std::filesystem::path& path) {
+  const auto file_descriptor = open(path.c_str(), O_RDONLY);
+  Assert(file_descriptor != -1, "Could not open '" + path.string() + "': " + std::strerror(errno));
+  const auto sync_result = fsync(file_descriptor);
+  close(file_descriptor);
+  Assert(sync_result == 0, "Could not sync '" + path.string() + "': " + std::strerror(errno));
+}
+
+}  // namespace
+
+namespace opossum {
+
+Checkpoint::Checkpoint(const std::string& directory) : _directory{directory} {}
+
+Checkpoint::~Checkpoint() { stop_background(); }
+
+CommitID Checkpoint::write() {
+  const auto lock = std::lock_guard<std::mutex>{_write_mutex};
+
+  if (!_previous_meta && exists(_directory)) _previous_meta = _read_meta(_directory);
+  std::filesystem::create_directories(_directory);
+
+  // The transaction context is only used to pin the snapshot: as long as it is registered as active, the
+  // MvccDeletePlugin does not physically remove chunks that contain rows visible for the snapshot. As the context does
+  // not execute any operators, it does not need to be committed.
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes);
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+
+  auto meta = Meta{};
+  meta.sequence_number = _previous_meta ? _previous_meta->sequence_number + 1 : 0;
+  meta.snapshot_commit_id = snapshot_commit_id;
+
+  auto checkpointed_tables = std::unordered_map<std::string, std::weak_ptr<const Table>>{};
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  auto reused_chunk_count = size_t{0};
+
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    auto& table_info = meta.tables[table_name];
+    table_info.column_definitions = table->column_definitions();
+    table_info.target_chunk_size = table->target_chunk_size();
+    checkpointed_tables.emplace(table_name, table);
+
+    const TableInfo* previous_table_info = nullptr;
+    const auto checkpointed_table_iter = _checkpointed_tables.find(table_name);
+    if (checkpointed_table_iter != _checkpointed_tables.end() && checkpointed_table_iter->second.lock() == table) {
+      previous_table_info = &_previous_meta->tables.at(table_name);
+    }
+
+    std::filesystem::create_directories(std::filesystem::path{_directory} / table_name);
+
+    // Chunks appended after this point cannot contain rows that are visible for the snapshot.
+    const auto chunk_count = table->chunk_count();
+    table_info.chunks.resize(chunk_count);
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      auto& chunk_info = table_info.chunks[chunk_id];
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk) {
+        chunk_info.is_removed = true;
+        continue;
+      }
+
+      // Same as above, rows appended later are not visible. Reading the size only once ensures that all rows we look at
+      // have been fully allocated (including their MVCC data). If the chunk is immutable at this point, its size is
+      // final and its segments can be written as they are.
+      const auto is_mutable = chunk->is_mutable();
+      chunk_info.size = chunk->size();
+      if (chunk_info.size == 0) continue;
+
+      const auto mvcc_data = chunk->mvcc_data();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_info.size; ++chunk_offset) {
+        // Same as Validate::is_row_visible, but without the transaction's own (uncommitted) changes.
+        const auto is_visible = snapshot_commit_id >= mvcc_data->get_begin_cid(chunk_offset) &&
+                                snapshot_commit_id < mvcc_data->get_end_cid(chunk_offset);
+        if (!is_visible) chunk_info.invisible_offsets.emplace_back(chunk_offset);
+      }
+
+      // The invisible offsets are stored in the meta file, so a chunk file can be reused even if rows have been deleted
+      // since. Only files that lack rows which are visible now (i.e., files written while some of the chunk's inserts
+      // were not committed yet) have to be rewritten.
+      if (previous_table_info && chunk_id < previous_table_info->chunks.size()) {
+        const auto& previous_chunk_info = previous_table_info->chunks[chunk_id];
+        if (!previous_chunk_info.file_name.empty() && previous_chunk_info.size == chunk_info.size &&
+            std::includes(chunk_info.invisible_offsets.cbegin(), chunk_info.invisible_offsets.cend(),
+                          previous_chunk_info.invisible_offsets.cbegin(), previous_chunk_info.invisible_offsets.cend()) &&
+            std::filesystem::exists(std::filesystem::path{_directory} / previous_chunk_info.file_name)) {
+          chunk_info.file_name = previous_chunk_info.file_name;
+          ++reused_chunk_count;
+          continue;
+        }
+      }
+
+      chunk_info.file_name =
+          table_name + "/" + std::to_string(chunk_id) + "_" + std::to_string(meta.sequence_number) + ".bin";
+      const auto file_path = std::filesystem::path{_directory} / chunk_info.file_name;
+      jobs.emplace_back(std::make_shared<JobTask>([&column_definitions = table_info.column_definitions, chunk,
+                                                   &chunk_info, is_mutable, file_path]() {
+        _write_chunk(column_definitions, chunk, chunk_info, is_mutable, file_path.string());
+      }));
+    }
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  // Only once all chunk files are durable, the new checkpoint replaces the previous one.
+  _write_meta(_directory, meta);
+  _remove_unreferenced_files(meta);
+
+  _written_chunk_count = jobs.size();
+  _reused_chunk_count = reused_chunk_count;
+  _previous_meta = std::move(meta);
+  _checkpointed_tables = std::move(checkpointed_tables);
+
+  auto& redo_log = Hyrise::get().redo_log;
+  if (redo_log.is_enabled()) redo_log.truncate(snapshot_commit_id);
+
+  return snapshot_commit_id;
+}
+
+void Checkpoint::start_background(const std::chrono::milliseconds interval) {
+  Assert(!_background_thread, "Background checkpoints have already been started");
+  _background_thread = std::make_unique<PausableLoopThread>(interval, [this](size_t) { write(); });
+}
+
+void Checkpoint::stop_background() { _background_thread.reset(); }
+
+size_t Checkpoint::written_chunk_count() const { return _written_chunk_count; }
+
+size_t Checkpoint::reused_chunk_count() const { return _reused_chunk_count; }
+
+bool Checkpoint::exists(const std::string& directory) {
+  return std::filesystem::exists(std::filesystem::path{directory} / META_FILE_NAME);
+}
+
+CommitID Checkpoint::load(const std::string& directory) {
+  const auto meta = _read_meta(directory);
+  auto& storage_manager = Hyrise::get().storage_manager;
+
+  // Parse the chunk files of all tables in parallel. Each file contains a table with a single chunk.
+  auto chunk_tables = std::map<std::string, std::vector<std::shared_ptr<Table>>>{};
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (const auto& [table_name, table_info] : meta.tables) {
+    Assert(!storage_manager.has_table(table_name), "Cannot load checkpoint, table '" + table_name + "' already exists");
+
+    auto& tables = chunk_tables[table_name];
+    tables.resize(table_info.chunks.size());
+    for (auto chunk_id = ChunkID{0}; chunk_id < table_info.chunks.size(); ++chunk_id) {
+      const auto& file_name = table_info.chunks[chunk_id].file_name;
+      if (file_name.empty()) continue;
+
+      const auto file_path = std::filesystem::path{directory} / file_name;
+      jobs.emplace_back(std::make_shared<JobTask>([&chunk_table = tables[chunk_id], file_path]() {
+        chunk_table = BinaryParser::parse(file_path.string(), BinaryParserMode::MemoryMapped);
+      }));
+    }
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  for (const auto& [table_name, table_info] : meta.tables) {
+    const auto table = std::make_shared<Table>(table_info.column_definitions, TableType::Data,
+                                               table_info.target_chunk_size, UseMvcc::Yes);
+    const auto& tables = chunk_tables[table_name];
+    const auto chunk_count = static_cast<ChunkID>(table_info.chunks.size());
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& chunk_info = table_info.chunks[chunk_id];
+      if (!tables[chunk_id]) {
+        // Chunks without a file are either empty or have been physically removed. To keep the ChunkIDs of the following
+        // chunks, an empty placeholder is appended. Unless it is the last chunk (which stays mutable for inserts), it is
+        // removed right away. Otherwise, appending the next chunk would fail as tables must not contain empty chunks.
+        table->append_mutable_chunk();
+        if (chunk_info.is_removed || chunk_id + 1 < chunk_count) table->remove_chunk(chunk_id);
+        continue;
+      }
+
+      const auto source_chunk = tables[chunk_id]->get_chunk(ChunkID{0});
+      auto segments = Segments{};
+      for (auto column_id = ColumnID{0}; column_id < source_chunk->column_count(); ++column_id) {
+        segments.emplace_back(source_chunk->get_segment(column_id));
+      }
+
+      // All visible rows have been committed before the checkpoint was taken. Similar to BinaryParser::parse, they are
+      // treated as if they had been there "from the beginning of time".
+      const auto mvcc_data = std::make_shared<MvccData>(chunk_info.size, CommitID{0});
+      for (const auto chunk_offset : chunk_info.invisible_offsets) {
+        mvcc_data->set_end_cid(chunk_offset, CommitID{0});
+      }
+
+      table->append_chunk(segments, mvcc_data);
+      const auto chunk = table->last_chunk();
+      if (!chunk_info.invisible_offsets.empty()) {
+        chunk->increase_invalid_row_count(static_cast<ChunkOffset>(chunk_info.invisible_offsets.size()));
+      }
+      chunk->finalize();
+      if (!source_chunk->individually_sorted_by().empty()) {
+        chunk->set_individually_sorted_by(source_chunk->individually_sorted_by());
+      }
+    }
+
+    storage_manager.add_table(table_name, table);
+  }
+
+  return meta.snapshot_commit_id;
+}
+
+Checkpoint::Meta Checkpoint::_read_meta(const std::string& directory) {
+  auto file = std::ifstream{std::filesystem::path{directory} / META_FILE_NAME, std::ios::binary};
+  Assert(file.is_open(), "Could not open checkpoint in '" + directory + "'");
+  file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+
+  Assert(read_value<uint32_t>(file) == META_FORMAT_VERSION, "Unsupported checkpoint format");
+
+  auto meta = Meta{};
+  meta.sequence_number = read_value<uint32_t>(file);
+  meta.snapshot_commit_id = read_value<CommitID>(file);
+
+  const auto table_count = read_value<uint32_t>(file);
+  for (auto table_index = uint32_t{0}; table_index < table_count; ++table_index) {
+    auto& table_info = meta.tables[read_string(file)];
+    table_info.target_chunk_size = read_value<ChunkOffset>(file);
+
+    const auto column_count = read_value<ColumnCount>(file);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      auto name = read_string(file);
+      const auto data_type = read_value<DataType>(file);
+      const auto nullable = read_value<bool>(file);
+      table_info.column_definitions.emplace_back(name, data_type, nullable);
+    }
+
+    table_info.chunks.resize(read_value<ChunkID>(file));
+    for (auto& chunk_info : table_info.chunks) {
+      chunk_info.is_removed = read_value<bool>(file);
+      chunk_info.size = read_value<ChunkOffset>(file);
+      chunk_info.file_name = read_string(file);
+      chunk_info.invisible_offsets.resize(read_value<ChunkOffset>(file));
+      file.read(reinterpret_cast<char*>(chunk_info.invisible_offsets.data()),
+                static_cast<std::streamsize>(chunk_info.invisible_offsets.size() * sizeof(ChunkOffset)));
+    }
+  }
+
+  return meta;
+}
+
+void Checkpoint::_write_meta(const std::string& directory, const Meta& meta) {
+  const auto meta_file_path = std::filesystem::path{directory} / META_FILE_NAME;
+  auto temporary_file_path = meta_file_path;
+  temporary_file_path += ".tmp";
+
+  {
+    auto file = std::ofstream{temporary_file_path, std::ios::binary | std::ios::trunc};
+    file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+
+    write_value(file, META_FORMAT_VERSION);
+    write_value(file, meta.sequence_number);
+    write_value(file, meta.snapshot_commit_id);
+
+    write_value(file, static_cast<uint32_t>(meta.tables.size()));
+    for (const auto& [table_name, table_info] : meta.tables) {
+      write_string(file, table_name);
+      write_value(file, table_info.target_chunk_size);
+
+      write_value(file, static_cast<ColumnCount>(table_info.column_definitions.size()));
+      for (const auto& column_definition : table_info.column_definitions) {
+        write_string(file, column_definition.name);
+        write_value(file, column_definition.data_type);
+        write_value(file, column_definition.nullable);
+      }
+
+      write_value(file, static_cast<ChunkID>(table_info.chunks.size()));
+      for (const auto& chunk_info : table_info.chunks) {
+        write_value(file, chunk_info.is_removed);
+        write_value(file, chunk_info.size);
+        write_string(file, chunk_info.file_name);
+        write_value(file, static_cast<ChunkOffset>(chunk_info.invisible_offsets.size()));
+        file.write(reinterpret_cast<const char*>(chunk_info.invisible_offsets.data()),
+                   static_cast<std::streamsize>(chunk_info.invisible_offsets.size() * sizeof(ChunkOffset)));
+      }
+    }
+  }
+
+  // Replace the previous meta file atomically. Syncing the directory makes the rename itself durable.
+  sync_path(temporary_file_path);
+  std::filesystem::rename(temporary_file_path, meta_file_path);
+  sync_path(directory);
+}
+
+void Checkpoint::_write_chunk(const TableColumnDefinitions& column_definitions,
+                              const std::shared_ptr<const Chunk>& chunk, const ChunkInfo& chunk_info,
+                              const bool is_mutable, const std::string& file_path) {
+  auto segments = Segments{};
+
+  if (is_mutable) {
+    auto is_invisible = std::vector<bool>(chunk_info.size);
+    for (const auto chunk_offset : chunk_info.invisible_offsets) {
+      is_invisible[chunk_offset] = true;
+    }
+
+    // Copy the visible rows into new ValueSegments of the size the chunk had when the snapshot was taken. The chunk
+    // might have been finalized (and encoded) in the meantime, so we do not rely on its segments being ValueSegments.
+    for (auto column_id = ColumnID{0}; column_id < column_definitions.size(); ++column_id) {
+      resolve_data_type(column_definitions[column_id].data_type, [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        const auto nullable = column_definitions[column_id].nullable;
+        const auto segment_accessor = create_segment_accessor<ColumnDataType>(chunk->get_segment(column_id));
+
+        auto values = pmr_vector<ColumnDataType>(chunk_info.size);
+        auto null_values = pmr_vector<bool>(nullable ? chunk_info.size : 0);
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_info.size; ++chunk_offset) {
+          if (is_invisible[chunk_offset]) continue;
+
+          const auto value = segment_accessor->access(chunk_offset);
+          if (value) {
+            values[chunk_offset] = *value;
+          } else {
+            null_values[chunk_offset] = true;
+          }
+        }
+
+        if (nullable) {
+          segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values),
+                                                                               std::move(null_values)));
+        } else {
+          segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+        }
+      });
+    }
+  } else {
+    // Immutable chunks do not change anymore (apart from their MVCC data), their segments can be written as they are.
+    for (auto column_id = ColumnID{0}; column_id < column_definitions.size(); ++column_id) {
+      segments.emplace_back(chunk->get_segment(column_id));
+    }
+  }
+
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{std::make_shared<Chunk>(segments)};
+  if (!is_mutable) {
+    chunks.front()->finalize();
+    if (!chunk->individually_sorted_by().empty()) {
+      chunks.front()->set_individually_sorted_by(chunk->individually_sorted_by());
+    }
+  }
+
+  const auto chunk_table = Table{column_definitions, TableType::Data, std::move(chunks)};
+  BinaryWriter::write(chunk_table, file_path);
+  sync_path(file_path);
+}
+
+void Checkpoint::_remove_unreferenced_files(const Meta& meta) const {
+  auto referenced_files = std::unordered_set<std::string>{};
+  for (const auto& [table_name, table_info] : meta.tables) {
+    for (const auto& chunk_info : table_info.chunks) {
+      if (!chunk_info.file_name.empty()) referenced_files.emplace(chunk_info.file_name);
+    }
+  }
+
+  // Only chunk files (i.e., binary files in the tables' directories) are removed. Other files in the directory, such as
+  // the redo log, are kept.
+  const auto directory = std::filesystem::path{_directory};
+  for (const auto& path : list_directory(_directory)) {
+    const auto relative_path = std::filesystem::relative(path, directory);
+    if (path.extension() != ".bin" || !relative_path.has_parent_path()) continue;
+    if (referenced_files.count(relative_path.string())) continue;
+    std::filesystem::remove(path);
+  }
+
+  // Remove the directories of tables that have been dropped.
+  for (const auto& entry : std::filesystem::directory_iterator{directory}) {
+    if (entry.is_directory() && !meta.tables.count(entry.path().filename().string()) &&
+        std::filesystem::is_empty(entry.path())) {
+      std::filesystem::remove(entry.path());
+    }
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "storage/table_column_definition.hpp"
+#include "types.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+/**
+ * Writes consistent snapshots of all tables in the StorageManager to disk without blocking concurrent transactions.
+ *
+ * A checkpoint reflects the state of the database as seen by a transaction with the checkpoint's snapshot commit id.
+ * To keep the RowIDs that the redo log refers to stable, every chunk is written with all of its rows. Rows that are
+ * not visible for the snapshot (i.e., rows that have been deleted before or have not been committed yet) are listed as
+ * invisible in the checkpoint's meta file and are invalidated when the checkpoint is loaded. For mutable chunks, the
+ * values of these rows might still be written by concurrent inserts. They are therefore stored as default values.
+ *
+ * Each chunk is written to a separate file in the BinaryWriter format, the chunks are written in parallel by the
+ * scheduler. As the invisible rows are stored in the meta file, a chunk file only has to be rewritten if the chunk
+ * received inserts since the previous checkpoint of the same table, i.e., if its size changed or rows that were
+ * written as default values have become visible. Otherwise, the file written for the previous checkpoint is reused.
+ * Deletes only change the meta file.
+ *
+ * The directory has the following layout:
+ *
+ *   <directory>/checkpoint.meta                             (snapshot commit id, schemas, and chunk information)
+ *   <directory>/<table name>/<chunk id>_<sequence number>.bin
+ *
+ * The meta file is replaced atomically once all chunk files have been written. Thus, a crash while writing a
+ * checkpoint leaves the previous checkpoint intact. Afterwards, files that are not referenced anymore are removed and,
+ * if the RedoLog is enabled, all log records covered by the checkpoint are truncated.
+ */
+class Checkpoint : private Noncopyable {
+ public:
+  explicit Checkpoint(const std::string& directory);
+  ~Checkpoint();
+
+  /**
+   * Writes a checkpoint of all tables and returns its snapshot commit id. Only one checkpoint is written at a time,
+   * concurrent calls wait for the running checkpoint to finish.
+   */
+  CommitID write();
+
+  /**
+   * Periodically writes checkpoints in a background thread until stop_background() is called or the Checkpoint object
+   * is destroyed.
+   */
+  void start_background(const std::chrono::milliseconds interval);
+  void stop_background();
+
+  // Number of chunk files written and reused by the last call to write().
+  size_t written_chunk_count() const;
+  size_t reused_chunk_count() const;
+
+  static bool exists(const std::string& directory);
+
+  /**
+   * Loads all tables of the checkpoint stored in the given directory into the StorageManager and returns the
+   * checkpoint's snapshot commit id. The chunk files are parsed in parallel.
+   */
+  static CommitID load(const std::string& directory);
+
+ protected:
+  struct ChunkInfo {
+    // A chunk that has been physically removed (see MvccDeletePlugin) is kept as a placeholder, so that the ChunkIDs
+    // of the following chunks do not change.
+    bool is_removed{false};
+    ChunkOffset size{0};
+    std::vector<ChunkOffset> invisible_offsets;
+    std::string file_name;
+  };
+
+  struct TableInfo {
+    TableColumnDefinitions column_definitions;
+    ChunkOffset target_chunk_size{0};
+    std::vector<ChunkInfo> chunks;
+  };
+
+  struct Meta {
+    uint32_t sequence_number{0};
+    CommitID snapshot_commit_id{0};
+    std::map<std::string, TableInfo> tables;
+  };
+
+  static Meta _read_meta(const std::string& directory);
+  static void _write_meta(const std::string& directory, const Meta& meta);
+
+  static void _write_chunk(const TableColumnDefinitions& column_definitions, const std::shared_ptr<const Chunk>& chunk,
+                           const ChunkInfo& chunk_info, const bool is_mutable, const std::string& file_path);
+
+  void _remove_unreferenced_files(const Meta& meta) const;
+
+  const std::string _directory;
+
+  std::mutex _write_mutex;
+
+  // Meta data of the last checkpoint written (or found on disk). Used to identify chunks that did not change.
+  std::optional<Meta> _previous_meta;
+
+  // Tables covered by _previous_meta. Chunk files are only reused if the table has not been replaced in the meantime
+  // (e.g., dropped and recreated with the same name). If the previous checkpoint has been read from disk, this is
+  // unknown and all chunks are written again.
+  std::unordered_map<std::string, std::weak_ptr<const Table>> _checkpointed_tables;
+
+  size_t _written_chunk_count{0};
+  size_t _reused_chunk_count{0};
+
+  std::unique_ptr<PausableLoopThread> _background_thread;
+};
+
+}  // namespace opossum
@@ -1,6 +1,13 @@
 #include "csv_parser.hpp"
 
-#include <fstream>
+#ifdef __AVX2__
+#include <x86intrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
 #include <list>
 #include <memory>
 #include <optional>
@@ -15,14 +22,91 @@
 #include "import_export/csv/csv_meta.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 #include "utils/load_table.hpp"
+#include "utils/memory_mapped_file.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Number of bytes that are classified at once. Each byte corresponds to one bit in the masks below.
+constexpr auto BLOCK_SIZE = size_t{64};
+
+// Bit i is set if the i-th byte of the block is the respective special character.
+struct BlockMasks {
+  uint64_t separators{0};
+  uint64_t delimiters{0};
+  uint64_t quotes{0};
+  uint64_t escapes{0};
+};
+
+#ifdef __AVX2__
+uint64_t match_mask(const __m256i& lower_half, const __m256i& upper_half, const char character) {
+  const auto pattern = _mm256_set1_epi8(character);
+  const auto lower_mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lower_half, pattern)));
+  const auto upper_mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(upper_half, pattern)));
+  return static_cast<uint64_t>(lower_mask) | (static_cast<uint64_t>(upper_mask) << 32u);
+}
+#endif
+
+BlockMasks classify_block(const char* block, const ParseConfig& config) {
+  auto masks = BlockMasks{};
+
+#ifdef __AVX2__
+  const auto lower_half = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+  const auto upper_half = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + BLOCK_SIZE / 2));
+  masks.separators = match_mask(lower_half, upper_half, config.separator);
+  masks.delimiters = match_mask(lower_half, upper_half, config.delimiter);
+  masks.quotes = match_mask(lower_half, upper_half, config.quote);
+  masks.escapes = match_mask(lower_half, upper_half, config.escape);
+#else
+  auto separators = uint64_t{0};
+  auto delimiters = uint64_t{0};
+  auto quotes = uint64_t{0};
+  auto escapes = uint64_t{0};
+
+  // As in the table scan, the OpenMP pragma makes the compiler try harder to vectorize this loop. We only use the
+  // compiler pragmas, not the OpenMP runtime (look up -fopenmp-simd).
+
+  // NOLINTNEXTLINE
+  {}  // clang-format off
+  #pragma omp simd reduction(|:separators, delimiters, quotes, escapes) safelen(BLOCK_SIZE)
+  // clang-format on
+  for (auto index = size_t{0}; index < BLOCK_SIZE; ++index) {
+    separators |= static_cast<uint64_t>(block[index] == config.separator) << index;
+    delimiters |= static_cast<uint64_t>(block[index] == config.delimiter) << index;
+    quotes |= static_cast<uint64_t>(block[index] == config.quote) << index;
+    escapes |= static_cast<uint64_t>(block[index] == config.escape) << index;
+  }
+
+  masks = BlockMasks{separators, delimiters, quotes, escapes};
+#endif
+
+  return masks;
+}
+
+// Bit i of the result is the XOR of the bits 0 to i of the input. Applied to the positions of (unescaped) quotes, the
+// result marks all bytes that are enclosed in quotes. The opening quote is included, the closing quote is not.
+uint64_t prefix_xor(uint64_t mask) {
+  mask ^= mask << 1u;
+  mask ^= mask << 2u;
+  mask ^= mask << 4u;
+  mask ^= mask << 8u;
+  mask ^= mask << 16u;
+  mask ^= mask << 32u;
+  return mask;
+}
+
+}  // namespace
 
 namespace opossum {
 
 std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const ChunkOffset chunk_size,
-                                        const std::optional<CsvMeta>& csv_meta) {
+                                        const std::optional<CsvMeta>& csv_meta,
+                                        const std::optional<ChunkEncodingSpec>& chunk_encoding_spec) {
   // If no meta info is given as a parameter, look for a json file
   CsvMeta meta;
   if (csv_meta == std::nullopt) {
@@ -33,66 +117,67 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const Chunk
 
   auto escaped_linebreak = std::string(1, meta.config.delimiter_escape) + std::string(1, meta.config.delimiter);
 
-  auto table = _create_table_from_meta(chunk_size, meta);
+  auto table = create_table_from_meta(chunk_size, meta);
+  Assert(!chunk_encoding_spec || chunk_encoding_spec->size() == table->column_count(),
+         "Encoding specification does not match the number of columns");
 
-  std::ifstream csvfile{filename};
-
-  // return empty table if input file is empty
-  if (!csvfile || csvfile.peek() == EOF || csvfile.peek() == '\r' || csvfile.peek() == '\n') return table;
-
-  {
-    std::string line;
-    std::getline(csvfile, line);
-    Assert(line.find('\r') == std::string::npos, "Windows encoding is not supported, use dos2unix");
-  }
+  if (!std::filesystem::is_regular_file(filename)) return table;
 
   /**
-   * Load the whole file(!) into a std::string using the, hopefully, fastest method to do so.
-   * TODO(anybody) Maybe use mmap() in the future. The current approach needs to have the entire file in RAM, mmap might
-   *               be cleverer, dunno.
+   * Instead of reading the whole file into memory, the file is mapped. The kernel loads pages as they are accessed by
+   * _find_fields_in_chunk, which is thus overlapped with the parsing tasks of the previous chunks. Pages that have been
+   * parsed can be dropped by the kernel, so that the file does not need to fit into memory.
    */
-  csvfile.seekg(0, std::ios::end);
-  const auto csvfile_size = csvfile.tellg();
-  std::string content(csvfile_size, ' ');
-  csvfile.seekg(0);
-  csvfile.read(content.data(), csvfile_size);
+  const auto csv_file = MemoryMappedFile{filename};
+  auto content_view = csv_file.view();
 
-  // make sure content ends with a delimiter for better row processing later
-  if (content.back() != meta.config.delimiter) content.push_back(meta.config.delimiter);
+  // return empty table if input file is empty
+  if (content_view.empty() || content_view.front() == '\r' || content_view.front() == '\n') return table;
 
-  std::string_view content_view{content.c_str(), content.size()};
+  Assert(content_view.substr(0, content_view.find('\n')).find('\r') == std::string_view::npos,
+         "Windows encoding is not supported, use dos2unix");
 
   // Save chunks in list to avoid memory relocation
-  std::list<Segments> segments_by_chunks;
+  std::list<std::shared_ptr<Chunk>> chunks;
   std::vector<std::shared_ptr<AbstractTask>> tasks;
   std::vector<size_t> field_ends;
   std::mutex append_chunk_mutex;
   while (_find_fields_in_chunk(content_view, *table, field_ends, meta)) {
     // create empty chunk
-    segments_by_chunks.emplace_back();
-    auto& segments = segments_by_chunks.back();
+    chunks.emplace_back();
+    auto& chunk = chunks.back();
 
     // Only pass the part of the string that is actually needed to the parsing task
     std::string_view relevant_content = content_view.substr(0, field_ends.back());
 
-    // Remove processed part of the csv content
-    content_view = content_view.substr(field_ends.back() + 1);
+    // Remove processed part of the csv content. If the file does not end with a delimiter, the last field ends at the
+    // end of the file.
+    content_view = content_view.substr(std::min(field_ends.back() + 1, content_view.size()));
 
     // create and start parsing task to fill chunk
-    tasks.emplace_back(std::make_shared<JobTask>([relevant_content, field_ends, &table, &segments, &meta,
-                                                  &escaped_linebreak, &append_chunk_mutex]() {
-      _parse_into_chunk(relevant_content, field_ends, *table, segments, meta, escaped_linebreak, append_chunk_mutex);
+    tasks.emplace_back(std::make_shared<JobTask>([relevant_content, field_ends, &table, &chunk, &meta,
+                                                  &escaped_linebreak, &append_chunk_mutex, &chunk_encoding_spec]() {
+      _parse_into_chunk(relevant_content, field_ends, *table, chunk, meta, escaped_linebreak, append_chunk_mutex,
+                        chunk_encoding_spec);
     }));
     tasks.back()->schedule();
   }
 
   Hyrise::get().scheduler()->wait_for_tasks(tasks);
 
-  for (auto& segments : segments_by_chunks) {
-    DebugAssert(!segments.empty(), "Empty chunks shouldn't occur when importing CSV");
-    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
-    table->append_chunk(segments, mvcc_data);
-    table->last_chunk()->finalize();
+  const auto column_count = table->column_count();
+  for (const auto& chunk : chunks) {
+    DebugAssert(chunk && chunk->size() > 0, "Empty chunks shouldn't occur when importing CSV");
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      segments.emplace_back(chunk->get_segment(column_id));
+    }
+    table->append_chunk(segments, chunk->mvcc_data());
+
+    // The pruning statistics of encoded chunks have already been generated by the parsing task.
+    const auto& appended_chunk = table->last_chunk();
+    appended_chunk->set_pruning_statistics(chunk->pruning_statistics());
+    appended_chunk->finalize();
   }
 
   return table;
@@ -101,10 +186,10 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const Chunk
 std::shared_ptr<Table> CsvParser::create_table_from_meta_file(const std::string& filename,
                                                               const ChunkOffset chunk_size) {
   const auto meta = process_csv_meta_file(filename);
-  return _create_table_from_meta(chunk_size, meta);
+  return create_table_from_meta(chunk_size, meta);
 }
 
-std::shared_ptr<Table> CsvParser::_create_table_from_meta(const ChunkOffset chunk_size, const CsvMeta& meta) {
+std::shared_ptr<Table> CsvParser::create_table_from_meta(const ChunkOffset chunk_size, const CsvMeta& meta) {
   TableColumnDefinitions column_definitions;
   for (const auto& column_meta : meta.columns) {
     auto column_name = column_meta.name;
@@ -128,55 +213,85 @@ bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table&
     return false;
   }
 
-  std::string search_for{meta.config.separator, meta.config.delimiter, meta.config.quote};
-
-  size_t from = 0;
-  unsigned int rows = 0;
-  unsigned int field_count = 1;
-  bool in_quotes = false;
-  while (rows < table.target_chunk_size()) {
-    // Find either of row separator, column delimiter, quote identifier
-    auto pos = csv_content.find_first_of(search_for, from);
-    if (std::string::npos == pos) {
-      break;
-    }
-    from = pos + 1;
-    const char elem = csv_content[pos];
-
-    // Make sure to "toggle" in_quotes ONLY if the quotes are not part of the string (i.e. escaped)
-    if (elem == meta.config.quote) {
-      bool quote_is_escaped = false;
-      if (meta.config.quote != meta.config.escape) {
-        quote_is_escaped = pos != 0 && csv_content[pos - 1] == meta.config.escape;
-      }
-      if (!quote_is_escaped) {
-        in_quotes = !in_quotes;
-      }
+  /**
+   * Instead of searching for the special characters one by one, the content is processed in blocks of 64 bytes. For
+   * each block, bitmasks of the positions of separators, delimiters, and quotes are built using SIMD comparisons.
+   * Using the prefix XOR of the quote mask, separators and delimiters within quoted values are masked out. Only the
+   * remaining positions, i.e., the actual field ends, are visited one by one.
+   */
+  const auto& config = meta.config;
+  const auto column_count = static_cast<size_t>(table.column_count());
+
+  auto rows = ChunkOffset{0};
+  auto field_count = size_t{1};
+
+  // All bits are set if the previous block ended within quotes.
+  auto in_quotes_carry = uint64_t{0};
+
+  // Position after the last delimiter that ended a row.
+  auto row_end = size_t{0};
+
+  auto padded_block = std::array<char, BLOCK_SIZE>{};
+  for (auto block_begin = size_t{0}; block_begin < csv_content.size(); block_begin += BLOCK_SIZE) {
+    const auto block_size = std::min(BLOCK_SIZE, csv_content.size() - block_begin);
+    const auto* block = csv_content.data() + block_begin;
+    auto valid_bytes = ~uint64_t{0};
+    if (block_size < BLOCK_SIZE) {
+      // Do not read beyond the end of the content
+      padded_block.fill('\0');
+      std::memcpy(padded_block.data(), block, block_size);
+      block = padded_block.data();
+      valid_bytes = (uint64_t{1} << block_size) - 1;
     }
 
-    // Determine if delimiter marks end of row or is part of the (string) value
-    if (elem == meta.config.delimiter && !in_quotes) {
-      DebugAssert(field_count == static_cast<size_t>(table.column_count()),
-                  "Number of CSV fields does not match number of columns.");
-      ++rows;
-      field_count = 0;
+    const auto masks = classify_block(block, config);
+
+    auto quotes = masks.quotes & valid_bytes;
+    if (config.quote != config.escape) {
+      // Make sure to "toggle" in_quotes ONLY if the quotes are not part of the string (i.e. escaped)
+      const auto previous_byte_is_escape = block_begin != 0 && csv_content[block_begin - 1] == config.escape;
+      quotes &= ~((masks.escapes << 1u) | static_cast<uint64_t>(previous_byte_is_escape));
     }
 
-    // Determine if separator marks end of field or is part of the (string) value
-    if (in_quotes || elem == meta.config.quote) {
-      continue;
+    const auto in_quotes = prefix_xor(quotes) ^ in_quotes_carry;
+    in_quotes_carry = (in_quotes >> 63u) ? ~uint64_t{0} : uint64_t{0};
+
+    // Separators and delimiters within quotes are part of the (string) value
+    auto field_end_mask = (masks.separators | masks.delimiters) & valid_bytes & ~in_quotes;
+    while (field_end_mask) {
+      const auto bit = static_cast<size_t>(__builtin_ctzll(field_end_mask));
+      field_end_mask &= field_end_mask - 1;
+
+      const auto position = block_begin + bit;
+      field_ends.push_back(position);
+
+      // Determine if the field end also marks the end of a row
+      if ((masks.delimiters >> bit) & 1u) {
+        DebugAssert(field_count == column_count, "Number of CSV fields does not match number of columns.");
+        field_count = 1;
+        row_end = position + 1;
+        ++rows;
+        if (rows == table.target_chunk_size()) return true;
+      } else {
+        ++field_count;
+      }
     }
+  }
 
-    ++field_count;
-    field_ends.push_back(pos);
+  // The last row of the file is not necessarily terminated by a delimiter.
+  if (row_end < csv_content.size()) {
+    Assert(!in_quotes_carry, "CSV file ends within a quoted value");
+    DebugAssert(field_count == column_count, "Number of CSV fields does not match number of columns.");
+    field_ends.push_back(csv_content.size());
   }
 
   return true;
 }
 
 size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vector<size_t>& field_ends,
-                                    const Table& table, Segments& segments, const CsvMeta& meta,
-                                    const std::string& escaped_linebreak, std::mutex& append_chunk_mutex) {
+                                    const Table& table, std::shared_ptr<Chunk>& chunk, const CsvMeta& meta,
+                                    const std::string& escaped_linebreak, std::mutex& append_chunk_mutex,
+                                    const std::optional<ChunkEncodingSpec>& chunk_encoding_spec) {
   // For each csv column, create a CsvConverter which builds up a ValueSegment
   const auto column_count = table.column_count();
   const auto row_count = field_ends.size() / column_count;
@@ -220,12 +335,24 @@ size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vecto
                            std::to_string(column_id) + ":\n" + exception.what());
   }
 
-  // Transform the field_offsets to segments and add segments to chunk.
+  // Transform the field_offsets to segments
+  auto chunk_segments = Segments{};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    chunk_segments.push_back(converters[column_id]->finish());
+  }
+
+  // If requested, the chunk is encoded right away, so that encoding is pipelined with reading and parsing the
+  // remaining chunks. Encoding the whole chunk (instead of single segments) also generates its pruning statistics.
+  auto parsed_chunk = std::make_shared<Chunk>(chunk_segments, std::make_shared<MvccData>(row_count, CommitID{0}));
+  if (chunk_encoding_spec) {
+    parsed_chunk->finalize();
+    ChunkEncoder::encode_chunk(parsed_chunk, table.column_data_types(), *chunk_encoding_spec);
+  }
+
+  // Add chunk to the list of parsed chunks.
   {
     std::lock_guard<std::mutex> lock(append_chunk_mutex);
-    for (auto& converter : converters) {
-      segments.push_back(converter->finish());
-    }
+    chunk = std::move(parsed_chunk);
   }
 
   return row_count;
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "import_export/csv/csv_meta.hpp"
+#include "storage/encoding_type.hpp"
 
 namespace opossum {
 
@@ -21,27 +22,32 @@ class Chunk;
  * For non-RFC 4180, all linebreaks within quoted strings are further escaped with an escape character.
  * For the structure of the meta csv file see export_csv.hpp
  *
- * This parser reads the whole csv file and iterates over it to separate the data into chunks that are aligned with the
- * csv rows.
- * Each data chunk is parsed and converted into a opossum chunk. In the end all chunks are combined to the final table.
+ * This parser maps the csv file into memory and iterates over it to separate the data into chunks that are aligned
+ * with the csv rows. Field ends are detected block-wise using SIMD comparisons (see _find_fields_in_chunk).
+ * Each data chunk is parsed (and optionally encoded) into a opossum chunk by a separate task, while the next chunk is
+ * being searched for. In the end all chunks are combined to the final table.
  */
 class CsvParser {
  public:
   /*
-   * @param filename      Path to the input file.
-   * @param csv_meta      Custom csv meta information which will be used instead of the default "filename" + ".json" meta.
-   * @returns             The table that was created from the csv file.
+   * @param filename            Path to the input file.
+   * @param csv_meta            Custom csv meta information which will be used instead of the default "filename" +
+   *                            ".json" meta.
+   * @param chunk_encoding_spec If set, the chunks are encoded while the file is being parsed.
+   * @returns                   The table that was created from the csv file.
    */
   static std::shared_ptr<Table> parse(const std::string& filename, const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE,
-                                      const std::optional<CsvMeta>& csv_meta = std::nullopt);
+                                      const std::optional<CsvMeta>& csv_meta = std::nullopt,
+                                      const std::optional<ChunkEncodingSpec>& chunk_encoding_spec = std::nullopt);
   static std::shared_ptr<Table> create_table_from_meta_file(const std::string& filename,
                                                             const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
 
- protected:
   /*
-   * Use the meta information stored in _meta to create a new table with according column description.
+   * Use the meta information stored in meta to create a new table with according column description.
    */
-  static std::shared_ptr<Table> _create_table_from_meta(const ChunkOffset chunk_size, const CsvMeta& meta);
+  static std::shared_ptr<Table> create_table_from_meta(const ChunkOffset chunk_size, const CsvMeta& meta);
+
+ protected:
 
   /*
    * @param      csv_content String_view on the remaining content of the CSV.
@@ -57,12 +63,13 @@ class CsvParser {
    * @param      csv_chunk  String_view on one chunk of the CSV.
    * @param      field_ends Positions of the field ends of the given \p csv_chunk.
    * @param      table      Empty table created by _process_meta_file.
-   * @param[out] segments   The segments of the chunk, to be populated with data
+   * @param[out] chunk      The parsed chunk, encoded (including pruning statistics) if \p chunk_encoding_spec is set
    * @returns               The number of rows in the chunk
    */
   static size_t _parse_into_chunk(std::string_view csv_chunk, const std::vector<size_t>& field_ends, const Table& table,
-                                  Segments& segments, const CsvMeta& meta, const std::string& escaped_linebreak,
-                                  std::mutex& append_chunk_mutex);
+                                  std::shared_ptr<Chunk>& chunk, const CsvMeta& meta,
+                                  const std::string& escaped_linebreak, std::mutex& append_chunk_mutex,
+                                  const std::optional<ChunkEncodingSpec>& chunk_encoding_spec);
 
   /*
    * @param field The field that needs to be modified to be RFC 4180 compliant.
@@ -21,12 +21,15 @@
 #include "export_node.hpp"
 #include "expression/abstract_expression.hpp"
 #include "expression/abstract_predicate_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/pqp_subquery_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "expression/window_function_expression.hpp"
 #include "hyrise.hpp"
 #include "import_node.hpp"
 #include "insert_node.hpp"
@@ -45,6 +48,7 @@
 #include "operators/join_hash.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
+#include "operators/key_index_scan.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
 #include "operators/maintenance/create_table.hpp"
@@ -62,13 +66,16 @@
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
+#include "operators/window.hpp"
 #include "predicate_node.hpp"
 #include "projection_node.hpp"
 #include "sort_node.hpp"
 #include "static_table_node.hpp"
+#include "storage/index/table_key_index.hpp"
 #include "stored_table_node.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
+#include "window_node.hpp"
 
 using namespace std::string_literals;  // NOLINT
 
@@ -135,6 +142,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
     case LQPNodeType::StaticTable:        return _translate_static_table_node(node);
     case LQPNodeType::Update:             return _translate_update_node(node);
     case LQPNodeType::Validate:           return _translate_validate_node(node);
+    case LQPNodeType::Window:             return _translate_window_node(node);
     case LQPNodeType::Union:              return _translate_union_node(node);
     case LQPNodeType::Intersect:          return _translate_intersect_node(node);
     case LQPNodeType::Except:             return _translate_except_node(node);
@@ -181,6 +189,11 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_index_scan(
     const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
+  // Lookups of entire keys are handled by the table's key index rather than by the chunk indexes.
+  if (const auto key_index_scan = _translate_predicate_node_to_key_index_scan(node, input_operator)) {
+    return key_index_scan;
+  }
+
   /**
    * Not using OperatorScanPredicate, since it splits up BETWEEN into two scans for some cases that TableScan cannot handle
    */
@@ -262,6 +275,41 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   return std::make_shared<UnionAll>(index_scan, table_scan);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_key_index_scan(
+    const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
+  const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
+  if (!stored_table_node) return nullptr;
+
+  // The predicate has to be a conjunction of `column = value` predicates, one for each column of a key index (see
+  // IndexScanRule). Instead of a value, a predicate can also hold a correlated parameter.
+  const auto is_key_value = [](const auto& expression) {
+    return expression->type == ExpressionType::Value || expression->type == ExpressionType::CorrelatedParameter;
+  };
+
+  auto column_ids = std::vector<ColumnID>{};
+  auto values = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& predicate : flatten_logical_expressions(node->predicate(), LogicalOperator::And)) {
+    const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate);
+    if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals) return nullptr;
+
+    auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->left_operand());
+    auto value_expression = binary_predicate->right_operand();
+    if (!column_expression || !is_key_value(value_expression)) {
+      column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->right_operand());
+      value_expression = binary_predicate->left_operand();
+    }
+    if (!column_expression || !is_key_value(value_expression)) return nullptr;
+
+    column_ids.emplace_back(column_expression->original_column_id);
+    values.emplace_back(_translate_expression(value_expression, node->left_input()));
+  }
+
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+  if (!table->key_index(column_ids)) return nullptr;
+
+  return std::make_shared<KeyIndexScan>(input_operator, column_ids, values);
+}
+
 std::shared_ptr<TableScan> LQPTranslator::_translate_predicate_node_to_table_scan(
     const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
   return std::make_shared<TableScan>(input_operator, _translate_expression(node->predicate(), node->left_input()));
@@ -481,6 +529,17 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_validate_node(
   return std::make_shared<Validate>(input_operator);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_window_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto input_node = node->left_input();
+  const auto window_node = std::dynamic_pointer_cast<WindowNode>(node);
+  const auto input_operator = translate_node(input_node);
+
+  const auto window_function_expression = std::static_pointer_cast<WindowFunctionExpression>(
+      _translate_expression(window_node->window_function_expression(), input_node));
+  return std::make_shared<Window>(input_operator, window_function_expression);
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_change_meta_table_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_operator_left = translate_node(node->left_input());
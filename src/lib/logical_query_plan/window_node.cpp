@@ -0,0 +1,59 @@
+#include "window_node.hpp"
+
+#include <sstream>
+
+#include "expression/expression_utils.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+WindowNode::WindowNode(const std::shared_ptr<AbstractExpression>& window_function_expression)
+    : AbstractLQPNode(LQPNodeType::Window, {window_function_expression}) {
+  Assert(window_function_expression->type == ExpressionType::WindowFunction,
+         "Expression '" + window_function_expression->as_column_name() + "' is not a WindowFunctionExpression");
+}
+
+std::string WindowNode::description(const DescriptionMode mode) const {
+  const auto expression_mode = _expression_description_mode(mode);
+
+  std::stringstream stream;
+
+  stream << "[Window] " << node_expressions[0]->description(expression_mode);
+
+  return stream.str();
+}
+
+std::vector<std::shared_ptr<AbstractExpression>> WindowNode::output_expressions() const {
+  auto output_expressions = left_input()->output_expressions();
+  output_expressions.emplace_back(node_expressions[0]);
+  return output_expressions;
+}
+
+bool WindowNode::is_column_nullable(const ColumnID column_id) const {
+  Assert(left_input(), "Need left input to determine nullability");
+  const auto input_column_count = left_input()->output_expressions().size();
+  if (column_id < input_column_count) return left_input()->is_column_nullable(column_id);
+
+  Assert(column_id == input_column_count, "ColumnID out of range");
+  return node_expressions[0]->is_nullable_on_lqp(*left_input());
+}
+
+std::shared_ptr<LQPUniqueConstraints> WindowNode::unique_constraints() const {
+  return _forward_left_unique_constraints();
+}
+
+std::shared_ptr<WindowFunctionExpression> WindowNode::window_function_expression() const {
+  return std::static_pointer_cast<WindowFunctionExpression>(node_expressions[0]);
+}
+
+std::shared_ptr<AbstractLQPNode> WindowNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
+  return make(expression_copy_and_adapt_to_different_lqp(*node_expressions[0], node_mapping));
+}
+
+bool WindowNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
+  const auto& window_node = static_cast<const WindowNode&>(rhs);
+  return expression_equal_to_expression_in_different_lqp(*node_expressions[0], *window_node.node_expressions[0],
+                                                         node_mapping);
+}
+
+}  // namespace opossum
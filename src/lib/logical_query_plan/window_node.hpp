@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_lqp_node.hpp"
+#include "expression/window_function_expression.hpp"
+
+namespace opossum {
+
+/**
+ * This node type computes a single window function (e.g., `RANK() OVER (PARTITION BY a ORDER BY b)`). It forwards all
+ * columns of its input and appends the result of the window function as an additional column. Multiple window
+ * functions are represented by a chain of WindowNodes.
+ */
+class WindowNode : public EnableMakeForLQPNode<WindowNode>, public AbstractLQPNode {
+ public:
+  explicit WindowNode(const std::shared_ptr<AbstractExpression>& window_function_expression);
+
+  std::string description(const DescriptionMode mode = DescriptionMode::Short) const override;
+  std::vector<std::shared_ptr<AbstractExpression>> output_expressions() const override;
+  bool is_column_nullable(const ColumnID column_id) const override;
+
+  // Forwards unique constraints from the left input node. The window function's result does not add any.
+  std::shared_ptr<LQPUniqueConstraints> unique_constraints() const override;
+
+  std::shared_ptr<WindowFunctionExpression> window_function_expression() const;
+
+ protected:
+  std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
+  bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,45 @@
+#include "numa_memory_resource.hpp"
+
+#if HYRISE_NUMA_SUPPORT
+
+#include <numa.h>
+
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+namespace opossum {
+
+NUMAMemoryResource::NUMAMemoryResource(const NodeID node_id) : _node_id(node_id) {}
+
+NodeID NUMAMemoryResource::node_id() const { return _node_id; }
+
+void* NUMAMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+#if HYRISE_NUMA_SUPPORT
+  // numa_alloc_onnode returns page-aligned memory, which satisfies every alignment requested by the containers.
+  // Empty allocations are not supported by libnuma.
+  auto* pointer = numa_alloc_onnode(std::max(bytes, std::size_t{1}), static_cast<int>(_node_id));
+#else
+  auto* pointer = std::malloc(bytes);  // NOLINT
+#endif
+  if (!pointer) throw std::bad_alloc{};
+  return pointer;
+}
+
+void NUMAMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+#if HYRISE_NUMA_SUPPORT
+  numa_free(pointer, std::max(bytes, std::size_t{1}));
+#else
+  std::free(pointer);  // NOLINT
+#endif
+}
+
+bool NUMAMemoryResource::do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept {
+  // Memory allocated on one node can only be freed by a resource of the same node, as numa_free needs to be called.
+  const auto* other_numa_memory_resource = dynamic_cast<const NUMAMemoryResource*>(&other);
+  return other_numa_memory_resource && other_numa_memory_resource->_node_id == _node_id;
+}
+
+}  // namespace opossum
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Memory resource that allocates memory on a specific NUMA node using libnuma. Allocations are rounded up to full
+ * pages, so this resource should only be used for large allocations (e.g., the partitions of the hash join). Without
+ * NUMA support, memory is allocated using malloc.
+ *
+ * Instances are obtained via Topology::get_memory_resource().
+ */
+class NUMAMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  explicit NUMAMemoryResource(const NodeID node_id);
+
+  NodeID node_id() const;
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept override;
+
+  const NodeID _node_id;
+};
+
+}  // namespace opossum
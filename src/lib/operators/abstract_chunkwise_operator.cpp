@@ -0,0 +1,186 @@
+#include "abstract_chunkwise_operator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+bool AbstractChunkwiseOperator::try_pipeline_left_input() {
+  if (_pipelines_left_input) return true;
+
+  const auto left_chunkwise_input = std::dynamic_pointer_cast<AbstractChunkwiseOperator>(mutable_left_input());
+  if (!left_chunkwise_input) return false;
+
+  if (state() != OperatorState::Created || left_chunkwise_input->state() != OperatorState::Created) return false;
+
+  // If other operators consume the input as well, its output table has to be materialized anyway.
+  if (left_chunkwise_input->consumer_count() != 1) return false;
+
+  if (!_can_be_pipelined() || !left_chunkwise_input->_can_be_pipelined()) return false;
+  if (!left_chunkwise_input->_keeps_input_columns()) return false;
+
+  _pipelines_left_input = true;
+  return true;
+}
+
+bool AbstractChunkwiseOperator::pipelines_left_input() const { return _pipelines_left_input; }
+
+bool AbstractChunkwiseOperator::try_stream_output(const OutputChunkConsumer& consumer) {
+  if (state() != OperatorState::Created || !_can_be_pipelined() || !_can_stream_output()) return false;
+
+  _output_chunk_consumer = consumer;
+  return true;
+}
+
+void AbstractChunkwiseOperator::pass_chunks_to_consumer(const std::shared_ptr<const Table>& table,
+                                                        const OutputChunkConsumer& consumer) {
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk || chunk->size() == 0) continue;
+
+    // The chunk is not modified, the table only serves as a wrapper.
+    consumer(std::make_shared<Table>(table->column_definitions(), table->type(),
+                                     std::vector<std::shared_ptr<Chunk>>{std::const_pointer_cast<Chunk>(chunk)},
+                                     table->uses_mvcc()));
+  }
+}
+
+bool AbstractChunkwiseOperator::_executes_as_pipeline() const {
+  return _pipelines_left_input || _output_chunk_consumer;
+}
+
+std::shared_ptr<const Table> AbstractChunkwiseOperator::_execute_pipeline() {
+  DebugAssert(_executes_as_pipeline(), "Operator is not executed as a pipeline");
+
+  // Collect the operators of the pipeline in the order in which they process the morsels. This operator has already
+  // been transitioned to OperatorState::Running by AbstractOperator::execute, the others have not.
+  auto pipeline = std::vector<AbstractChunkwiseOperator*>{this};
+  while (pipeline.back()->_pipelines_left_input) {
+    pipeline.emplace_back(static_cast<AbstractChunkwiseOperator*>(pipeline.back()->mutable_left_input().get()));
+  }
+  std::reverse(pipeline.begin(), pipeline.end());
+  const auto pipeline_length = pipeline.size();
+
+  const auto input_table = pipeline.front()->left_input_table();
+
+  for (auto* const pipelined_operator : pipeline) {
+    if (pipelined_operator != this) pipelined_operator->_transition_to(OperatorState::Running);
+    pipelined_operator->_on_begin_pipeline(input_table);
+  }
+
+  auto output_row_counts = std::vector<std::atomic_size_t>(pipeline_length);
+  auto output_chunk_counts = std::vector<std::atomic_size_t>(pipeline_length);
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  output_chunks.reserve(input_table->chunk_count());
+  auto output_mutex = std::mutex{};
+
+  const auto execute_morsel = [&](const ChunkID chunk_id) {
+    auto morsel_table = input_table;
+    auto morsel_chunk_id = chunk_id;
+
+    for (auto operator_idx = size_t{0}; operator_idx < pipeline_length; ++operator_idx) {
+      const auto chunk = pipeline[operator_idx]->_on_execute_morsel(morsel_table, morsel_chunk_id);
+      if (!chunk) return;
+
+      output_row_counts[operator_idx] += chunk->size();
+      ++output_chunk_counts[operator_idx];
+
+      if (operator_idx == pipeline_length - 1) {
+        if (_output_chunk_consumer) {
+          // Not synchronized, so that the morsels do not wait for each other while handing over their output.
+          _output_chunk_consumer(_make_streamed_table(input_table, chunk));
+        } else {
+          const auto lock = std::lock_guard<std::mutex>{output_mutex};
+          output_chunks.emplace_back(chunk);
+        }
+        return;
+      }
+
+      // The output of TableScan and Validate always references other tables. Wrap it into a table so that the next
+      // operator can process it just like a chunk of its regular input table. Operators that change the columns
+      // (see _keeps_input_columns) are always the last operator of a pipeline and never reach this point.
+      morsel_table = std::make_shared<Table>(input_table->column_definitions(), TableType::References,
+                                             std::vector<std::shared_ptr<Chunk>>{chunk});
+      morsel_chunk_id = ChunkID{0};
+    }
+  };
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(input_table->chunk_count());
+
+  const auto chunk_count = input_table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    // Same threshold as in TableScan: Small chunks are not worth the scheduling overhead.
+    constexpr auto JOB_SPAWN_THRESHOLD = ChunkOffset{500};
+    if (chunk->size() >= JOB_SPAWN_THRESHOLD) {
+      jobs.emplace_back(std::make_shared<JobTask>([&execute_morsel, chunk_id]() { execute_morsel(chunk_id); }));
+    } else {
+      execute_morsel(chunk_id);
+    }
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  for (auto operator_idx = size_t{0}; operator_idx < pipeline_length; ++operator_idx) {
+    auto* const pipelined_operator = pipeline[operator_idx];
+    pipelined_operator->_on_end_pipeline();
+    if (pipelined_operator == this) continue;
+
+    // Mirror what AbstractOperator::execute does for operators that are executed on their own.
+    pipelined_operator->_on_cleanup();
+    auto& pipelined_performance_data = *pipelined_operator->performance_data;
+    pipelined_performance_data.has_output = true;
+    pipelined_performance_data.output_row_count = output_row_counts[operator_idx];
+    pipelined_performance_data.output_chunk_count = output_chunk_counts[operator_idx];
+    pipelined_operator->_transition_to(OperatorState::ExecutedAndAvailable);
+  }
+
+  // Only now that all operators of the pipeline are executed, they deregister from their inputs. This clears all
+  // pipelined operators (which never held an output) except for the input of this operator, which is deregistered by
+  // AbstractOperator::execute.
+  for (auto* const pipelined_operator : pipeline) {
+    if (pipelined_operator != this) pipelined_operator->mutable_left_input()->deregister_consumer();
+  }
+
+  // Drop the consumer, which might reference state of the caller that does not outlive the execution.
+  _output_chunk_consumer = nullptr;
+
+  return _build_pipeline_output(input_table, std::move(output_chunks));
+}
+
+bool AbstractChunkwiseOperator::_can_be_pipelined() const { return true; }
+
+bool AbstractChunkwiseOperator::_keeps_input_columns() const { return true; }
+
+bool AbstractChunkwiseOperator::_can_stream_output() const { return _keeps_input_columns(); }
+
+std::shared_ptr<const Table> AbstractChunkwiseOperator::_make_streamed_table(
+    const std::shared_ptr<const Table>& pipeline_input_table, const std::shared_ptr<Chunk>& chunk) const {
+  return std::make_shared<Table>(pipeline_input_table->column_definitions(), TableType::References,
+                                 std::vector<std::shared_ptr<Chunk>>{chunk});
+}
+
+void AbstractChunkwiseOperator::_on_end_pipeline() {}
+
+std::shared_ptr<const Table> AbstractChunkwiseOperator::_build_pipeline_output(
+    const std::shared_ptr<const Table>& pipeline_input_table, std::vector<std::shared_ptr<Chunk>>&& output_chunks) {
+  return std::make_shared<Table>(pipeline_input_table->column_definitions(), TableType::References,
+                                 std::move(output_chunks));
+}
+
+}  // namespace opossum
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "operators/abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+// Receives the output of an operator chunk by chunk, each wrapped in a table of its own.
+using OutputChunkConsumer = std::function<void(const std::shared_ptr<const Table>&)>;
+
+/**
+ * Superclass for read-only operators that process their input chunk by chunk (currently, TableScan, Validate, and
+ * Projection). Chains of these operators can be executed as a single pipeline (see Leis et al., "Morsel-Driven
+ * Parallelism", SIGMOD 2014). Instead of having every operator materialize its entire output table before the next
+ * operator starts, each chunk (morsel) of the pipeline's input table is passed through all operators of the pipeline
+ * within the same job. As such, intermediate results only exist for single chunks and are likely to still be cached
+ * when the next operator processes them.
+ *
+ * Pipelines are formed when the OperatorTasks for a PQP are created (see OperatorTask::make_tasks_from_operator). A
+ * chunk-wise operator pipelines its left input if that input is a chunk-wise operator as well, if neither of them has
+ * been executed yet, and if this operator is the only consumer of the input. Only the topmost operator of a pipeline
+ * gets an OperatorTask. When it is executed, it executes the morsels of the entire pipeline. The other operators of
+ * the pipeline never hold an output table, but still report their output row and chunk counts.
+ *
+ * Within a pipeline, morsels are passed on as chunks with the columns of the pipeline's input table. Operators whose
+ * output chunks have different columns (Projection) can therefore only end a pipeline. Operators that consume their
+ * entire input before producing output (e.g., the build side of AggregateHash and both sides of JoinHash, which
+ * partition their inputs) are not chunk-wise and always break pipelines.
+ *
+ * Operators that are executed directly via execute() (e.g., in most tests) are never pipelined.
+ *
+ * The last operator of a pipeline can also stream its output (see try_stream_output). Then, every output chunk is
+ * passed to a consumer (e.g., the server, which sends it to the client) as soon as its morsel has been processed. This
+ * requires the columns of the streamed chunks to be known before the first morsel, which is the case for operators that
+ * keep their input columns and for Projections that only forward or reorder columns.
+ */
+class AbstractChunkwiseOperator : public AbstractReadOnlyOperator {
+ public:
+  using AbstractReadOnlyOperator::AbstractReadOnlyOperator;
+
+  // Executes the left input as part of this operator's pipeline if possible (see above). Returns whether the left
+  // input is pipelined.
+  bool try_pipeline_left_input();
+
+  bool pipelines_left_input() const override;
+
+  // Instead of collecting the output chunks in the output table, passes each of them to @param consumer as soon as it
+  // has been produced. The output table then has no chunks. The consumer is called concurrently by the workers that
+  // process the morsels and not in the order of the input chunks, so it has to be thread-safe. As it delays the
+  // morsel's worker, it should only hand the chunk over, e.g., to a bounded queue that applies backpressure (see
+  // Session). Returns false if the operator has already been executed or cannot be executed as a pipeline, in which
+  // case the output is produced as usual.
+  bool try_stream_output(const OutputChunkConsumer& consumer);
+
+  // Passes the chunks of an existing @param table to @param consumer, e.g., if an operator could not stream its output.
+  static void pass_chunks_to_consumer(const std::shared_ptr<const Table>& table, const OutputChunkConsumer& consumer);
+
+ protected:
+  // Returns whether the operator is executed as a pipeline, i.e., whether it pipelines its left input or streams its
+  // output.
+  bool _executes_as_pipeline() const;
+
+  // Executes the pipeline that ends with this operator. Called by the subclasses' _on_execute instead of their regular
+  // execution if _executes_as_pipeline() is true.
+  std::shared_ptr<const Table> _execute_pipeline();
+
+  // Returns whether the operator can currently be part of a pipeline.
+  virtual bool _can_be_pipelined() const;
+
+  // Returns whether the output chunks of the operator have the same columns as its input chunks. Only then can the
+  // operator pass its morsels on to another operator of the pipeline.
+  virtual bool _keeps_input_columns() const;
+
+  // Returns whether the operator can stream its output, i.e., whether its output columns do not depend on the morsels.
+  // By default, this is the case if the operator keeps its input columns.
+  virtual bool _can_stream_output() const;
+
+  // Wraps an output chunk of the last operator of a pipeline into a table for the consumer of the streamed output. By
+  // default, the table is a reference table with the columns of the pipeline's input table.
+  virtual std::shared_ptr<const Table> _make_streamed_table(const std::shared_ptr<const Table>& pipeline_input_table,
+                                                            const std::shared_ptr<Chunk>& chunk) const;
+
+  // Called for every operator of a pipeline before the first morsel is processed. All morsels have the same columns as
+  // the pipeline's input table.
+  virtual void _on_begin_pipeline(const std::shared_ptr<const Table>& pipeline_input_table) = 0;
+
+  // Processes the chunk `chunk_id` of `in_table` and returns the output chunk or nullptr if no row qualifies. For the
+  // first operator of the pipeline, `in_table` is the pipeline's input table. For the others, it is a reference table
+  // that holds the output of the previous operator as its only chunk. Called concurrently for different morsels.
+  virtual std::shared_ptr<Chunk> _on_execute_morsel(const std::shared_ptr<const Table>& in_table,
+                                                    const ChunkID chunk_id) = 0;
+
+  // Called for every operator of a pipeline after the last morsel has been processed.
+  virtual void _on_end_pipeline();
+
+  // Called for the last operator of a pipeline to create its output table from the non-empty output chunks of all
+  // morsels. By default, these are wrapped in a reference table with the columns of the pipeline's input table.
+  virtual std::shared_ptr<const Table> _build_pipeline_output(const std::shared_ptr<const Table>& pipeline_input_table,
+                                                              std::vector<std::shared_ptr<Chunk>>&& output_chunks);
+
+ private:
+  bool _pipelines_left_input{false};
+  OutputChunkConsumer _output_chunk_consumer;
+};
+
+}  // namespace opossum
@@ -68,9 +68,11 @@ void AbstractOperator::execute() {
   _transition_to(OperatorState::Running);
 
   if constexpr (HYRISE_DEBUG) {
-    Assert(!_left_input || _left_input->executed(), "Left input has not yet been executed");
+    // Pipelined inputs are executed as part of this operator's execution.
+    const auto left_input_is_pending = pipelines_left_input();
+    Assert(!_left_input || left_input_is_pending || _left_input->executed(), "Left input has not yet been executed");
     Assert(!_right_input || _right_input->executed(), "Right input has not yet been executed");
-    Assert(!_left_input || _left_input->get_output(), "Left input has no output data.");
+    Assert(!_left_input || left_input_is_pending || _left_input->get_output(), "Left input has no output data.");
     Assert(!_right_input || _right_input->get_output(), "Right input has no output data.");
   }
 
@@ -281,6 +283,8 @@ void AbstractOperator::set_parameters(const std::unordered_map<ParameterID, AllT
 
 OperatorState AbstractOperator::state() const { return _state; }
 
+bool AbstractOperator::pipelines_left_input() const { return false; }
+
 std::shared_ptr<OperatorTask> AbstractOperator::get_or_create_operator_task() {
   std::lock_guard<std::mutex> lock(_operator_task_mutex);
   // Return the OperatorTask that owns this operator if it already exists.
@@ -39,6 +39,7 @@ enum class OperatorType {
   JoinNestedLoop,
   JoinSortMerge,
   JoinVerification,
+  KeyIndexScan,
   Limit,
   Print,
   Product,
@@ -50,6 +51,7 @@ enum class OperatorType {
   UnionPositions,
   Update,
   Validate,
+  Window,
   Mock  // for Tests that need to Mock operators
 };
 
@@ -205,6 +207,11 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
 
   OperatorState state() const;
 
+  // Returns whether this operator executes its left input as part of its own execution, i.e., whether both are part of
+  // the same pipeline (see AbstractChunkwiseOperator). In that case, the left input does not get an OperatorTask and
+  // is not executed when this operator starts.
+  virtual bool pipelines_left_input() const;
+
   /**
    * Creates an OperatorTask that owns this operator, if not already existing.
    * @returns a shared pointer to the OperatorTask.
@@ -251,6 +258,10 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Weak pointer breaks cyclical dependency between operators and context
   std::optional<std::weak_ptr<TransactionContext>> _transaction_context;
 
+  // State management. Usually, only execute() and clear_output() transition the state. Pipelines also use it for the
+  // operators that they execute (see AbstractChunkwiseOperator).
+  void _transition_to(OperatorState new_state);
+
  private:
   // We track the number of consuming operators to automate the clearing of operator results.
   std::atomic_int32_t _consumer_count = 0;
@@ -261,7 +272,6 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
 
   // State management
   std::atomic<OperatorState> _state{OperatorState::Created};
-  void _transition_to(OperatorState new_state);
 
   /**
    * OperatorTasks wrap operators for scheduling. Since operator results are shared between uncorrelated subqueries
@@ -51,6 +51,12 @@ void AbstractReadWriteOperator::rollback_records() {
   _rw_state = ReadWriteOperatorState::RolledBack;
 }
 
+void AbstractReadWriteOperator::log_records(RedoLogRecordBuilder& record_builder) const {
+  Assert(_rw_state == ReadWriteOperatorState::Executed, "Operator needs to have state Executed in order to be logged.");
+
+  _on_log_records(record_builder);
+}
+
 bool AbstractReadWriteOperator::execute_failed() const {
   return _rw_state == ReadWriteOperatorState::Conflicted || _rw_state == ReadWriteOperatorState::RolledBack;
 }
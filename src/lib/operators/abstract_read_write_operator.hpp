@@ -13,6 +13,8 @@
 
 namespace opossum {
 
+class RedoLogRecordBuilder;
+
 enum class ReadWriteOperatorState {
   Pending,     // The operator has been instantiated.
   Executed,    // Execution succeeded.
@@ -48,6 +50,12 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   void rollback_records();
 
+  /**
+   * Adds the changes made by the operator to the redo log record of the committing transaction. Called after the
+   * commit id has been assigned, but before commit_records.
+   */
+  void log_records(RedoLogRecordBuilder& record_builder) const;
+
   /**
    * Returns true if a previous call to _on_execute produced an error.
    */
@@ -80,6 +88,12 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   virtual void _on_rollback_records() = 0;
 
+  /**
+   * Called by log_records. Operators that do not modify data themselves (e.g., Update, which uses nested Delete and
+   * Insert operators) do not need to log anything.
+   */
+  virtual void _on_log_records(RedoLogRecordBuilder& record_builder) const {}
+
   /**
    * This method is used in sub classes in their _on_execute() method.
    *
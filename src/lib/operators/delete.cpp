@@ -4,6 +4,7 @@
 #include <string>
 #include <utility>
 
+#include "concurrency/redo_log.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
@@ -95,6 +96,7 @@ void Delete::_on_commit_records(const CommitID commit_id) {
     const auto referencing_segment =
         std::static_pointer_cast<const ReferenceSegment>(referencing_chunk->get_segment(ColumnID{0}));
     const auto referenced_table = referencing_segment->referenced_table();
+    referenced_table->update_last_modification_commit_id(commit_id);
 
     for (const auto row_id : *referencing_segment->pos_list()) {
       const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
@@ -130,6 +132,16 @@ void Delete::_on_rollback_records() {
   }
 }
 
+void Delete::_on_log_records(RedoLogRecordBuilder& record_builder) const {
+  for (ChunkID referencing_chunk_id{0}; referencing_chunk_id < _referencing_table->chunk_count();
+       ++referencing_chunk_id) {
+    const auto referencing_chunk = _referencing_table->get_chunk(referencing_chunk_id);
+    const auto referencing_segment =
+        std::static_pointer_cast<const ReferenceSegment>(referencing_chunk->get_segment(ColumnID{0}));
+    record_builder.add_delete(referencing_segment->referenced_table(), *referencing_segment->pos_list());
+  }
+}
+
 std::shared_ptr<AbstractOperator> Delete::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input,
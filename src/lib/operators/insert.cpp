@@ -3,12 +3,17 @@
 #include <algorithm>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
+#include "concurrency/redo_log.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "statistics/table_statistics_delta.hpp"
 #include "storage/abstract_encoded_segment.hpp"
+#include "storage/index/table_key_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
@@ -68,6 +73,18 @@ void copy_value_range(const std::shared_ptr<const AbstractSegment>& source_abstr
   }
 }
 
+// Appends a new mutable chunk to the table if its last chunk is still `last_chunk` (or, if `last_chunk` is nullptr,
+// if the table has no chunks). Otherwise, a concurrent Insert has already appended a new chunk.
+void append_mutable_chunk_if_last(Table& table, const std::shared_ptr<Chunk>& last_chunk) {
+  const auto append_lock = table.acquire_append_mutex();
+
+  const auto chunk_count = table.chunk_count();
+  const auto current_last_chunk = chunk_count > 0 ? table.get_chunk(ChunkID{chunk_count - 1}) : nullptr;
+  if (current_last_chunk != last_chunk) return;
+
+  table.append_mutable_chunk();
+}
+
 }  // namespace
 
 namespace opossum {
@@ -93,82 +110,83 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
 
   /**
    * 1. Allocate the required rows in the target Table, without actually copying data to them.
-   *    Do so while locking the table to prevent multiple threads modifying the table's size simultaneously.
-   *    Since allocation is expected to be faster than writing to the memory, allocating under lock and then writing -
-   *    in a second step - without lock will minimize the time that the Table's append_mutex is locked.
+   *    Rows are reserved atomically per chunk (see Chunk::reserve_rows), so that concurrent Inserts into the same table
+   *    do not have to lock it. Only appending a new chunk, which happens once every target_chunk_size rows, is done
+   *    under the Table's append_mutex. Copying the data is done in a second step.
    */
-  {
-    const auto append_lock = _target_table->acquire_append_mutex();
+  const auto target_chunk_size = _target_table->target_chunk_size();
+  auto remaining_rows = left_input_table()->row_count();
+  while (remaining_rows > 0) {
+    const auto chunk_count = _target_table->chunk_count();
+    const auto target_chunk_id = ChunkID{chunk_count > 0 ? chunk_count - 1 : 0};
+    const auto target_chunk = chunk_count > 0 ? _target_table->get_chunk(target_chunk_id) : nullptr;
+
+    // If the last Chunk of the target Table is either immutable or full, append a new mutable Chunk
+    if (!target_chunk || !target_chunk->is_mutable()) {
+      append_mutable_chunk_if_last(*_target_table, target_chunk);
+      continue;
+    }
 
-    auto remaining_rows = left_input_table()->row_count();
+    const auto& mvcc_data = target_chunk->mvcc_data();
+    DebugAssert(mvcc_data, "Insert cannot operate on a table without MVCC data");
 
-    if (_target_table->chunk_count() == 0) {
-      _target_table->append_mutable_chunk();
+    const auto [begin_chunk_offset, end_chunk_offset] = target_chunk->reserve_rows(
+        static_cast<ChunkOffset>(std::min<size_t>(remaining_rows, target_chunk_size)), target_chunk_size);
+    if (begin_chunk_offset == end_chunk_offset) {
+      append_mutable_chunk_if_last(*_target_table, target_chunk);
+      continue;
     }
-    while (remaining_rows > 0) {
-      auto target_chunk_id = ChunkID{_target_table->chunk_count() - 1};
-      auto target_chunk = _target_table->get_chunk(target_chunk_id);
-
-      // If the last Chunk of the target Table is either immutable or full, append a new mutable Chunk
-      if (!target_chunk->is_mutable() || target_chunk->size() == _target_table->target_chunk_size()) {
-        _target_table->append_mutable_chunk();
-        ++target_chunk_id;
-        target_chunk = _target_table->get_chunk(target_chunk_id);
-      }
 
-      const auto num_rows_for_target_chunk =
-          std::min<size_t>(_target_table->target_chunk_size() - target_chunk->size(), remaining_rows);
-
-      _target_chunk_ranges.emplace_back(
-          ChunkRange{target_chunk_id, target_chunk->size(),
-                     static_cast<ChunkOffset>(target_chunk->size() + num_rows_for_target_chunk)});
-
-      // Mark new (but still empty) rows as being under modification by current transaction.
-      // Do so before resizing the Segments, because the resize of `Chunk::_segments.front()` is what releases the
-      // new row count.
-      {
-        const auto& mvcc_data = target_chunk->mvcc_data();
-        DebugAssert(mvcc_data, "Insert cannot operate on a table without MVCC data");
-        const auto transaction_id = context->transaction_id();
-        const auto end_offset = target_chunk->size() + num_rows_for_target_chunk;
-        for (auto target_chunk_offset = target_chunk->size(); target_chunk_offset < end_offset; ++target_chunk_offset) {
-          DebugAssert(mvcc_data->get_begin_cid(target_chunk_offset) == MvccData::MAX_COMMIT_ID, "Invalid begin CID");
-          DebugAssert(mvcc_data->get_end_cid(target_chunk_offset) == MvccData::MAX_COMMIT_ID, "Invalid end CID");
-          mvcc_data->set_tid(target_chunk_offset, transaction_id, std::memory_order_relaxed);
-        }
-      }
+    // Register the Insert before it grows the chunk (see _finalize_chunk_if_completed)
+    ++mvcc_data->pending_insert_count;
 
-      // Make sure the MVCC data is written before the first segment (and thus the chunk) is resized
-      std::atomic_thread_fence(std::memory_order_seq_cst);
+    _target_chunk_ranges.emplace_back(ChunkRange{target_chunk_id, begin_chunk_offset, end_chunk_offset});
 
-      // Grow data Segments.
-      // Do so in REVERSE column order so that the resize of `Chunk::_segments.front()` happens last. It is this last
-      // resize that makes the new row count visible to the outside world.
-      auto old_size = target_chunk->size();
-      for (ColumnID reverse_column_id{0}; reverse_column_id < target_chunk->column_count(); ++reverse_column_id) {
-        const auto column_id = static_cast<ColumnID>(target_chunk->column_count() - reverse_column_id - 1);
+    // Mark new (but still empty) rows as being under modification by current transaction.
+    // Do so before resizing the Segments, because the resize of `Chunk::_segments.front()` is what releases the
+    // new row count.
+    const auto transaction_id = context->transaction_id();
+    for (auto target_chunk_offset = begin_chunk_offset; target_chunk_offset < end_chunk_offset;
+         ++target_chunk_offset) {
+      DebugAssert(mvcc_data->get_begin_cid(target_chunk_offset) == MvccData::MAX_COMMIT_ID, "Invalid begin CID");
+      DebugAssert(mvcc_data->get_end_cid(target_chunk_offset) == MvccData::MAX_COMMIT_ID, "Invalid end CID");
+      mvcc_data->set_tid(target_chunk_offset, transaction_id, std::memory_order_relaxed);
+    }
 
-        resolve_data_type(_target_table->column_data_type(column_id), [&](const auto data_type_t) {
-          using ColumnDataType = typename decltype(data_type_t)::type;
+    // Segments cannot be resized concurrently, and a chunk's size must never cover rows whose transaction ID has not
+    // been set yet. Thus, Inserts grow the chunk in the order of their reservations. Until the Inserts that reserved
+    // the preceding rows are done with this (which takes only a couple of instructions), wait for them.
+    while (target_chunk->size() != begin_chunk_offset) {
+      std::this_thread::yield();
+    }
 
-          const auto value_segment =
-              std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(target_chunk->get_segment(column_id));
-          Assert(value_segment, "Cannot insert into non-ValueSegments");
+    // Make sure the MVCC data is written before the first segment (and thus the chunk) is resized
+    std::atomic_thread_fence(std::memory_order_seq_cst);
 
-          const auto new_size = old_size + num_rows_for_target_chunk;
+    // Grow data Segments.
+    // Do so in REVERSE column order so that the resize of `Chunk::_segments.front()` happens last. It is this last
+    // resize that makes the new row count visible to the outside world.
+    for (ColumnID reverse_column_id{0}; reverse_column_id < target_chunk->column_count(); ++reverse_column_id) {
+      const auto column_id = static_cast<ColumnID>(target_chunk->column_count() - reverse_column_id - 1);
 
-          // Cannot guarantee resize without reallocation. The ValueSegment should have been allocated with the target
-          // table's target chunk size reserved.
-          Assert(value_segment->values().capacity() >= new_size, "ValueSegment too small");
-          value_segment->resize(new_size);
-        });
+      resolve_data_type(_target_table->column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
 
-        // Make sure the first column's resize actually happens last and doesn't get reordered.
-        std::atomic_thread_fence(std::memory_order_seq_cst);
-      }
+        const auto value_segment =
+            std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(target_chunk->get_segment(column_id));
+        Assert(value_segment, "Cannot insert into non-ValueSegments");
+
+        // Cannot guarantee resize without reallocation. The ValueSegment should have been allocated with the target
+        // table's target chunk size reserved.
+        Assert(value_segment->values().capacity() >= end_chunk_offset, "ValueSegment too small");
+        value_segment->resize(end_chunk_offset);
+      });
 
-      remaining_rows -= num_rows_for_target_chunk;
+      // Make sure the first column's resize actually happens last and doesn't get reordered.
+      std::atomic_thread_fence(std::memory_order_seq_cst);
     }
+
+    remaining_rows -= end_chunk_offset - begin_chunk_offset;
   }
 
   /**
@@ -213,10 +231,33 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
     }
   }
 
+  /**
+   * 3. Add the inserted rows to the key indexes of the target table. This fails if a row violates a key constraint,
+   *    i.e., if its key already exists (or is inserted by a concurrent transaction). Rows inserted so far are removed
+   *    from the indexes again when the transaction is rolled back.
+   */
+  const auto transaction_id = context->transaction_id();
+  for (const auto& key_index : _target_table->key_indexes()) {
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      for (auto chunk_offset = target_chunk_range.begin_chunk_offset;
+           chunk_offset < target_chunk_range.end_chunk_offset; ++chunk_offset) {
+        if (!key_index->try_insert(RowID{target_chunk_range.chunk_id, chunk_offset}, transaction_id)) {
+          _mark_as_failed();
+          return nullptr;
+        }
+      }
+    }
+  }
+
   return nullptr;
 }
 
 void Insert::_on_commit_records(const CommitID cid) {
+  _target_table->update_last_modification_commit_id(cid);
+
+  // The committed rows are merged into the table statistics asynchronously, see StatisticsRefresher.
+  const auto table_statistics_delta = _target_table->table_statistics_delta();
+
   for (const auto& target_chunk_range : _target_chunk_ranges) {
     const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
     auto mvcc_data = target_chunk->mvcc_data();
@@ -229,10 +270,27 @@ void Insert::_on_commit_records(const CommitID cid) {
 
     // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
     std::atomic_thread_fence(std::memory_order_release);
+
+    if (table_statistics_delta) {
+      table_statistics_delta->add_rows(*target_chunk, target_chunk_range.begin_chunk_offset,
+                                       target_chunk_range.end_chunk_offset);
+    }
+
+    _finalize_chunk_if_completed(target_chunk);
   }
 }
 
 void Insert::_on_rollback_records() {
+  // Remove the rows from the key indexes. This reads their keys, so it has to happen while the values are still there.
+  for (const auto& key_index : _target_table->key_indexes()) {
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      for (auto chunk_offset = target_chunk_range.begin_chunk_offset;
+           chunk_offset < target_chunk_range.end_chunk_offset; ++chunk_offset) {
+        key_index->erase(RowID{target_chunk_range.chunk_id, chunk_offset});
+      }
+    }
+  }
+
   for (const auto& target_chunk_range : _target_chunk_ranges) {
     const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
     auto mvcc_data = target_chunk->mvcc_data();
@@ -270,6 +328,34 @@ void Insert::_on_rollback_records() {
 
     // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
     std::atomic_thread_fence(std::memory_order_release);
+
+    _finalize_chunk_if_completed(target_chunk);
+  }
+}
+
+void Insert::_finalize_chunk_if_completed(const std::shared_ptr<Chunk>& target_chunk) const {
+  /**
+   * A chunk is completed once it is full and all Inserts that allocated rows in it have committed or rolled back. The
+   * size has to be read BEFORE this Insert is deregistered: an Insert that fills up the chunk registers itself before
+   * it grows the chunk (see _on_execute). Thus, if the chunk is full here, the pending insert count can only drop to
+   * zero once that Insert is done as well. Exactly one Insert observes the count dropping to zero.
+   */
+  const auto chunk_is_full = target_chunk->size() == _target_table->target_chunk_size();
+  const auto is_last_pending_insert = target_chunk->mvcc_data()->pending_insert_count.fetch_sub(1) == 1;
+  if (!chunk_is_full || !is_last_pending_insert || !target_chunk->is_mutable()) return;
+
+  // Finalizing the chunk sets its max_begin_cid, which speeds up the Validate operator. The pruning statistics allow
+  // the ChunkPruningRule to skip the chunk. As long as a chunk is mutable, it does not have pruning statistics and is
+  // never pruned: a cached plan that pruned it would miss rows inserted later.
+  target_chunk->finalize();
+  generate_chunk_pruning_statistics(target_chunk);
+}
+
+void Insert::_on_log_records(RedoLogRecordBuilder& record_builder) const {
+  for (const auto& target_chunk_range : _target_chunk_ranges) {
+    record_builder.add_insert(_target_table_name, *_target_table,
+                              RowID{target_chunk_range.chunk_id, target_chunk_range.begin_chunk_offset},
+                              target_chunk_range.end_chunk_offset - target_chunk_range.begin_chunk_offset);
   }
 }
 
@@ -10,6 +10,7 @@
 
 namespace opossum {
 
+class Chunk;
 class TransactionContext;
 
 /**
@@ -17,6 +18,9 @@ class TransactionContext;
  * Expects the table name of the table to insert into as a string and
  * the values to insert in a separate table using the same column layout.
  *
+ * If the target table has key indexes (see Table::create_key_index), the Insert fails (i.e., conflicts) if a row
+ * violates one of the respective key constraints.
+ *
  * Assumption: The input has been validated before.
  */
 class Insert : public AbstractReadWriteOperator {
@@ -35,8 +39,12 @@ class Insert : public AbstractReadWriteOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_commit_records(const CommitID cid) override;
   void _on_rollback_records() override;
+  void _on_log_records(RedoLogRecordBuilder& record_builder) const override;
 
  private:
+  // Finalizes a chunk and generates its pruning statistics if this Insert was the last one to complete in it.
+  void _finalize_chunk_if_completed(const std::shared_ptr<Chunk>& target_chunk) const;
+
   const std::string _target_table_name;
 
   // Ranges of rows to which the inserted values are written
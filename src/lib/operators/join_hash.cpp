@@ -301,7 +301,7 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
      * tasks themselves. For example, materialize parallelizes over the input chunks and the following steps over the
      * radix clusters.
      *
-     * Bloom filters can be used to skip rows that will not find a join partner. They are not shown here.
+     * Bloom filters are used to skip rows that will not find a join partner. They are not shown here.
      *
      *            Build Table                          Probe Table
      *                 |                                    |
@@ -353,6 +353,12 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
       }
     };
 
+    // The side that is materialized second is filtered by the Bloom filter of the first side. The Bloom filter created
+    // while materializing the second side is then used to filter the first side during radix partitioning or, if no
+    // partitioning takes place, when building the hash tables (build side only).
+    auto build_side_is_filtered = false;
+    auto probe_side_is_filtered = false;
+
     Timer timer_materialization;
     if (_build_input_table->row_count() < _probe_input_table->row_count()) {
       // When materializing the first side (here: the build side), we do not yet have a Bloom filter. To keep the number
@@ -362,14 +368,17 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
       _performance_data.set_step_runtime(OperatorSteps::BuildSideMaterializing, timer_materialization.lap());
       materialize_probe_side(build_side_bloom_filter);
       _performance_data.set_step_runtime(OperatorSteps::ProbeSideMaterializing, timer_materialization.lap());
+      // Sides that keep NULL values are not filtered (see materialize_input).
+      probe_side_is_filtered = !keep_nulls_probe_column;
     } else {
       // Here, we first materialize the probe side and use the resulting Bloom filter in the materialization of the
-      // build side. Consequently, the Bloom filter later passed into build() will have no effect as it has already
-      // been used here to filter non-matching values.
+      // build side. Consequently, the Bloom filter does not need to be passed into build() as it has already been used
+      // here to filter non-matching values.
       materialize_probe_side(ALL_TRUE_BLOOM_FILTER);
       _performance_data.set_step_runtime(OperatorSteps::ProbeSideMaterializing, timer_materialization.lap());
       materialize_build_side(probe_side_bloom_filter);
       _performance_data.set_step_runtime(OperatorSteps::BuildSideMaterializing, timer_materialization.lap());
+      build_side_is_filtered = !keep_nulls_build_column;
     }
 
     // Store the number of materialized values. Depending on the order of materialization (which depends on the input
@@ -382,10 +391,9 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
     }
 
     /**
-     * 2. Perform radix partitioning for build and probe sides. The Bloom filters are not used in this step. Future work
-     *    could use them on the build side to exclude them for values that are not seen on the probe side. That would
-     *    reduce the size of the intermediary results, but would require an adapted calculation of the output offsets
-     *    within partition_by_radix.
+     * 2. Perform radix partitioning for build and probe sides. The side that has not been filtered during its
+     *    materialization is filtered with the other side's Bloom filter. This reduces the size of the intermediary
+     *    results. Partitioning does not filter sides that keep NULL values (see partition_by_radix).
      */
     if (_radix_bits > 0) {
       Timer timer_clustering;
@@ -398,7 +406,9 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
               materialized_build_column, histograms_build_column, _radix_bits);
         } else {
           radix_build_column = partition_by_radix<BuildColumnType, HashedType, false>(
-              materialized_build_column, histograms_build_column, _radix_bits);
+              materialized_build_column, histograms_build_column, _radix_bits,
+              build_side_is_filtered ? ALL_TRUE_BLOOM_FILTER : probe_side_bloom_filter);
+          build_side_is_filtered = true;
         }
 
         // After the data in materialized_build_column has been partitioned, it is not needed anymore.
@@ -412,7 +422,8 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
               materialized_probe_column, histograms_probe_column, _radix_bits);
         } else {
           radix_probe_column = partition_by_radix<ProbeColumnType, HashedType, false>(
-              materialized_probe_column, histograms_probe_column, _radix_bits);
+              materialized_probe_column, histograms_probe_column, _radix_bits,
+              probe_side_is_filtered ? ALL_TRUE_BLOOM_FILTER : build_side_bloom_filter);
         }
 
         // After the data in materialized_probe_column has been partitioned, it is not needed anymore.
@@ -436,17 +447,18 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
      *    In the case of semi or anti joins, we do not need to track all rows on the hashed side, just one per value.
      *    value. However, if we have secondary predicates, those might fail on that single row. In that case, we DO need
      *    all rows.
-     *    We use the probe side's Bloom filter to exclude values from the hash table that will not be accessed in the
-     *    probe step.
+     *    If the build side has not been filtered yet, we use the probe side's Bloom filter to exclude values from the
+     *    hash table that will not be accessed in the probe step.
      */
     Timer timer_hash_map_building;
+    const auto& build_bloom_filter = build_side_is_filtered ? ALL_TRUE_BLOOM_FILTER : probe_side_bloom_filter;
     if (_secondary_predicates.empty() &&
         (_mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse)) {
       hash_tables = build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::ExistenceOnly,
-                                                       _radix_bits, probe_side_bloom_filter);
+                                                       _radix_bits, build_bloom_filter);
     } else {
       hash_tables = build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::AllPositions, _radix_bits,
-                                                       probe_side_bloom_filter);
+                                                       build_bloom_filter);
     }
     _performance_data.set_step_runtime(OperatorSteps::Building, timer_hash_map_building.lap());
 
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Register-blocked Bloom filter used by the hash join to skip values that will not find a join partner (see Putze et
+ * al., "Cache-, Hash-, and Space-Efficient Bloom Filters", WEA 2007). All HASH_FUNCTION_COUNT bits of a value are
+ * located in the same 64-bit word. As such, inserting or checking a value requires a single memory access. Compared to
+ * a standard Bloom filter of the same size, the false positive rate is slightly higher.
+ *
+ * The filter is sized according to the number of values that are expected to be inserted (see bit_count_for()). The
+ * hash join passes in values that have been hashed with std::hash, which is the identity function for integers. The
+ * filter thus mixes the hash value before deriving the word and the bits from it.
+ */
+class BloomFilter {
+ public:
+  static constexpr auto HASH_FUNCTION_COUNT = 3;
+  static constexpr auto BITS_PER_VALUE = size_t{16};
+
+  // The minimum size is chosen so that a filter for few values has virtually no false positives while still fitting
+  // into the L1 cache. The maximum size limits the memory allocated per materialization task (see materialize_input).
+  static constexpr auto MIN_BIT_COUNT = size_t{1} << 16;
+  static constexpr auto MAX_BIT_COUNT = size_t{1} << 23;
+
+  // A default-constructed filter consists of a single word with all bits set. It contains every value and can be used
+  // where no filtering should take place without introducing a branch in the hot loops.
+  BloomFilter() : _words(1, ~uint64_t{0}), _word_mask(0) {}
+
+  // Creates an empty filter with the given number of bits, which has to be a power of two of at least 64.
+  explicit BloomFilter(const size_t bit_count) : _words(bit_count / 64), _word_mask(bit_count / 64 - 1) {
+    Assert(bit_count >= 64 && (bit_count & (bit_count - 1)) == 0, "Bit count must be a power of two of at least 64");
+  }
+
+  // Returns the number of bits for a filter that holds up to value_count distinct values.
+  static size_t bit_count_for(const size_t value_count) {
+    auto bit_count = MIN_BIT_COUNT;
+    while (bit_count < MAX_BIT_COUNT && bit_count < value_count * BITS_PER_VALUE) {
+      bit_count <<= 1;
+    }
+    return bit_count;
+  }
+
+  void insert(const size_t hash) {
+    const auto mixed_hash = _mix(hash);
+    _words[_word_index(mixed_hash)] |= _bit_pattern(mixed_hash);
+  }
+
+  bool contains(const size_t hash) const {
+    const auto mixed_hash = _mix(hash);
+    const auto bit_pattern = _bit_pattern(mixed_hash);
+    return (_words[_word_index(mixed_hash)] & bit_pattern) == bit_pattern;
+  }
+
+  // Merges a filter of the same size (e.g., one that was built by a different thread) into this filter.
+  BloomFilter& operator|=(const BloomFilter& other) {
+    Assert(_words.size() == other._words.size(), "Only Bloom filters of the same size can be merged");
+    for (auto word_idx = size_t{0}; word_idx < _words.size(); ++word_idx) {
+      _words[word_idx] |= other._words[word_idx];
+    }
+    return *this;
+  }
+
+  bool operator==(const BloomFilter& other) const { return _words == other._words; }
+
+  size_t bit_count() const { return _words.size() * 64; }
+
+ protected:
+  static uint64_t _mix(const size_t hash) {
+    // Fold the upper half into the lower half and use Fibonacci hashing. The upper bits of the product depend on all
+    // bits of the input.
+    return (static_cast<uint64_t>(hash) ^ (static_cast<uint64_t>(hash) >> 32)) * uint64_t{0x9E3779B97F4A7C15};
+  }
+
+  size_t _word_index(const uint64_t mixed_hash) const { return (mixed_hash >> 40) & _word_mask; }
+
+  static uint64_t _bit_pattern(const uint64_t mixed_hash) {
+    auto bit_pattern = uint64_t{0};
+    for (auto hash_function_idx = 0; hash_function_idx < HASH_FUNCTION_COUNT; ++hash_function_idx) {
+      bit_pattern |= uint64_t{1} << ((mixed_hash >> (22 + 6 * hash_function_idx)) & 63);
+    }
+    return bit_pattern;
+  }
+
+  std::vector<uint64_t> _words;
+  size_t _word_mask;
+};
+
+// Referenced where a Bloom filter is expected but no values should be filtered.
+inline const auto ALL_TRUE_BLOOM_FILTER = BloomFilter{};
+
+/**
+ * Checking a Bloom filter only pays off if it filters out a significant share of the values. Otherwise, the random
+ * accesses to the filter slow down the materialization without reducing the amount of work in the later steps. Each
+ * task that checks values against a Bloom filter does so through an AdaptiveBloomFilter. It checks the first
+ * SAMPLE_SIZE values against the filter and stops using it if more than MAX_PASS_RATIO of them passed. The decision is
+ * shared between the tasks through `is_selective`, so that tasks started afterwards do not check the filter at all.
+ */
+class AdaptiveBloomFilter {
+ public:
+  static constexpr auto SAMPLE_SIZE = size_t{1'000};
+  static constexpr auto MAX_PASS_RATIO = 0.8;
+
+  AdaptiveBloomFilter(const BloomFilter& bloom_filter, std::atomic_bool& is_selective)
+      : _bloom_filter(is_selective ? &bloom_filter : &ALL_TRUE_BLOOM_FILTER),
+        _is_selective(is_selective),
+        _sampled_value_count(is_selective ? 0 : SAMPLE_SIZE) {}
+
+  bool contains(const size_t hash) {
+    const auto result = _bloom_filter->contains(hash);
+    if (_sampled_value_count == SAMPLE_SIZE) return result;
+
+    _passed_value_count += result;
+    ++_sampled_value_count;
+    if (_sampled_value_count == SAMPLE_SIZE &&
+        static_cast<double>(_passed_value_count) > MAX_PASS_RATIO * static_cast<double>(SAMPLE_SIZE)) {
+      _bloom_filter = &ALL_TRUE_BLOOM_FILTER;
+      _is_selective = false;
+    }
+    return result;
+  }
+
+ protected:
+  const BloomFilter* _bloom_filter;
+  std::atomic_bool& _is_selective;
+  size_t _sampled_value_count;
+  size_t _passed_value_count{0};
+};
+
+}  // namespace opossum
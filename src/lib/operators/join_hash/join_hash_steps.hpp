@@ -1,17 +1,19 @@
 #pragma once
 
+#include <boost/container/pmr/global_resource.hpp>
 #include <boost/container/pmr/monotonic_buffer_resource.hpp>
 #include <boost/container/pmr/unsynchronized_pool_resource.hpp>
 #include <boost/container/small_vector.hpp>
-#include <boost/dynamic_bitset.hpp>
 #include <boost/lexical_cast.hpp>
 #include <uninitialized_vector.hpp>
 
 #include "bytell_hash_map.hpp"
 #include "hyrise.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_hash/bloom_filter.hpp"
 #include "operators/multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_scheduler.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
@@ -52,10 +54,13 @@ struct PartitionedElement {
 template <typename T>
 struct Partition {
   // Initializing the partition vector takes some time. This is not necessary, because it will be overwritten anyway.
-  // The uninitialized_vector behaves like a regular std::vector, but the entries are initially invalid.
-  std::conditional_t<std::is_trivially_destructible_v<T>, uninitialized_vector<PartitionedElement<T>>,
-                     std::vector<PartitionedElement<T>>>
-      elements;
+  // The uninitialized_vector behaves like a regular std::vector, but the entries are initially invalid. A polymorphic
+  // allocator is used so that radix partitions can be placed on a specific NUMA node (see partition_by_radix).
+  using Allocator = PolymorphicAllocator<PartitionedElement<T>>;
+  using Elements = std::conditional_t<std::is_trivially_destructible_v<T>,
+                                      uninitialized_vector<PartitionedElement<T>, Allocator>,
+                                      pmr_vector<PartitionedElement<T>>>;
+  Elements elements;
 
   // Bit vector to store NULL flags - not using uninitialized_vector because it is not specialized for bool.
   // It is stored independently of the elements as adding a single bit to PartitionedElement would cause memory waste
@@ -72,6 +77,34 @@ struct Partition {
 template <typename T>
 using RadixContainer = std::vector<Partition<T>>;
 
+// On NUMA systems, the radix partitions are assigned to the nodes in a round-robin fashion. The build and probe
+// partitions with the same index are allocated on the same node. The jobs that build the hash table for a partition and
+// that probe it are scheduled on that node. As workers are pinned to the CPUs of their node, the hash table is
+// allocated on that node as well. Returns CURRENT_NODE_ID if the scheduler does not have multiple nodes.
+inline NodeID node_id_for_partition(const size_t partition_idx) {
+  const auto node_count = Hyrise::get().scheduler()->queues().size();
+  if (node_count <= 1) return CURRENT_NODE_ID;
+  return NodeID{static_cast<NodeID::base_type>(partition_idx % node_count)};
+}
+
+// Schedules each job on the given node and waits for all jobs to finish. Different from schedule_and_wait_for_tasks(),
+// jobs with a preferred node are not grouped, as a group of jobs is executed by a single worker.
+inline void schedule_and_wait_for_partition_jobs(const std::vector<std::shared_ptr<AbstractTask>>& jobs,
+                                                 const std::vector<NodeID>& node_ids) {
+  DebugAssert(jobs.size() == node_ids.size(), "Expected one node id per job");
+  const auto has_preferred_node =
+      std::any_of(node_ids.begin(), node_ids.end(), [](const auto node_id) { return node_id != CURRENT_NODE_ID; });
+  if (!has_preferred_node) {
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    return;
+  }
+
+  for (auto job_idx = size_t{0}; job_idx < jobs.size(); ++job_idx) {
+    jobs[job_idx]->schedule(node_ids[job_idx]);
+  }
+  AbstractScheduler::wait_for_tasks(jobs);
+}
+
 // Stores the mapping from HashedType to positions. Conceptually, this is similar to an (unordered_)multimap, but it has
 // some optimizations for the performance-critical probe() method. Instead of storing the matches directly in the
 // hashmap (think map<HashedType, PosList>), we store an offset - thus OffsetHashTable. This keeps the hashmap small and
@@ -222,42 +255,19 @@ class PosHashTable {
   std::optional<UnifiedPosList> _unified_pos_list{};
 };
 
-// The Bloom filter (with k=1) is used during the materialization and build phases. It contains `true` for each
-// `hash_function(value) % BLOOM_FILTER_SIZE`. Much of how the Bloom filter is used in the hash join could be improved:
-// (1) Dynamically check whether Bloom filters are worth the memory and computational costs. This could be based on the
-//     input table sizes, the expected cardinalities, the hardware characteristics, or other factors.
-// (2) Choosing an appropriate filter size. 2^20 was experimentally found to be good for TPC-H SF 10, but is certainly
-//     not optimal in every situation.
-// (3) Evaluate whether using multiple hash functions (k>1) brings any improvement. In a first experiment, however, we
-//     saw no benefits for single-threaded TPC-H SF 10.
-// (4) Use the probe side Bloom filter when partitioning the build side. By doing that, we reduce the size of the
-//     intermediary results. When a Bloom filter-supported partitioning has been done (i.e., partitioning has not
-//     been skipped), we do not need to use a Bloom filter in the build phase anymore.
-// Some of these points could be addressed with relatively low effort and should bring additional, significant benefits.
-// We did not yet work on this because the Bloom filter was a byproduct of a research project and we have not had the
-// resources to optimize it at the time.
-static constexpr auto BLOOM_FILTER_SIZE = 1 << 20;
-static constexpr auto BLOOM_FILTER_MASK = BLOOM_FILTER_SIZE - 1;
-
-// Using dynamic_bitset because, different from vector<bool>, it has an efficient operator| implementation, which is
-// needed for merging partial Bloom filters created by different threads. Note that the dynamic_bitset(n, value)
-// constructor does not do what you would expect it to, so try to avoid it.
-using BloomFilter = boost::dynamic_bitset<>;
-
-// ALL_TRUE_BLOOM_FILTER is initialized by creating a BloomFilter with every value being false and using bitwise
-// negation (~x). As the negation is surprisingly expensive, we create a static empty Bloom filter and reference
-// it where needed. Having a Bloom filter that always returns true avoids a branch in the hot loop.
-static const auto ALL_TRUE_BLOOM_FILTER = ~BloomFilter(BLOOM_FILTER_SIZE);
+// Bloom filters (see bloom_filter.hpp) are used in both directions: The filter of the side that is materialized first
+// is used to skip values when materializing the other side. The filter created during that second materialization is
+// used when radix partitioning the first side (or, if no partitioning takes place, when building the hash tables).
+// Every task decides on its own whether checking the filter pays off (see AdaptiveBloomFilter).
 
 // @param in_table             Table to materialize
 // @param column_id            Column within that table to materialize
 // @param histograms           Out: If radix_bits > 0, contains one histogram per chunk where each histogram contains
 //                             1 << radix_bits slots
 // @param radix_bits           Number of radix_bits, needed only for histogram calculation
-// @param output_bloom_filter  Out: A filled BloomFilter where `value & BLOOM_FILTER_MASK == true` for each value
-//                             encountered in the input column
-// @param input_bloom_filter   Optional: Materialization is skipped for each value where the corresponding slot in the
-//                             Bloom filter is false
+// @param output_bloom_filter  Out: A BloomFilter, sized for the input table, that contains each value materialized
+// @param input_bloom_filter   Optional: Materialization is skipped for each value not contained in the Bloom filter
+//                             (unless the filter turns out not to be selective, see AdaptiveBloomFilter)
 template <typename T, typename HashedType, bool keep_null_values>
 RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
                                     std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
@@ -278,11 +288,10 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   const auto pass = size_t{0};
   const auto radix_mask = static_cast<size_t>(pow(2, radix_bits * (pass + 1)) - 1);
 
-  Assert(output_bloom_filter.empty(), "output_bloom_filter should be empty");
-  output_bloom_filter.resize(BLOOM_FILTER_SIZE);
+  output_bloom_filter = BloomFilter{BloomFilter::bit_count_for(in_table->row_count())};
   std::mutex output_bloom_filter_mutex;
 
-  Assert(input_bloom_filter.size() == BLOOM_FILTER_SIZE, "Invalid input_bloom_filter");
+  auto input_bloom_filter_is_selective = std::atomic_bool{true};
 
   // Create histograms per chunk
   histograms.resize(chunk_count);
@@ -300,9 +309,10 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
       std::reference_wrapper<BloomFilter> used_output_bloom_filter = output_bloom_filter;
       if (Hyrise::get().is_multi_threaded()) {
         // We cannot write to BloomFilter concurrently, so we build a local one first.
-        local_output_bloom_filter = BloomFilter(BLOOM_FILTER_SIZE, false);
+        local_output_bloom_filter = BloomFilter{output_bloom_filter.bit_count()};
         used_output_bloom_filter = local_output_bloom_filter;
       }
+      auto used_input_bloom_filter = AdaptiveBloomFilter{input_bloom_filter, input_bloom_filter_is_selective};
 
       // Skip chunks that were physically deleted
       if (!chunk_in) return;
@@ -347,14 +357,14 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
             const Hash hashed_value = hash_function(static_cast<HashedType>(value.value()));
 
             auto skip = false;
-            if (!value.is_null() && !input_bloom_filter[hashed_value & BLOOM_FILTER_MASK] && !keep_null_values) {
+            if (!keep_null_values && !value.is_null() && !used_input_bloom_filter.contains(hashed_value)) {
               // Value in not present in input bloom filter and can be skipped
               skip = true;
             }
 
             if (!skip) {
               // Fill the corresponding slot in the bloom filter
-              used_output_bloom_filter.get()[hashed_value & BLOOM_FILTER_MASK] = true;
+              used_output_bloom_filter.get().insert(hashed_value);
 
               /*
               For ReferenceSegments we do not use the RowIDs from the referenced tables.
@@ -424,14 +434,10 @@ template <typename BuildColumnType, typename HashedType>
 std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<BuildColumnType>& radix_container,
                                                            const JoinHashBuildMode mode, const size_t radix_bits,
                                                            const BloomFilter& input_bloom_filter) {
-  Assert(input_bloom_filter.size() == BLOOM_FILTER_SIZE, "invalid input_bloom_filter");
-
   if (radix_container.empty()) return {};
 
-  /*
-  NUMA notes:
-  The hash tables for each partition P should also reside on the same node as the build and probe partitions.
-  */
+  // If radix partitioning is used, the hash table for each partition is built on the partition's node (see
+  // node_id_for_partition).
   std::vector<std::optional<PosHashTable<HashedType>>> hash_tables;
 
   if (radix_bits == 0) {
@@ -447,6 +453,10 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
 
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(radix_container.size());
+  auto node_ids = std::vector<NodeID>{};
+  node_ids.reserve(radix_container.size());
+
+  auto input_bloom_filter_is_selective = std::atomic_bool{true};
 
   for (size_t partition_idx = 0; partition_idx < radix_container.size(); ++partition_idx) {
     // Skip empty partitions, so that we don't have too many empty jobs and hash tables
@@ -465,11 +475,12 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
       if (radix_bits > 0) {
         hash_table = PosHashTable<HashedType>(mode, elements_count);
       }
+      auto used_input_bloom_filter = AdaptiveBloomFilter{input_bloom_filter, input_bloom_filter_is_selective};
       for (const auto& element : elements) {
         DebugAssert(!(element.row_id == NULL_ROW_ID), "No NULL_ROW_IDs should make it to this point");
 
         const Hash hashed_value = hash_function(static_cast<HashedType>(element.value));
-        if (!input_bloom_filter[hashed_value & BLOOM_FILTER_MASK]) {
+        if (!used_input_bloom_filter.contains(hashed_value)) {
           continue;
         }
 
@@ -489,9 +500,10 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
       insert_into_hash_table();
     } else {
       jobs.emplace_back(std::make_shared<JobTask>(insert_into_hash_table));
+      node_ids.emplace_back(node_id_for_partition(partition_idx));
     }
   }
-  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  schedule_and_wait_for_partition_jobs(jobs, node_ids);
 
   // If radix partitioning is used, finalize is called above.
   if (radix_bits == 0) hash_tables[0]->finalize();
@@ -499,6 +511,9 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
   return hash_tables;
 }
 
+// Values that are not contained in the input Bloom filter are not written to the output partitions. As the output
+// offsets are calculated from the histograms created during the materialization, this leaves gaps in the output
+// partitions, which are closed once all values have been written. If NULL values are kept, no values are skipped.
 template <typename T, typename HashedType, bool keep_null_values>
 RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
                                      std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
@@ -520,8 +535,16 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
   const size_t pass = 0;
   const size_t radix_mask = static_cast<uint32_t>(pow(2, radix_bits * (pass + 1)) - 1);
 
-  // allocate new (shared) output
-  auto output = RadixContainer<T>(output_partition_count);
+  // allocate new (shared) output, each partition on its NUMA node
+  auto output = RadixContainer<T>{};
+  output.reserve(output_partition_count);
+  for (auto output_partition_idx = size_t{0}; output_partition_idx < output_partition_count; ++output_partition_idx) {
+    const auto node_id = node_id_for_partition(output_partition_idx);
+    auto* const memory_resource = node_id == CURRENT_NODE_ID ? boost::container::pmr::get_default_resource()
+                                                             : Hyrise::get().topology.get_memory_resource(node_id);
+    output.emplace_back(
+        Partition<T>{typename Partition<T>::Elements{typename Partition<T>::Allocator{memory_resource}}, {}});
+  }
 
   Assert(histograms.size() == input_partition_count, "Expected one histogram per input partition");
   Assert(histograms[0].size() == output_partition_count, "Expected one histogram bucket per output partition");
@@ -551,20 +574,32 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(input_partition_count);
 
+  auto input_bloom_filter_is_selective = std::atomic_bool{true};
+  auto skipped_value_count = std::atomic<size_t>{0};
+
   for (auto input_partition_idx = ChunkID{0}; input_partition_idx < input_partition_count; ++input_partition_idx) {
     const auto& input_partition = radix_container[input_partition_idx];
     const auto& elements = input_partition.elements;
     const auto elements_count = elements.size();
 
     const auto perform_partition = [&, input_partition_idx, elements_count]() {
+      auto used_input_bloom_filter = AdaptiveBloomFilter{input_bloom_filter, input_bloom_filter_is_selective};
+      auto local_skipped_value_count = size_t{0};
+
       for (auto input_idx = size_t{0}; input_idx < elements_count; ++input_idx) {
         const auto& element = elements[input_idx];
+        const Hash hashed_value = hash_function(static_cast<HashedType>(element.value));
 
         if constexpr (!keep_null_values) {
           DebugAssert(!(element.row_id == NULL_ROW_ID), "NULL_ROW_ID should not have made it this far");
+
+          if (!used_input_bloom_filter.contains(hashed_value)) {
+            ++local_skipped_value_count;
+            continue;
+          }
         }
 
-        const size_t radix = hash_function(static_cast<HashedType>(element.value)) & radix_mask;
+        const size_t radix = hashed_value & radix_mask;
 
         auto& output_idx = output_offsets_by_input_partition[input_partition_idx][radix];
         DebugAssert(output_idx < output[radix].elements.size(), "output_idx is completely out-of-bounds");
@@ -583,6 +618,8 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
 
         ++output_idx;
       }
+
+      skipped_value_count += local_skipped_value_count;
     };
     if (JoinHash::JOB_SPAWN_THRESHOLD > elements_count) {
       perform_partition();
@@ -593,9 +630,37 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
   jobs.clear();
 
+  // Close the gaps left by skipped values. For each output partition, the values written by an input partition are
+  // stored in the range starting at the sum of the preceding input partitions' histogram entries and ending at the
+  // final value of output_offsets_by_input_partition.
+  auto node_ids = std::vector<NodeID>{};
+  if (skipped_value_count > 0) {
+    for (auto output_partition_idx = size_t{0}; output_partition_idx < output_partition_count; ++output_partition_idx) {
+      node_ids.emplace_back(node_id_for_partition(output_partition_idx));
+      jobs.emplace_back(std::make_shared<JobTask>([&, output_partition_idx]() {
+        auto& elements = output[output_partition_idx].elements;
+        auto range_begin = size_t{0};
+        auto write_offset = size_t{0};
+        for (auto input_partition_idx = size_t{0}; input_partition_idx < input_partition_count; ++input_partition_idx) {
+          const auto range_end = output_offsets_by_input_partition[input_partition_idx][output_partition_idx];
+          if (range_begin != write_offset) {
+            std::move(elements.begin() + range_begin, elements.begin() + range_end, elements.begin() + write_offset);
+          }
+          write_offset += range_end - range_begin;
+          range_begin += histograms[input_partition_idx][output_partition_idx];
+        }
+        elements.resize(write_offset);
+      }));
+    }
+    schedule_and_wait_for_partition_jobs(jobs, node_ids);
+    jobs.clear();
+    node_ids.clear();
+  }
+
   // Compress null_values_as_char into partition.null_values
   if constexpr (keep_null_values) {
     for (auto output_partition_idx = size_t{0}; output_partition_idx < output_partition_count; ++output_partition_idx) {
+      node_ids.emplace_back(node_id_for_partition(output_partition_idx));
       jobs.emplace_back(std::make_shared<JobTask>([&, output_partition_idx]() {
         for (auto element_idx = size_t{0}; element_idx < output[output_partition_idx].null_values.size();
              ++element_idx) {
@@ -604,7 +669,7 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
         }
       }));
     }
-    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    schedule_and_wait_for_partition_jobs(jobs, node_ids);
   }
 
   return output;
@@ -624,13 +689,11 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(probe_radix_container.size());
 
-  /*
-    NUMA notes:
-    At this point both input relations are partitioned using radix partitioning.
-    Probing will be done per partition for both sides.
-    Therefore, inputs for one partition should be located on the same NUMA node,
-    and the job that probes that partition should also be on that NUMA node.
-  */
+  // If both input relations are radix partitioned, probing is done per partition. The probe partition and the hash
+  // table of the build partition are located on the same NUMA node (see node_id_for_partition) and the job that probes
+  // the partition is scheduled on that node.
+  auto node_ids = std::vector<NodeID>{};
+  node_ids.reserve(probe_radix_container.size());
 
   for (size_t partition_idx = 0; partition_idx < probe_radix_container.size(); ++partition_idx) {
     // Skip empty partitions to avoid empty output chunks
@@ -769,10 +832,11 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
       probe_partition();
     } else {
       jobs.emplace_back(std::make_shared<JobTask>(probe_partition));
+      node_ids.emplace_back(hash_tables.size() > 1 ? node_id_for_partition(partition_idx) : CURRENT_NODE_ID);
     }
   }
 
-  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  schedule_and_wait_for_partition_jobs(jobs, node_ids);
 }
 
 template <typename ProbeColumnType, typename HashedType, JoinMode mode>
@@ -783,6 +847,10 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(probe_radix_container.size());
 
+  // See probe() for the placement of the jobs.
+  auto node_ids = std::vector<NodeID>{};
+  node_ids.reserve(probe_radix_container.size());
+
   for (size_t partition_idx = 0; partition_idx < probe_radix_container.size(); ++partition_idx) {
     // Skip empty partitions to avoid empty output chunks
     if (probe_radix_container[partition_idx].elements.empty()) {
@@ -887,10 +955,11 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
       probe_partition();
     } else {
       jobs.emplace_back(std::make_shared<JobTask>(probe_partition));
+      node_ids.emplace_back(hash_tables.size() > 1 ? node_id_for_partition(partition_idx) : CURRENT_NODE_ID);
     }
   }
 
-  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  schedule_and_wait_for_partition_jobs(jobs, node_ids);
 }
 
 }  // namespace opossum
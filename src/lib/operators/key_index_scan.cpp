@@ -0,0 +1,119 @@
+#include "key_index_scan.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "operators/get_table.hpp"
+#include "storage/index/table_key_index.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+KeyIndexScan::KeyIndexScan(const std::shared_ptr<const AbstractOperator>& in, const std::vector<ColumnID>& column_ids,
+                           const std::vector<std::shared_ptr<AbstractExpression>>& values)
+    : AbstractReadOnlyOperator{OperatorType::KeyIndexScan, in}, _column_ids{column_ids}, _values{values} {
+  Assert(_column_ids.size() == _values.size(), "Expected one value per key column");
+  Assert(std::all_of(_values.cbegin(), _values.cend(),
+                     [](const auto& value) {
+                       return value->type == ExpressionType::Value ||
+                              value->type == ExpressionType::CorrelatedParameter;
+                     }),
+         "Expected values or correlated parameters");
+}
+
+const std::string& KeyIndexScan::name() const {
+  static const auto name = std::string{"KeyIndexScan"};
+  return name;
+}
+
+std::string KeyIndexScan::description(DescriptionMode description_mode) const {
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(left_input());
+  const auto stored_table = get_table ? Hyrise::get().storage_manager.get_table(get_table->table_name()) : nullptr;
+
+  const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << AbstractOperator::description(description_mode) << separator << "(";
+  for (auto key_column_index = size_t{0}; key_column_index < _column_ids.size(); ++key_column_index) {
+    if (key_column_index > 0) stream << " AND ";
+
+    const auto column_id = _column_ids[key_column_index];
+    stream << (stored_table ? stored_table->column_name(column_id) : "Column #" + std::to_string(column_id)) << " = "
+           << _values[key_column_index]->as_column_name();
+  }
+  stream << ")";
+
+  return stream.str();
+}
+
+std::shared_ptr<const Table> KeyIndexScan::_on_execute() {
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(left_input());
+  Assert(get_table, "KeyIndexScan must follow a GetTable");
+
+  const auto stored_table = Hyrise::get().storage_manager.get_table(get_table->table_name());
+  const auto key_index = stored_table->key_index(_column_ids);
+  Assert(key_index, "No key index found for the given columns");
+
+  const auto input_table = left_input_table();
+  auto output_table = std::make_shared<Table>(input_table->column_definitions(), TableType::References);
+
+  // The key index expects the values in the order of its (sorted) columns.
+  auto values = std::vector<AllTypeVariant>(_values.size());
+  for (auto key_column_index = size_t{0}; key_column_index < _column_ids.size(); ++key_column_index) {
+    const auto value = expression_get_value_or_parameter(*_values[key_column_index]);
+    Assert(value, "Expected the value of the key column to be set");
+
+    // A correlated parameter can be NULL, and `column = NULL` never holds.
+    if (variant_is_null(*value)) return output_table;
+
+    const auto& index_column_ids = key_index->column_ids();
+    const auto index_column_iter =
+        std::find(index_column_ids.cbegin(), index_column_ids.cend(), _column_ids[key_column_index]);
+    values[std::distance(index_column_ids.cbegin(), index_column_iter)] = *value;
+  }
+
+  const auto row_ids = key_index->lookup(values);
+  if (row_ids.empty()) return output_table;
+
+  const auto pos_list = std::make_shared<RowIDPosList>(row_ids.cbegin(), row_ids.cend());
+
+  // The output references the stored table, skipping the columns pruned by GetTable.
+  const auto& pruned_column_ids = get_table->pruned_column_ids();
+  auto segments = Segments{};
+  segments.reserve(input_table->column_count());
+
+  auto pruned_column_ids_iter = pruned_column_ids.cbegin();
+  for (auto stored_column_id = ColumnID{0}; stored_column_id < stored_table->column_count(); ++stored_column_id) {
+    if (pruned_column_ids_iter != pruned_column_ids.cend() && stored_column_id == *pruned_column_ids_iter) {
+      ++pruned_column_ids_iter;
+      continue;
+    }
+
+    segments.emplace_back(std::make_shared<ReferenceSegment>(stored_table, stored_column_id, pos_list));
+  }
+
+  output_table->append_chunk(segments);
+
+  return output_table;
+}
+
+std::shared_ptr<AbstractOperator> KeyIndexScan::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+  return std::make_shared<KeyIndexScan>(copied_left_input, _column_ids, expressions_deep_copy(_values, copied_ops));
+}
+
+void KeyIndexScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  expressions_set_parameters(_values, parameters);
+}
+
+}  // namespace opossum
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/abstract_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that looks up the rows with a given key in a key index of a stored table (see TableKeyIndex). Its input
+ * has to be the GetTable operator of that table. The key is given as the values of all key columns, which are
+ * identified by their ColumnIDs in the stored table (i.e., regardless of column pruning).
+ *
+ * As the key index covers the entire table including mutable chunks, the output can contain rows that are not part of
+ * the input (e.g., from chunks appended after GetTable executed or pruned chunks). Like all other versions of a key,
+ * these rows have to be filtered by a Validate operator.
+ *
+ * The values are ValueExpressions or CorrelatedParameterExpressions. The latter allow correlated subqueries to look up
+ * the key of every outer row (see set_parameters).
+ */
+class KeyIndexScan : public AbstractReadOnlyOperator {
+ public:
+  KeyIndexScan(const std::shared_ptr<const AbstractOperator>& in, const std::vector<ColumnID>& column_ids,
+               const std::vector<std::shared_ptr<AbstractExpression>>& values);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+ private:
+  const std::vector<ColumnID> _column_ids;
+  const std::vector<std::shared_ptr<AbstractExpression>> _values;
+};
+
+}  // namespace opossum
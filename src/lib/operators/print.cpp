@@ -234,6 +234,10 @@ std::string Print::_segment_type(const std::shared_ptr<AbstractSegment>& segment
         segment_type += "LZ4";
         break;
       }
+      case EncodingType::FSST: {
+        segment_type += "FSST";
+        break;
+      }
     }
     if (encoded_segment->compressed_vector_type()) {
       switch (*encoded_segment->compressed_vector_type()) {
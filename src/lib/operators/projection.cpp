@@ -5,7 +5,9 @@
 #include <functional>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -22,11 +24,59 @@
 #include "utils/assert.hpp"
 #include "utils/timer.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Creates a mapping from output columns to input columns. This is necessary as the order may have been changed. The
+// mapping only contains column IDs that are forwarded without modifications.
+std::unordered_map<ColumnID, ColumnID> map_output_columns_to_input_columns(
+    const std::vector<std::shared_ptr<AbstractExpression>>& expressions,
+    const ExpressionUnorderedSet& forwarded_pqp_columns) {
+  auto output_column_to_input_column = std::unordered_map<ColumnID, ColumnID>{};
+  for (auto expression_id = ColumnID{0}; expression_id < expressions.size(); ++expression_id) {
+    const auto& expression = expressions[expression_id];
+    if (const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression)) {
+      if (forwarded_pqp_columns.contains(expression)) {
+        const auto& original_id = pqp_column_expression->column_id;
+        output_column_to_input_column[expression_id] = original_id;
+      }
+    }
+  }
+  return output_column_to_input_column;
+}
+
+// Forwards the sorted_by flags of the input chunk to the (finalized) output chunk, mapping the column ids.
+void forward_individually_sorted_by(const Chunk& input_chunk, Chunk& output_chunk,
+                                    const std::unordered_map<ColumnID, ColumnID>& output_column_to_input_column) {
+  const auto& sorted_by = input_chunk.individually_sorted_by();
+  if (sorted_by.empty()) return;
+
+  std::vector<SortColumnDefinition> transformed;
+  transformed.reserve(sorted_by.size());
+
+  // We need to iterate both sorted information and the output/input mapping as multiple output columns might
+  // originate from the same sorted input column.
+  for (const auto& [output_column_id, input_column_id] : output_column_to_input_column) {
+    const auto iter =
+        std::find_if(sorted_by.begin(), sorted_by.end(),
+                     [input_column_id = input_column_id](const auto sort) { return input_column_id == sort.column; });
+    if (iter != sorted_by.end()) {
+      transformed.emplace_back(SortColumnDefinition{output_column_id, iter->sort_mode});
+    }
+  }
+  if (!transformed.empty()) {
+    output_chunk.set_individually_sorted_by(transformed);
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 
 Projection::Projection(const std::shared_ptr<const AbstractOperator>& input_operator,
                        const std::vector<std::shared_ptr<AbstractExpression>>& init_expressions)
-    : AbstractReadOnlyOperator(OperatorType::Projection, input_operator, nullptr,
+    : AbstractChunkwiseOperator(OperatorType::Projection, input_operator, nullptr,
                                std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
       expressions(init_expressions) {
   /**
@@ -72,6 +122,8 @@ void Projection::_on_set_transaction_context(const std::weak_ptr<TransactionCont
 }
 
 std::shared_ptr<const Table> Projection::_on_execute() {
+  if (_executes_as_pipeline()) return _execute_pipeline();
+
   Timer timer;
 
   const auto& input_table = *left_input_table();
@@ -111,13 +163,7 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   });
   const auto output_table_type = forwards_any_columns ? input_table.type() : TableType::Data;
 
-  // Uncorrelated subqueries need to be evaluated exactly once, not once per chunk.
-  const auto uncorrelated_subquery_results =
-      ExpressionEvaluator::populate_uncorrelated_subquery_results_cache(_uncorrelated_subquery_expressions);
-  // Deregister, because we obtained the results and no longer need the subquery plans.
-  for (const auto& pqp_subquery_expression : _uncorrelated_subquery_expressions) {
-    pqp_subquery_expression->pqp->deregister_consumer();
-  }
+  const auto uncorrelated_subquery_results = _evaluate_uncorrelated_subqueries();
 
   auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
   if (!uncorrelated_subquery_results->empty()) {
@@ -237,18 +283,7 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   auto output_chunks = std::vector<std::shared_ptr<Chunk>>{chunk_count};
   auto projection_result_chunks = std::vector<std::shared_ptr<Chunk>>{chunk_count};
 
-  // Create a mapping from output columns to input columns for future use. This is necessary as the order may have been
-  // changed. The mapping only contains column IDs that are forwarded without modfications.
-  auto output_column_to_input_column = std::unordered_map<ColumnID, ColumnID>{};
-  for (auto expression_id = ColumnID{0}; expression_id < expression_count; ++expression_id) {
-    const auto& expression = expressions[expression_id];
-    if (const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression)) {
-      if (forwarded_pqp_columns.contains(expression)) {
-        const auto& original_id = pqp_column_expression->column_id;
-        output_column_to_input_column[expression_id] = original_id;
-      }
-    }
-  }
+  const auto output_column_to_input_column = map_output_columns_to_input_columns(expressions, forwarded_pqp_columns);
 
   // Create the actual chunks, and, if needed, fill the projection_result_table. Also set MVCC and
   // individually_sorted_by information as needed.
@@ -293,25 +328,7 @@ std::shared_ptr<const Table> Projection::_on_execute() {
     }
 
     // Forward sorted_by flags, mapping column ids
-    const auto& sorted_by = input_chunk->individually_sorted_by();
-    if (!sorted_by.empty()) {
-      std::vector<SortColumnDefinition> transformed;
-      transformed.reserve(sorted_by.size());
-
-      // We need to iterate both sorted information and the output/input mapping as multiple output columns might
-      // originate from the same sorted input column.
-      for (const auto& [output_column_id, input_column_id] : output_column_to_input_column) {
-        const auto iter = std::find_if(
-            sorted_by.begin(), sorted_by.end(),
-            [input_column_id = input_column_id](const auto sort) { return input_column_id == sort.column; });
-        if (iter != sorted_by.end()) {
-          transformed.emplace_back(SortColumnDefinition{output_column_id, iter->sort_mode});
-        }
-      }
-      if (!transformed.empty()) {
-        chunk->set_individually_sorted_by(transformed);
-      }
-    }
+    forward_individually_sorted_by(*input_chunk, *chunk, output_column_to_input_column);
 
     output_chunks[chunk_id] = chunk;
   }
@@ -322,6 +339,142 @@ std::shared_ptr<const Table> Projection::_on_execute() {
                                  input_table.uses_mvcc());
 }
 
+std::shared_ptr<const ExpressionEvaluator::UncorrelatedSubqueryResults>
+Projection::_evaluate_uncorrelated_subqueries() {
+  // Uncorrelated subqueries need to be evaluated exactly once, not once per chunk.
+  const auto uncorrelated_subquery_results =
+      ExpressionEvaluator::populate_uncorrelated_subquery_results_cache(_uncorrelated_subquery_expressions);
+  // Deregister, because we obtained the results and no longer need the subquery plans.
+  for (const auto& pqp_subquery_expression : _uncorrelated_subquery_expressions) {
+    pqp_subquery_expression->pqp->deregister_consumer();
+  }
+  return uncorrelated_subquery_results;
+}
+
+bool Projection::_keeps_input_columns() const { return false; }
+
+bool Projection::_can_stream_output() const {
+  return std::all_of(expressions.begin(), expressions.end(), [&](const auto& expression) {
+    return expression->type == ExpressionType::PQPColumn;
+  });
+}
+
+void Projection::_on_begin_pipeline(const std::shared_ptr<const Table>& pipeline_input_table) {
+  // The morsels are chunks of reference tables with the columns of the pipeline's input table if the Projection
+  // pipelines its input. Otherwise, it streams its output and the morsels are the chunks of its input table. See
+  // _on_execute for the choice of the output table type.
+  const auto morsel_table_type = pipelines_left_input() ? TableType::References : pipeline_input_table->type();
+  const auto forwards_any_columns = std::any_of(expressions.begin(), expressions.end(), [&](const auto& expression) {
+    return expression->type == ExpressionType::PQPColumn;
+  });
+  _pipeline_output_table_type = forwards_any_columns ? morsel_table_type : TableType::Data;
+  _pipeline_forwarded_pqp_columns = _determine_forwarded_columns(morsel_table_type);
+  _pipeline_output_column_to_input_column =
+      map_output_columns_to_input_columns(expressions, _pipeline_forwarded_pqp_columns);
+  _pipeline_uncorrelated_subquery_results = _evaluate_uncorrelated_subqueries();
+
+  _pipeline_column_is_nullable = std::vector<std::atomic_bool>(expressions.size());
+  for (const auto& [output_column_id, input_column_id] : _pipeline_output_column_to_input_column) {
+    _pipeline_column_is_nullable[output_column_id] = pipeline_input_table->column_is_nullable(input_column_id);
+  }
+}
+
+std::shared_ptr<Chunk> Projection::_on_execute_morsel(const std::shared_ptr<const Table>& in_table,
+                                                      const ChunkID chunk_id) {
+  const auto input_chunk = in_table->get_chunk(chunk_id);
+  const auto expression_count = expressions.size();
+
+  // Forwarded columns are taken from the morsel, all other columns are evaluated.
+  auto output_segments = Segments{expression_count};
+  auto segment_is_nullable = std::vector<bool>(expression_count);
+  auto evaluator = std::optional<ExpressionEvaluator>{};
+  for (auto column_id = ColumnID{0}; column_id < expression_count; ++column_id) {
+    const auto& expression = expressions[column_id];
+    if (_pipeline_forwarded_pqp_columns.contains(expression)) {
+      const auto& pqp_column_expression = static_cast<const PQPColumnExpression&>(*expression);
+      output_segments[column_id] = input_chunk->get_segment(pqp_column_expression.column_id);
+      continue;
+    }
+
+    if (!evaluator) evaluator.emplace(in_table, chunk_id, _pipeline_uncorrelated_subquery_results);
+    auto output_segment = evaluator->evaluate_expression_to_segment(*expression);
+    segment_is_nullable[column_id] = output_segment->is_nullable();
+    if (segment_is_nullable[column_id]) _pipeline_column_is_nullable[column_id] = true;
+    output_segments[column_id] = std::move(output_segment);
+  }
+
+  // If the output is a reference table, the newly generated ValueSegments are moved into a projection_result_table
+  // (see _on_execute). As the chunk ids of the output table are only known once all morsels are done, every morsel
+  // gets a single-chunk projection_result_table of its own.
+  if (_pipeline_output_table_type == TableType::References) {
+    auto projection_result_column_definitions = TableColumnDefinitions{};
+    auto projection_result_segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < expression_count; ++column_id) {
+      if (_pipeline_forwarded_pqp_columns.contains(expressions[column_id])) continue;
+
+      projection_result_column_definitions.emplace_back(expressions[column_id]->as_column_name(),
+                                                        expressions[column_id]->data_type(),
+                                                        segment_is_nullable[column_id]);
+      projection_result_segments.emplace_back(output_segments[column_id]);
+    }
+
+    if (!projection_result_segments.empty()) {
+      auto projection_result_chunk = std::make_shared<Chunk>(std::move(projection_result_segments));
+      projection_result_chunk->finalize();
+      const auto projection_result_table =
+          std::make_shared<Table>(projection_result_column_definitions, TableType::Data,
+                                  std::vector<std::shared_ptr<Chunk>>{projection_result_chunk}, UseMvcc::No);
+
+      const auto entire_chunk_pos_list = std::make_shared<EntireChunkPosList>(ChunkID{0}, input_chunk->size());
+      auto projection_result_column_id = ColumnID{0};
+      for (auto column_id = ColumnID{0}; column_id < expression_count; ++column_id) {
+        if (_pipeline_forwarded_pqp_columns.contains(expressions[column_id])) continue;
+
+        output_segments[column_id] = std::make_shared<ReferenceSegment>(
+            projection_result_table, projection_result_column_id, entire_chunk_pos_list);
+        ++projection_result_column_id;
+      }
+    }
+  }
+
+  auto output_chunk = std::make_shared<Chunk>(std::move(output_segments));
+  output_chunk->finalize();
+  forward_individually_sorted_by(*input_chunk, *output_chunk, _pipeline_output_column_to_input_column);
+  return output_chunk;
+}
+
+std::shared_ptr<const Table> Projection::_build_pipeline_output(
+    const std::shared_ptr<const Table>& /*pipeline_input_table*/, std::vector<std::shared_ptr<Chunk>>&& output_chunks) {
+  // Now that all morsels are evaluated, the nullability of the output columns is known (see _on_execute).
+  auto output_column_definitions = TableColumnDefinitions{};
+  for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
+    output_column_definitions.emplace_back(expressions[column_id]->as_column_name(),
+                                           expressions[column_id]->data_type(),
+                                           _pipeline_column_is_nullable[column_id]);
+  }
+
+  _pipeline_uncorrelated_subquery_results = nullptr;
+
+  // The output chunks do not carry MVCC data, not even when they are forwarded from a data table.
+  return std::make_shared<Table>(output_column_definitions, _pipeline_output_table_type, std::move(output_chunks),
+                                 UseMvcc::No);
+}
+
+std::shared_ptr<const Table> Projection::_make_streamed_table(
+    const std::shared_ptr<const Table>& /*pipeline_input_table*/, const std::shared_ptr<Chunk>& chunk) const {
+  // Only Projections that forward all of their columns stream their output, so the nullability of the output columns
+  // has been taken from the input in _on_begin_pipeline and does not change while the morsels are processed.
+  auto output_column_definitions = TableColumnDefinitions{};
+  for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
+    output_column_definitions.emplace_back(expressions[column_id]->as_column_name(),
+                                           expressions[column_id]->data_type(),
+                                           _pipeline_column_is_nullable[column_id]);
+  }
+
+  return std::make_shared<Table>(output_column_definitions, _pipeline_output_table_type,
+                                 std::vector<std::shared_ptr<Chunk>>{chunk}, UseMvcc::No);
+}
+
 // returns the singleton dummy table used for literal projections
 std::shared_ptr<Table> Projection::dummy_table() {
   static auto shared_dummy = std::make_shared<DummyTable>();
@@ -3,15 +3,18 @@
 #include <cstdint>
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
-#include "abstract_read_only_operator.hpp"
+#include "abstract_chunkwise_operator.hpp"
 #include "expression/abstract_expression.hpp"
+#include "expression/evaluation/expression_evaluator.hpp"
 
 namespace opossum {
 
@@ -19,8 +22,13 @@ class PQPSubqueryExpression;
 
 /**
  * Operator to evaluate Expressions (except for AggregateExpressions)
+ *
+ * Projections can end a pipeline of chunk-wise operators (see AbstractChunkwiseOperator), e.g., TableScan -> Validate
+ * -> Projection. As the nullability of newly generated columns is only known once all chunks have been evaluated, the
+ * output table is built after the last morsel and a Projection cannot feed another pipelined operator. Projections
+ * that only forward or reorder columns take the nullability from their input and can thus stream their output.
  */
-class Projection : public AbstractReadOnlyOperator {
+class Projection : public AbstractChunkwiseOperator {
  public:
   Projection(const std::shared_ptr<const AbstractOperator>& input_operator,
              const std::vector<std::shared_ptr<AbstractExpression>>& init_expressions);
@@ -66,7 +74,27 @@ class Projection : public AbstractReadOnlyOperator {
 
   ExpressionUnorderedSet _determine_forwarded_columns(const TableType table_type) const;
 
+  // Evaluates the uncorrelated subqueries once and deregisters from their plans.
+  std::shared_ptr<const ExpressionEvaluator::UncorrelatedSubqueryResults> _evaluate_uncorrelated_subqueries();
+
+  bool _keeps_input_columns() const override;
+  bool _can_stream_output() const override;
+  void _on_begin_pipeline(const std::shared_ptr<const Table>& pipeline_input_table) override;
+  std::shared_ptr<Chunk> _on_execute_morsel(const std::shared_ptr<const Table>& in_table,
+                                            const ChunkID chunk_id) override;
+  std::shared_ptr<const Table> _build_pipeline_output(const std::shared_ptr<const Table>& pipeline_input_table,
+                                                      std::vector<std::shared_ptr<Chunk>>&& output_chunks) override;
+  std::shared_ptr<const Table> _make_streamed_table(const std::shared_ptr<const Table>& pipeline_input_table,
+                                                    const std::shared_ptr<Chunk>& chunk) const override;
+
   std::vector<std::shared_ptr<PQPSubqueryExpression>> _uncorrelated_subquery_expressions;
+
+  // Only set while the operator is part of a pipeline.
+  TableType _pipeline_output_table_type{TableType::Data};
+  ExpressionUnorderedSet _pipeline_forwarded_pqp_columns;
+  std::unordered_map<ColumnID, ColumnID> _pipeline_output_column_to_input_column;
+  std::shared_ptr<const ExpressionEvaluator::UncorrelatedSubqueryResults> _pipeline_uncorrelated_subquery_results;
+  std::vector<std::atomic_bool> _pipeline_column_is_nullable;
 };
 
 }  // namespace opossum
@@ -16,7 +16,9 @@
 #include "expression/binary_predicate_expression.hpp"
 #include "expression/correlated_parameter_expression.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/in_expression.hpp"
 #include "expression/is_null_expression.hpp"
+#include "expression/list_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "hyrise.hpp"
@@ -29,6 +31,7 @@
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "table_scan/column_between_table_scan_impl.hpp"
+#include "table_scan/column_in_table_scan_impl.hpp"
 #include "table_scan/column_is_null_table_scan_impl.hpp"
 #include "table_scan/column_like_table_scan_impl.hpp"
 #include "table_scan/column_vs_column_table_scan_impl.hpp"
@@ -42,7 +45,7 @@ namespace opossum {
 
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in,
                      const std::shared_ptr<AbstractExpression>& predicate)
-    : AbstractReadOnlyOperator{OperatorType::TableScan, in, nullptr, std::make_unique<PerformanceData>()},
+    : AbstractChunkwiseOperator{OperatorType::TableScan, in, nullptr, std::make_unique<PerformanceData>()},
       _predicate(predicate) {
   /**
    * Register as a consumer for all uncorrelated subqueries.
@@ -97,6 +100,8 @@ std::shared_ptr<AbstractOperator> TableScan::_on_deep_copy(
 }
 
 std::shared_ptr<const Table> TableScan::_on_execute() {
+  if (_executes_as_pipeline()) return _execute_pipeline();
+
   const auto in_table = left_input_table();
 
   _impl = create_impl();
@@ -118,93 +123,10 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
     const auto chunk_in = in_table->get_chunk(chunk_id);
     Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
-    // chunk_in – Copy by value since copy by reference is not possible due to the limited scope of the for-iteration.
-    auto perform_table_scan = [this, chunk_id, chunk_in, &in_table, &output_mutex, &output_chunks]() {
-      // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = _impl->scan_chunk(chunk_id);
-      if (matches_out->empty()) return;
-
-      Segments out_segments;
-      out_segments.reserve(in_table->column_count());
-
-      /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can directly use
-       * the matches to construct the reference segments of the output. If it is a reference segment, we need to
-       * resolve the row IDs so that they reference the physical data segments (value, dictionary) instead, since we
-       * don’t allow multi-level referencing. To save time and space, we want to share position lists between segments
-       * as much as possible. Position lists can be shared between two segments iff (a) they point to the same table
-       * and (b) the reference segments of the input table point to the same positions in the same order (i.e. they
-       * share their position list).
-       */
-      auto keep_chunk_sort_order = true;
-      if (in_table->type() == TableType::References) {
-        if (matches_out->size() == chunk_in->size()) {
-          // Shortcut - the entire input reference segment matches, so we can simply forward that chunk
-          for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-            const auto segment_in = chunk_in->get_segment(column_id);
-            out_segments.emplace_back(segment_in);
-          }
-        } else {
-          auto filtered_pos_lists = std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>>{};
-
-          for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-            const auto segment_in = chunk_in->get_segment(column_id);
-
-            auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
-            DebugAssert(ref_segment_in, "All segments should be of type ReferenceSegment.");
-
-            const auto pos_list_in = ref_segment_in->pos_list();
-
-            const auto table_out = ref_segment_in->referenced_table();
-            const auto column_id_out = ref_segment_in->referenced_column_id();
-
-            auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
-
-            if (!filtered_pos_list) {
-              filtered_pos_list = std::make_shared<RowIDPosList>(matches_out->size());
-              if (pos_list_in->references_single_chunk()) {
-                filtered_pos_list->guarantee_single_chunk();
-              } else {
-                // When segments reference multiple chunks, we do not keep the sort order of the input chunk. The main
-                // reason is that several table scan implementations split the pos lists by chunks (see
-                // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment) and thus shuffle the data. While
-                // this does not affect all scan implementations, we chose the safe and defensive path for now.
-                keep_chunk_sort_order = false;
-              }
-
-              size_t offset = 0;
-              for (const auto& match : *matches_out) {
-                const auto row_id = (*pos_list_in)[match.chunk_offset];
-                (*filtered_pos_list)[offset] = row_id;
-                ++offset;
-              }
-            }
-
-            const auto ref_segment_out =
-                std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
-            out_segments.push_back(ref_segment_out);
-          }
-        }
-      } else {
-        matches_out->guarantee_single_chunk();
-
-        // If the entire chunk is matched, create an EntireChunkPosList instead
-        const auto output_pos_list = matches_out->size() == chunk_in->size()
-                                         ? static_cast<std::shared_ptr<AbstractPosList>>(
-                                               std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size()))
-                                         : static_cast<std::shared_ptr<AbstractPosList>>(matches_out);
+    auto perform_table_scan = [this, chunk_id, &in_table, &output_mutex, &output_chunks]() {
+      const auto chunk = _scan_chunk(*_impl, in_table, chunk_id);
+      if (!chunk) return;
 
-        for (auto column_id = ColumnID{0u}; column_id < in_table->column_count(); ++column_id) {
-          const auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, output_pos_list);
-          out_segments.push_back(ref_segment_out);
-        }
-      }
-
-      const auto chunk = std::make_shared<Chunk>(out_segments, nullptr, chunk_in->get_allocator());
-      chunk->finalize();
-      if (keep_chunk_sort_order && !chunk_in->individually_sorted_by().empty()) {
-        chunk->set_individually_sorted_by(chunk_in->individually_sorted_by());
-      }
       std::lock_guard<std::mutex> lock(output_mutex);
       output_chunks.emplace_back(chunk);
     };
@@ -229,6 +151,125 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
   return std::make_shared<Table>(in_table->column_definitions(), TableType::References, std::move(output_chunks));
 }
 
+std::shared_ptr<Chunk> TableScan::_scan_chunk(AbstractTableScanImpl& impl, const std::shared_ptr<const Table>& in_table,
+                                              const ChunkID chunk_id) {
+  const auto chunk_in = in_table->get_chunk(chunk_id);
+
+  // The actual scan happens in the sub classes of BaseTableScanImpl
+  const auto matches_out = impl.scan_chunk(chunk_id);
+  if (matches_out->empty()) return nullptr;
+
+  Segments out_segments;
+  out_segments.reserve(in_table->column_count());
+
+  /**
+   * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can directly use
+   * the matches to construct the reference segments of the output. If it is a reference segment, we need to
+   * resolve the row IDs so that they reference the physical data segments (value, dictionary) instead, since we
+   * don’t allow multi-level referencing. To save time and space, we want to share position lists between segments
+   * as much as possible. Position lists can be shared between two segments iff (a) they point to the same table
+   * and (b) the reference segments of the input table point to the same positions in the same order (i.e. they
+   * share their position list).
+   */
+  auto keep_chunk_sort_order = true;
+  if (in_table->type() == TableType::References) {
+    if (matches_out->size() == chunk_in->size()) {
+      // Shortcut - the entire input reference segment matches, so we can simply forward that chunk
+      for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+        const auto segment_in = chunk_in->get_segment(column_id);
+        out_segments.emplace_back(segment_in);
+      }
+    } else {
+      auto filtered_pos_lists = std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>>{};
+
+      for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+        const auto segment_in = chunk_in->get_segment(column_id);
+
+        auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
+        DebugAssert(ref_segment_in, "All segments should be of type ReferenceSegment.");
+
+        const auto pos_list_in = ref_segment_in->pos_list();
+
+        const auto table_out = ref_segment_in->referenced_table();
+        const auto column_id_out = ref_segment_in->referenced_column_id();
+
+        auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+
+        if (!filtered_pos_list) {
+          filtered_pos_list = std::make_shared<RowIDPosList>(matches_out->size());
+          if (pos_list_in->references_single_chunk()) {
+            filtered_pos_list->guarantee_single_chunk();
+          } else {
+            // When segments reference multiple chunks, we do not keep the sort order of the input chunk. The main
+            // reason is that several table scan implementations split the pos lists by chunks (see
+            // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment) and thus shuffle the data. While
+            // this does not affect all scan implementations, we chose the safe and defensive path for now.
+            keep_chunk_sort_order = false;
+          }
+
+          size_t offset = 0;
+          for (const auto& match : *matches_out) {
+            const auto row_id = (*pos_list_in)[match.chunk_offset];
+            (*filtered_pos_list)[offset] = row_id;
+            ++offset;
+          }
+        }
+
+        const auto ref_segment_out =
+            std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
+        out_segments.push_back(ref_segment_out);
+      }
+    }
+  } else {
+    matches_out->guarantee_single_chunk();
+
+    // If the entire chunk is matched, create an EntireChunkPosList instead
+    const auto output_pos_list = matches_out->size() == chunk_in->size()
+                                     ? static_cast<std::shared_ptr<AbstractPosList>>(
+                                           std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size()))
+                                     : static_cast<std::shared_ptr<AbstractPosList>>(matches_out);
+
+    for (auto column_id = ColumnID{0u}; column_id < in_table->column_count(); ++column_id) {
+      const auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, output_pos_list);
+      out_segments.push_back(ref_segment_out);
+    }
+  }
+
+  const auto chunk = std::make_shared<Chunk>(out_segments, nullptr, chunk_in->get_allocator());
+  chunk->finalize();
+  if (keep_chunk_sort_order && !chunk_in->individually_sorted_by().empty()) {
+    chunk->set_individually_sorted_by(chunk_in->individually_sorted_by());
+  }
+  return chunk;
+}
+
+bool TableScan::_can_be_pipelined() const {
+  // Excluded chunks refer to the chunk ids of the input table, which are not known for the morsels of a pipeline.
+  return excluded_chunk_ids.empty();
+}
+
+void TableScan::_on_begin_pipeline(const std::shared_ptr<const Table>& pipeline_input_table) {
+  _impl_factory = _create_impl_factory();
+  _impl_description = _impl_factory(pipeline_input_table)->description();
+}
+
+std::shared_ptr<Chunk> TableScan::_on_execute_morsel(const std::shared_ptr<const Table>& in_table,
+                                                     const ChunkID chunk_id) {
+  // The impls are bound to their input table. As every morsel but those of the first operator in a pipeline is a
+  // separate table, each morsel gets its own impl. Creating an impl is cheap compared to scanning a chunk.
+  const auto impl = _impl_factory(in_table);
+  const auto chunk = _scan_chunk(*impl, in_table, chunk_id);
+
+  auto& scan_performance_data = dynamic_cast<PerformanceData&>(*performance_data);
+  scan_performance_data.num_chunks_with_early_out += impl->num_chunks_with_early_out.load();
+  scan_performance_data.num_chunks_with_all_rows_matching += impl->num_chunks_with_all_rows_matching.load();
+  scan_performance_data.num_chunks_with_binary_search += impl->num_chunks_with_binary_search.load();
+
+  return chunk;
+}
+
+void TableScan::_on_end_pipeline() { _impl_factory = nullptr; }
+
 std::shared_ptr<const AbstractExpression> TableScan::_resolve_uncorrelated_subqueries(
     const std::shared_ptr<const AbstractExpression>& predicate) {
   /**
@@ -309,7 +350,9 @@ std::shared_ptr<const AbstractExpression> TableScan::_resolve_uncorrelated_subqu
   Fail("Unexpected predicate type");
 }
 
-std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() {
+std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() { return _create_impl_factory()(left_input_table()); }
+
+TableScan::ImplFactory TableScan::_create_impl_factory() {
   /**
    * Select the scanning implementation (`_impl`) to use based on the kind of the expression. For this we have to
    * closely examine the predicate expression.
@@ -320,6 +363,9 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() {
    *
    * Use the ExpressionEvaluator as a powerful, but slower fallback if no dedicated scanning implementation exists for
    * an expression.
+   *
+   * The choice of the implementation only depends on the predicate, not on the input table. A factory is returned so
+   * that pipelined scans can create an implementation for each morsel (see _on_execute_morsel).
    */
 
   const auto resolved_predicate = _resolve_uncorrelated_subqueries(_predicate);
@@ -371,24 +417,38 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() {
     // Predicate pattern: <column of type string> LIKE <value of type string>
     if (left_column_expression && left_column_expression->data_type() == DataType::String && is_like_predicate &&
         right_value) {
-      return std::make_unique<ColumnLikeTableScanImpl>(left_input_table(), left_column_expression->column_id,
-                                                       predicate_condition, boost::get<pmr_string>(*right_value));
+      const auto column_id = left_column_expression->column_id;
+      const auto pattern = boost::get<pmr_string>(*right_value);
+      return [column_id, predicate_condition, pattern](const auto& in_table) {
+        return std::make_unique<ColumnLikeTableScanImpl>(in_table, column_id, predicate_condition, pattern);
+      };
     }
 
     // Predicate pattern: <column of type T> <binary predicate_condition> <value of type T>
     if (left_column_expression && right_value) {
-      return std::make_unique<ColumnVsValueTableScanImpl>(left_input_table(), left_column_expression->column_id,
-                                                          predicate_condition, *right_value);
+      const auto column_id = left_column_expression->column_id;
+      const auto value = *right_value;
+      return [column_id, predicate_condition, value](const auto& in_table) {
+        return std::make_unique<ColumnVsValueTableScanImpl>(in_table, column_id, predicate_condition, value);
+      };
     }
     if (right_column_expression && left_value) {
-      return std::make_unique<ColumnVsValueTableScanImpl>(left_input_table(), right_column_expression->column_id,
-                                                          flip_predicate_condition(predicate_condition), *left_value);
+      const auto column_id = right_column_expression->column_id;
+      const auto flipped_predicate_condition = flip_predicate_condition(predicate_condition);
+      const auto value = *left_value;
+      return [column_id, flipped_predicate_condition, value](const auto& in_table) {
+        return std::make_unique<ColumnVsValueTableScanImpl>(in_table, column_id, flipped_predicate_condition, value);
+      };
     }
 
     // Predicate pattern: <column> <binary predicate_condition> <column>
     if (left_column_expression && right_column_expression) {
-      return std::make_unique<ColumnVsColumnTableScanImpl>(left_input_table(), left_column_expression->column_id,
-                                                           predicate_condition, right_column_expression->column_id);
+      const auto left_column_id = left_column_expression->column_id;
+      const auto right_column_id = right_column_expression->column_id;
+      return [left_column_id, predicate_condition, right_column_id](const auto& in_table) {
+        return std::make_unique<ColumnVsColumnTableScanImpl>(in_table, left_column_id, predicate_condition,
+                                                             right_column_id);
+      };
     }
   }
 
@@ -396,8 +456,11 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() {
     // Predicate pattern: <column> IS NULL
     if (const auto left_column_expression =
             std::dynamic_pointer_cast<PQPColumnExpression>(is_null_expression->operand())) {
-      return std::make_unique<ColumnIsNullTableScanImpl>(left_input_table(), left_column_expression->column_id,
-                                                         is_null_expression->predicate_condition);
+      const auto column_id = left_column_expression->column_id;
+      const auto predicate_condition = is_null_expression->predicate_condition;
+      return [column_id, predicate_condition](const auto& in_table) {
+        return std::make_unique<ColumnIsNullTableScanImpl>(in_table, column_id, predicate_condition);
+      };
     }
   }
 
@@ -440,8 +503,49 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() {
     // Predicate pattern: <column of type T> BETWEEN <value of type T> AND <value of type T>
     if (left_column && lower_bound_value && upper_bound_value &&
         lower_bound_value->type() == upper_bound_value->type()) {
-      return std::make_unique<ColumnBetweenTableScanImpl>(left_input_table(), left_column->column_id,
-                                                          *lower_bound_value, *upper_bound_value, predicate_condition);
+      const auto column_id = left_column->column_id;
+      const auto lower_value = *lower_bound_value;
+      const auto upper_value = *upper_bound_value;
+      return [column_id, lower_value, upper_value, predicate_condition](const auto& in_table) {
+        return std::make_unique<ColumnBetweenTableScanImpl>(in_table, column_id, lower_value, upper_value,
+                                                            predicate_condition);
+      };
+    }
+  }
+
+  if (const auto in_expression = std::dynamic_pointer_cast<const InExpression>(resolved_predicate)) {
+    // Predicate pattern: <column of type T> IN (<value of type T>, <value of type T>, ...)
+    // NULLs in the list are dropped as they never lead to a match. If a value cannot be cast losslessly to the column
+    // type, the ExpressionEvaluator has to take care of the comparison. NOT IN is left to the ExpressionEvaluator, too,
+    // as a NULL in the list would make the predicate reject all rows.
+    const auto column = std::dynamic_pointer_cast<PQPColumnExpression>(in_expression->value());
+    const auto list = std::dynamic_pointer_cast<ListExpression>(in_expression->set());
+
+    if (column && list && !in_expression->is_negated()) {
+      auto values = std::vector<AllTypeVariant>{};
+      auto all_values_castable = true;
+      for (const auto& element : list->elements()) {
+        const auto value = expression_get_value_or_parameter(*element);
+        if (!value) {
+          all_values_castable = false;
+          break;
+        }
+        if (variant_is_null(*value)) continue;
+
+        const auto cast_value = lossless_variant_cast(*value, column->data_type());
+        if (!cast_value) {
+          all_values_castable = false;
+          break;
+        }
+        values.emplace_back(*cast_value);
+      }
+
+      if (all_values_castable) {
+        const auto column_id = column->column_id;
+        return [column_id, values](const auto& in_table) {
+          return std::make_unique<ColumnInTableScanImpl>(in_table, column_id, values);
+        };
+      }
     }
   }
 
@@ -452,8 +556,10 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() {
   for (const auto& pqp_subquery_expression : _uncorrelated_subquery_expressions) {
     pqp_subquery_expression->pqp->deregister_consumer();
   }
-  return std::make_unique<ExpressionEvaluatorTableScanImpl>(left_input_table(), resolved_predicate,
-                                                            uncorrelated_subquery_results);
+  return [resolved_predicate, uncorrelated_subquery_results](const auto& in_table) {
+    return std::make_unique<ExpressionEvaluatorTableScanImpl>(in_table, resolved_predicate,
+                                                              uncorrelated_subquery_results);
+  };
 }
 
 void TableScan::_on_cleanup() { _impl.reset(); }
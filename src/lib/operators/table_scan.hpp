@@ -1,11 +1,12 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
 #include <vector>
 
-#include "abstract_read_only_operator.hpp"
+#include "abstract_chunkwise_operator.hpp"
 #include "all_parameter_variant.hpp"
 #include "expression/abstract_expression.hpp"
 #include "table_scan/abstract_table_scan_impl.hpp"
@@ -17,7 +18,7 @@ namespace opossum {
 class PQPSubqueryExpression;
 class Table;
 
-class TableScan : public AbstractReadOnlyOperator {
+class TableScan : public AbstractChunkwiseOperator {
   friend class LQPTranslatorTest;
 
  public:
@@ -79,16 +80,32 @@ class TableScan : public AbstractReadOnlyOperator {
 
   void _on_cleanup() override;
 
+  bool _can_be_pipelined() const override;
+  void _on_begin_pipeline(const std::shared_ptr<const Table>& pipeline_input_table) override;
+  std::shared_ptr<Chunk> _on_execute_morsel(const std::shared_ptr<const Table>& in_table,
+                                            const ChunkID chunk_id) override;
+  void _on_end_pipeline() override;
+
   // Turns top-level uncorrelated subqueries into their value, e.g. `a = (SELECT 123)` becomes `a = 123`. This makes it
   // easier to avoid using the more expensive ExpressionEvaluatorTableScanImpl.
   std::shared_ptr<const AbstractExpression> _resolve_uncorrelated_subqueries(
       const std::shared_ptr<const AbstractExpression>& predicate);
 
  private:
+  using ImplFactory = std::function<std::unique_ptr<AbstractTableScanImpl>(const std::shared_ptr<const Table>&)>;
+
+  // Selects the impl for the predicate. Resolves uncorrelated subqueries and must thus only be called once.
+  ImplFactory _create_impl_factory();
+
+  // Creates the output chunk for the chunk `chunk_id` of `in_table` or returns nullptr if no row matches.
+  static std::shared_ptr<Chunk> _scan_chunk(AbstractTableScanImpl& impl, const std::shared_ptr<const Table>& in_table,
+                                            const ChunkID chunk_id);
+
   const std::shared_ptr<AbstractExpression> _predicate;
   std::vector<std::shared_ptr<PQPSubqueryExpression>> _uncorrelated_subquery_expressions;
 
   std::unique_ptr<AbstractTableScanImpl> _impl;
+  ImplFactory _impl_factory;
 
   // The description of the impl, so that it still available after the _impl is resetted in _on_cleanup()
   std::string _impl_description{"Unset"};
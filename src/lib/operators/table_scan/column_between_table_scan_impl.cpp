@@ -4,6 +4,7 @@
 #include <string>
 #include <type_traits>
 
+#include "compressed_attribute_vector_scan.hpp"
 #include "expression/between_expression.hpp"
 #include "sorted_segment_search.hpp"
 #include "storage/chunk.hpp"
@@ -112,8 +113,13 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
    */
   // NOLINTNEXTLINE - cpplint is drunk
   if (lower_bound_value_id == ValueID{0} && upper_bound_value_id == INVALID_VALUE_ID) {
-    if (_column_is_nullable) {
+    if (_column_is_nullable && !position_filter) {
       // We still have to check for NULLs
+      const auto null_value_id = static_cast<ValueID::base_type>(segment.null_value_id());
+      scan_compressed_attribute_vector(
+          *segment.attribute_vector(), chunk_id,
+          [null_value_id](const ValueID::base_type value_id) { return value_id != null_value_id; }, matches);
+    } else if (_column_is_nullable) {
       attribute_vector_iterable.with_iterators(position_filter, [&](auto left_it, auto left_end) {
         static const auto always_true = [](const auto&) { return true; };
         _scan_with_iterators<true>(always_true, left_it, left_end, chunk_id, matches);
@@ -160,6 +166,19 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
   }
 
   const auto value_id_diff = upper_bound_value_id - lower_bound_value_id;
+
+  if (!position_filter) {
+    const auto lower_bound_value_id_base = static_cast<ValueID::base_type>(lower_bound_value_id);
+    const auto value_id_diff_base = static_cast<ValueID::base_type>(value_id_diff);
+    scan_compressed_attribute_vector(
+        *segment.attribute_vector(), chunk_id,
+        [lower_bound_value_id_base, value_id_diff_base](const ValueID::base_type value_id) {
+          return (value_id - lower_bound_value_id_base) < value_id_diff_base;
+        },
+        matches);
+    return;
+  }
+
   const auto comparator = [lower_bound_value_id, value_id_diff](const auto& position) {
     // Using < here because the right value id is the upper_bound. Also, because the value ids are integers, we can do
     // a little hack here: (x >= a && x < b) === ((x - a) < (b - a)); cf. https://stackoverflow.com/a/17095534/2204581
@@ -0,0 +1,109 @@
+#include "column_in_table_scan_impl.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "compressed_attribute_vector_scan.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ColumnInTableScanImpl::ColumnInTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
+                                             const std::vector<AllTypeVariant>& init_values)
+    : AbstractDereferencedColumnTableScanImpl{in_table, column_id, PredicateCondition::In}, values{init_values} {
+  const auto column_data_type = in_table->column_data_type(column_id);
+  for (const auto& value : values) {
+    Assert(column_data_type == data_type_from_all_type_variant(value), "Type of values has to match column");
+  }
+}
+
+std::string ColumnInTableScanImpl::description() const { return "ColumnIn"; }
+
+void ColumnInTableScanImpl::_scan_non_reference_segment(
+    const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+    const std::shared_ptr<const AbstractPosList>& position_filter) {
+  if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
+    _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+  } else {
+    _scan_generic_segment(segment, chunk_id, matches, position_filter);
+  }
+}
+
+void ColumnInTableScanImpl::_scan_generic_segment(const AbstractSegment& segment, const ChunkID chunk_id,
+                                                  RowIDPosList& matches,
+                                                  const std::shared_ptr<const AbstractPosList>& position_filter) const {
+  segment_with_iterators_filtered(segment, position_filter, [&](auto it, [[maybe_unused]] const auto end) {
+    // Don't instantiate this for this for DictionarySegments and ReferenceSegments to save compile time.
+    // DictionarySegments are handled in _scan_dictionary_segment()
+    // ReferenceSegments are handled via position_filter
+    if constexpr (!is_dictionary_segment_iterable_v<typename decltype(it)::IterableType> &&
+                  !is_reference_segment_iterable_v<typename decltype(it)::IterableType>) {
+      using ColumnDataType = typename decltype(it)::ValueType;
+
+      auto typed_values = std::vector<ColumnDataType>{};
+      typed_values.reserve(values.size());
+      for (const auto& value : values) {
+        typed_values.emplace_back(boost::get<ColumnDataType>(value));
+      }
+      std::sort(typed_values.begin(), typed_values.end());
+
+      const auto comparator = [&typed_values](const auto& position) {
+        return std::binary_search(typed_values.cbegin(), typed_values.cend(), position.value());
+      };
+      _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
+    } else {
+      Fail("Dictionary and Reference segments have their own code paths and should be handled there");
+    }
+  });
+}
+
+void ColumnInTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id,
+                                                     RowIDPosList& matches,
+                                                     const std::shared_ptr<const AbstractPosList>& position_filter) {
+  // Translate the values into the set of matching value ids, represented as one byte per value id (including the NULL
+  // value id, which never matches). Unlike a bitmap, this can be probed without branches and shifts.
+  const auto null_value_id = static_cast<ValueID::base_type>(segment.null_value_id());
+  auto value_id_matches = std::vector<uint8_t>(null_value_id + size_t{1}, 0);
+  auto matches_any = false;
+  for (const auto& value : values) {
+    const auto value_id = segment.lower_bound(value);
+    if (value_id != INVALID_VALUE_ID && segment.value_of_value_id(value_id) == value) {
+      value_id_matches[value_id] = 1;
+      matches_any = true;
+    }
+  }
+
+  if (!matches_any) {
+    ++num_chunks_with_early_out;
+    return;
+  }
+
+  const auto* value_id_matches_data = value_id_matches.data();
+
+  if (!position_filter) {
+    scan_compressed_attribute_vector(
+        *segment.attribute_vector(), chunk_id,
+        [value_id_matches_data](const ValueID::base_type value_id) { return value_id_matches_data[value_id] != 0; },
+        matches);
+    return;
+  }
+
+  const auto comparator = [value_id_matches_data](const auto& position) {
+    return value_id_matches_data[position.value()] != 0;
+  };
+
+  auto attribute_vector_iterable = create_iterable_from_attribute_vector(segment);
+  attribute_vector_iterable.with_iterators(position_filter, [&](auto it, auto end) {
+    // No need to check for NULL because the NULL value id is never part of the set
+    _scan_with_iterators<false>(comparator, it, end, chunk_id, matches);
+  });
+}
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_dereferenced_column_table_scan_impl.hpp"
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * @brief Compares a column to a list of scalar values (... WHERE col IN (value_1, value_2, ...))
+ *
+ * Limitations:
+ * - The values are expected to have the same data type as the column and must not be NULL. As NULLs in the list never
+ *   lead to a match, they can be dropped before creating the scan.
+ * - NOT IN is not supported, as a NULL in the list would have to reject all rows.
+ *
+ * The InExpressionRewriteRule turns short lists into disjunctions and long lists into semi joins. The lists in between
+ * end up here.
+ */
+class ColumnInTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
+ public:
+  ColumnInTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
+                        const std::vector<AllTypeVariant>& init_values);
+
+  std::string description() const override;
+
+  const std::vector<AllTypeVariant> values;
+
+ protected:
+  void _scan_non_reference_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+                                   const std::shared_ptr<const AbstractPosList>& position_filter) override;
+
+  void _scan_generic_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+                             const std::shared_ptr<const AbstractPosList>& position_filter) const;
+
+  // Optimized scan on DictionarySegments
+  void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
+                                const std::shared_ptr<const AbstractPosList>& position_filter);
+};
+
+}  // namespace opossum
@@ -4,12 +4,12 @@
 #include <array>
 #include <map>
 #include <memory>
-#include <regex>
 #include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "compressed_attribute_vector_scan.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
@@ -71,23 +71,31 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegme
   // First, build a bitmap containing 1s/0s for matching/non-matching dictionary values. Second, iterate over the
   // attribute vector and check against the bitmap. If too many input rows have already been removed (are not part of
   // position_filter), this optimization is detrimental. See caller for that case.
-  std::pair<size_t, std::vector<bool>> result;
+  // The bitmap is kept per thread and reused for the following chunks, so that it does not have to be allocated for
+  // each dictionary. It holds one byte per value id to allow for lookups without branches and shifts.
+  thread_local auto dictionary_matches = std::vector<uint8_t>{};
 
+  auto match_count = size_t{0};
   if (segment.encoding_type() == EncodingType::Dictionary) {
     const auto& typed_segment = static_cast<const DictionarySegment<pmr_string>&>(segment);
-    result = _find_matches_in_dictionary(*typed_segment.dictionary());
+    match_count = _find_matches_in_dictionary(*typed_segment.dictionary(), dictionary_matches);
   } else {
     const auto& typed_segment = static_cast<const FixedStringDictionarySegment<pmr_string>&>(segment);
-    result = _find_matches_in_dictionary(*typed_segment.fixed_string_dictionary());
+    match_count = _find_matches_in_dictionary(*typed_segment.fixed_string_dictionary(), dictionary_matches);
   }
 
-  const auto& match_count = result.first;
-  const auto& dictionary_matches = result.second;
-
+  const auto null_value_id = static_cast<ValueID::base_type>(segment.null_value_id());
   auto attribute_vector_iterable = create_iterable_from_attribute_vector(segment);
 
   // LIKE matches all rows, but we still need to check for NULL
-  if (match_count == dictionary_matches.size()) {
+  if (match_count == segment.unique_values_count()) {
+    if (!position_filter) {
+      scan_compressed_attribute_vector(
+          *segment.attribute_vector(), chunk_id,
+          [null_value_id](const ValueID::base_type value_id) { return value_id != null_value_id; }, matches);
+      return;
+    }
+
     attribute_vector_iterable.with_iterators(position_filter, [&](auto it, auto end) {
       static const auto always_true = [](const auto&) { return true; };
       _scan_with_iterators<true>(always_true, it, end, chunk_id, matches);
@@ -102,24 +110,33 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegme
     return;
   }
 
-  const auto dictionary_lookup = [&dictionary_matches](const auto& position) {
-    return dictionary_matches[position.value()];
+  // The entry for the NULL value id is 0, so that NULLs do not need to be checked separately.
+  const auto* dictionary_matches_data = dictionary_matches.data();
+
+  if (!position_filter) {
+    scan_compressed_attribute_vector(
+        *segment.attribute_vector(), chunk_id,
+        [dictionary_matches_data](const ValueID::base_type value_id) { return dictionary_matches_data[value_id] != 0; },
+        matches);
+    return;
+  }
+
+  const auto dictionary_lookup = [dictionary_matches_data](const auto& position) {
+    return dictionary_matches_data[position.value()] != 0;
   };
 
   attribute_vector_iterable.with_iterators(position_filter, [&](auto it, auto end) {
-    _scan_with_iterators<true>(dictionary_lookup, it, end, chunk_id, matches);
+    _scan_with_iterators<false>(dictionary_lookup, it, end, chunk_id, matches);
   });
 }
 
 template <typename D>
-std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_dictionary(const D& dictionary) const {
-  auto result = std::pair<size_t, std::vector<bool>>{};
+size_t ColumnLikeTableScanImpl::_find_matches_in_dictionary(const D& dictionary,
+                                                            std::vector<uint8_t>& dictionary_matches) const {
+  auto count = size_t{0};
 
-  auto& count = result.first;
-  auto& dictionary_matches = result.second;
-
-  count = 0u;
-  dictionary_matches.reserve(dictionary.size());
+  dictionary_matches.resize(dictionary.size() + 1);
+  auto value_id = size_t{0};
 
   _matcher.resolve(_invert_results, [&](const auto& matcher) {
 #ifdef __clang__
@@ -132,7 +149,8 @@ std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_d
     for (const auto& value : dictionary) {
       const auto matches = matcher(value);
       count += static_cast<size_t>(matches);
-      dictionary_matches.push_back(matches);
+      dictionary_matches[value_id] = static_cast<uint8_t>(matches);
+      ++value_id;
     }
 
 #ifdef __clang__
@@ -140,7 +158,10 @@ std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_d
 #endif
   });
 
-  return result;
+  // NULL value id
+  dictionary_matches[value_id] = 0;
+
+  return count;
 }
 
 }  // namespace opossum
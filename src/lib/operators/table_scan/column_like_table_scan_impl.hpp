@@ -2,7 +2,6 @@
 
 #include <map>
 #include <memory>
-#include <regex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -25,10 +24,11 @@ class Table;
  * - Value segments are scanned sequentially
  * - For dictionary segments, we check the values in the dictionary and store the matches in a vector
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
- *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ *   enables us to detect if all or none of the values in the segment satisfy the expression. Without a position
+ *   filter, the attribute vector is then scanned on its compressed value ids (see compressed_attribute_vector_scan.hpp).
  *
- * Performance Notes: Uses std::regex as a slow fallback and resorts to much faster Pattern matchers for special cases,
- *                    e.g., StartsWithPattern. 
+ * Performance Notes: Uses a compiled LikeMatcher::GeneralPattern for arbitrary patterns and resorts to even faster
+ *                    Pattern matchers for special cases, e.g., StartsWithPattern.
  */
 class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
  public:
@@ -47,11 +47,12 @@ class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
                                 const std::shared_ptr<const AbstractPosList>& position_filter);
 
   /**
-   * Used for dictionary segments
-   * @returns number of matches and the result of each dictionary entry
+   * Used for dictionary segments. Writes the result of each dictionary entry (1 for a match, 0 otherwise) to
+   * @param dictionary_matches, which is resized to hold an additional 0 for the NULL value id.
+   * @returns number of matches
    */
   template <typename D>
-  std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(const D& dictionary) const;
+  size_t _find_matches_in_dictionary(const D& dictionary, std::vector<uint8_t>& dictionary_matches) const;
 
   const LikeMatcher _matcher;
 
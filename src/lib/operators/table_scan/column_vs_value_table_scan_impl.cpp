@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "compressed_attribute_vector_scan.hpp"
 #include "sorted_segment_search.hpp"
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
@@ -111,10 +112,15 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
    */
 
   auto iterable = create_iterable_from_attribute_vector(segment);
+  const auto null_value_id = static_cast<ValueID::base_type>(segment.null_value_id());
 
   if (_value_matches_all(segment, search_value_id)) {
-    if (_column_is_nullable) {
+    if (_column_is_nullable && !position_filter) {
       // We still have to check for NULLs
+      scan_compressed_attribute_vector(
+          *segment.attribute_vector(), chunk_id,
+          [null_value_id](const ValueID::base_type value_id) { return value_id != null_value_id; }, matches);
+    } else if (_column_is_nullable) {
       iterable.with_iterators(position_filter, [&](auto it, auto end) {
         static const auto always_true = [](const auto&) { return true; };
         _scan_with_iterators<true>(always_true, it, end, chunk_id, matches);
@@ -147,6 +153,53 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
     return;
   }
 
+  if (!position_filter) {
+    // Evaluate the predicate directly on the compressed value ids. The predicates are written such that the NULL value
+    // id (i.e., unique_values_count) never matches.
+    const auto search_value_id_base = static_cast<ValueID::base_type>(search_value_id);
+    switch (predicate_condition) {
+      case PredicateCondition::Equals:
+        scan_compressed_attribute_vector(
+            *segment.attribute_vector(), chunk_id,
+            [search_value_id_base](const ValueID::base_type value_id) { return value_id == search_value_id_base; },
+            matches);
+        return;
+
+      case PredicateCondition::NotEquals:
+        scan_compressed_attribute_vector(
+            *segment.attribute_vector(), chunk_id,
+            [search_value_id_base, null_value_id](const ValueID::base_type value_id) {
+              return (value_id != search_value_id_base) & (value_id != null_value_id);
+            },
+            matches);
+        return;
+
+      case PredicateCondition::LessThan:
+      case PredicateCondition::LessThanEquals:
+        scan_compressed_attribute_vector(
+            *segment.attribute_vector(), chunk_id,
+            [search_value_id_base](const ValueID::base_type value_id) { return value_id < search_value_id_base; },
+            matches);
+        return;
+
+      case PredicateCondition::GreaterThan:
+      case PredicateCondition::GreaterThanEquals: {
+        // value_id >= search_value_id && value_id < null_value_id, see ColumnBetweenTableScanImpl
+        const auto value_id_diff = null_value_id - search_value_id_base;
+        scan_compressed_attribute_vector(
+            *segment.attribute_vector(), chunk_id,
+            [search_value_id_base, value_id_diff](const ValueID::base_type value_id) {
+              return (value_id - search_value_id_base) < value_id_diff;
+            },
+            matches);
+        return;
+      }
+
+      default:
+        Fail("Unsupported comparison type encountered");
+    }
+  }
+
   _with_operator_for_dict_segment_scan([&](auto predicate_comparator) {
     auto comparator = [predicate_comparator, search_value_id](const auto& position) {
       return predicate_comparator(position.value(), search_value_id);
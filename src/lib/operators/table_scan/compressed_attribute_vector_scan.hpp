@@ -0,0 +1,125 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/vector_compression/bitpacking/bitpacking_unpack.hpp"
+#include "storage/vector_compression/bitpacking/bitpacking_vector.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Evaluates a predicate on the attribute vector (i.e., the compressed value ids) of a dictionary segment and appends
+ * the matching rows to a RowIDPosList. This is used by the table scans on dictionary segments when the entire segment
+ * is scanned, i.e., when there is no position filter.
+ *
+ * Instead of accessing the value ids one by one through the iterators of the attribute vector, the codes are processed
+ * in blocks of 64:
+ *  - FixedWidthIntegerVectors are read in their native width (one, two, or four bytes per code).
+ *  - BitPackingVectors are unpacked block-wise into a small buffer that stays in the L1 cache
+ *    (see unpack_bitpacking_block). The vector is never decompressed as a whole.
+ *
+ * For each block, the predicate is evaluated for all codes in a loop without branches, which the compiler vectorizes,
+ * and the results are collected in a 64-bit match mask. Only then is the mask converted into RowIDs: blocks without
+ * matches are skipped and blocks in which all rows match are written in one go, so that both very selective and very
+ * unselective predicates barely pay for the conversion.
+ *
+ * The predicate is called with a ValueID::base_type and must be branch-free to allow for vectorization, e.g.,
+ * `value_id < search_value_id` or `(value_id - lower_bound) < (upper_bound - lower_bound)`. NULLs are represented by
+ * the null value id of the segment and have to be excluded by the predicate if necessary.
+ */
+template <typename Predicate>
+void scan_compressed_attribute_vector(const BaseCompressedVector& attribute_vector, const ChunkID chunk_id,
+                                      const Predicate& predicate, RowIDPosList& matches);
+
+namespace detail {
+
+constexpr auto ATTRIBUTE_VECTOR_SCAN_BLOCK_SIZE = size_t{64};
+constexpr auto ALL_ROWS_MATCHING_MASK = ~uint64_t{0};
+
+// Returns the match mask for the first @param count (at most 64) codes, bit i representing codes[i].
+template <typename Code, typename Predicate>
+uint64_t evaluate_codes(const Code* codes, const size_t count, const Predicate& predicate) {
+  auto mask = uint64_t{0};
+
+  // This empty block is used to convince clang-format to keep the pragma indented.
+  // NOLINTNEXTLINE
+  {}  // clang-format off
+  #pragma omp simd reduction(| : mask)
+  // clang-format on
+  for (auto index = size_t{0}; index < count; ++index) {
+    mask |= static_cast<uint64_t>(predicate(static_cast<ValueID::base_type>(codes[index]))) << index;
+  }
+
+  return mask;
+}
+
+// Appends the rows of the set bits in @param mask, bit i representing the row first_chunk_offset + i.
+inline void append_matches(uint64_t mask, const ChunkID chunk_id, const ChunkOffset first_chunk_offset,
+                           RowIDPosList& matches) {
+  if (mask == 0) return;
+
+  const auto output_start_offset = matches.size();
+
+  if (mask == ALL_ROWS_MATCHING_MASK) {
+    matches.resize(output_start_offset + ATTRIBUTE_VECTOR_SCAN_BLOCK_SIZE);
+    for (auto index = ChunkOffset{0}; index < ATTRIBUTE_VECTOR_SCAN_BLOCK_SIZE; ++index) {
+      matches[output_start_offset + index] = RowID{chunk_id, first_chunk_offset + index};
+    }
+    return;
+  }
+
+  matches.resize(output_start_offset + __builtin_popcountll(mask));
+  auto output_offset = output_start_offset;
+  while (mask != 0) {
+    matches[output_offset] = RowID{chunk_id, first_chunk_offset + static_cast<ChunkOffset>(__builtin_ctzll(mask))};
+    ++output_offset;
+    mask &= mask - 1;
+  }
+}
+
+template <typename Code, typename Predicate>
+void scan_codes(const Code* codes, const size_t count, const ChunkID chunk_id, const ChunkOffset first_chunk_offset,
+                const Predicate& predicate, RowIDPosList& matches) {
+  for (auto block_begin = size_t{0}; block_begin < count; block_begin += ATTRIBUTE_VECTOR_SCAN_BLOCK_SIZE) {
+    const auto block_size = std::min(ATTRIBUTE_VECTOR_SCAN_BLOCK_SIZE, count - block_begin);
+    const auto mask = block_size == ATTRIBUTE_VECTOR_SCAN_BLOCK_SIZE
+                          ? evaluate_codes(codes + block_begin, ATTRIBUTE_VECTOR_SCAN_BLOCK_SIZE, predicate)
+                          : evaluate_codes(codes + block_begin, block_size, predicate);
+    append_matches(mask, chunk_id, static_cast<ChunkOffset>(first_chunk_offset + block_begin), matches);
+  }
+}
+
+}  // namespace detail
+
+template <typename Predicate>
+void scan_compressed_attribute_vector(const BaseCompressedVector& attribute_vector, const ChunkID chunk_id,
+                                      const Predicate& predicate, RowIDPosList& matches) {
+  resolve_compressed_vector_type(attribute_vector, [&](const auto& vector) {
+    using VectorType = std::decay_t<decltype(vector)>;
+
+    if constexpr (std::is_same_v<VectorType, BitPackingVector>) {
+      const auto& data = vector.data();
+      const auto size = vector.size();
+
+      // BITPACKING_BLOCK_SIZE is a multiple of the scan block size, so that only the last block is a partial one.
+      static_assert(BITPACKING_BLOCK_SIZE % detail::ATTRIBUTE_VECTOR_SCAN_BLOCK_SIZE == 0);
+      auto block = BitPackingBlock{};
+      for (auto block_begin = size_t{0}; block_begin < size; block_begin += BITPACKING_BLOCK_SIZE) {
+        unpack_bitpacking_block(data, block_begin, block);
+        const auto block_size = std::min(BITPACKING_BLOCK_SIZE, size - block_begin);
+        detail::scan_codes(block.data(), block_size, chunk_id, static_cast<ChunkOffset>(block_begin), predicate,
+                           matches);
+      }
+    } else {
+      // FixedWidthIntegerVector
+      detail::scan_codes(vector.data(), vector.size(), chunk_id, ChunkOffset{0}, predicate, matches);
+    }
+  });
+}
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #include "validate.hpp"
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -50,11 +51,12 @@ bool Validate::_is_entire_chunk_visible(const std::shared_ptr<const Chunk>& chun
   const auto max_begin_cid = mvcc_data->max_begin_cid;
   if (!max_begin_cid) return false;
 
-  return snapshot_commit_id >= max_begin_cid && chunk->invalid_row_count() == 0;
+  return snapshot_commit_id >= max_begin_cid &&
+         (chunk->invalid_row_count() == 0 || snapshot_commit_id < mvcc_data->min_end_cid);
 }
 
 Validate::Validate(const std::shared_ptr<AbstractOperator>& in)
-    : AbstractReadOnlyOperator(OperatorType::Validate, in) {}
+    : AbstractChunkwiseOperator(OperatorType::Validate, in) {}
 
 const std::string& Validate::name() const {
   static const auto name = std::string{"Validate"};
@@ -78,6 +80,8 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   DebugAssert(transaction_context, "Validate requires a valid TransactionContext.");
   DebugAssert(transaction_context->phase() == TransactionPhase::Active, "Transaction is not active anymore.");
 
+  if (_executes_as_pipeline()) return _execute_pipeline();
+
   const auto in_table = left_input_table();
   const auto chunk_count = in_table->chunk_count();
   const auto our_tid = transaction_context->transaction_id();
@@ -98,15 +102,11 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   // (2) all rows in the chunk have been committed (i.e., their begin_cid has been set),
   // (3) the highest begin_cid in the chunk is lower than/equal to the snapshot_cid of the transaction
   //     (the max_begin_cid is stored in the chunk, not determined by the ValidateOperator),
-  // (4) no rows in the chunk have been invalidated before this transaction was started,
+  // (4) no rows in the chunk have been invalidated as of the snapshot_cid of the transaction (i.e., the lowest
+  //     end_cid in the chunk is higher than the snapshot_cid),
   // (5) the current transaction has no in-flight deletes.
-  const auto& read_write_operators = transaction_context->read_write_operators();
-  for (const auto& read_write_operator : read_write_operators) {
-    if (read_write_operator->type() == OperatorType::Delete) {
-      _can_use_chunk_shortcut = false;
-      break;
-    }
-  }
+  _can_use_chunk_shortcut = _can_use_chunk_shortcut_for(*transaction_context);
+  _can_ignore_transaction_ids = _can_ignore_transaction_ids_for(*transaction_context);
 
   while (job_end_chunk_id < chunk_count) {
     const auto chunk = in_table->get_chunk(job_end_chunk_id);
@@ -141,6 +141,39 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   return std::make_shared<Table>(in_table->column_definitions(), TableType::References, std::move(output_chunks));
 }
 
+bool Validate::_can_use_chunk_shortcut_for(TransactionContext& transaction_context) {
+  const auto& read_write_operators = transaction_context.read_write_operators();
+  for (const auto& read_write_operator : read_write_operators) {
+    if (read_write_operator->type() == OperatorType::Delete) return false;
+  }
+  return true;
+}
+
+bool Validate::_can_ignore_transaction_ids_for(TransactionContext& transaction_context) {
+  return transaction_context.read_write_operators().empty();
+}
+
+void Validate::_on_begin_pipeline(const std::shared_ptr<const Table>& pipeline_input_table) {
+  const auto transaction_context = this->transaction_context();
+  Assert(transaction_context, "Validate can't be called without a transaction context.");
+  DebugAssert(transaction_context->phase() == TransactionPhase::Active, "Transaction is not active anymore.");
+
+  // See _on_execute for the conditions of the shortcut.
+  _can_use_chunk_shortcut = _can_use_chunk_shortcut_for(*transaction_context);
+  _can_ignore_transaction_ids = _can_ignore_transaction_ids_for(*transaction_context);
+  _pipeline_tid = transaction_context->transaction_id();
+  _pipeline_snapshot_commit_id = transaction_context->snapshot_commit_id();
+}
+
+std::shared_ptr<Chunk> Validate::_on_execute_morsel(const std::shared_ptr<const Table>& in_table,
+                                                    const ChunkID chunk_id) {
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  auto output_mutex = std::mutex{};
+  _validate_chunks(in_table, chunk_id, chunk_id, _pipeline_tid, _pipeline_snapshot_commit_id, output_chunks,
+                   output_mutex);
+  return output_chunks.empty() ? nullptr : output_chunks.front();
+}
+
 void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id_start,
                                 const ChunkID chunk_id_end, const TransactionID our_tid,
                                 const TransactionID snapshot_commit_id,
@@ -264,9 +297,35 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
         temp_pos_list.guarantee_single_chunk();
         // Generate pos_list_out.
         auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
-        for (auto i = 0u; i < chunk_size; i++) {
-          if (opossum::is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_data)) {
-            temp_pos_list.emplace_back(RowID{chunk_id, i});
+        auto chunk_offset = ChunkOffset{0};
+        if (_can_ignore_transaction_ids) {
+          // Check blocks of rows at once. Blocks in which all rows are visible, which is common for chunks in which
+          // only a few rows have been updated, are added without looking at the individual rows.
+          constexpr auto BLOCK_SIZE = MvccData::VISIBILITY_MASK_SIZE;
+          constexpr auto ALL_VISIBLE_MASK = std::numeric_limits<uint32_t>::max();
+          static_assert(BLOCK_SIZE == sizeof(ALL_VISIBLE_MASK) * 8, "Mask does not match the block size");
+
+          for (; chunk_offset + BLOCK_SIZE <= chunk_size; chunk_offset += BLOCK_SIZE) {
+            auto mask = mvcc_data->get_committed_visibility_mask(chunk_offset, snapshot_commit_id);
+            if (mask == ALL_VISIBLE_MASK) {
+              for (auto block_offset = ChunkOffset{0}; block_offset < BLOCK_SIZE; ++block_offset) {
+                temp_pos_list.emplace_back(RowID{chunk_id, chunk_offset + block_offset});
+              }
+              continue;
+            }
+
+            while (mask) {
+              const auto block_offset = static_cast<ChunkOffset>(__builtin_ctz(mask));
+              temp_pos_list.emplace_back(RowID{chunk_id, chunk_offset + block_offset});
+              mask &= mask - 1;
+            }
+          }
+        }
+
+        // Check the remaining rows (or all rows if the transaction might have modified some of them) one by one.
+        for (; chunk_offset < chunk_size; ++chunk_offset) {
+          if (opossum::is_row_visible(our_tid, snapshot_commit_id, chunk_offset, *mvcc_data)) {
+            temp_pos_list.emplace_back(RowID{chunk_id, chunk_offset});
           }
         }
         pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
@@ -4,7 +4,7 @@
 #include <string>
 #include <vector>
 
-#include "abstract_read_only_operator.hpp"
+#include "abstract_chunkwise_operator.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -16,7 +16,7 @@ namespace opossum {
  *
  * Assumption: Validate happens before joins.
  */
-class Validate : public AbstractReadOnlyOperator {
+class Validate : public AbstractChunkwiseOperator {
   friend class OperatorsValidateTest;
 
  public:
@@ -37,7 +37,19 @@ class Validate : public AbstractReadOnlyOperator {
   // _can_use_chunk_shortcut is true. Consult _on_execute() for more details on the conditions.
   bool _is_entire_chunk_visible(const std::shared_ptr<const Chunk>& chunk, const CommitID snapshot_commit_id) const;
 
+  // The shortcut cannot be used if the transaction has in-flight deletes.
+  static bool _can_use_chunk_shortcut_for(TransactionContext& transaction_context);
+
+  // If the transaction has not executed any read-write operators, no row carries its TID. Thus, the visibility only
+  // depends on the CIDs and can be checked for blocks of rows at once (see MvccData::get_committed_visibility_mask).
+  static bool _can_ignore_transaction_ids_for(TransactionContext& transaction_context);
+
   bool _can_use_chunk_shortcut = true;
+  bool _can_ignore_transaction_ids = false;
+
+  // Only set while the operator is part of a pipeline.
+  TransactionID _pipeline_tid{0};
+  CommitID _pipeline_snapshot_commit_id{0};
 
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
@@ -47,6 +59,10 @@ class Validate : public AbstractReadOnlyOperator {
       const std::shared_ptr<AbstractOperator>& copied_right_input,
       std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  void _on_begin_pipeline(const std::shared_ptr<const Table>& pipeline_input_table) override;
+  std::shared_ptr<Chunk> _on_execute_morsel(const std::shared_ptr<const Table>& in_table,
+                                            const ChunkID chunk_id) override;
 };
 
 }  // namespace opossum
@@ -0,0 +1,647 @@
+#include "window.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "expression/pqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Rows are addressed by their global index in the input table, i.e., the row (chunk_id, chunk_offset) has the index
+// chunk_offsets[chunk_id] + chunk_offset.
+
+class BaseMaterializedColumn {
+ public:
+  virtual ~BaseMaterializedColumn() = default;
+
+  virtual bool is_null(const size_t row) const = 0;
+
+  // Returns a negative value, zero, or a positive value if the value of `lhs` is smaller than, equal to, or greater
+  // than the value of `rhs`. NULLs are equal to each other and smaller than all other values.
+  virtual int compare(const size_t lhs, const size_t rhs) const = 0;
+
+  virtual size_t hash(const size_t row) const = 0;
+};
+
+template <typename ColumnDataType>
+class MaterializedColumn : public BaseMaterializedColumn {
+ public:
+  MaterializedColumn(const Table& table, const ColumnID column_id, const std::vector<size_t>& chunk_offsets)
+      : values(chunk_offsets.back()), nulls(chunk_offsets.back(), false) {
+    const auto chunk_count = table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+      const auto chunk_offset_begin = chunk_offsets[chunk_id];
+      segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+        const auto row = chunk_offset_begin + position.chunk_offset();
+        if (position.is_null()) {
+          nulls[row] = true;
+        } else {
+          values[row] = position.value();
+        }
+      });
+    }
+  }
+
+  bool is_null(const size_t row) const final { return nulls[row]; }
+
+  int compare(const size_t lhs, const size_t rhs) const final {
+    if (nulls[lhs] || nulls[rhs]) return static_cast<int>(!nulls[lhs]) - static_cast<int>(!nulls[rhs]);
+    if (values[lhs] < values[rhs]) return -1;
+    if (values[rhs] < values[lhs]) return 1;
+    return 0;
+  }
+
+  size_t hash(const size_t row) const final { return nulls[row] ? 0 : std::hash<ColumnDataType>{}(values[row]); }
+
+  std::vector<ColumnDataType> values;
+  std::vector<bool> nulls;
+};
+
+using MaterializedColumns = std::vector<std::unique_ptr<BaseMaterializedColumn>>;
+
+ColumnID column_id_of(const std::shared_ptr<AbstractExpression>& expression) {
+  const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression);
+  Assert(pqp_column_expression, "Window operator expects columns as input, got '" + expression->as_column_name() +
+                                    "'. Compute it in a Projection first.");
+  return pqp_column_expression->column_id;
+}
+
+std::unique_ptr<BaseMaterializedColumn> materialize_column(const Table& table, const ColumnID column_id,
+                                                           const std::vector<size_t>& chunk_offsets) {
+  auto materialized_column = std::unique_ptr<BaseMaterializedColumn>{};
+  resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    materialized_column = std::make_unique<MaterializedColumn<ColumnDataType>>(table, column_id, chunk_offsets);
+  });
+  return materialized_column;
+}
+
+/**
+ * Hash-partitions the rows by their PARTITION BY values and sorts each hash partition by the PARTITION BY values and
+ * the ORDER BY values. As all rows of a window partition end up in the same hash partition, the hash partitions can be
+ * sorted and evaluated independently of each other.
+ */
+class WindowPartitioning {
+ public:
+  WindowPartitioning(MaterializedColumns partition_columns, MaterializedColumns order_columns,
+                     const std::vector<SortMode>& sort_modes, const size_t row_count)
+      : _partition_columns(std::move(partition_columns)),
+        _order_columns(std::move(order_columns)),
+        _sort_modes(sort_modes) {
+    // Aim for about one hash partition per default-sized chunk so that there is enough parallelism without having to
+    // schedule jobs for tiny partitions. Without PARTITION BY, there is only a single window partition.
+    constexpr auto MAX_HASH_PARTITION_BITS = size_t{8};
+    auto hash_partition_bits = size_t{0};
+    if (!_partition_columns.empty()) {
+      while (hash_partition_bits < MAX_HASH_PARTITION_BITS &&
+             (row_count >> hash_partition_bits) > static_cast<size_t>(Chunk::DEFAULT_SIZE)) {
+        ++hash_partition_bits;
+      }
+    }
+
+    _hash_partitions.resize(size_t{1} << hash_partition_bits);
+    if (hash_partition_bits == 0) {
+      _hash_partitions[0].resize(row_count);
+      std::iota(_hash_partitions[0].begin(), _hash_partitions[0].end(), size_t{0});
+      return;
+    }
+
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      auto hash = size_t{0};
+      for (const auto& partition_column : _partition_columns) {
+        boost::hash_combine(hash, partition_column->hash(row));
+      }
+      // Fibonacci hashing, so that the upper bits of the hash determine the hash partition.
+      const auto hash_partition = (hash * 0x9E3779B97F4A7C15ull) >> (64 - hash_partition_bits);
+      _hash_partitions[hash_partition].emplace_back(row);
+    }
+  }
+
+  // Calls `functor(rows, begin, end)` for every window partition, where rows[begin] to rows[end - 1] are the sorted
+  // rows of the partition. Hash partitions are processed by concurrent jobs, so the functor must be thread-safe.
+  template <typename Functor>
+  void for_each_partition(const Functor& functor) {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(_hash_partitions.size());
+
+    for (auto& rows : _hash_partitions) {
+      if (rows.empty()) continue;
+
+      const auto sort_and_evaluate = [this, &rows, &functor]() {
+        std::sort(rows.begin(), rows.end(), [&](const auto lhs, const auto rhs) { return _less(lhs, rhs); });
+
+        const auto row_count = rows.size();
+        auto partition_begin = size_t{0};
+        for (auto row_idx = size_t{1}; row_idx <= row_count; ++row_idx) {
+          if (row_idx < row_count && _same_partition(rows[row_idx - 1], rows[row_idx])) continue;
+          functor(rows, partition_begin, row_idx);
+          partition_begin = row_idx;
+        }
+      };
+
+      // Same threshold as in other operators: Small hash partitions are not worth the scheduling overhead.
+      constexpr auto JOB_SPAWN_THRESHOLD = size_t{500};
+      if (rows.size() >= JOB_SPAWN_THRESHOLD) {
+        jobs.emplace_back(std::make_shared<JobTask>(sort_and_evaluate));
+      } else {
+        sort_and_evaluate();
+      }
+    }
+
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  }
+
+  // Two rows are peers if they have the same ORDER BY values. Both rows must belong to the same window partition.
+  bool is_peer(const size_t lhs, const size_t rhs) const {
+    return std::all_of(_order_columns.begin(), _order_columns.end(),
+                       [&](const auto& order_column) { return order_column->compare(lhs, rhs) == 0; });
+  }
+
+ private:
+  bool _same_partition(const size_t lhs, const size_t rhs) const {
+    return std::all_of(_partition_columns.begin(), _partition_columns.end(),
+                       [&](const auto& partition_column) { return partition_column->compare(lhs, rhs) == 0; });
+  }
+
+  bool _less(const size_t lhs, const size_t rhs) const {
+    for (const auto& partition_column : _partition_columns) {
+      const auto comparison = partition_column->compare(lhs, rhs);
+      if (comparison != 0) return comparison < 0;
+    }
+
+    const auto order_column_count = _order_columns.size();
+    for (auto order_column_idx = size_t{0}; order_column_idx < order_column_count; ++order_column_idx) {
+      const auto& order_column = *_order_columns[order_column_idx];
+      const auto comparison = order_column.compare(lhs, rhs);
+      if (comparison == 0) continue;
+
+      // As in the Sort operator, NULLs come first, independent of the sort mode.
+      if (order_column.is_null(lhs) || order_column.is_null(rhs)) return comparison < 0;
+      return _sort_modes[order_column_idx] == SortMode::Ascending ? comparison < 0 : comparison > 0;
+    }
+
+    // Break ties by the input position to make the sort stable.
+    return lhs < rhs;
+  }
+
+  const MaterializedColumns _partition_columns;
+  const MaterializedColumns _order_columns;
+  const std::vector<SortMode> _sort_modes;
+  std::vector<std::vector<size_t>> _hash_partitions;
+};
+
+// Holds the result for every row of the input table, indexed by the global row index.
+template <typename ResultType>
+struct WindowResult {
+  explicit WindowResult(const size_t row_count) : values(row_count), nulls(row_count, false) {}
+
+  std::vector<ResultType> values;
+
+  // Not a std::vector<bool>, as the jobs write the results of different rows concurrently.
+  std::vector<uint8_t> nulls;
+};
+
+template <typename ResultType>
+std::vector<std::shared_ptr<AbstractSegment>> write_result_segments(WindowResult<ResultType>& result,
+                                                                    const std::vector<size_t>& chunk_offsets,
+                                                                    const bool nullable) {
+  const auto chunk_count = chunk_offsets.size() - 1;
+  auto result_segments = std::vector<std::shared_ptr<AbstractSegment>>(chunk_count);
+
+  for (auto chunk_id = size_t{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto begin = static_cast<std::ptrdiff_t>(chunk_offsets[chunk_id]);
+    const auto end = static_cast<std::ptrdiff_t>(chunk_offsets[chunk_id + 1]);
+
+    auto values = pmr_vector<ResultType>(std::make_move_iterator(result.values.begin() + begin),
+                                         std::make_move_iterator(result.values.begin() + end));
+    if (nullable) {
+      auto nulls = pmr_vector<bool>(result.nulls.begin() + begin, result.nulls.begin() + end);
+      result_segments[chunk_id] = std::make_shared<ValueSegment<ResultType>>(std::move(values), std::move(nulls));
+    } else {
+      result_segments[chunk_id] = std::make_shared<ValueSegment<ResultType>>(std::move(values));
+    }
+  }
+
+  return result_segments;
+}
+
+std::vector<std::shared_ptr<AbstractSegment>> evaluate_ranking_function(const WindowFunction window_function,
+                                                                        WindowPartitioning& partitioning,
+                                                                        const std::vector<size_t>& chunk_offsets) {
+  auto result = WindowResult<int64_t>{chunk_offsets.back()};
+
+  partitioning.for_each_partition([&](const std::vector<size_t>& rows, const size_t begin, const size_t end) {
+    auto rank = int64_t{0};
+    auto dense_rank = int64_t{0};
+    for (auto row_idx = begin; row_idx < end; ++row_idx) {
+      const auto row_number = static_cast<int64_t>(row_idx - begin + 1);
+      if (row_idx == begin || !partitioning.is_peer(rows[row_idx - 1], rows[row_idx])) {
+        rank = row_number;
+        ++dense_rank;
+      }
+
+      switch (window_function) {
+        case WindowFunction::RowNumber:
+          result.values[rows[row_idx]] = row_number;
+          break;
+        case WindowFunction::Rank:
+          result.values[rows[row_idx]] = rank;
+          break;
+        case WindowFunction::DenseRank:
+          result.values[rows[row_idx]] = dense_rank;
+          break;
+        default:
+          Fail("Not a ranking function");
+      }
+    }
+  });
+
+  return write_result_segments(result, chunk_offsets, false);
+}
+
+// The partial aggregate of a range of rows. `count` is the number of non-NULL values (or rows, for COUNT(*)).
+template <typename AggregateType>
+struct AggregateState {
+  AggregateType value{};
+  uint64_t count{0};
+};
+
+template <WindowFunction window_function, typename AggregateType>
+AggregateState<AggregateType> combine(const AggregateState<AggregateType>& lhs,
+                                      const AggregateState<AggregateType>& rhs) {
+  if constexpr (window_function == WindowFunction::Min || window_function == WindowFunction::Max) {
+    if (lhs.count == 0) return rhs;
+    if (rhs.count == 0) return lhs;
+    const auto take_lhs = window_function == WindowFunction::Min ? !(rhs.value < lhs.value) : !(lhs.value < rhs.value);
+    return {take_lhs ? lhs.value : rhs.value, lhs.count + rhs.count};
+  } else if constexpr (window_function == WindowFunction::Sum || window_function == WindowFunction::Avg) {
+    return {lhs.value + rhs.value, lhs.count + rhs.count};
+  } else {
+    return {AggregateType{}, lhs.count + rhs.count};
+  }
+}
+
+/**
+ * Segment tree over the partial aggregates of the rows of a window partition. Each inner node holds the combined
+ * aggregate of its two children, so the aggregate of any range of rows can be combined from O(log n) nodes. This is
+ * used for frames that do not start at the beginning of the partition, where the aggregate cannot be maintained
+ * incrementally without supporting the removal of values (which is impossible for MIN and MAX).
+ */
+template <WindowFunction window_function, typename AggregateType>
+class SegmentTree {
+ public:
+  using State = AggregateState<AggregateType>;
+
+  explicit SegmentTree(std::vector<State>&& leaves) : _leaf_count(leaves.size()), _nodes(2 * leaves.size()) {
+    std::move(leaves.begin(), leaves.end(), _nodes.begin() + static_cast<std::ptrdiff_t>(_leaf_count));
+    for (auto node = _leaf_count - 1; node > 0; --node) {
+      _nodes[node] = combine<window_function>(_nodes[2 * node], _nodes[2 * node + 1]);
+    }
+  }
+
+  // Returns the aggregate of the leaves [begin, end).
+  State query(size_t begin, size_t end) const {
+    auto left_state = State{};
+    auto right_state = State{};
+    for (begin += _leaf_count, end += _leaf_count; begin < end; begin >>= 1, end >>= 1) {
+      if (begin & 1) left_state = combine<window_function>(left_state, _nodes[begin++]);
+      if (end & 1) right_state = combine<window_function>(_nodes[--end], right_state);
+    }
+    return combine<window_function>(left_state, right_state);
+  }
+
+ private:
+  const size_t _leaf_count;
+  std::vector<State> _nodes;
+};
+
+// Returns the frame [frame_begin, frame_end) of the row at `row_idx`. All indexes are relative to the partition.
+// peer_begins and peer_ends are only used for RANGE frames.
+std::pair<size_t, size_t> frame_of(const FrameDescription& frame_description, const size_t row_idx,
+                                   const size_t partition_size, const std::vector<size_t>& peer_begins,
+                                   const std::vector<size_t>& peer_ends) {
+  const auto is_range = frame_description.type == FrameType::Range;
+
+  const auto& start = frame_description.start;
+  auto frame_begin = size_t{0};
+  if (!start.unbounded) {
+    switch (start.type) {
+      case FrameBoundType::Preceding:
+        frame_begin = row_idx >= start.offset ? row_idx - start.offset : 0;
+        break;
+      case FrameBoundType::CurrentRow:
+        frame_begin = is_range ? peer_begins[row_idx] : row_idx;
+        break;
+      case FrameBoundType::Following:
+        frame_begin = std::min(row_idx + start.offset, partition_size);
+        break;
+    }
+  }
+
+  const auto& end = frame_description.end;
+  auto frame_end = partition_size;
+  if (!end.unbounded) {
+    switch (end.type) {
+      case FrameBoundType::Preceding:
+        frame_end = row_idx + 1 >= end.offset ? row_idx + 1 - end.offset : 0;
+        break;
+      case FrameBoundType::CurrentRow:
+        frame_end = is_range ? peer_ends[row_idx] : row_idx + 1;
+        break;
+      case FrameBoundType::Following:
+        frame_end = std::min(row_idx + end.offset + 1, partition_size);
+        break;
+    }
+  }
+
+  return {frame_begin, std::max(frame_begin, frame_end)};
+}
+
+template <WindowFunction window_function, typename AggregateType, typename LeafFunctor>
+std::vector<std::shared_ptr<AbstractSegment>> evaluate_aggregate_function(
+    WindowPartitioning& partitioning, const FrameDescription& frame_description, const LeafFunctor& leaf_of_row,
+    const std::vector<size_t>& chunk_offsets) {
+  using State = AggregateState<AggregateType>;
+
+  auto result = WindowResult<AggregateType>{chunk_offsets.back()};
+
+  const auto write_result = [&](const size_t row, const State& state) {
+    if constexpr (window_function == WindowFunction::Count) {
+      result.values[row] = static_cast<AggregateType>(state.count);
+    } else {
+      if (state.count == 0) {
+        result.nulls[row] = true;
+      } else if constexpr (window_function == WindowFunction::Avg) {
+        result.values[row] = state.value / static_cast<AggregateType>(state.count);
+      } else {
+        result.values[row] = state.value;
+      }
+    }
+  };
+
+  partitioning.for_each_partition([&](const std::vector<size_t>& rows, const size_t begin, const size_t end) {
+    const auto partition_size = end - begin;
+
+    auto peer_begins = std::vector<size_t>{};
+    auto peer_ends = std::vector<size_t>{};
+    if (frame_description.type == FrameType::Range) {
+      peer_begins.resize(partition_size);
+      peer_ends.resize(partition_size);
+      for (auto row_idx = size_t{0}; row_idx < partition_size; ++row_idx) {
+        const auto is_peer = row_idx > 0 && partitioning.is_peer(rows[begin + row_idx - 1], rows[begin + row_idx]);
+        peer_begins[row_idx] = is_peer ? peer_begins[row_idx - 1] : row_idx;
+      }
+      for (auto row_idx = partition_size; row_idx > 0; --row_idx) {
+        const auto is_peer = row_idx < partition_size && peer_begins[row_idx] == peer_begins[row_idx - 1];
+        peer_ends[row_idx - 1] = is_peer ? peer_ends[row_idx] : row_idx;
+      }
+    }
+
+    auto leaves = std::vector<State>(partition_size);
+    for (auto row_idx = size_t{0}; row_idx < partition_size; ++row_idx) {
+      leaves[row_idx] = leaf_of_row(rows[begin + row_idx]);
+    }
+
+    if (frame_description.start.unbounded) {
+      // The frame only grows from row to row, so the aggregate can be maintained incrementally.
+      auto state = State{};
+      auto aggregated_row_count = size_t{0};
+      for (auto row_idx = size_t{0}; row_idx < partition_size; ++row_idx) {
+        const auto frame_end = frame_of(frame_description, row_idx, partition_size, peer_begins, peer_ends).second;
+        for (; aggregated_row_count < frame_end; ++aggregated_row_count) {
+          state = combine<window_function>(state, leaves[aggregated_row_count]);
+        }
+        write_result(rows[begin + row_idx], state);
+      }
+      return;
+    }
+
+    const auto segment_tree = SegmentTree<window_function, AggregateType>{std::move(leaves)};
+    for (auto row_idx = size_t{0}; row_idx < partition_size; ++row_idx) {
+      const auto [frame_begin, frame_end] =
+          frame_of(frame_description, row_idx, partition_size, peer_begins, peer_ends);
+      write_result(rows[begin + row_idx], segment_tree.query(frame_begin, frame_end));
+    }
+  });
+
+  return write_result_segments(result, chunk_offsets, window_function != WindowFunction::Count);
+}
+
+template <WindowFunction window_function, typename AggregateType, typename ArgumentType>
+std::vector<std::shared_ptr<AbstractSegment>> evaluate_aggregate_function_on_column(
+    WindowPartitioning& partitioning, const FrameDescription& frame_description,
+    const MaterializedColumn<ArgumentType>& argument_column, const std::vector<size_t>& chunk_offsets) {
+  const auto leaf_of_row = [&](const size_t row) {
+    if (argument_column.nulls[row]) return AggregateState<AggregateType>{};
+    return AggregateState<AggregateType>{static_cast<AggregateType>(argument_column.values[row]), 1};
+  };
+  return evaluate_aggregate_function<window_function, AggregateType>(partitioning, frame_description, leaf_of_row,
+                                                                     chunk_offsets);
+}
+
+}  // namespace
+
+namespace opossum {
+
+Window::Window(const std::shared_ptr<const AbstractOperator>& input_operator,
+               const std::shared_ptr<WindowFunctionExpression>& window_function_expression)
+    : AbstractReadOnlyOperator(OperatorType::Window, input_operator, nullptr,
+                               std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
+      _window_function_expression(window_function_expression) {}
+
+const std::string& Window::name() const {
+  static const auto name = std::string{"Window"};
+  return name;
+}
+
+std::string Window::description(DescriptionMode description_mode) const {
+  const auto* const separator = description_mode == DescriptionMode::SingleLine ? " " : "\n";
+
+  std::stringstream stream;
+  stream << AbstractOperator::description(description_mode) << separator
+         << _window_function_expression->as_column_name();
+  return stream.str();
+}
+
+const std::shared_ptr<WindowFunctionExpression>& Window::window_function_expression() const {
+  return _window_function_expression;
+}
+
+std::shared_ptr<AbstractOperator> Window::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+  return std::make_shared<Window>(
+      copied_left_input,
+      std::static_pointer_cast<WindowFunctionExpression>(_window_function_expression->deep_copy(copied_ops)));
+}
+
+void Window::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> Window::_on_execute() {
+  Timer timer;
+
+  const auto& input_table = *left_input_table();
+  const auto& window_function_expression = *_window_function_expression;
+  const auto window_function = window_function_expression.window_function;
+
+  const auto chunk_count = input_table.chunk_count();
+  auto chunk_offsets = std::vector<size_t>(chunk_count + 1);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table.get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+    chunk_offsets[chunk_id + 1] = chunk_offsets[chunk_id] + chunk->size();
+  }
+  const auto row_count = chunk_offsets.back();
+
+  // (1) Materialize the PARTITION BY and ORDER BY columns.
+  auto partition_columns = MaterializedColumns{};
+  for (const auto& expression : window_function_expression.partition_by_expressions()) {
+    partition_columns.emplace_back(materialize_column(input_table, column_id_of(expression), chunk_offsets));
+  }
+  auto order_columns = MaterializedColumns{};
+  for (const auto& expression : window_function_expression.order_by_expressions()) {
+    order_columns.emplace_back(materialize_column(input_table, column_id_of(expression), chunk_offsets));
+  }
+
+  auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
+  step_performance_data.set_step_runtime(OperatorSteps::MaterializeColumns, timer.lap());
+
+  // (2) Hash-partition the rows.
+  auto partitioning = WindowPartitioning{std::move(partition_columns), std::move(order_columns),
+                                         window_function_expression.sort_modes, row_count};
+  step_performance_data.set_step_runtime(OperatorSteps::Partition, timer.lap());
+
+  // (3) Sort the hash partitions and evaluate the window function for each window partition.
+  const auto& frame_description = window_function_expression.frame_description;
+  auto result_segments = std::vector<std::shared_ptr<AbstractSegment>>{};
+  if (WindowFunctionExpression::is_ranking_function(window_function)) {
+    result_segments = evaluate_ranking_function(window_function, partitioning, chunk_offsets);
+  } else if (window_function == WindowFunction::Count) {
+    const auto argument = window_function_expression.argument();
+    const auto argument_column =
+        argument ? materialize_column(input_table, column_id_of(argument), chunk_offsets) : nullptr;
+    const auto leaf_of_row = [&](const size_t row) {
+      const auto counted = !argument_column || !argument_column->is_null(row);
+      return AggregateState<int64_t>{0, counted ? uint64_t{1} : uint64_t{0}};
+    };
+    result_segments = evaluate_aggregate_function<WindowFunction::Count, int64_t>(partitioning, frame_description,
+                                                                                  leaf_of_row, chunk_offsets);
+  } else {
+    const auto argument_column_id = column_id_of(window_function_expression.argument());
+    resolve_data_type(input_table.column_data_type(argument_column_id), [&](const auto data_type_t) {
+      using ArgumentDataType = typename decltype(data_type_t)::type;
+      const auto argument_column = MaterializedColumn<ArgumentDataType>{input_table, argument_column_id, chunk_offsets};
+
+      switch (window_function) {
+        case WindowFunction::Min:
+          result_segments = evaluate_aggregate_function_on_column<WindowFunction::Min, ArgumentDataType>(
+              partitioning, frame_description, argument_column, chunk_offsets);
+          break;
+        case WindowFunction::Max:
+          result_segments = evaluate_aggregate_function_on_column<WindowFunction::Max, ArgumentDataType>(
+              partitioning, frame_description, argument_column, chunk_offsets);
+          break;
+        case WindowFunction::Sum:
+        case WindowFunction::Avg:
+          if constexpr (std::is_arithmetic_v<ArgumentDataType>) {
+            // Sum integers as int64_t, everything else (including AVG of integers) as double. This matches the
+            // result types of the AggregateTraits.
+            if (window_function == WindowFunction::Sum && std::is_integral_v<ArgumentDataType>) {
+              result_segments = evaluate_aggregate_function_on_column<WindowFunction::Sum, int64_t>(
+                  partitioning, frame_description, argument_column, chunk_offsets);
+            } else if (window_function == WindowFunction::Sum) {
+              result_segments = evaluate_aggregate_function_on_column<WindowFunction::Sum, double>(
+                  partitioning, frame_description, argument_column, chunk_offsets);
+            } else {
+              result_segments = evaluate_aggregate_function_on_column<WindowFunction::Avg, double>(
+                  partitioning, frame_description, argument_column, chunk_offsets);
+            }
+          } else {
+            Fail("SUM and AVG require a numeric argument");
+          }
+          break;
+        default:
+          Fail("Unexpected window function");
+      }
+    });
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::SortAndEvaluate, timer.lap());
+
+  // (4) Write the output. Similar to the Projection, a table cannot mix data and reference segments. For reference
+  // inputs, the result segments are thus stored in a separate table and referenced via EntireChunkPosLists.
+  const auto output_table_type = input_table.type();
+  const auto result_column_definition =
+      TableColumnDefinition{window_function_expression.as_column_name(), window_function_expression.data_type(),
+                            !WindowFunctionExpression::is_ranking_function(window_function) &&
+                                window_function != WindowFunction::Count};
+
+  auto output_column_definitions = input_table.column_definitions();
+  output_column_definitions.emplace_back(result_column_definition);
+
+  auto window_result_table = std::shared_ptr<Table>{};
+  if (output_table_type == TableType::References) {
+    window_result_table = std::make_shared<Table>(TableColumnDefinitions{result_column_definition}, TableType::Data,
+                                                  std::nullopt, input_table.uses_mvcc());
+  }
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+  const auto input_column_count = input_table.column_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto input_chunk = input_table.get_chunk(chunk_id);
+
+    auto output_segments = Segments{};
+    output_segments.reserve(input_column_count + 1);
+    for (auto column_id = ColumnID{0}; column_id < input_column_count; ++column_id) {
+      output_segments.emplace_back(input_chunk->get_segment(column_id));
+    }
+
+    auto chunk = std::shared_ptr<Chunk>{};
+    if (output_table_type == TableType::Data) {
+      output_segments.emplace_back(result_segments[chunk_id]);
+      chunk = std::make_shared<Chunk>(std::move(output_segments), input_chunk->mvcc_data());
+      chunk->increase_invalid_row_count(input_chunk->invalid_row_count());
+    } else {
+      window_result_table->append_chunk(Segments{result_segments[chunk_id]}, input_chunk->mvcc_data());
+      const auto entire_chunk_pos_list = std::make_shared<EntireChunkPosList>(chunk_id, input_chunk->size());
+      output_segments.emplace_back(
+          std::make_shared<ReferenceSegment>(window_result_table, ColumnID{0}, entire_chunk_pos_list));
+      chunk = std::make_shared<Chunk>(std::move(output_segments));
+    }
+    chunk->finalize();
+
+    // The rows keep their order, so the sort order of the input columns is still valid.
+    const auto& sorted_by = input_chunk->individually_sorted_by();
+    if (!sorted_by.empty()) chunk->set_individually_sorted_by(sorted_by);
+
+    output_chunks[chunk_id] = chunk;
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::WriteOutput, timer.lap());
+
+  return std::make_shared<Table>(output_column_definitions, output_table_type, std::move(output_chunks),
+                                 input_table.uses_mvcc());
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/window_function_expression.hpp"
+
+namespace opossum {
+
+/**
+ * Operator to compute a single window function (see WindowFunctionExpression). The output consists of all input
+ * columns, followed by the window function's result. The rows keep the order of the input table.
+ *
+ * The rows are first hash-partitioned by their PARTITION BY values. Each hash partition, which contains one or more
+ * complete window partitions, is sorted and evaluated in a separate job. Like the Sort operator, the sort is stable and
+ * places NULLs before all other values. Aggregate functions are computed incrementally if the frame starts at the
+ * beginning of the window partition. Otherwise, a segment tree over the window partition answers each frame query in
+ * logarithmic time (see Leis et al., "Efficient Processing of Window Functions in Analytical SQL Queries", VLDB 2015).
+ *
+ * The argument, the PARTITION BY expressions, and the ORDER BY expressions have to be columns of the input table.
+ */
+class Window : public AbstractReadOnlyOperator {
+ public:
+  enum class OperatorSteps : uint8_t { MaterializeColumns, Partition, SortAndEvaluate, WriteOutput };
+
+  Window(const std::shared_ptr<const AbstractOperator>& input_operator,
+         const std::shared_ptr<WindowFunctionExpression>& window_function_expression);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  const std::shared_ptr<WindowFunctionExpression>& window_function_expression() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const override;
+
+  const std::shared_ptr<WindowFunctionExpression> _window_function_expression;
+};
+
+}  // namespace opossum
@@ -40,9 +40,10 @@ void gather_expressions_not_computed_by_expression_evaluator(
     return;
   }
 
-  if (expression->type == ExpressionType::Aggregate || expression->type == ExpressionType::LQPColumn) {
-    // Aggregates and LQPColumns are not calculated by the ExpressionEvaluator and are thus required to be part of the
-    // input.
+  if (expression->type == ExpressionType::Aggregate || expression->type == ExpressionType::WindowFunction ||
+      expression->type == ExpressionType::LQPColumn) {
+    // Aggregates, window functions, and LQPColumns are not calculated by the ExpressionEvaluator and are thus required
+    // to be part of the input.
     required_expressions.emplace(expression);
     return;
   }
@@ -115,6 +116,13 @@ ExpressionUnorderedSet gather_locally_required_expressions(
       }
     } break;
 
+    // WindowNodes need the argument, the PARTITION BY, and the ORDER BY expressions of their window function
+    case LQPNodeType::Window: {
+      const auto& window_function_expression = *node->node_expressions[0];
+      locally_required_expressions.insert(window_function_expression.arguments.begin(),
+                                          window_function_expression.arguments.end());
+    } break;
+
     // For ProjectionNodes, collect all expressions that
     //   (1) were already computed and are re-used as arguments in this projection
     //   (2) cannot be computed (i.e., Aggregate and LQPColumn inputs)
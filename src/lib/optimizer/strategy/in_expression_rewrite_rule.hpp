@@ -14,7 +14,8 @@ class PredicateNode;
 //   MIN_ELEMENTS_FOR_JOIN elements and the elements are of the same type. The exact value of MIN_ELEMENTS_FOR_JOIN
 //   also depends on the size of the input data (see #1817). Once this becomes relevant, we might want to add a cost
 //   estimator.
-// Otherwise, the IN expression is untouched and will be handled by the ExpressionEvaluator.
+// Otherwise, the IN expression is untouched. If its left side is a column and the list consists of literals, the
+// TableScan handles it with the ColumnInTableScanImpl. Everything else is handled by the ExpressionEvaluator.
 
 class InExpressionRewriteRule : public AbstractRule {
  public:
@@ -3,18 +3,28 @@
 #include <algorithm>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
 #include "cost_estimation/abstract_cost_estimator.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/cardinality_estimator.hpp"
+#include "storage/index/table_key_index.hpp"
+#include "storage/table.hpp"
 #include "utils/assert.hpp"
 
 namespace {
@@ -26,6 +36,38 @@ constexpr float INDEX_SCAN_SELECTIVITY_THRESHOLD = 0.01f;
 // Only if the number of input rows exceeds num_input_rows, the ScanType can be set to IndexScan.
 // The number is taken from: Fast Lookups for In-Memory Column Stores: Group-Key Indices, Lookup and Maintenance.
 constexpr float INDEX_SCAN_ROW_COUNT_THRESHOLD = 1000.0f;
+
+using namespace opossum;  // NOLINT
+
+// Returns whether @param expression is a non-NULL value or a correlated parameter, the value of which the KeyIndexScan
+// receives via set_parameters.
+bool is_key_value(const std::shared_ptr<AbstractExpression>& expression) {
+  if (expression->type == ExpressionType::CorrelatedParameter) return true;
+
+  const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(expression);
+  return value_expression && !variant_is_null(value_expression->value);
+}
+
+// Returns the column of @param stored_table_node that is compared to a key value (see is_key_value) by @param
+// predicate using Equals, or std::nullopt if the predicate has a different form.
+std::optional<ColumnID> equals_value_column_id(const AbstractExpression& predicate,
+                                               const std::shared_ptr<const StoredTableNode>& stored_table_node) {
+  const auto* const binary_predicate = dynamic_cast<const BinaryPredicateExpression*>(&predicate);
+  if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals) return std::nullopt;
+
+  auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->left_operand());
+  auto value_expression = binary_predicate->right_operand();
+  if (!column_expression || !is_key_value(value_expression)) {
+    column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(binary_predicate->right_operand());
+    value_expression = binary_predicate->left_operand();
+  }
+
+  if (!column_expression || !is_key_value(value_expression)) return std::nullopt;
+  if (column_expression->original_node.lock() != stored_table_node) return std::nullopt;
+
+  return column_expression->original_column_id;
+}
+
 }  // namespace
 
 namespace opossum {
@@ -39,6 +81,19 @@ void IndexScanRule::_apply_to_plan_without_subqueries(const std::shared_ptr<Abst
   DebugAssert(cost_estimator, "IndexScanRule requires cost estimator to be set");
   Assert(lqp_root->type == LQPNodeType::Root, "ExpressionReductionRule needs root to hold onto");
 
+  // Key lookups are planned first, as they modify the predicate chains above the StoredTableNodes.
+  auto stored_table_nodes = std::vector<std::shared_ptr<StoredTableNode>>{};
+  visit_lqp(lqp_root, [&](const auto& node) {
+    if (node->type == LQPNodeType::StoredTable) {
+      stored_table_nodes.emplace_back(std::static_pointer_cast<StoredTableNode>(node));
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& stored_table_node : stored_table_nodes) {
+    _apply_key_index_scan(stored_table_node);
+  }
+
   visit_lqp(lqp_root, [&](const auto& node) {
     if (node->type == LQPNodeType::Predicate) {
       const auto& child = node->left_input();
@@ -60,6 +115,56 @@ void IndexScanRule::_apply_to_plan_without_subqueries(const std::shared_ptr<Abst
   });
 }
 
+void IndexScanRule::_apply_key_index_scan(const std::shared_ptr<StoredTableNode>& stored_table_node) {
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+  if (table->key_indexes().empty()) return;
+
+  // Gather the equality predicates of the chain of PredicateNodes and ValidateNodes above the StoredTableNode. The
+  // chain ends at the first node with multiple outputs.
+  auto predicate_node_by_column_id = std::unordered_map<ColumnID, std::shared_ptr<PredicateNode>>{};
+  auto current_node = std::shared_ptr<AbstractLQPNode>{stored_table_node};
+  while (current_node->output_count() == 1) {
+    const auto output = current_node->outputs()[0];
+    if (output->type != LQPNodeType::Predicate && output->type != LQPNodeType::Validate) break;
+    current_node = output;
+
+    const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(current_node);
+    if (!predicate_node) continue;
+
+    const auto column_id = equals_value_column_id(*predicate_node->predicate(), stored_table_node);
+    if (column_id) {
+      predicate_node_by_column_id.emplace(*column_id, predicate_node);
+    }
+  }
+
+  // Find a key index whose columns are all compared to values. At most one row per key is visible, so the lookup is
+  // always preferable to scanning the table.
+  for (const auto& key_index : table->key_indexes()) {
+    const auto& key_column_ids = key_index->column_ids();
+    const auto key_is_covered = std::all_of(key_column_ids.cbegin(), key_column_ids.cend(), [&](const auto column_id) {
+      return predicate_node_by_column_id.count(column_id);
+    });
+    if (!key_is_covered) continue;
+
+    // Replace the predicates on the key columns by a single PredicateNode directly above the StoredTableNode, which
+    // is translated into a KeyIndexScan.
+    auto key_predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+    for (const auto column_id : key_column_ids) {
+      const auto& predicate_node = predicate_node_by_column_id.at(column_id);
+      key_predicates.emplace_back(predicate_node->predicate());
+      lqp_remove_node(predicate_node);
+    }
+
+    const auto key_predicate_node =
+        PredicateNode::make(inflate_logical_expressions(key_predicates, LogicalOperator::And));
+    key_predicate_node->scan_type = ScanType::IndexScan;
+
+    const auto output = stored_table_node->outputs()[0];
+    lqp_insert_node(output, stored_table_node->get_input_side(output), key_predicate_node);
+    return;
+  }
+}
+
 bool IndexScanRule::_is_index_scan_applicable(const IndexStatistics& index_statistics,
                                               const std::shared_ptr<PredicateNode>& predicate_node) const {
   if (!_is_single_segment_index(index_statistics)) return false;
@@ -82,6 +82,9 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   // method was public, we chose this approach.
   friend class AbstractScheduler;
 
+  // Workers keep tasks in their work-stealing deques as raw pointers and need to manage the tasks' _deque_reference.
+  friend class Worker;
+
  public:
   explicit AbstractTask(SchedulePriority priority = SchedulePriority::Default, bool stealable = true);
   virtual ~AbstractTask() = default;
@@ -218,6 +221,10 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   // Purely for debugging purposes, in order to be able to identify tasks after they have been scheduled
   std::string _description;
+
+  // Keeps the task alive while it is only referenced by a Worker's deque. Set when the task is pushed and moved out
+  // by the worker that pops or steals it.
+  std::shared_ptr<AbstractTask> _deque_reference;
 };
 
 }  // namespace opossum
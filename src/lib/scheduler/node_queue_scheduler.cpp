@@ -88,6 +88,8 @@ bool NodeQueueScheduler::active() const { return _active; }
 
 const std::vector<std::shared_ptr<TaskQueue>>& NodeQueueScheduler::queues() const { return _queues; }
 
+const std::vector<std::shared_ptr<Worker>>& NodeQueueScheduler::workers() const { return _workers; }
+
 void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
                                   SchedulePriority priority) {
   /**
@@ -102,8 +104,8 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
   if (!task->is_ready()) return;
 
   // Lookup node id for current worker.
+  const auto worker = Worker::get_this_thread_worker();
   if (preferred_node_id == CURRENT_NODE_ID) {
-    auto worker = Worker::get_this_thread_worker();
     if (worker) {
       preferred_node_id = worker->queue()->node_id();
     } else {
@@ -115,6 +117,12 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
   DebugAssert(!(static_cast<size_t>(preferred_node_id) >= _queues.size()),
               "preferred_node_id is not within range of available nodes");
 
+  // Tasks that a worker schedules for its own node go to its deque, see WORK STEALING in node_queue_scheduler.hpp.
+  if (worker && worker->queue()->node_id() == preferred_node_id && priority == SchedulePriority::Default) {
+    worker->push(task);
+    return;
+  }
+
   auto queue = _queues[preferred_node_id];
   queue->push(task, static_cast<uint32_t>(priority));
 }
@@ -56,18 +56,19 @@ namespace opossum {
  *
  * WORK STEALING
  *
- * Currently, a simple work stealing is implemented. Work stealing is useful to avoid idle workers (and therefore
- * idle CPUs) while there are still tasks in the system that need to be processed. A worker gets idle if it can not
- * pull a ready task. This occurs in two cases:
- *  1) all tasks in the queue are not ready
- *  2) the queue is empty
- * In both cases, the current worker is checking another queue for a ready task. Checking another queue means accessing
- * another node (remote node). As of the physical distance of nodes, accessing a remote node is ~1.6 times slower than
- * accessing a local node. [1]
- * Therefore, the current worker fetches a task from a remote queue (without removing it). Then, the current worker
- * is sleeping some milliseconds to give any local worker of the remote node the chance to pull that task. If no local
- * worker of the remote node pulled the task, the current worker is pulling the task and therefore steals it.
- * Afterwards, the current worker is checking its local queue gain.
+ * Besides the TaskQueue of its node, every worker owns a lock-free work-stealing deque (see WorkStealingDeque). Tasks
+ * that are scheduled by a worker for its own node (e.g., the jobs of an operator) are pushed into that worker's deque.
+ * Tasks scheduled from outside of the workers, tasks for other nodes, and high-priority tasks go to the TaskQueue.
+ * A worker pops its own tasks in LIFO order, so that it works on the most recently spawned task, whose data is likely
+ * still in the cache. Pushing and popping usually neither takes a lock nor modifies a cache line that other workers
+ * read. A worker gets idle if it can neither find a ready task in its deque nor in its node's queue. It then steals
+ * the oldest task from the deque of another worker on the same node (FIFO). If that fails, it checks other nodes.
+ * As of the physical distance of nodes, accessing a remote node is ~1.6 times slower than accessing a local node. [1]
+ * Therefore, a worker first checks the queues of remote nodes, as tasks in there have not been claimed by any worker
+ * yet, and only then steals from the deques of remote workers.
+ * If no task was found, the worker yields a couple of times before it parks on its node's queue. Parked workers are
+ * woken up when a task is pushed into the queue or into one of the node's deques. As long as no worker is parked,
+ * pushing a task does not touch the condition variable at all.
  *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
  */
@@ -96,6 +97,8 @@ class NodeQueueScheduler : public AbstractScheduler {
 
   const std::vector<std::shared_ptr<TaskQueue>>& queues() const override;
 
+  const std::vector<std::shared_ptr<Worker>>& workers() const;
+
   /**
    * @param task
    * @param preferred_node_id The Task will be initially added to this node, but might get stolen by other Nodes later
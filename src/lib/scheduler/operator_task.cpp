@@ -4,6 +4,7 @@
 #include <unordered_set>
 #include <utility>
 
+#include "operators/abstract_chunkwise_operator.hpp"
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 
@@ -26,7 +27,17 @@ std::shared_ptr<OperatorTask> add_operator_tasks_recursively(const std::shared_p
   const auto& [_, inserted] = tasks.insert(task);
   if (!inserted) return task;
 
-  if (auto left = op->mutable_left_input()) {
+  auto left = op->mutable_left_input();
+
+  // Pipelined inputs are executed as part of the operator that pipelines them and thus do not get a task of their own.
+  // Instead, the task depends on the input of the pipeline (see AbstractChunkwiseOperator).
+  auto chunkwise_operator = std::dynamic_pointer_cast<AbstractChunkwiseOperator>(op);
+  while (chunkwise_operator && chunkwise_operator->try_pipeline_left_input()) {
+    chunkwise_operator = std::static_pointer_cast<AbstractChunkwiseOperator>(left);
+    left = chunkwise_operator->mutable_left_input();
+  }
+
+  if (left) {
     if (auto left_subtree_root = add_operator_tasks_recursively(left, tasks)) {
       left_subtree_root->set_as_predecessor_of(task);
     }
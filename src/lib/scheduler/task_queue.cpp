@@ -1,6 +1,7 @@
 #include "task_queue.hpp"
 
 #include <memory>
+#include <mutex>
 #include <utility>
 
 #include "abstract_task.hpp"
@@ -28,7 +29,7 @@ void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priorit
   task->set_node_id(_node_id);
   _queues[priority].push(task);
 
-  new_task.notify_one();
+  notify_parked_worker();
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::pull() {
@@ -41,6 +42,16 @@ std::shared_ptr<AbstractTask> TaskQueue::pull() {
   return nullptr;
 }
 
+std::shared_ptr<AbstractTask> TaskQueue::pull(uint32_t priority) {
+  DebugAssert((priority < NUM_PRIORITY_LEVELS), "Illegal priority level");
+
+  std::shared_ptr<AbstractTask> task;
+  if (_queues[priority].try_pop(task)) {
+    return task;
+  }
+  return nullptr;
+}
+
 std::shared_ptr<AbstractTask> TaskQueue::steal() {
   std::shared_ptr<AbstractTask> task;
   for (auto& queue : _queues) {
@@ -55,4 +66,16 @@ std::shared_ptr<AbstractTask> TaskQueue::steal() {
   return nullptr;
 }
 
+void TaskQueue::notify_parked_worker() {
+  // Either this check sees a worker that is about to park, or that worker sees the new task when it checks for work.
+  // The fence pairs with the increment of _parked_worker_count in park().
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (_parked_worker_count.load(std::memory_order_relaxed) == 0) return;
+
+  // Acquiring the lock makes sure that the parking worker is already waiting on the condition variable and does not
+  // miss the notification.
+  { const auto lock_guard = std::lock_guard<std::mutex>{_lock}; }
+  _new_task.notify_one();
+}
+
 }  // namespace opossum
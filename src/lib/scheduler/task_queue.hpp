@@ -4,8 +4,10 @@
 #include <tbb/concurrent_queue.h>
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
+#include <mutex>
 
 #include "types.hpp"
 
@@ -33,23 +35,43 @@ class TaskQueue {
    */
   std::shared_ptr<AbstractTask> pull();
 
+  /**
+   * Same as pull(), but only considers tasks with the given priority
+   */
+  std::shared_ptr<AbstractTask> pull(uint32_t priority);
+
   /**
    * Returns a Tasks that is ready to be executed and removes it from one of the stealable queues
    */
   std::shared_ptr<AbstractTask> steal();
 
   /**
-   * Notifies one worker as soon as a new task gets pushed into the queue
+   * Puts the calling worker to sleep until a new task becomes available on this node or until the timeout expires.
+   * `has_work` is checked after the worker has registered itself as parked. This way, a task that was pushed right
+   * before cannot go unnoticed.
    */
-  std::condition_variable new_task;
+  template <typename Predicate>
+  void park(const std::chrono::microseconds timeout, const Predicate& has_work) {
+    auto unique_lock = std::unique_lock<std::mutex>{_lock};
+    ++_parked_worker_count;
+    if (!has_work()) {
+      _new_task.wait_for(unique_lock, timeout);
+    }
+    --_parked_worker_count;
+  }
 
   /**
-   * Mutex accessed by workers in order to notify them using condition variable
+   * Wakes up one of the workers parked on this queue, if any. Called whenever a task is pushed into the queue or into
+   * the deque of one of the node's workers. Checking the number of parked workers first avoids the cost of notifying
+   * the condition variable while all workers are busy, which is the common case for many short tasks.
    */
-  std::mutex lock;
+  void notify_parked_worker();
 
  private:
   NodeID _node_id;
+  std::atomic_uint32_t _parked_worker_count{0};
+  std::condition_variable _new_task;
+  std::mutex _lock;
   std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
 };
 
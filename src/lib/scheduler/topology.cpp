@@ -14,6 +14,10 @@
 #include <utility>
 #include <vector>
 
+#include <boost/container/pmr/global_resource.hpp>
+
+#include "utils/assert.hpp"
+
 namespace opossum {
 
 #if HYRISE_NUMA_SUPPORT
@@ -104,6 +108,13 @@ void Topology::_init_numa_topology(uint32_t max_num_cores) {
 
   numa_free_cpumask(affinity_cpu_bitmask);
   numa_free_cpumask(this_node_cpu_bitmask);
+
+  // The memory resources are created here instead of in get_memory_resource() so that the latter does not need to be
+  // synchronized.
+  while (_memory_resources.size() < _nodes.size()) {
+    const auto node_id = NodeID{static_cast<NodeID::base_type>(_memory_resources.size())};
+    _memory_resources.emplace_back(std::make_unique<NUMAMemoryResource>(node_id));
+  }
 #endif
 }
 
@@ -162,6 +173,14 @@ const std::vector<TopologyNode>& Topology::nodes() const { return _nodes; }
 
 size_t Topology::num_cpus() const { return _num_cpus; }
 
+boost::container::pmr::memory_resource* Topology::get_memory_resource(const NodeID node_id) {
+  Assert(node_id < _nodes.size(), "Node ID is not part of the topology");
+  if (_fake_numa_topology || _nodes.size() == 1) return boost::container::pmr::get_default_resource();
+
+  DebugAssert(node_id < _memory_resources.size(), "Expected memory resources to be created with the NUMA topology");
+  return _memory_resources[node_id].get();
+}
+
 void Topology::_clear() {
   _nodes.clear();
   _num_cpus = 0;
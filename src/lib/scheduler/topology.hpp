@@ -5,6 +5,9 @@
 #include <utility>
 #include <vector>
 
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include "memory/numa_memory_resource.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -73,6 +76,12 @@ class Topology final : public Noncopyable {
 
   size_t num_cpus() const;
 
+  /**
+   * Returns a memory resource that allocates memory on the given node. For fake NUMA topologies and non-NUMA
+   * topologies, the default memory resource is returned.
+   */
+  boost::container::pmr::memory_resource* get_memory_resource(const NodeID node_id);
+
  private:
   Topology();
 
@@ -91,6 +100,10 @@ class Topology final : public Noncopyable {
   bool _fake_numa_topology{false};
   bool _filtered_by_affinity{false};
 
+  // One resource per hardware node. Resources are never removed when the topology changes, as memory allocated from
+  // them might still be in use.
+  std::vector<std::unique_ptr<NUMAMemoryResource>> _memory_resources;
+
   static const int _number_of_hardware_nodes;
 };
 
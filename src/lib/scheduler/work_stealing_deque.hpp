@@ -0,0 +1,147 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Lock-free work-stealing deque as described by Chase and Lev ("Dynamic Circular Work-Stealing Deque", SPAA 2005),
+ * using the memory orderings of Lê et al. ("Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP 2013).
+ *
+ * The deque has a single owner, which pushes and pops items at the bottom (LIFO). Any other thread may steal items
+ * from the top (FIFO). As such, the owner works on the most recently spawned, cache-hot items while thieves take the
+ * oldest items, which usually represent larger chunks of work. Only a steal that races with another steal or with the
+ * owner popping the last item requires a CAS.
+ *
+ * The circular buffer grows if it is full. As thieves might still read from the previous buffer, old buffers are kept
+ * until the deque is destroyed. Since the buffer size doubles, this at most doubles the memory consumption.
+ *
+ * Items have to be trivially copyable as they are stored in std::atomics. Use pointers for everything else.
+ */
+template <typename T>
+class WorkStealingDeque : private Noncopyable {
+  static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque can only store trivially copyable items");
+
+ public:
+  explicit WorkStealingDeque(const size_t initial_capacity = 256) {
+    Assert(initial_capacity > 0 && (initial_capacity & (initial_capacity - 1)) == 0,
+           "Capacity must be a power of two");
+    _buffers.emplace_back(std::make_unique<Buffer>(initial_capacity));
+    _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+  }
+
+  // Adds an item at the bottom. Must only be called by the owner.
+  void push(const T item) {
+    const auto bottom = _bottom.load(std::memory_order_relaxed);
+    const auto top = _top.load(std::memory_order_acquire);
+    auto* buffer = _buffer.load(std::memory_order_relaxed);
+
+    if (bottom - top > static_cast<int64_t>(buffer->capacity()) - 1) {
+      _buffers.emplace_back(buffer->grow(bottom, top));
+      buffer = _buffers.back().get();
+      _buffer.store(buffer, std::memory_order_release);
+    }
+
+    buffer->put(bottom, item);
+    std::atomic_thread_fence(std::memory_order_release);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  // Removes the most recently pushed item. Must only be called by the owner.
+  std::optional<T> pop() {
+    const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+    auto* buffer = _buffer.load(std::memory_order_relaxed);
+    _bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto top = _top.load(std::memory_order_relaxed);
+
+    if (top > bottom) {
+      // The deque is empty.
+      _bottom.store(bottom + 1, std::memory_order_relaxed);
+      return std::nullopt;
+    }
+
+    const auto item = buffer->get(bottom);
+    if (top < bottom) return item;
+
+    // This is the last item. Race against the thieves for it.
+    const auto successful =
+        _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    if (!successful) return std::nullopt;
+    return item;
+  }
+
+  // Removes the least recently pushed item. May be called by any thread. Returns nullopt if the deque is empty or if
+  // another thread won the race for the item.
+  std::optional<T> steal() {
+    auto top = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const auto bottom = _bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom) return std::nullopt;
+
+    const auto* buffer = _buffer.load(std::memory_order_acquire);
+    const auto item = buffer->get(top);
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      return std::nullopt;
+    }
+    return item;
+  }
+
+  // Both methods are only a snapshot if called concurrently to push, pop, or steal.
+  bool empty() const { return size() == 0; }
+
+  size_t size() const {
+    const auto bottom = _bottom.load(std::memory_order_relaxed);
+    const auto top = _top.load(std::memory_order_relaxed);
+    return bottom > top ? static_cast<size_t>(bottom - top) : size_t{0};
+  }
+
+ protected:
+  class Buffer {
+   public:
+    explicit Buffer(const size_t capacity)
+        : _mask(capacity - 1), _items(std::make_unique<std::atomic<T>[]>(capacity)) {}
+
+    size_t capacity() const { return _mask + 1; }
+
+    T get(const int64_t index) const {
+      return _items[static_cast<size_t>(index) & _mask].load(std::memory_order_relaxed);
+    }
+
+    void put(const int64_t index, const T item) {
+      _items[static_cast<size_t>(index) & _mask].store(item, std::memory_order_relaxed);
+    }
+
+    std::unique_ptr<Buffer> grow(const int64_t bottom, const int64_t top) const {
+      auto buffer = std::make_unique<Buffer>(capacity() * 2);
+      for (auto index = top; index < bottom; ++index) {
+        buffer->put(index, get(index));
+      }
+      return buffer;
+    }
+
+   protected:
+    const size_t _mask;
+    std::unique_ptr<std::atomic<T>[]> _items;
+  };
+
+  // Top and bottom are modified by different threads and are thus placed on different cache lines.
+  alignas(64) std::atomic<int64_t> _top{0};
+  alignas(64) std::atomic<int64_t> _bottom{0};
+  std::atomic<Buffer*> _buffer{nullptr};
+
+  // Owns the current and all previous buffers. Only accessed by the owner.
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+}  // namespace opossum
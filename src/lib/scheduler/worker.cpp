@@ -15,6 +15,7 @@
 #include "abstract_scheduler.hpp"
 #include "abstract_task.hpp"
 #include "hyrise.hpp"
+#include "node_queue_scheduler.hpp"
 #include "task_queue.hpp"
 
 namespace {
@@ -29,18 +30,27 @@ thread_local std::weak_ptr<opossum::Worker> this_thread_worker;
 // The sleep time was determined experimentally
 static constexpr auto WORKER_SLEEP_TIME = std::chrono::microseconds(300);
 
+// Number of times an idle worker yields before it parks.
+static constexpr auto WORKER_SPIN_ROUNDS = uint32_t{32};
+
 namespace opossum {
 
 std::shared_ptr<Worker> Worker::get_this_thread_worker() { return ::this_thread_worker.lock(); }
 
 Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id)
-    : _queue(queue), _id(id), _cpu_id(cpu_id) {
+    : _queue(queue), _id(id), _cpu_id(cpu_id), _next_victim(id) {
   // Generate a random distribution from 0-99 for later use, see below
   _random.resize(100);
   std::iota(_random.begin(), _random.end(), 0);
   std::shuffle(_random.begin(), _random.end(), std::default_random_engine{std::random_device{}()});
 }
 
+Worker::~Worker() {
+  // Tasks that have been executed by another worker while still being in the deque (see _wait_for_tasks) might remain
+  // after the scheduler finished. Only their self-references have to be released.
+  while (_take(_deque.pop())) {}
+}
+
 WorkerID Worker::id() const { return _id; }
 
 std::shared_ptr<TaskQueue> Worker::queue() const { return _queue; }
@@ -54,47 +64,39 @@ void Worker::operator()() {
 
   _set_affinity();
 
+  // Workers steal from the other workers of their own node first. As all workers are created before the first one is
+  // started, the list of workers is complete at this point.
+  const auto node_queue_scheduler = std::dynamic_pointer_cast<NodeQueueScheduler>(Hyrise::get().scheduler());
+  Assert(node_queue_scheduler, "Workers can only be used by the NodeQueueScheduler");
+  for (const auto is_local_pass : {true, false}) {
+    for (const auto& worker : node_queue_scheduler->workers()) {
+      if (worker.get() != this && (worker->queue() == _queue) == is_local_pass) {
+        _victims.emplace_back(worker.get());
+      }
+    }
+    if (is_local_pass) _local_victim_count = _victims.size();
+  }
+
   while (Hyrise::get().scheduler()->active()) {
     _work();
   }
 }
 
 void Worker::_work() {
-  // If execute_next has been called, run that task first, otherwise try to retrieve a task from the queue.
+  // If execute_next has been called, run that task first, otherwise try to retrieve a task from the deque or queues.
   auto task = std::shared_ptr<AbstractTask>{};
   if (_next_task) {
     task = std::move(_next_task);
     _next_task = nullptr;
   } else {
-    task = _queue->pull();
+    task = _find_task();
   }
 
   if (!task) {
-    // Simple work stealing without explicitly transferring data between nodes.
-    auto work_stealing_successful = false;
-    for (const auto& queue : Hyrise::get().scheduler()->queues()) {
-      if (queue == _queue) {
-        continue;
-      }
-
-      task = queue->steal();
-      if (task) {
-        task->set_node_id(_queue->node_id());
-        work_stealing_successful = true;
-        break;
-      }
-    }
-
-    // If there is no ready task neither in our queue nor in any other, worker waits for a new task to be pushed to the
-    // own queue or returns after timer exceeded (whatever occurs first).
-    if (!work_stealing_successful) {
-      {
-        std::unique_lock<std::mutex> unique_lock(_queue->lock);
-        _queue->new_task.wait_for(unique_lock, WORKER_SLEEP_TIME);
-      }
-      return;
-    }
+    _idle();
+    return;
   }
+  _idle_round_count = 0;
 
   const auto successfully_assigned = task->try_mark_as_assigned_to_worker();
   if (!successfully_assigned) {
@@ -126,8 +128,28 @@ void Worker::execute_next(const std::shared_ptr<AbstractTask>& task) {
     Assert(successfully_enqueued, "Task was already enqueued, expected to be solely responsible for execution");
     _next_task = task;
   } else {
+    push(task);
+  }
+}
+
+void Worker::push(const std::shared_ptr<AbstractTask>& task) {
+  DebugAssert(&*get_this_thread_worker() == this, "push must be called from the same thread that the worker works in");
+
+  // Tasks in the deque may be stolen by workers of other nodes. Tasks that must stay on this node go to the queue.
+  if (!task->is_stealable()) {
     _queue->push(task, static_cast<uint32_t>(SchedulePriority::Default));
+    return;
   }
+
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) return;
+
+  task->set_node_id(_queue->node_id());
+  task->_deque_reference = task;
+  _deque.push(task.get());
+
+  // Other workers of this node might be parked even though there is now work to steal.
+  _queue->notify_parked_worker();
 }
 
 void Worker::start() { _thread = std::thread(&Worker::operator(), this); }
@@ -204,6 +226,80 @@ void Worker::_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& t
   }
 }
 
+std::shared_ptr<AbstractTask> Worker::_find_task() {
+  // High-priority tasks are only pushed into the node's queue. They are preferred over everything else.
+  auto task = _queue->pull(static_cast<uint32_t>(SchedulePriority::High));
+  if (task) return task;
+
+  // Continue with the task that this worker spawned most recently. Its input is most likely still cached.
+  task = _take(_deque.pop());
+  if (task) return task;
+
+  // Tasks that were scheduled by non-worker threads (e.g., new queries) or by workers of other nodes.
+  task = _queue->pull(static_cast<uint32_t>(SchedulePriority::Default));
+  if (task) return task;
+
+  // Steal the oldest task of one of the other workers on this node. Each attempt starts at a different victim so that
+  // idle workers do not all contend for the same deque.
+  ++_next_victim;
+  for (auto victim_offset = size_t{0}; victim_offset < _local_victim_count; ++victim_offset) {
+    task = _take(_victims[(_next_victim + victim_offset) % _local_victim_count]->_deque.steal());
+    if (task) return task;
+  }
+
+  // Simple work stealing from other nodes without explicitly transferring data between nodes. The queues of other nodes
+  // are checked first as their tasks have not been picked up by any worker yet.
+  for (const auto& queue : Hyrise::get().scheduler()->queues()) {
+    if (queue == _queue) {
+      continue;
+    }
+
+    task = queue->steal();
+    if (task) {
+      task->set_node_id(_queue->node_id());
+      return task;
+    }
+  }
+
+  const auto remote_victim_count = _victims.size() - _local_victim_count;
+  for (auto victim_offset = size_t{0}; victim_offset < remote_victim_count; ++victim_offset) {
+    task = _take(_victims[_local_victim_count + (_next_victim + victim_offset) % remote_victim_count]->_deque.steal());
+    if (task) {
+      task->set_node_id(_queue->node_id());
+      return task;
+    }
+  }
+
+  return nullptr;
+}
+
+void Worker::_idle() {
+  // New tasks often become available shortly after a worker ran out of work, e.g., when a query spawns its next set of
+  // jobs. Yielding a couple of times first avoids the latency of parking and waking up the worker.
+  if (_idle_round_count < WORKER_SPIN_ROUNDS) {
+    ++_idle_round_count;
+    std::this_thread::yield();
+    return;
+  }
+
+  // Wait for a new task to be pushed to the own queue or to the deque of a worker on the same node or return after the
+  // timer exceeded (whatever occurs first). The timeout makes sure that tasks of other nodes are stolen eventually.
+  _queue->park(WORKER_SLEEP_TIME, [&]() {
+    if (!_queue->empty() || !_deque.empty()) return true;
+    for (auto victim_idx = size_t{0}; victim_idx < _local_victim_count; ++victim_idx) {
+      if (!_victims[victim_idx]->_deque.empty()) return true;
+    }
+    return false;
+  });
+}
+
+std::shared_ptr<AbstractTask> Worker::_take(const std::optional<AbstractTask*>& item) {
+  if (!item) return nullptr;
+
+  // Only one thread can pop or steal a given item, so the reference is not accessed concurrently.
+  return std::move((*item)->_deque_reference);
+}
+
 void Worker::_set_affinity() {
 #if HYRISE_NUMA_SUPPORT
   cpu_set_t cpuset;
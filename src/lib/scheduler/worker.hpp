@@ -2,10 +2,12 @@
 
 #include <atomic>
 #include <memory>
+#include <optional>
 #include <thread>
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "scheduler/work_stealing_deque.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -24,6 +26,7 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   static std::shared_ptr<Worker> get_this_thread_worker();
 
   Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id);
+  ~Worker();
 
   /**
    * Unique ID of a worker. Currently not in use, but really helpful for debugging.
@@ -42,6 +45,10 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   // so that they are worked on as soon as possible by either this or another worker.
   void execute_next(const std::shared_ptr<AbstractTask>& task);
 
+  // Pushes a task that was scheduled by this worker's thread into the worker's deque. The worker pops its own tasks in
+  // LIFO order, while idle workers steal them in FIFO order. Must only be called from this worker's thread.
+  void push(const std::shared_ptr<AbstractTask>& task);
+
   uint64_t num_finished_tasks() const;
 
   void operator=(const Worker&) = delete;
@@ -53,7 +60,21 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
 
   void _wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
 
+  // Retrieves the next task, either from this worker's deque, from the node's queue, or by stealing from other workers
+  // and nodes. Returns nullptr if no task was found.
+  std::shared_ptr<AbstractTask> _find_task();
+
+  // Called if no task was found. Backs off by yielding a couple of times before parking the worker.
+  void _idle();
+
  private:
+  // The deque stores raw pointers as its items need to be trivially copyable. While a task is in the deque, it keeps
+  // itself alive through AbstractTask::_deque_reference. Whoever pops or steals the task takes over that reference.
+  // This avoids a heap allocation per pushed task.
+  using Deque = WorkStealingDeque<AbstractTask*>;
+
+  static std::shared_ptr<AbstractTask> _take(const std::optional<AbstractTask*>& item);
+
   /**
    * Pin a worker to a particular core.
    * This does not work on non-NUMA systems, and might be addressed in the future.
@@ -67,6 +88,14 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   std::thread _thread;
   std::atomic_uint64_t _num_finished_tasks{0};
 
+  Deque _deque;
+
+  // The other workers of the scheduler, those of the same node first. Set when the worker starts.
+  std::vector<Worker*> _victims{};
+  size_t _local_victim_count{0};
+  size_t _next_victim{0};
+  uint32_t _idle_round_count{0};
+
   std::vector<int> _random{};
   size_t _next_random{};
 };
@@ -0,0 +1,62 @@
+#include "admission_control.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "scheduler/job_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AdmissionControl::AdmissionControl(const std::optional<size_t> max_concurrent_requests)
+    : _max_concurrent_requests(max_concurrent_requests) {
+  Assert(!_max_concurrent_requests || *_max_concurrent_requests > 0, "At least one request must be admitted");
+}
+
+void AdmissionControl::submit(const std::function<void()>& request) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_max_concurrent_requests && _running_request_count >= *_max_concurrent_requests) {
+      _queued_requests.emplace_back(request);
+      return;
+    }
+    ++_running_request_count;
+  }
+
+  // Scheduling happens outside of the lock as the ImmediateExecutionScheduler runs the request right away.
+  _schedule(request);
+}
+
+std::optional<size_t> AdmissionControl::max_concurrent_requests() const { return _max_concurrent_requests; }
+
+size_t AdmissionControl::running_request_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _running_request_count;
+}
+
+size_t AdmissionControl::queued_request_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _queued_requests.size();
+}
+
+void AdmissionControl::_schedule(const std::function<void()>& request) {
+  const auto job = std::make_shared<JobTask>([this, request]() {
+    request();
+
+    // Hand the slot of the finished request over to the next queued request, if any.
+    auto next_request = std::function<void()>{};
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_queued_requests.empty()) {
+        --_running_request_count;
+        return;
+      }
+      next_request = std::move(_queued_requests.front());
+      _queued_requests.pop_front();
+    }
+    _schedule(next_request);
+  });
+  job->schedule();
+}
+
+}  // namespace opossum
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Limits the number of client requests that are processed at the same time. Requests that exceed the limit are queued
+// and processed in the order of their arrival once earlier requests have finished. This prevents a large number of
+// connections from overcommitting the scheduler, which would increase the latency of all queries alike.
+//
+// Requests are processed as JobTasks by the current scheduler, so that the threads of the network io_service only
+// receive and send data and never block on query execution. Sessions only submit a request once its message has been
+// received completely (see SessionStream), so that requests never wait for their client to send data either.
+class AdmissionControl : public Noncopyable {
+ public:
+  // std::nullopt means that the number of concurrent requests is not limited.
+  explicit AdmissionControl(const std::optional<size_t> max_concurrent_requests = std::nullopt);
+
+  // Processes @param request as soon as fewer than max_concurrent_requests requests are running. Never blocks. The
+  // request must handle its exceptions itself.
+  void submit(const std::function<void()>& request);
+
+  std::optional<size_t> max_concurrent_requests() const;
+  size_t running_request_count() const;
+  size_t queued_request_count() const;
+
+ protected:
+  void _schedule(const std::function<void()>& request);
+
+  const std::optional<size_t> _max_concurrent_requests;
+
+  mutable std::mutex _mutex;
+  size_t _running_request_count{0};
+  std::deque<std::function<void()>> _queued_requests;
+};
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <string>
+
+#include <boost/asio.hpp>
+
+namespace opossum {
+
+// Stream that keeps the data written by a WriteBuffer in memory instead of sending it. Sessions use it to serialize
+// each streamed result chunk and then queue the chunk's messages as a whole (see SessionStream::queue_deferred_data).
+// Nothing can be read from it.
+class MemoryStream {
+ public:
+  template <typename MutableBufferSequence>
+  size_t read_some(const MutableBufferSequence& /*buffers*/, boost::system::error_code& error_code) {
+    error_code = boost::asio::error::eof;
+    return 0;
+  }
+
+  template <typename ConstBufferSequence>
+  size_t write_some(const ConstBufferSequence& buffers, boost::system::error_code& error_code) {
+    const auto byte_count = boost::asio::buffer_size(buffers);
+    const auto previous_size = _data.size();
+    _data.resize(previous_size + byte_count);
+    boost::asio::buffer_copy(boost::asio::buffer(_data.data() + previous_size, byte_count), buffers);
+
+    error_code = {};
+    return byte_count;
+  }
+
+  std::string& data() { return _data; }
+
+ private:
+  std::string _data;
+};
+
+}  // namespace opossum
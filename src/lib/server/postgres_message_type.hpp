@@ -22,6 +22,9 @@ enum class PostgresMessageType : unsigned char {
   ReadyForQuery = 'Z',
   RowDescription = 'T',
   DataRow = 'D',
+  CopyOutResponse = 'H',
+  CopyData = 'd',
+  CopyDone = 'c',
 
   // Selection of error and notice message fields. All possible fields are documented at:
   // https://www.postgresql.org/docs/12/protocol-error-fields.html
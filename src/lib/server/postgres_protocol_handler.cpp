@@ -1,5 +1,8 @@
 #include "postgres_protocol_handler.hpp"
 
+#include "memory_stream.hpp"
+#include "session_stream.hpp"
+
 namespace opossum {
 
 template <typename SocketType>
@@ -7,7 +10,7 @@ PostgresProtocolHandler<SocketType>::PostgresProtocolHandler(const std::shared_p
     : _read_buffer(socket), _write_buffer(socket) {}
 
 template <typename SocketType>
-uint32_t PostgresProtocolHandler<SocketType>::read_startup_packet_header() {
+std::optional<uint32_t> PostgresProtocolHandler<SocketType>::read_startup_packet_header() {
   // Special SSL version number that we catch to deny SSL support
   constexpr auto SSL_REQUEST_CODE = 80877103u;
 
@@ -17,7 +20,7 @@ uint32_t PostgresProtocolHandler<SocketType>::read_startup_packet_header() {
   // We currently do not support SSL
   if (protocol_version == SSL_REQUEST_CODE) {
     _ssl_deny();
-    return read_startup_packet_header();
+    return std::nullopt;
   } else {
     // Subtract uint32_t twice, since both packet length and protocol version have been read already
     return body_length - 2 * LENGTH_FIELD_SIZE;
@@ -89,7 +92,8 @@ void PostgresProtocolHandler<SocketType>::send_row_description_header(const uint
 
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_row_description(const std::string& column_name, const uint32_t object_id,
-                                                               const int16_t type_width) {
+                                                               const int16_t type_width,
+                                                               const FormatCode format_code) {
   _write_buffer.put_string(column_name);
   // This field contains the table ID (OID in postgres). We have to set it in order to fulfill the protocol
   // specification. We do not know what it's good for.
@@ -99,32 +103,31 @@ void PostgresProtocolHandler<SocketType>::send_row_description(const std::string
   _write_buffer.template put_value<int32_t>(object_id);   // Object id of type
   _write_buffer.template put_value<int16_t>(type_width);  // Data type size
   _write_buffer.template put_value<int32_t>(-1);          // No modifier
-  _write_buffer.template put_value<int16_t>(0u);          // Text format
+  _write_buffer.template put_value<int16_t>(static_cast<int16_t>(format_code));  // Text or binary format
 }
 
 template <typename SocketType>
-void PostgresProtocolHandler<SocketType>::send_data_row(
-    const std::vector<std::optional<std::string>>& values_as_strings, const uint32_t string_length_sum) {
+void PostgresProtocolHandler<SocketType>::send_data_row(const std::vector<std::optional<std::string_view>>& values,
+                                                        const uint32_t value_length_sum) {
   // The documentation of the fields in this message can be found at:
   // https://www.postgresql.org/docs/12/static/protocol-message-formats.html
 
   _write_buffer.template put_value(PostgresMessageType::DataRow);
 
-  const auto packet_size =
-      LENGTH_FIELD_SIZE + sizeof(uint16_t) + values_as_strings.size() * LENGTH_FIELD_SIZE + string_length_sum;
+  const auto packet_size = LENGTH_FIELD_SIZE + sizeof(uint16_t) + values.size() * LENGTH_FIELD_SIZE + value_length_sum;
 
   _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(packet_size));
 
   // Number of columns in row
-  _write_buffer.template put_value<uint16_t>(static_cast<uint16_t>(values_as_strings.size()));
+  _write_buffer.template put_value<uint16_t>(static_cast<uint16_t>(values.size()));
 
-  for (const auto& value_string : values_as_strings) {
-    if (value_string.has_value()) {
-      // Size of string representation of value, NOT of value type's size
-      _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(value_string.value().size()));
+  for (const auto& value : values) {
+    if (value.has_value()) {
+      // Size of the serialized value, i.e., of the string representation in text mode
+      _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(value->size()));
 
-      // Text mode means all values are sent as non-terminated strings
-      _write_buffer.put_string(value_string.value(), HasNullTerminator::No);
+      // Values are sent without terminator in both text and binary mode
+      _write_buffer.put_string(*value, HasNullTerminator::No);
     } else {
       // NULL values are represented by setting the value's length to -1
       _write_buffer.template put_value<int32_t>(-1);
@@ -140,6 +143,31 @@ void PostgresProtocolHandler<SocketType>::send_command_complete(const std::strin
   _write_buffer.put_string(command_complete_message);
 }
 
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_copy_out_response(const uint16_t column_count) {
+  _write_buffer.template put_value(PostgresMessageType::CopyOutResponse);
+  const auto packet_size = LENGTH_FIELD_SIZE + sizeof(int8_t) + sizeof(uint16_t) + column_count * sizeof(FormatCode);
+  _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(packet_size));
+  // The overall format (0 = textual) is followed by the format of each column, which must be text for textual copies
+  _write_buffer.template put_value<int8_t>(0);
+  _write_buffer.template put_value<uint16_t>(column_count);
+  for (auto column_id = uint16_t{0}; column_id < column_count; ++column_id) {
+    _write_buffer.template put_value<int16_t>(static_cast<int16_t>(FormatCode::Text));
+  }
+}
+
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_copy_data(const std::string_view data) {
+  _write_buffer.template put_value(PostgresMessageType::CopyData);
+  _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(LENGTH_FIELD_SIZE + data.size()));
+  _write_buffer.put_string(data, HasNullTerminator::No);
+}
+
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_copy_done() {
+  send_status_message(PostgresMessageType::CopyDone);
+}
+
 template <typename SocketType>
 std::pair<std::string, std::string> PostgresProtocolHandler<SocketType>::read_parse_packet() {
   _read_buffer.template get_value<uint32_t>();  // Ignore packet size
@@ -207,11 +235,14 @@ PreparedStatementDetails PostgresProtocolHandler<SocketType>::read_bind_packet()
 
   const auto num_result_column_format_codes = _read_buffer.template get_value<int16_t>();
 
+  auto result_format_codes = std::vector<FormatCode>(num_result_column_format_codes);
   for (auto i = 0; i < num_result_column_format_codes; i++) {
-    Assert(_read_buffer.template get_value<int16_t>() == 0, "Assuming all result columns to be in text format (0)");
+    const auto format_code = _read_buffer.template get_value<int16_t>();
+    AssertInput(format_code == 0 || format_code == 1, "Result columns must be in text (0) or binary format (1)");
+    result_format_codes[i] = static_cast<FormatCode>(format_code);
   }
 
-  return {statement_name, portal, parameter_values};
+  return {statement_name, portal, parameter_values, result_format_codes};
 }
 
 template <typename SocketType>
@@ -272,7 +303,8 @@ void PostgresProtocolHandler<SocketType>::_ssl_deny() {
   _write_buffer.flush();
 }
 
-template class PostgresProtocolHandler<Socket>;
+template class PostgresProtocolHandler<MemoryStream>;
+template class PostgresProtocolHandler<SessionStream>;
 // For testing purposes only. stream_descriptor is used to write data to file
 template class PostgresProtocolHandler<boost::asio::posix::stream_descriptor>;
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+#include <string_view>
 #include <unordered_map>
 
 #include "all_type_variant.hpp"
@@ -16,6 +18,9 @@ struct PreparedStatementDetails {
   std::string statement_name;
   std::string portal;
   std::vector<AllTypeVariant> parameters;
+  // Format codes of the result columns as sent by the client: none (all text), a single one (for all columns), or one
+  // per column.
+  std::vector<FormatCode> result_format_codes;
 };
 
 // This class extracts information from client messages and serializes the response data according to the PostgreSQL
@@ -25,8 +30,9 @@ class PostgresProtocolHandler {
  public:
   explicit PostgresProtocolHandler(const std::shared_ptr<SocketType>& socket);
 
-  // Handle the startup packet header returning the body's size
-  uint32_t read_startup_packet_header();
+  // Handle the startup packet header returning the body's size. SSL requests are denied and return std::nullopt. The
+  // client then sends a new startup packet.
+  std::optional<uint32_t> read_startup_packet_header();
   void read_startup_packet_body(const uint32_t size);
 
   // Setup new connection: successful authentication + sending parameters
@@ -39,16 +45,26 @@ class PostgresProtocolHandler {
   // Read first byte of next packet to determine its type
   PostgresMessageType read_packet_type();
 
+  // Drop data that has been received but not read, e.g., the remainder of a message whose processing failed.
+  void discard_buffered_input() { _read_buffer.discard(); }
+
   // Read SQL query packet
   std::string read_query_packet();
 
   // Send query result
   void send_row_description_header(const uint32_t total_column_name_length, const uint16_t column_count);
-  void send_row_description(const std::string& column_name, const uint32_t object_id, const int16_t type_width);
-  void send_data_row(const std::vector<std::optional<std::string>>& values_as_strings,
-                     const uint32_t string_length_sum);
+  void send_row_description(const std::string& column_name, const uint32_t object_id, const int16_t type_width,
+                            const FormatCode format_code = FormatCode::Text);
+  // The values are already serialized in the format announced in the row description. NULL values are std::nullopt.
+  void send_data_row(const std::vector<std::optional<std::string_view>>& values, const uint32_t value_length_sum);
   void send_command_complete(const std::string& command_complete_message);
 
+  // Send the result of COPY ... TO STDOUT: the response header, one CopyData message per row (text format), and the
+  // closing CopyDone message.
+  void send_copy_out_response(const uint16_t column_count);
+  void send_copy_data(const std::string_view data);
+  void send_copy_done();
+
   // Messages for parsing prepared statements
   std::pair<std::string, std::string> read_parse_packet();
   void read_sync_packet();
@@ -67,7 +83,7 @@ class PostgresProtocolHandler {
   // Additional (optional) message containing execution times of different components (such as translator or optimizer)
   void send_execution_info(const std::string& execution_information);
 
-  // This method is required for testing. Otherwise we cannot make the protocol handler flush its data.
+  // Flush the buffered data, e.g., before data is written to the socket by other means. Also required for testing.
   void force_flush() { _write_buffer.flush(); }
 
  private:
@@ -1,5 +1,7 @@
 #include "query_handler.hpp"
 
+#include <regex>
+
 #include "expression/value_expression.hpp"
 #include "optimizer/optimizer.hpp"
 #include "sql/sql_pipeline_builder.hpp"
@@ -9,7 +11,7 @@ namespace opossum {
 
 std::pair<ExecutionInformation, std::shared_ptr<TransactionContext>> QueryHandler::execute_pipeline(
     const std::string& query, const SendExecutionInfo send_execution_info,
-    const std::shared_ptr<TransactionContext>& transaction_context) {
+    const std::shared_ptr<TransactionContext>& transaction_context, const OutputChunkConsumer& result_chunk_consumer) {
   // A simple query command invalidates unnamed statements
   // See: https://postgresql.org/docs/12/protocol-flow.html#PROTOCOL-FLOW-EXT-QUERY
   if (Hyrise::get().storage_manager.has_prepared_plan("")) Hyrise::get().storage_manager.drop_prepared_plan("");
@@ -18,7 +20,10 @@ std::pair<ExecutionInformation, std::shared_ptr<TransactionContext>> QueryHandle
               "Auto-commit transaction contexts should not be passed around this far");
 
   auto execution_info = ExecutionInformation();
-  auto sql_pipeline = SQLPipelineBuilder{query}.with_transaction_context(transaction_context).create_pipeline();
+  auto sql_pipeline = SQLPipelineBuilder{query}
+                          .with_transaction_context(transaction_context)
+                          .with_result_chunk_consumer(result_chunk_consumer)
+                          .create_pipeline();
 
   const auto [pipeline_status, result_table] = sql_pipeline.get_result_table();
 
@@ -95,10 +100,38 @@ std::shared_ptr<AbstractOperator> QueryHandler::bind_prepared_plan(const Prepare
 }
 
 std::shared_ptr<const Table> QueryHandler::execute_prepared_plan(
-    const std::shared_ptr<AbstractOperator>& physical_plan) {
+    const std::shared_ptr<AbstractOperator>& physical_plan, const OutputChunkConsumer& result_chunk_consumer) {
   const auto& [tasks, root_operator_task] = OperatorTask::make_tasks_from_operator(physical_plan);
+
+  auto result_is_streamed = false;
+  if (result_chunk_consumer) {
+    const auto chunkwise_root_operator = std::dynamic_pointer_cast<AbstractChunkwiseOperator>(physical_plan);
+    result_is_streamed = chunkwise_root_operator && chunkwise_root_operator->try_stream_output(result_chunk_consumer);
+  }
+
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
-  return root_operator_task->get_operator()->get_output();
+
+  const auto result_table = root_operator_task->get_operator()->get_output();
+  if (result_chunk_consumer && result_table && !result_is_streamed) {
+    AbstractChunkwiseOperator::pass_chunks_to_consumer(result_table, result_chunk_consumer);
+  }
+  return result_table;
+}
+
+std::optional<std::string> QueryHandler::build_copy_to_stdout_query(const std::string& query) {
+  static const auto copy_to_stdout_regex =
+      std::regex{R"(^\s*COPY\s+(?:\(([\s\S]+)\)|(\w+)\s*(?:\(([\w\s,]+)\))?)\s+TO\s+STDOUT\s*;?\s*$)",
+                 std::regex_constants::icase};
+
+  auto matches = std::smatch{};
+  if (!std::regex_match(query, matches, copy_to_stdout_regex)) return std::nullopt;
+
+  // COPY (query) TO STDOUT
+  if (matches[1].matched) return matches[1].str();
+
+  // COPY table [(column, ...)] TO STDOUT
+  const auto columns = matches[3].matched ? matches[3].str() : std::string{"*"};
+  return "SELECT " + columns + " FROM " + matches[2].str();
 }
 
 void QueryHandler::_handle_transaction_statement_message(ExecutionInformation& execution_info,
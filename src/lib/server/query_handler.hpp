@@ -1,7 +1,11 @@
 #pragma once
 
+#include <optional>
+#include <string>
 #include <variant>
+
 #include "hyrise.hpp"
+#include "operators/abstract_chunkwise_operator.hpp"
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
 #include "sql/sql_pipeline.hpp"
@@ -24,15 +28,25 @@ struct ExecutionInformation {
 // error handling happens in this class.
 class QueryHandler {
  public:
+  // If a @param result_chunk_consumer is given, the result of the last statement is passed to it chunk by chunk,
+  // possibly while it is still being computed. The result table in the ExecutionInformation might have no chunks then.
   static std::pair<ExecutionInformation, std::shared_ptr<TransactionContext>> execute_pipeline(
       const std::string& query, const SendExecutionInfo send_execution_info,
-      const std::shared_ptr<TransactionContext>& transaction_context);
+      const std::shared_ptr<TransactionContext>& transaction_context,
+      const OutputChunkConsumer& result_chunk_consumer = {});
 
   static void setup_prepared_plan(const std::string& statement_name, const std::string& query);
 
   static std::shared_ptr<AbstractOperator> bind_prepared_plan(const PreparedStatementDetails& statement_details);
 
-  static std::shared_ptr<const Table> execute_prepared_plan(const std::shared_ptr<AbstractOperator>& physical_plan);
+  // See execute_pipeline for the @param result_chunk_consumer.
+  static std::shared_ptr<const Table> execute_prepared_plan(const std::shared_ptr<AbstractOperator>& physical_plan,
+                                                            const OutputChunkConsumer& result_chunk_consumer = {});
+
+  // The SQL parser does not support COPY ... TO STDOUT, which clients use to extract data in bulk. If @param query is
+  // such a statement (COPY table [(column, ...)] TO STDOUT or COPY (query) TO STDOUT), the query that selects the data
+  // to copy is returned.
+  static std::optional<std::string> build_copy_to_stdout_query(const std::string& query);
 
  private:
   static void _handle_transaction_statement_message(ExecutionInformation& execution_info, SQLPipeline& sql_pipeline);
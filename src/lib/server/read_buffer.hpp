@@ -42,6 +42,9 @@ class ReadBuffer {
     }
   }
 
+  // Drop all data that has been received but not read yet
+  void discard() { _start_position = _current_position; }
+
   // String functions
   std::string get_string(const size_t string_length,
                          const HasNullTerminator has_null_terminator = HasNullTerminator::Yes);
@@ -1,13 +1,150 @@
 #include "result_serializer.hpp"
-#include "lossy_cast.hpp"
+
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+
+#include <boost/endian/conversion.hpp>
+
 #include "query_handler.hpp"
+#include "memory_stream.hpp"
+#include "resolve_type.hpp"
+#include "session_stream.hpp"
+#include "storage/segment_iterate.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+enum class ValueEncoding { Text, Binary, CopyText };
+
+// Values of a single segment, serialized back to back. NULL values have a length of -1 and take no space in data.
+class SerializedSegment {
+ public:
+  void clear() {
+    _data.clear();
+    _value_lengths.clear();
+    _next_value_idx = 0;
+    _next_value_offset = 0;
+  }
+
+  template <ValueEncoding encoding>
+  void serialize(const AbstractSegment& segment, const DataType data_type) {
+    resolve_data_type(data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        if (position.is_null()) {
+          _value_lengths.emplace_back(-1);
+          return;
+        }
+
+        const auto previous_size = _data.size();
+        if constexpr (encoding == ValueEncoding::Binary) {
+          _append_binary(position.value());
+        } else if constexpr (encoding == ValueEncoding::CopyText && std::is_same_v<ColumnDataType, pmr_string>) {
+          _append_escaped(position.value());
+        } else {
+          _append_text(position.value());
+        }
+        _value_lengths.emplace_back(static_cast<int32_t>(_data.size() - previous_size));
+      });
+    });
+  }
+
+  // Values have to be retrieved in the order of their chunk offsets. The returned view is valid until clear() is
+  // called.
+  std::optional<std::string_view> next_value() {
+    const auto value_length = _value_lengths[_next_value_idx++];
+    if (value_length < 0) return std::nullopt;
+
+    const auto value = std::string_view{_data.data() + _next_value_offset, static_cast<size_t>(value_length)};
+    _next_value_offset += value_length;
+    return value;
+  }
+
+ private:
+  template <typename T>
+  void _append_text(const T& value) {
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      _data.append(value);
+    } else if constexpr (std::is_floating_point_v<T>) {
+      // Same representation as boost::lexical_cast, which is used by lossy_variant_cast
+      char buffer[32];
+      const auto length = std::snprintf(buffer, sizeof(buffer), "%.*g", std::numeric_limits<T>::max_digits10, value);
+      _data.append(buffer, length);
+    } else {
+      char buffer[24];
+      const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+      _data.append(buffer, result.ptr);
+    }
+  }
+
+  template <typename T>
+  void _append_binary(const T& value) {
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      _data.append(value);
+    } else {
+      // Integers and IEEE 754 floating point numbers are sent in network byte order
+      using UnsignedType = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+      auto bits = UnsignedType{};
+      std::memcpy(&bits, &value, sizeof(T));
+      bits = boost::endian::native_to_big(bits);
+      _data.append(reinterpret_cast<const char*>(&bits), sizeof(bits));
+    }
+  }
+
+  // In the text format of COPY, tabs and newlines separate values and rows. Thus, they have to be escaped.
+  void _append_escaped(const pmr_string& value) {
+    for (const auto character : value) {
+      switch (character) {
+        case '\\':
+          _data.append("\\\\");
+          break;
+        case '\t':
+          _data.append("\\t");
+          break;
+        case '\n':
+          _data.append("\\n");
+          break;
+        case '\r':
+          _data.append("\\r");
+          break;
+        default:
+          _data.push_back(character);
+      }
+    }
+  }
+
+  std::string _data;
+  std::vector<int32_t> _value_lengths;
+  size_t _next_value_idx{0};
+  size_t _next_value_offset{0};
+};
+
+std::vector<FormatCode> resolve_format_codes(const std::vector<FormatCode>& format_codes,
+                                             const ColumnCount column_count) {
+  if (format_codes.empty()) return std::vector<FormatCode>(column_count, FormatCode::Text);
+  if (format_codes.size() == 1) return std::vector<FormatCode>(column_count, format_codes.front());
+
+  AssertInput(format_codes.size() == column_count, "Number of result format codes does not match the column count");
+  return format_codes;
+}
+
+}  // namespace
 
 namespace opossum {
 
 template <typename SocketType>
 void ResultSerializer::send_table_description(
     const std::shared_ptr<const Table>& table,
-    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const std::vector<FormatCode>& format_codes) {
+  const auto column_format_codes = resolve_format_codes(format_codes, table->column_count());
+
   // Calculate sum of length of all column names
   uint32_t column_name_length_sum = 0;
   for (auto& column_name : table->column_names()) {
@@ -48,44 +185,82 @@ void ResultSerializer::send_table_description(
       case DataType::Null:
         Fail("Bad DataType");
     }
-    postgres_protocol_handler->send_row_description(table->column_name(column_id), object_id, type_width);
+    postgres_protocol_handler->send_row_description(table->column_name(column_id), object_id, type_width,
+                                                    column_format_codes[column_id]);
   }
 }
 
 template <typename SocketType>
 void ResultSerializer::send_query_response(
     const std::shared_ptr<const Table>& table,
-    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
-  auto values_as_strings = std::vector<std::optional<std::string>>(table->column_count());
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const std::vector<FormatCode>& format_codes) {
+  const auto column_count = table->column_count();
+  const auto column_format_codes = resolve_format_codes(format_codes, column_count);
 
-  const auto chunk_count = table->chunk_count();
+  // The buffers are reused for all chunks to avoid repeated allocations
+  auto serialized_segments = std::vector<SerializedSegment>(column_count);
+  auto values = std::vector<std::optional<std::string_view>>(column_count);
 
   // Iterate over each chunk in result table
+  const auto chunk_count = table->chunk_count();
   for (ChunkID chunk_id{0}; chunk_id < chunk_count; chunk_id++) {
     const auto chunk = table->get_chunk(chunk_id);
     const auto chunk_size = chunk->size();
 
-    const auto column_count = table->column_count();
-    auto segments = Segments(column_count);
     for (auto column_id = ColumnID{0}; column_id < column_count; column_id++) {
-      segments[column_id] = chunk->get_segment(column_id);
+      auto& serialized_segment = serialized_segments[column_id];
+      serialized_segment.clear();
+      if (column_format_codes[column_id] == FormatCode::Binary) {
+        serialized_segment.serialize<ValueEncoding::Binary>(*chunk->get_segment(column_id),
+                                                            table->column_data_type(column_id));
+      } else {
+        serialized_segment.serialize<ValueEncoding::Text>(*chunk->get_segment(column_id),
+                                                          table->column_data_type(column_id));
+      }
     }
 
     // Iterate over each row in chunk
     for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-      auto string_length_sum = 0;
-      // Iterate over each attribute in row
-      for (auto segment_id = ColumnID{0}; segment_id < column_count; segment_id++) {
-        const auto attribute_value = (*segments[segment_id])[chunk_offset];
-        // The PostgreSQL protocol requires the conversion of values to strings
-        const auto string_value = lossy_variant_cast<pmr_string>(attribute_value);
-        if (string_value.has_value()) {
-          // Sum up string lengths for a row to save an extra loop during serialization
-          string_length_sum += string_value.value().size();
-        }
-        values_as_strings[segment_id] = string_value;
+      // Sum up value lengths for a row to save an extra loop during serialization
+      auto value_length_sum = uint32_t{0};
+      for (auto column_id = ColumnID{0}; column_id < column_count; column_id++) {
+        values[column_id] = serialized_segments[column_id].next_value();
+        if (values[column_id]) value_length_sum += static_cast<uint32_t>(values[column_id]->size());
       }
-      postgres_protocol_handler->send_data_row(values_as_strings, string_length_sum);
+      postgres_protocol_handler->send_data_row(values, value_length_sum);
+    }
+  }
+}
+
+template <typename SocketType>
+void ResultSerializer::send_copy_data(
+    const std::shared_ptr<const Table>& table,
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
+  const auto column_count = table->column_count();
+  auto serialized_segments = std::vector<SerializedSegment>(column_count);
+  auto row = std::string{};
+
+  const auto chunk_count = table->chunk_count();
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; chunk_id++) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto chunk_size = chunk->size();
+
+    for (auto column_id = ColumnID{0}; column_id < column_count; column_id++) {
+      serialized_segments[column_id].clear();
+      serialized_segments[column_id].serialize<ValueEncoding::CopyText>(*chunk->get_segment(column_id),
+                                                                        table->column_data_type(column_id));
+    }
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      row.clear();
+      for (auto column_id = ColumnID{0}; column_id < column_count; column_id++) {
+        if (column_id > 0) row.push_back('\t');
+        const auto value = serialized_segments[column_id].next_value();
+        row.append(value ? *value : std::string_view{"\\N"});
+      }
+      row.push_back('\n');
+      postgres_protocol_handler->send_copy_data(row);
     }
   }
 }
@@ -122,17 +297,35 @@ std::string ResultSerializer::build_command_complete_message(const OperatorType
   }
 }
 
-template void ResultSerializer::send_table_description<Socket>(const std::shared_ptr<const Table>&,
-                                                               const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+template void ResultSerializer::send_table_description<SessionStream>(
+    const std::shared_ptr<const Table>&, const std::shared_ptr<PostgresProtocolHandler<SessionStream>>&,
+    const std::vector<FormatCode>&);
 
 template void ResultSerializer::send_table_description<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
-    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&,
+    const std::vector<FormatCode>&);
 
-template void ResultSerializer::send_query_response<Socket>(const std::shared_ptr<const Table>&,
-                                                            const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+template void ResultSerializer::send_query_response<MemoryStream>(
+    const std::shared_ptr<const Table>&, const std::shared_ptr<PostgresProtocolHandler<MemoryStream>>&,
+    const std::vector<FormatCode>&);
+
+template void ResultSerializer::send_query_response<SessionStream>(
+    const std::shared_ptr<const Table>&, const std::shared_ptr<PostgresProtocolHandler<SessionStream>>&,
+    const std::vector<FormatCode>&);
 
 template void ResultSerializer::send_query_response<boost::asio::posix::stream_descriptor>(
+    const std::shared_ptr<const Table>&,
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&,
+    const std::vector<FormatCode>&);
+
+template void ResultSerializer::send_copy_data<MemoryStream>(
+    const std::shared_ptr<const Table>&, const std::shared_ptr<PostgresProtocolHandler<MemoryStream>>&);
+
+template void ResultSerializer::send_copy_data<SessionStream>(
+    const std::shared_ptr<const Table>&, const std::shared_ptr<PostgresProtocolHandler<SessionStream>>&);
+
+template void ResultSerializer::send_copy_data<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
     const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
 
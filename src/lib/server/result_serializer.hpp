@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <vector>
+
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
 #include "storage/table.hpp"
@@ -10,17 +12,33 @@ namespace opossum {
 struct ExecutionInformation;
 
 // The ResultSerializer serializes the result data returned by Hyrise according to PostgreSQL Wire Protocol.
+//
+// Values are serialized column by column: For each chunk, the segments are iterated and their values are written back
+// to back into one buffer per column. The rows are then assembled from these buffers. Thereby, values are neither
+// materialized as AllTypeVariants nor as individual strings.
+//
+// The @param format_codes follow the rules of the Bind message: if empty, all columns are sent as text. A single code
+// applies to all columns. Otherwise, there must be one code per column.
 class ResultSerializer {
  public:
   // Serialize information about the result table
   template <typename SocketType>
   static void send_table_description(
       const std::shared_ptr<const Table>& table,
-      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+      const std::vector<FormatCode>& format_codes = {});
 
   template <typename SocketType>
-  // Cast attributes of the result table and send them row-wise
+  // Serialize the attributes of the result table and send them row-wise
   static void send_query_response(
+      const std::shared_ptr<const Table>& table,
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+      const std::vector<FormatCode>& format_codes = {});
+
+  // Send the rows of the result table as CopyData messages of COPY ... TO STDOUT (text format with tab-separated
+  // values). The CopyOutResponse and CopyDone messages that enclose them are sent by the PostgresProtocolHandler.
+  template <typename SocketType>
+  static void send_copy_data(
       const std::shared_ptr<const Table>& table,
       const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
 
@@ -2,8 +2,11 @@
 
 #include <pthread.h>
 
+#include <algorithm>
 #include <iostream>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "hyrise.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
@@ -12,12 +15,23 @@ namespace opossum {
 
 // Specified port (default: 5432) will be opened after initializing the _acceptor
 Server::Server(const boost::asio::ip::address& address, const uint16_t port,
-               const SendExecutionInfo send_execution_info)
-    : _acceptor(_io_service, boost::asio::ip::tcp::endpoint(address, port)), _send_execution_info(send_execution_info) {
+               const SendExecutionInfo send_execution_info, const uint32_t network_thread_count,
+               const std::optional<size_t> max_concurrent_requests)
+    : _acceptor(_io_service, boost::asio::ip::tcp::endpoint(address, port)),
+      _acceptor_strand(_io_service),
+      _send_execution_info(send_execution_info),
+      _network_thread_count(network_thread_count),
+      _admission_control(max_concurrent_requests) {
+  Assert(_network_thread_count > 0, "The server requires at least one network thread");
   std::cout << "Server started at " << server_address() << " and port " << server_port() << std::endl
             << "Run 'psql -h localhost " << server_address() << "' to connect to the server" << std::endl;
 }
 
+size_t Server::default_max_concurrent_requests() {
+  // hardware_concurrency() returns 0 if the number of hardware threads is unknown.
+  return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
 void Server::run() {
   _is_initialized = false;
 
@@ -30,45 +44,52 @@ void Server::run() {
 
   _is_initialized = true;
   _accept_new_session();
+
+  // The calling thread is the first network thread. As there is always a pending accept operation, run() does not
+  // return before the io_service is stopped.
+  auto network_threads = std::vector<std::thread>{};
+  network_threads.reserve(_network_thread_count - 1);
+  for (auto thread_id = uint32_t{1}; thread_id < _network_thread_count; ++thread_id) {
+    network_threads.emplace_back([&, thread_id]() {
+      const std::string thread_name = "server_net_" + std::to_string(thread_id);
+#ifdef __APPLE__
+      pthread_setname_np(thread_name.c_str());
+#elif __linux__
+      pthread_setname_np(pthread_self(), thread_name.c_str());
+#endif
+      _io_service.run();
+    });
+  }
+
   _io_service.run();
+
+  for (auto& network_thread : network_threads) {
+    network_thread.join();
+  }
 }
 
 void Server::_accept_new_session() {
   // Create a new session. This will also open a new data socket in order to communicate with the client
   // For more information on TCP ports + Asio see:
   // https://www.gamedev.net/forums/topic/586557-boostasio-allowing-multiple-connections-to-a-single-server-socket/
-  auto new_session = std::make_shared<Session>(_io_service, _send_execution_info);
-  _acceptor.async_accept(*(new_session->socket()),
-                         boost::bind(&Server::_start_session, this, new_session, boost::asio::placeholders::error));
+  auto new_session = std::make_shared<Session>(_io_service, _send_execution_info, _admission_control);
+  // As multiple threads run the io_service, operations on the acceptor are serialized by a strand.
+  _acceptor.async_accept(
+      *(new_session->socket()),
+      boost::asio::bind_executor(_acceptor_strand, boost::bind(&Server::_start_session, this, new_session,
+                                                               boost::asio::placeholders::error)));
 }
 
 void Server::_start_session(const std::shared_ptr<Session>& new_session, const boost::system::error_code& error) {
+  // The acceptor was closed during shutdown.
+  if (error == boost::asio::error::operation_aborted) return;
   Assert(!error, error.message());
 
-  std::thread session_thread([session = new_session, &num_running_sessions = this->_num_running_sessions]() mutable {
-    const std::string thread_name = "server_p_" + std::to_string(session->socket()->remote_endpoint().port());
-#ifdef __APPLE__
-    pthread_setname_np(thread_name.c_str());
-#elif __linux__
-    pthread_setname_np(pthread_self(), thread_name.c_str());
-#endif
-
-    ++num_running_sessions;
-
-    session->run();
+  // We ensure that all sessions are completed before the server is shut down by tracking the number of running
+  // sessions. The counter is decreased when a session is destroyed, i.e., after its socket has been closed.
+  ++_num_running_sessions;
+  new_session->start([&num_running_sessions = _num_running_sessions]() { --num_running_sessions; });
 
-    // Destroy the session before reducing the number of running sessions. This makes sure that the server has not shut
-    // down yet. In case session.use_count is not yet zero, this makes sure that the destructor is not called in
-    // the detached thread.
-    session.reset();
-    --num_running_sessions;
-  });
-
-  // We ensure that all threads are completed before the server is shut down by tracking the number of running threads
-  // in _num_running_sessions. The alternative would be to store the std::thread objects in some kind of data structure
-  // and call join() on all of them before shutting down the server. This would result in a growing number of completed
-  // threads waiting to be joined and the need for a cleanup procedure.
-  session_thread.detach();
   _accept_new_session();
 }
 
@@ -77,6 +98,9 @@ boost::asio::ip::address Server::server_address() const { return _acceptor.local
 uint16_t Server::server_port() const { return _acceptor.local_endpoint().port(); }
 
 void Server::shutdown() {
+  // Stop accepting new sessions, but let the network threads serve the running ones until their clients disconnect.
+  boost::asio::post(_acceptor_strand, [&]() { _acceptor.close(); });
+
   while (_num_running_sessions > 0) {
     // This busy wait might be inefficient, but as this is only to guarantee a clean shutdown, it's good enough.
     std::this_thread::yield();
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <atomic>
+#include <optional>
+
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/ip/tcp.hpp>
 
+#include "admission_control.hpp"
 #include "server_types.hpp"
 #include "session.hpp"
 
@@ -10,9 +14,13 @@ namespace opossum {
 
 /* In the following a short description of the classes used for the server implementation.
 
-*  Server - Opens and binds a server socket. Starts a new session per client.
+*  Server - Opens and binds a server socket. Starts a new session per client. Runs the network io_service on a pool
+*           of threads.
 *  Session - Creates a data socket for client server communication. It is responsible for the message flow and holds
 *            session-specific data.
+*  SessionStream - Receives complete messages and sends the queued responses of a session asynchronously on the
+*                  network threads.
+*  AdmissionControl - Limits the number of concurrently processed client messages and executes them on the scheduler.
 *  PostgresProtocolHandler - This class operates on the message level. It serializes and de-serializes information from
 *                            messages.
 *  PostgresMessageTypes - Set of different message types supported by Hyrise.
@@ -29,9 +37,17 @@ namespace opossum {
 
 class Server {
  public:
-  Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info);
+  // The @param network_thread_count threads only accept connections and receive and send data. Processing a message
+  // (i.e., parsing and executing queries as well as serializing results) happens on the scheduler's workers. Of these
+  // messages, at most @param max_concurrent_requests are processed at the same time, others are queued. By default,
+  // this is the number of hardware threads. std::nullopt means unlimited.
+  Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info,
+         const uint32_t network_thread_count = 1,
+         const std::optional<size_t> max_concurrent_requests = default_max_concurrent_requests());
+
+  static size_t default_max_concurrent_requests();
 
-  // Start server to accept new sessions.
+  // Start server to accept new sessions. Blocks until the server is shut down.
   void run();
 
   // Return the port the server is running on.
@@ -54,7 +70,10 @@ class Server {
   std::atomic_uint64_t _num_running_sessions{0};
   boost::asio::io_service _io_service;
   boost::asio::ip::tcp::acceptor _acceptor;
+  boost::asio::io_service::strand _acceptor_strand;
   const SendExecutionInfo _send_execution_info;
+  const uint32_t _network_thread_count;
+  AdmissionControl _admission_control;
   std::atomic_bool _is_initialized{false};
 };
 }  // namespace opossum
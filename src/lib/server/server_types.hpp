@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include <boost/asio.hpp>
 
 namespace opossum {
@@ -10,4 +12,8 @@ enum class HasNullTerminator : bool { Yes = true, No = false };
 
 enum class SendExecutionInfo : bool { Yes = true, No = false };
 
+// Format of parameters and result columns as negotiated in Bind messages. See
+// https://www.postgresql.org/docs/12/protocol-overview.html#PROTOCOL-FORMAT-CODES
+enum class FormatCode : int16_t { Text = 0, Binary = 1 };
+
 }  // namespace opossum
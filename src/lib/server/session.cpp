@@ -1,56 +1,211 @@
 #include "session.hpp"
 
+#include <atomic>
+#include <exception>
+#include <iostream>
+#include <mutex>
+
 #include "client_disconnect_exception.hpp"
+#include "memory_stream.hpp"
 #include "postgres_message_type.hpp"
 #include "query_handler.hpp"
 #include "result_serializer.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Sends the result of a statement to the client chunk by chunk while the statement is still being executed (see
+// SQLPipelineStatement). The row description, or the CopyOutResponse for COPY ... TO STDOUT, precedes the first chunk.
+// The chunks are passed by the workers that produce them, possibly concurrently. Each chunk's messages are queued as a
+// whole in the SessionStream, which sends them on a network thread. Usually, the worker serializes the chunk right
+// away. If the client does not keep up, the stream defers the serialization until the data queued before has been
+// sent (see SessionStream::queue_deferred_data). Thus, workers never wait for the client. Exceptions (e.g., because the
+// client disconnected) are stored and rethrown by the session.
+class ResultStreamer {
+ public:
+  ResultStreamer(const std::shared_ptr<SessionStream>& stream,
+                 const std::shared_ptr<PostgresProtocolHandler<SessionStream>>& postgres_protocol_handler,
+                 const bool copy_to_stdout, const std::vector<FormatCode>& format_codes = {})
+      : _stream(stream),
+        _postgres_protocol_handler(postgres_protocol_handler),
+        _copy_to_stdout(copy_to_stdout),
+        _format_codes(format_codes) {}
+
+  OutputChunkConsumer consumer() {
+    return [&](const std::shared_ptr<const Table>& chunk_table) { _send_chunk(chunk_table); };
+  }
+
+  void rethrow_exception() const {
+    if (_exception) std::rethrow_exception(_exception);
+  }
+
+  // Completes the response for @param result_table, of which all rows have been passed to the consumer before, and
+  // returns the number of rows sent.
+  uint64_t finish(const std::shared_ptr<const Table>& result_table) {
+    // Clients expect a description even if there are no rows
+    if (!_header_sent) _send_header(result_table);
+    if (_copy_to_stdout) _postgres_protocol_handler->send_copy_done();
+    return _row_count;
+  }
+
+ private:
+  void _send_chunk(const std::shared_ptr<const Table>& chunk_table) {
+    if (chunk_table->row_count() == 0) return;
+
+    try {
+      {
+        const auto lock = std::lock_guard<std::mutex>{_mutex};
+        if (_exception) return;
+
+        // Flushing the header also queues the responses to previous messages (e.g., BindComplete) before the rows.
+        if (!_header_sent) {
+          _send_header(chunk_table);
+          _postgres_protocol_handler->force_flush();
+        }
+      }
+
+      // The serialization might outlive the ResultStreamer, so it only captures copies.
+      const auto serialize = [chunk_table, copy_to_stdout = _copy_to_stdout, format_codes = _format_codes]() {
+        const auto chunk_stream = std::make_shared<MemoryStream>();
+        const auto chunk_protocol_handler = std::make_shared<PostgresProtocolHandler<MemoryStream>>(chunk_stream);
+        if (copy_to_stdout) {
+          ResultSerializer::send_copy_data(chunk_table, chunk_protocol_handler);
+        } else {
+          ResultSerializer::send_query_response(chunk_table, chunk_protocol_handler, format_codes);
+        }
+        chunk_protocol_handler->force_flush();
+        return std::move(chunk_stream->data());
+      };
+
+      if (!_stream->queue_deferred_data(serialize)) {
+        throw ClientDisconnectException("Write operation failed. Client closed connection.");
+      }
+      _row_count += chunk_table->row_count();
+    } catch (...) {
+      const auto lock = std::lock_guard<std::mutex>{_mutex};
+      if (!_exception) _exception = std::current_exception();
+    }
+  }
+
+  void _send_header(const std::shared_ptr<const Table>& table) {
+    if (_copy_to_stdout) {
+      _postgres_protocol_handler->send_copy_out_response(static_cast<uint16_t>(table->column_count()));
+    } else {
+      ResultSerializer::send_table_description(table, _postgres_protocol_handler, _format_codes);
+    }
+    _header_sent = true;
+  }
+
+  const std::shared_ptr<SessionStream> _stream;
+  const std::shared_ptr<PostgresProtocolHandler<SessionStream>> _postgres_protocol_handler;
+  const bool _copy_to_stdout;
+  const std::vector<FormatCode> _format_codes;
+
+  std::mutex _mutex;
+  bool _header_sent{false};
+  std::atomic_uint64_t _row_count{0};
+  std::exception_ptr _exception;
+};
+
+}  // namespace
+
 namespace opossum {
 
-Session::Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info)
-    : _socket(std::make_shared<Socket>(io_service)),
-      _postgres_protocol_handler(std::make_shared<PostgresProtocolHandler<Socket>>(_socket)),
-      _send_execution_info(send_execution_info) {}
+Session::Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info,
+                 AdmissionControl& admission_control)
+    : _stream(std::make_shared<SessionStream>(io_service)),
+      _postgres_protocol_handler(std::make_shared<PostgresProtocolHandler<SessionStream>>(_stream)),
+      _send_execution_info(send_execution_info),
+      _admission_control(admission_control) {}
 
-std::shared_ptr<Socket> Session::socket() { return _socket; }
+Session::~Session() {
+  if (_on_close) _on_close();
+}
+
+std::shared_ptr<Socket> Session::socket() { return _stream->socket(); }
+
+void Session::start(const std::function<void()>& on_close) {
+  _on_close = on_close;
 
-void Session::run() {
   // Set TCP_NODELAY in order to disable Nagle's algorithm. It handles congestion control in TCP networks. Therefore,
   // small packets are buffered and sent out later as one large packet. This might introduce a delay of up to 40 ms
   // which we have to avoid. Further reading: https://howdoesinternetwork.com/2015/nagles-algorithm
-  _socket->set_option(boost::asio::ip::tcp::no_delay(true));
-  _establish_connection();
-  while (!_terminate_session) {
-    try {
+  _stream->socket()->set_option(boost::asio::ip::tcp::no_delay(true));
+  _await_request();
+}
+
+void Session::_await_request() {
+  // Returning without a pending operation releases the last reference to the session. The stream closes the socket once
+  // the queued responses have been sent.
+  if (_terminate_session) return;
+
+  // Whatever the previous message left unread (e.g., because processing it failed) is discarded.
+  _postgres_protocol_handler->discard_buffered_input();
+
+  // The processing is only submitted once the message is complete. Thus, it never waits for the client.
+  _stream->async_receive_message(!_connection_established, [session = shared_from_this()](const bool is_received) {
+    if (!is_received) return;
+    session->_admission_control.submit([session]() { session->_process_request(); });
+  });
+}
+
+void Session::_process_request() {
+  try {
+    if (!_connection_established) {
+      _connection_established = _establish_connection();
+    } else {
       _handle_request();
-    } catch (const ClientDisconnectException&) {
+    }
+  } catch (const ClientDisconnectException&) {
+    _terminate_session = true;
+  } catch (const std::exception& e) {
+    _handle_exception(e);
+  }
+
+  _await_request();
+}
+
+void Session::_handle_exception(const std::exception& exception) {
+  // Requests are processed by the scheduler's workers (see AdmissionControl), so no exception may escape from here.
+  try {
+    const auto client_port = _stream->socket()->remote_endpoint().port();
+    std::cerr << "Exception in session with client port " << client_port << ":" << std::endl
+              << exception.what() << std::endl;
+
+    // Without an established connection, the client does not expect error messages.
+    if (!_connection_established) {
+      _terminate_session = true;
       return;
-    } catch (const std::exception& e) {
-      std::cerr << "Exception in session with client port " << _socket->remote_endpoint().port() << ":" << std::endl
-                << e.what() << std::endl;
-      const auto error_message = ErrorMessage{{PostgresMessageType::HumanReadableError, e.what()}};
-      _postgres_protocol_handler->send_error_message(error_message);
-      _postgres_protocol_handler->send_ready_for_query();
-      // In case of an error, an error message has to be send to the client followed by a "ReadyForQuery" message.
-      // Messages that have already been received are processed further. A "sync" message makes the server send another
-      // "ReadyForQuery" message. In order to avoid this, we set this flag for further operations. As soon as a new
-      // query arrives it must be set to false again to ensure correct message flow.
-      _sync_send_after_error = true;
     }
+
+    const auto error_message = ErrorMessage{{PostgresMessageType::HumanReadableError, exception.what()}};
+    _postgres_protocol_handler->send_error_message(error_message);
+    _postgres_protocol_handler->send_ready_for_query();
+    // In case of an error, an error message has to be send to the client followed by a "ReadyForQuery" message.
+    // Messages that have already been received are processed further. A "sync" message makes the server send another
+    // "ReadyForQuery" message. In order to avoid this, we set this flag for further operations. As soon as a new query
+    // arrives it must be set to false again to ensure correct message flow.
+    _sync_send_after_error = true;
+  } catch (const std::exception&) {
+    // The client closed the connection or the socket is broken otherwise.
+    _terminate_session = true;
   }
 }
 
-void Session::_establish_connection() {
+bool Session::_establish_connection() {
   const auto body_length = _postgres_protocol_handler->read_startup_packet_header();
+  if (!body_length) return false;
 
   // Currently, the information available in the start up packet body (such as db name, user name) is ignored
-  _postgres_protocol_handler->read_startup_packet_body(body_length);
+  _postgres_protocol_handler->read_startup_packet_body(*body_length);
   _postgres_protocol_handler->send_authentication_response();
   _postgres_protocol_handler->send_parameter("server_version", "12");
   _postgres_protocol_handler->send_parameter("server_encoding", "UTF8");
   _postgres_protocol_handler->send_parameter("client_encoding", "UTF8");
   _postgres_protocol_handler->send_parameter("DateStyle", "ISO, DMY");
   _postgres_protocol_handler->send_ready_for_query();
+  return true;
 }
 
 void Session::_handle_request() {
@@ -107,19 +262,27 @@ void Session::_handle_simple_query() {
 
   ExecutionInformation execution_information;
 
+  const auto copy_to_stdout_query = QueryHandler::build_copy_to_stdout_query(query);
+
+  // The result of the last statement is sent while it is being computed
+  auto result_streamer = ResultStreamer{_stream, _postgres_protocol_handler, copy_to_stdout_query.has_value()};
+
   std::tie(execution_information, _transaction_context) =
-      QueryHandler::execute_pipeline(query, _send_execution_info, _transaction_context);
+      QueryHandler::execute_pipeline(copy_to_stdout_query ? *copy_to_stdout_query : query, _send_execution_info,
+                                     _transaction_context, result_streamer.consumer());
+  result_streamer.rethrow_exception();
 
   if (!execution_information.error_message.empty()) {
     _postgres_protocol_handler->send_error_message(execution_information.error_message);
   } else {
     uint64_t row_count = 0;
     // If there is no result table, e.g. after an INSERT command, we cannot send row data. Otherwise, the result table
-    // of the last statement will be send back.
+    // of the last statement has been streamed and the response is completed.
     if (execution_information.result_table) {
-      ResultSerializer::send_table_description(execution_information.result_table, _postgres_protocol_handler);
-      ResultSerializer::send_query_response(execution_information.result_table, _postgres_protocol_handler);
-      row_count = execution_information.result_table->row_count();
+      row_count = result_streamer.finish(execution_information.result_table);
+      if (copy_to_stdout_query) {
+        execution_information.custom_command_complete_message = "COPY " + std::to_string(row_count);
+      }
     }
     if (_send_execution_info == SendExecutionInfo::Yes) {
       _postgres_protocol_handler->send_execution_info(execution_information.pipeline_metrics);
@@ -155,11 +318,11 @@ void Session::_handle_bind_command() {
   // Since bind and execute packet usually arrive together, we still have to handle the execute packet. Therefore,
   // we first store a nullptr in the portals map to signalize an error. However, if binding succeeds in the next step
   // this nullptr gets replaced by the correct pqp. Before executing the prepared statement we make a check for errors.
-  _portals.emplace(parameters.portal, nullptr);
+  _portals.emplace(parameters.portal, Portal{});
 
   const auto pqp = QueryHandler::bind_prepared_plan(parameters);
 
-  _portals[parameters.portal] = pqp;
+  _portals[parameters.portal] = Portal{pqp, parameters.result_format_codes};
   _postgres_protocol_handler->send_status_message(PostgresMessageType::BindComplete);
 
   // Ready for query + flush will be done after reading sync message
@@ -182,12 +345,13 @@ void Session::_handle_execute() {
 
   // In case of an error occured during binding there is no pqp available. Hence, early return here since there is
   // nothing to execute.
-  if (!portal_it->second) {
+  if (!portal_it->second.physical_plan) {
     _portals.erase(portal_it);
     return;
   }
 
-  const auto physical_plan = portal_it->second;
+  const auto physical_plan = portal_it->second.physical_plan;
+  const auto result_format_codes = portal_it->second.result_format_codes;
 
   if (portal_name.empty()) _portals.erase(portal_it);
 
@@ -196,14 +360,14 @@ void Session::_handle_execute() {
   }
   physical_plan->set_transaction_context_recursively(_transaction_context);
 
-  const auto result_table = QueryHandler::execute_prepared_plan(physical_plan);
+  auto result_streamer = ResultStreamer{_stream, _postgres_protocol_handler, false, result_format_codes};
+  const auto result_table = QueryHandler::execute_prepared_plan(physical_plan, result_streamer.consumer());
+  result_streamer.rethrow_exception();
 
   uint64_t row_count = 0;
   // If there is no result table, e.g. after an INSERT command, we cannot send row data
   if (result_table) {
-    ResultSerializer::send_table_description(result_table, _postgres_protocol_handler);
-    ResultSerializer::send_query_response(result_table, _postgres_protocol_handler);
-    row_count = result_table->row_count();
+    row_count = result_streamer.finish(result_table);
   } else {
     _postgres_protocol_handler->send_status_message(PostgresMessageType::NoDataResponse);
   }
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <functional>
+#include <memory>
+
+#include "admission_control.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "session_stream.hpp"
 
 namespace opossum {
 
@@ -12,23 +17,43 @@ namespace opossum {
 // portals used for CURSOR operations are currently not supported by Hyrise. For further documentation see here:
 // https://www.postgresql.org/docs/12/protocol-overview.html#PROTOCOL-QUERY-CONCEPTS
 // Example usage can be found here: https://stackoverflow.com/questions/52479293/postgresql-refcursor-and-portal-name
-class Session {
+//
+// Sessions do not own a thread. Instead, their SessionStream receives messages asynchronously on the io_service. Once
+// a message is complete, the session submits its processing to the AdmissionControl. Responses are queued by the
+// stream and sent by the network threads, so that workers never wait for the client. If the client does not receive
+// its responses, the stream holds back its next message instead. The session is only ever
+// processed by one thread at a time, but not necessarily by the same one. It keeps itself alive by passing a
+// shared_ptr to the pending operation and is destroyed once the client terminated the connection.
+class Session : public std::enable_shared_from_this<Session> {
  public:
-  explicit Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info);
+  Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info,
+          AdmissionControl& admission_control);
+
+  ~Session();
 
-  // Start new session.
-  void run();
+  // Start processing the messages of the connected client. @param on_close is called when the session is destroyed.
+  void start(const std::function<void()>& on_close = {});
 
   std::shared_ptr<Socket> socket();
 
  private:
-  // Establish new connection by exchanging parameters.
-  void _establish_connection();
+  // Wait until the next message of the client is complete and submit its processing to the admission control.
+  void _await_request();
+
+  // Process a single message (or the startup packets of a new connection) and wait for the next one.
+  void _process_request();
+
+  // Report the error to the client, or terminate the session if that is not possible.
+  void _handle_exception(const std::exception& exception);
+
+  // Establish new connection by exchanging parameters. Returns false if the client has to send another startup packet
+  // because its SSL request was denied.
+  bool _establish_connection();
 
   // Determine message and call the appropriate method.
   void _handle_request();
 
-  // Execute plain SQL statement.
+  // Execute plain SQL statement. COPY ... TO STDOUT statements are answered with a CopyOutResponse.
   void _handle_simple_query();
 
   // Parse prepared statement.
@@ -46,12 +71,21 @@ class Session {
   // Commit current transaction.
   void _sync();
 
-  const std::shared_ptr<Socket> _socket;
-  const std::shared_ptr<PostgresProtocolHandler<Socket>> _postgres_protocol_handler;
+  // A bound prepared statement along with the result format requested by the client.
+  struct Portal {
+    std::shared_ptr<AbstractOperator> physical_plan;
+    std::vector<FormatCode> result_format_codes;
+  };
+
+  const std::shared_ptr<SessionStream> _stream;
+  const std::shared_ptr<PostgresProtocolHandler<SessionStream>> _postgres_protocol_handler;
   const SendExecutionInfo _send_execution_info;
+  AdmissionControl& _admission_control;
+  std::function<void()> _on_close;
+  bool _connection_established = false;
   bool _terminate_session = false;
   bool _sync_send_after_error = false;
   std::shared_ptr<TransactionContext> _transaction_context;
-  std::unordered_map<std::string, std::shared_ptr<AbstractOperator>> _portals;
+  std::unordered_map<std::string, Portal> _portals;
 };
 }  // namespace opossum
@@ -0,0 +1,212 @@
+#include "session_stream.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <utility>
+
+#include "postgres_message_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+SessionStream::SessionStream(boost::asio::io_service& io_service)
+    : _socket(std::make_shared<Socket>(io_service)), _strand(io_service) {}
+
+std::shared_ptr<Socket> SessionStream::socket() { return _socket; }
+
+void SessionStream::async_receive_message(const bool is_startup_message, const std::function<void(bool)>& handler) {
+  boost::asio::post(_strand, [stream = shared_from_this(), is_startup_message, handler]() {
+    stream->_received_data.erase(0, stream->_readable_end);
+    stream->_read_position = 0;
+    stream->_readable_end = 0;
+
+    // As long as the client does not receive the responses queued already, its next message is not processed.
+    if (!stream->_is_writable()) {
+      stream->_postponed_receive = [stream, is_startup_message, handler]() {
+        stream->_receive_message(is_startup_message, handler);
+      };
+      return;
+    }
+
+    stream->_receive_message(is_startup_message, handler);
+  });
+}
+
+void SessionStream::_receive_message(const bool is_startup_message, const std::function<void(bool)>& handler) {
+  // The length of a message includes the length field itself, but not the message type that precedes it.
+  const auto type_size = is_startup_message ? size_t{0} : sizeof(PostgresMessageType);
+  if (_received_data.size() >= type_size + LENGTH_FIELD_SIZE) {
+    auto network_length = uint32_t{0};
+    std::memcpy(&network_length, _received_data.data() + type_size, LENGTH_FIELD_SIZE);
+    const auto message_length = ntohl(network_length);
+
+    const auto max_message_length = is_startup_message ? MAX_STARTUP_MESSAGE_LENGTH : MAX_MESSAGE_LENGTH;
+    if (message_length < LENGTH_FIELD_SIZE || message_length > max_message_length) {
+      handler(false);
+      return;
+    }
+
+    const auto message_size = type_size + message_length;
+    if (_received_data.size() >= message_size) {
+      _readable_end = message_size;
+      handler(true);
+      return;
+    }
+  }
+
+  _socket->async_read_some(
+      boost::asio::buffer(_receive_buffer),
+      boost::asio::bind_executor(_strand, [stream = shared_from_this(), is_startup_message, handler](
+                                              const boost::system::error_code& error, const size_t bytes_received) {
+        if (error) {
+          handler(false);
+          return;
+        }
+        stream->_received_data.append(stream->_receive_buffer.data(), bytes_received);
+        stream->_receive_message(is_startup_message, handler);
+      }));
+}
+
+bool SessionStream::queue_data(std::string&& data) {
+  const auto lock = std::lock_guard<std::mutex>{_send_mutex};
+  if (_is_closed) return false;
+
+  _queued_byte_count += data.size();
+  _queued_data.emplace_back(QueuedData{std::move(data), nullptr});
+
+  if (!_is_sending) {
+    _is_sending = true;
+    boost::asio::post(_strand, [stream = shared_from_this()]() { stream->_send_queued_data(); });
+  }
+  return true;
+}
+
+bool SessionStream::queue_deferred_data(const std::function<std::string()>& serialize) {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_send_mutex};
+    if (_is_closed) return false;
+
+    if (_queued_byte_count >= MAX_QUEUED_BYTES || _deferred_data_count > 0) {
+      _queued_data.emplace_back(QueuedData{std::string{}, serialize});
+      ++_deferred_data_count;
+
+      if (!_is_sending) {
+        _is_sending = true;
+        boost::asio::post(_strand, [stream = shared_from_this()]() { stream->_send_queued_data(); });
+      }
+      return true;
+    }
+  }
+
+  return queue_data(serialize());
+}
+
+void SessionStream::_send_queued_data() {
+  auto deferred_serialize = std::function<std::string()>{};
+  {
+    const auto lock = std::lock_guard<std::mutex>{_send_mutex};
+    while (!_queued_data.empty() && !_queued_data.front().serialize) {
+      _data_being_sent.emplace_back(std::move(_queued_data.front().data));
+      _queued_data.pop_front();
+    }
+
+    if (_data_being_sent.empty()) {
+      if (_queued_data.empty()) {
+        _is_sending = false;
+        return;
+      }
+      // The deferred data stays at the front of the queue until it has been serialized, so that it keeps its position.
+      deferred_serialize = _queued_data.front().serialize;
+    }
+  }
+
+  if (deferred_serialize) {
+    // Serializing might take a while, so it is done by a worker instead of the network thread. Meanwhile, nothing else
+    // is sent, which keeps _send_queued_data from being called concurrently.
+    const auto job = std::make_shared<JobTask>([stream = shared_from_this(), deferred_serialize]() {
+      auto data = std::optional<std::string>{};
+      try {
+        data = deferred_serialize();
+      } catch (const std::exception& exception) {
+        std::cerr << "Failed to serialize data for the client: " << exception.what() << std::endl;
+      }
+      boost::asio::post(stream->_strand, [stream, data = std::move(data)]() mutable {
+        stream->_complete_deferred_data(std::move(data));
+      });
+    });
+    job->schedule();
+    return;
+  }
+
+  auto buffers = std::vector<boost::asio::const_buffer>{};
+  buffers.reserve(_data_being_sent.size());
+  for (const auto& data : _data_being_sent) {
+    buffers.emplace_back(boost::asio::buffer(data));
+  }
+
+  boost::asio::async_write(
+      *_socket, buffers,
+      boost::asio::bind_executor(_strand, [stream = shared_from_this()](const boost::system::error_code& error,
+                                                                         const size_t bytes_sent) {
+        stream->_data_being_sent.clear();
+        {
+          const auto lock = std::lock_guard<std::mutex>{stream->_send_mutex};
+          stream->_queued_byte_count -= bytes_sent;
+          // The client closed the connection. Further writes fail.
+          if (error) stream->_close();
+        }
+
+        stream->_try_resume_receiving();
+        if (!error) stream->_send_queued_data();
+      }));
+}
+
+void SessionStream::_complete_deferred_data(std::optional<std::string>&& data) {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_send_mutex};
+    if (_is_closed) return;
+
+    if (!data) {
+      // The client would receive an incomplete response, so the connection is closed instead.
+      _close();
+      auto error_code = boost::system::error_code{};
+      _socket->close(error_code);
+    } else {
+      auto& front = _queued_data.front();
+      DebugAssert(front.serialize, "Expected deferred data at the front of the queue");
+      _queued_byte_count += data->size();
+      front.data = std::move(*data);
+      front.serialize = nullptr;
+      --_deferred_data_count;
+    }
+  }
+
+  _try_resume_receiving();
+  _send_queued_data();
+}
+
+void SessionStream::_close() {
+  _is_closed = true;
+  _is_sending = false;
+  _queued_data.clear();
+  _queued_byte_count = 0;
+  _deferred_data_count = 0;
+}
+
+bool SessionStream::_is_writable() {
+  const auto lock = std::lock_guard<std::mutex>{_send_mutex};
+  return _is_closed || (_queued_byte_count < MAX_QUEUED_BYTES && _deferred_data_count == 0);
+}
+
+void SessionStream::_try_resume_receiving() {
+  if (!_postponed_receive || !_is_writable()) return;
+
+  // The function is moved out first, as the receive operation might postpone itself again.
+  const auto postponed_receive = std::move(_postponed_receive);
+  _postponed_receive = nullptr;
+  postponed_receive();
+}
+
+}  // namespace opossum
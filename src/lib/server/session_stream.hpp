@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include "ring_buffer_iterator.hpp"
+#include "server_types.hpp"
+
+namespace opossum {
+
+// The stream through which the PostgresProtocolHandler of a Session communicates with its client. All operations on
+// the socket are performed asynchronously by the network threads that run the io_service:
+//
+//  - Incoming data is buffered until the next message has been received completely (see async_receive_message). Only
+//    then is the message processed by the scheduler's workers, which read it via read_some without ever waiting for
+//    the client. Thus, clients that send their messages slowly do not occupy any worker.
+//  - Outgoing data is appended to a queue via write_some or queue_data, and the network threads send it to the client.
+//    Writers never wait. Instead, backpressure is applied in two ways if the client does not keep up with receiving:
+//    Result chunks that are queued via queue_deferred_data while MAX_QUEUED_BYTES are queued already are only
+//    serialized (by a JobTask) once the data before them has been sent. Furthermore, the client's next message is only
+//    received once the queue has drained. Thus, clients that do not read their responses do not occupy any worker.
+//
+// read_some and write_some implement the SyncReadStream and SyncWriteStream concepts of boost::asio, so that the
+// stream can be used by the ReadBuffer and the WriteBuffer.
+class SessionStream : public std::enable_shared_from_this<SessionStream> {
+ public:
+  // Limit of outgoing data that has not been sent yet, see above. As writers do not wait, it may be exceeded.
+  static constexpr auto MAX_QUEUED_BYTES = size_t{1'048'576};
+
+  // Messages that claim to be longer are considered malformed. The limits match the ones of PostgreSQL. The buffer for
+  // a message only grows as its data arrives, so that a client cannot make the server allocate memory by merely
+  // announcing a long message.
+  static constexpr auto MAX_MESSAGE_LENGTH = uint32_t{1'073'741'823};
+  static constexpr auto MAX_STARTUP_MESSAGE_LENGTH = uint32_t{10'000};
+
+  explicit SessionStream(boost::asio::io_service& io_service);
+
+  std::shared_ptr<Socket> socket();
+
+  // Receives data until the next message is complete and makes it available to read_some. Data of the previous message
+  // that has not been read is discarded. Receiving only starts once less than MAX_QUEUED_BYTES and no deferred data are
+  // queued for sending. Startup messages of new connections have no message type, i.e., they start
+  // with their length. @param handler is called on a network thread with true once the message can be read, or with
+  // false if the client closed the connection or sent a malformed message header.
+  void async_receive_message(const bool is_startup_message, const std::function<void(bool)>& handler);
+
+  // Reads from the message that has been received last. Fails with boost::asio::error::eof at the end of the message.
+  template <typename MutableBufferSequence>
+  size_t read_some(const MutableBufferSequence& buffers, boost::system::error_code& error_code) {
+    const auto bytes_read = boost::asio::buffer_copy(
+        buffers, boost::asio::buffer(_received_data.data() + _read_position, _readable_end - _read_position));
+    if (bytes_read == 0) {
+      error_code = boost::asio::error::eof;
+      return 0;
+    }
+
+    _read_position += bytes_read;
+    error_code = {};
+    return bytes_read;
+  }
+
+  // Queues @param data to be sent to the client. Never blocks. Returns false if the data cannot be sent because a
+  // previous write failed.
+  bool queue_data(std::string&& data);
+
+  // Queues the data returned by @param serialize. If MAX_QUEUED_BYTES or other deferred data are queued already,
+  // @param serialize is not called right away, but by a JobTask once the data queued before has been sent. It must
+  // thus not reference objects that might be gone by then. See queue_data for the return value.
+  bool queue_deferred_data(const std::function<std::string()>& serialize);
+
+  // See queue_data. Fails with boost::asio::error::broken_pipe if a previous write failed.
+  template <typename ConstBufferSequence>
+  size_t write_some(const ConstBufferSequence& buffers, boost::system::error_code& error_code) {
+    const auto byte_count = boost::asio::buffer_size(buffers);
+    auto data = std::string(byte_count, '\0');
+    boost::asio::buffer_copy(boost::asio::buffer(data), buffers);
+
+    if (!queue_data(std::move(data))) {
+      error_code = boost::asio::error::broken_pipe;
+      return 0;
+    }
+
+    error_code = {};
+    return byte_count;
+  }
+
+ private:
+  void _receive_message(const bool is_startup_message, const std::function<void(bool)>& handler);
+
+  // Sends all queued data up to the first deferred data at once. Called on the strand until the queue is empty.
+  void _send_queued_data();
+
+  // Replaces the deferred data at the front of the queue with its serialization, or closes the stream if the
+  // serialization failed. Called on the strand.
+  void _complete_deferred_data(std::optional<std::string>&& data);
+
+  // Discards all queued data, so that further writes fail. Expects _send_mutex to be locked.
+  void _close();
+
+  // Whether the next message can be received, see async_receive_message.
+  bool _is_writable();
+
+  // Starts a receive operation that has been postponed until the queue has drained, if possible. Called on the strand.
+  void _try_resume_receiving();
+
+  const std::shared_ptr<Socket> _socket;
+
+  // Serializes the operations on the socket, which are performed by multiple network threads.
+  boost::asio::io_service::strand _strand;
+
+  // The received data that has not been discarded yet. The bytes before _read_position have been read, those up to
+  // _readable_end belong to the last complete message, the remaining ones to the next message. Only accessed by the
+  // network threads while no message is processed, and by the processing worker otherwise.
+  std::string _received_data;
+  size_t _read_position{0};
+  size_t _readable_end{0};
+  std::array<char, SERVER_BUFFER_SIZE> _receive_buffer;
+
+  // Queued data, or a function that returns it if it is deferred (see queue_deferred_data).
+  struct QueuedData {
+    std::string data;
+    std::function<std::string()> serialize;
+  };
+
+  std::mutex _send_mutex;
+  // Data that has been queued but not yet sent. _queued_byte_count includes the data that is being sent, but not the
+  // deferred data, which is counted by _deferred_data_count.
+  std::deque<QueuedData> _queued_data;
+  size_t _queued_byte_count{0};
+  size_t _deferred_data_count{0};
+  bool _is_sending{false};
+  bool _is_closed{false};
+  // Only accessed on the strand.
+  std::vector<std::string> _data_being_sent;
+  std::function<void()> _postponed_receive;
+};
+
+}  // namespace opossum
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <cstring>
+#include <string_view>
+
+#include <boost/endian/conversion.hpp>
+
 #include "ring_buffer_iterator.hpp"
 #include "server_types.hpp"
 #include "types.hpp"
@@ -35,6 +40,15 @@ class WriteBuffer {
       converted_value = htons(network_value);
     } else if constexpr (std::is_same_v<T, uint32_t> || std::is_same_v<T, int32_t>) {
       converted_value = htonl(network_value);
+    } else if constexpr (std::is_same_v<T, uint64_t> || std::is_same_v<T, int64_t>) {
+      converted_value = boost::endian::native_to_big(network_value);
+    } else if constexpr (std::is_floating_point_v<T>) {
+      // The binary format of floating point numbers is their IEEE 754 representation in network byte order
+      using UnsignedType = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+      auto bits = UnsignedType{};
+      std::memcpy(&bits, &network_value, sizeof(T));
+      bits = boost::endian::native_to_big(bits);
+      std::memcpy(&converted_value, &bits, sizeof(T));
     } else {
       converted_value = network_value;
     }
@@ -43,7 +57,7 @@ class WriteBuffer {
   }
 
   // Put string into the buffer. If the string is longer than the buffer itself the buffer will flush automatically.
-  void put_string(const std::string& value, const HasNullTerminator has_null_terminator = HasNullTerminator::Yes);
+  void put_string(const std::string_view value, const HasNullTerminator has_null_terminator = HasNullTerminator::Yes);
 
   // Flush buffer by at least bytes_required. 0 means, flush whole buffer.
   void flush(const size_t bytes_required = 0);
@@ -35,7 +35,8 @@ class SQLPipeline : public Noncopyable {
   SQLPipeline(const std::string& sql, const std::shared_ptr<TransactionContext>& transaction_context,
               const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
               const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-              const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
+              const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+              const std::shared_ptr<ResultCache>& init_result_cache = nullptr);
 
   // Returns the original SQL string
   const std::string& get_sql() const;
@@ -79,6 +80,10 @@ class SQLPipeline : public Noncopyable {
   std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> get_result_table() &;
   std::pair<SQLPipelineStatus, std::shared_ptr<const Table>> get_result_table() &&;
 
+  // Passes the result of the last statement chunk by chunk to @param result_chunk_consumer, possibly while the
+  // statement is still being executed (see SQLPipelineStatement). Must be called before the pipeline is executed.
+  void set_result_chunk_consumer(const OutputChunkConsumer& result_chunk_consumer);
+
   // Returns the TransactionContext that was passed to the SQLPipelineStatement, or nullptr if none was passed in.
   std::shared_ptr<TransactionContext> transaction_context() const;
 
@@ -95,6 +100,7 @@ class SQLPipeline : public Noncopyable {
 
   const std::shared_ptr<SQLPhysicalPlanCache> pqp_cache;
   const std::shared_ptr<SQLLogicalPlanCache> lqp_cache;
+  const std::shared_ptr<ResultCache> result_cache;
 
  private:
   friend class SQLPipelineStatementTest;
@@ -5,7 +5,10 @@
 namespace opossum {
 
 SQLPipelineBuilder::SQLPipelineBuilder(const std::string& sql)
-    : _sql(sql), _pqp_cache(Hyrise::get().default_pqp_cache), _lqp_cache(Hyrise::get().default_lqp_cache) {}
+    : _sql(sql),
+      _pqp_cache(Hyrise::get().default_pqp_cache),
+      _lqp_cache(Hyrise::get().default_lqp_cache),
+      _result_cache(Hyrise::get().default_result_cache) {}
 
 SQLPipelineBuilder& SQLPipelineBuilder::with_mvcc(const UseMvcc use_mvcc) {
   _use_mvcc = use_mvcc;
@@ -35,12 +38,24 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_lqp_cache(const std::shared_ptr<SQL
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_result_cache(const std::shared_ptr<ResultCache>& result_cache) {
+  _result_cache = result_cache;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_result_chunk_consumer(
+    const OutputChunkConsumer& result_chunk_consumer) {
+  _result_chunk_consumer = result_chunk_consumer;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() { return with_mvcc(UseMvcc::No); }
 
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   DTRACE_PROBE1(HYRISE, CREATE_PIPELINE, reinterpret_cast<uintptr_t>(this));
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
-  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, optimizer, _pqp_cache, _lqp_cache);
+  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, optimizer, _pqp_cache, _lqp_cache, _result_cache);
+  if (_result_chunk_consumer) pipeline.set_result_chunk_consumer(_result_chunk_consumer);
   DTRACE_PROBE3(HYRISE, PIPELINE_CREATION_DONE, pipeline.get_sql_per_statement().size(), _sql.c_str(),
                 reinterpret_cast<uintptr_t>(this));
   return pipeline;
@@ -25,6 +25,11 @@ class Optimizer;
  *          with_transaction_context(tc).
  *          create_pipeline();
  *
+ * Receiving the result of the last statement chunk by chunk (e.g., to send it to a client while it is computed):
+ *      SQLPipelineBuilder{query}.
+ *          with_result_chunk_consumer([&](const auto& chunk_table) { ... }).
+ *          create_pipeline();
+ *
  * Defaults:
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer()) is used.
@@ -42,6 +47,8 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
   SQLPipelineBuilder& with_pqp_cache(const std::shared_ptr<SQLPhysicalPlanCache>& pqp_cache);
   SQLPipelineBuilder& with_lqp_cache(const std::shared_ptr<SQLLogicalPlanCache>& lqp_cache);
+  SQLPipelineBuilder& with_result_cache(const std::shared_ptr<ResultCache>& result_cache);
+  SQLPipelineBuilder& with_result_chunk_consumer(const OutputChunkConsumer& result_chunk_consumer);
 
   /**
    * Short for with_mvcc(UseMvcc::No)
@@ -58,6 +65,8 @@ class SQLPipelineBuilder final {
   std::shared_ptr<Optimizer> _optimizer;
   std::shared_ptr<SQLPhysicalPlanCache> _pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> _lqp_cache;
+  std::shared_ptr<ResultCache> _result_cache;
+  OutputChunkConsumer _result_chunk_consumer;
 };
 
 }  // namespace opossum
@@ -32,9 +32,11 @@ namespace opossum {
 SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                                            const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                                            const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                                           const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache)
+                                           const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                                           const std::shared_ptr<ResultCache>& init_result_cache)
     : pqp_cache(init_pqp_cache),
       lqp_cache(init_lqp_cache),
+      result_cache(init_result_cache),
       _sql_string(sql),
       _use_mvcc(use_mvcc),
       _optimizer(optimizer),
@@ -54,6 +56,11 @@ void SQLPipelineStatement::set_transaction_context(const std::shared_ptr<Transac
   _transaction_context = transaction_context;
 }
 
+void SQLPipelineStatement::set_result_chunk_consumer(const OutputChunkConsumer& result_chunk_consumer) {
+  DebugAssert(!_result_table, "Statement has already been executed");
+  _result_chunk_consumer = result_chunk_consumer;
+}
+
 const std::string& SQLPipelineStatement::get_sql_string() { return _sql_string; }
 
 const std::shared_ptr<hsql::SQLParserResult>& SQLPipelineStatement::get_parsed_sql_statement() {
@@ -265,8 +272,30 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
     return {SQLPipelineStatus::Success, _result_table};
   }
 
+  const auto result_cache_key = _result_cache_key();
+  if (result_cache_key) {
+    if (const auto cached_result_table = result_cache->try_get(*result_cache_key)) {
+      _result_table = cached_result_table;
+      _metrics->result_cache_hit = true;
+
+      // The statement is read-only, so committing the auto-commit transaction only finishes it.
+      _transaction_context->commit();
+      if (_result_chunk_consumer) {
+        AbstractChunkwiseOperator::pass_chunks_to_consumer(_result_table, _result_chunk_consumer);
+      }
+      return {SQLPipelineStatus::Success, _result_table};
+    }
+  }
+
   const auto& tasks = get_tasks();
 
+  auto result_is_streamed = false;
+  if (_result_chunk_consumer && _root_operator_task) {
+    const auto chunkwise_root_operator =
+        std::dynamic_pointer_cast<AbstractChunkwiseOperator>(_root_operator_task->get_operator());
+    result_is_streamed = chunkwise_root_operator && chunkwise_root_operator->try_stream_output(_result_chunk_consumer);
+  }
+
   const auto started = std::chrono::high_resolution_clock::now();
 
   DTRACE_PROBE3(HYRISE, TASKS_PER_STATEMENT, reinterpret_cast<uintptr_t>(&tasks), _sql_string.c_str(),
@@ -312,6 +341,13 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
 
   if (!_result_table) _query_has_output = false;
 
+  if (_result_chunk_consumer && _result_table && !result_is_streamed) {
+    AbstractChunkwiseOperator::pass_chunks_to_consumer(_result_table, _result_chunk_consumer);
+  }
+
+  // A streamed result has been handed to the consumer and is not part of the result table.
+  if (result_cache_key && _result_table && !result_is_streamed) result_cache->set(*result_cache_key, _result_table);
+
   DTRACE_PROBE8(HYRISE, SUMMARY, _sql_string.c_str(), _metrics->sql_translation_duration.count(),
                 _metrics->optimization_duration.count(), _metrics->lqp_translation_duration.count(),
                 _metrics->plan_execution_duration.count(), _metrics->query_plan_cache_hit, get_tasks().size(),
@@ -375,6 +411,23 @@ void SQLPipelineStatement::_precheck_ddl_operators(const std::shared_ptr<Abstrac
   }
 }
 
+std::optional<ResultCache::Key> SQLPipelineStatement::_result_cache_key() {
+  if (!result_cache || _use_mvcc == UseMvcc::No || _is_transaction_statement()) return std::nullopt;
+
+  // Statements within multi-statement transactions might see the transaction's own, uncommitted modifications.
+  if (_transaction_context && !_transaction_context->is_auto_commit()) return std::nullopt;
+
+  const auto& lqp = get_optimized_logical_plan();
+
+  // The versions of the tables have to be read after the snapshot was taken (see ResultCache::create_key). Usually,
+  // the auto-commit transaction context is created in get_physical_plan(), which is only called on a cache miss.
+  if (!_transaction_context) {
+    _transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes);
+  }
+
+  return ResultCache::create_key(lqp, _transaction_context->snapshot_commit_id());
+}
+
 bool SQLPipelineStatement::_is_transaction_statement() {
   return get_parsed_sql_statement()->getStatements().front()->isType(hsql::kStmtTransaction);
 }
@@ -1,12 +1,15 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "SQLParserResult.h"
 #include "cache/gdfs_cache.hpp"
+#include "cache/result_cache.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
+#include "operators/abstract_chunkwise_operator.hpp"
 #include "optimizer/optimizer.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
@@ -26,6 +29,7 @@ struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds plan_execution_duration{};
 
   bool query_plan_cache_hit = false;
+  bool result_cache_hit = false;
 };
 
 enum class SQLPipelineStatus {
@@ -50,6 +54,16 @@ enum class SQLPipelineStatus {
  *  If a physical plan for an SQL statement is in the SQLPhysicalPlanCache, it will be used instead of translating the
  *  optimized LQP (get_optimized_logical_plans()) into a PQP. Thus, in this case, the optimized LQP and PQP could be
  *  different.
+ *
+ * NOTE:
+ *  If a ResultCache is given, the results of read-only auto-commit statements are cached. On a cache hit,
+ *  get_result_table() returns the cached table without translating the LQP into a PQP and executing it.
+ *
+ * NOTE:
+ *  If a result chunk consumer is set, the result is passed to it chunk by chunk. If the root operator can stream its
+ *  output (see AbstractChunkwiseOperator::try_stream_output), the chunks are passed concurrently while the statement
+ *  is executed and the table returned by get_result_table() has no chunks. Otherwise, the chunks of the result table
+ *  are passed after the execution.
  */
 class SQLPipelineStatement : public Noncopyable {
  public:
@@ -57,11 +71,15 @@ class SQLPipelineStatement : public Noncopyable {
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                        const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                        const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
+                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                       const std::shared_ptr<ResultCache>& init_result_cache = nullptr);
 
   // Set the transaction context if this SQLPipelineStatement should not auto-commit.
   void set_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
 
+  // Set a consumer that receives the result chunk by chunk (see above). Must be called before get_result_table().
+  void set_result_chunk_consumer(const OutputChunkConsumer& result_chunk_consumer);
+
   // Returns the raw SQL string.
   const std::string& get_sql_string();
 
@@ -102,10 +120,15 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::shared_ptr<SQLPhysicalPlanCache> pqp_cache;
   const std::shared_ptr<SQLLogicalPlanCache> lqp_cache;
+  const std::shared_ptr<ResultCache> result_cache;
 
  private:
   bool _is_transaction_statement();
 
+  // Returns the key for the result of this statement in the result cache, or std::nullopt if there is no result cache
+  // or the result of this statement cannot be cached.
+  std::optional<ResultCache::Key> _result_cache_key();
+
   // Returns the tasks that execute transaction statements
   std::vector<std::shared_ptr<AbstractTask>> _get_transaction_tasks();
 
@@ -129,6 +152,7 @@ class SQLPipelineStatement : public Noncopyable {
   std::vector<std::shared_ptr<AbstractTask>> _tasks;
 
   std::shared_ptr<const Table> _result_table;
+  OutputChunkConsumer _result_chunk_consumer;
   // Assume there is an output table. Only change if nullptr is returned from execution.
   bool _query_has_output{true};
   SQLTranslationInfo _translation_info;
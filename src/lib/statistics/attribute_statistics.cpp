@@ -5,6 +5,7 @@
 #include "resolve_type.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram.hpp"
+#include "statistics/statistics_objects/hyper_log_log_sketch.hpp"
 #include "statistics/statistics_objects/min_max_filter.hpp"
 #include "statistics/statistics_objects/range_filter.hpp"
 
@@ -28,6 +29,8 @@ void AttributeStatistics<T>::set_statistics_object(const std::shared_ptr<Abstrac
   } else if (const auto null_value_ratio_object =
                  std::dynamic_pointer_cast<NullValueRatioStatistics>(statistics_object)) {
     null_value_ratio = null_value_ratio_object;
+  } else if (const auto sketch_object = std::dynamic_pointer_cast<HyperLogLogSketch<T>>(statistics_object)) {
+    distinct_count_sketch = sketch_object;
   } else {
     if constexpr (std::is_arithmetic_v<
                       T>) {  // NOLINT clang-tidy is crazy and sees a "potentially unintended semicolon" here...
@@ -53,6 +56,10 @@ std::shared_ptr<BaseAttributeStatistics> AttributeStatistics<T>::scaled(const Se
     statistics->set_statistics_object(null_value_ratio->scaled(selectivity));
   }
 
+  if (distinct_count_sketch) {
+    statistics->set_statistics_object(distinct_count_sketch->scaled(selectivity));
+  }
+
   if (min_max_filter) {
     statistics->set_statistics_object(min_max_filter->scaled(selectivity));
   }
@@ -81,6 +88,11 @@ std::shared_ptr<BaseAttributeStatistics> AttributeStatistics<T>::sliced(
     statistics->set_statistics_object(null_value_ratio->sliced(predicate_condition, variant_value, variant_value2));
   }
 
+  if (distinct_count_sketch) {
+    statistics->set_statistics_object(
+        distinct_count_sketch->sliced(predicate_condition, variant_value, variant_value2));
+  }
+
   if (min_max_filter) {
     statistics->set_statistics_object(min_max_filter->sliced(predicate_condition, variant_value, variant_value2));
   }
@@ -111,6 +123,11 @@ std::shared_ptr<BaseAttributeStatistics> AttributeStatistics<T>::pruned(
     statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(null_value_ratio->ratio));
   }
 
+  if (distinct_count_sketch) {
+    // Pruned chunks might contain some of the distinct values, but which ones is unknown. Keep the sketch unmodified.
+    statistics->set_statistics_object(distinct_count_sketch);
+  }
+
   // As pruning is on a table-level granularity, it does not make too much sense to implement pruning on chunk-level
   // statistics such as the filters below.
 
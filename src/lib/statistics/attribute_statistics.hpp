@@ -6,6 +6,7 @@
 #include "base_attribute_statistics.hpp"
 #include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram.hpp"
+#include "statistics/statistics_objects/hyper_log_log_sketch.hpp"
 #include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
 #include "types.hpp"
 
@@ -45,6 +46,7 @@ class AttributeStatistics : public BaseAttributeStatistics {
   std::shared_ptr<MinMaxFilter<T>> min_max_filter;
   std::shared_ptr<RangeFilter<T>> range_filter;
   std::shared_ptr<NullValueRatioStatistics> null_value_ratio;
+  std::shared_ptr<HyperLogLogSketch<T>> distinct_count_sketch;
 };
 
 template <typename T>
@@ -69,6 +71,11 @@ std::ostream& operator<<(std::ostream& stream, const AttributeStatistics<T>& att
     stream << "NullValueRatio: " << attribute_statistics.null_value_ratio->ratio << std::endl;
   }
 
+  if (attribute_statistics.distinct_count_sketch) {
+    stream << "DistinctCountSketch: " << attribute_statistics.distinct_count_sketch->estimate_distinct_count()
+           << std::endl;
+  }
+
   stream << "}" << std::endl;
 
   return stream;
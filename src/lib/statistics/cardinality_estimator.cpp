@@ -24,6 +24,7 @@
 #include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/validate_node.hpp"
+#include "logical_query_plan/window_node.hpp"
 #include "lossy_cast.hpp"
 #include "operators/operator_join_predicate.hpp"
 #include "operators/operator_scan_predicate.hpp"
@@ -193,6 +194,11 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_statistics(
       output_table_statistics = estimate_validate_node(*validate_node, left_input_table_statistics);
     } break;
 
+    case LQPNodeType::Window: {
+      const auto window_node = std::dynamic_pointer_cast<const WindowNode>(lqp);
+      output_table_statistics = estimate_window_node(*window_node, left_input_table_statistics);
+    } break;
+
     case LQPNodeType::Union: {
       const auto union_node = std::dynamic_pointer_cast<const UnionNode>(lqp);
       output_table_statistics =
@@ -292,6 +298,15 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_aggregate_node(
   auto column_statistics =
       std::vector<std::shared_ptr<BaseAttributeStatistics>>{aggregate_node.output_expressions().size()};
 
+  // If distinct count sketches are available for all group-by columns, the number of groups is estimated as the
+  // product of their distinct counts (i.e., assuming that the columns are independent), which is bounded by the
+  // number of input rows. Otherwise, the input row count is forwarded as an upper bound.
+  const auto group_by_expression_count = aggregate_node.aggregate_expressions_begin_idx;
+  auto group_count = std::optional<Cardinality>{};
+  if (group_by_expression_count > 0) {
+    group_count = Cardinality{1};
+  }
+
   for (size_t expression_idx{0}; expression_idx < aggregate_node.output_expressions().size(); ++expression_idx) {
     const auto& expression = *aggregate_node.output_expressions()[expression_idx];
     const auto input_column_id = aggregate_node.left_input()->find_column_id(expression);
@@ -303,9 +318,31 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_aggregate_node(
         column_statistics[expression_idx] = std::make_shared<AttributeStatistics<ColumnDataType>>();
       });
     }
+
+    if (expression_idx >= group_by_expression_count || !group_count) continue;
+
+    resolve_data_type(expression.data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto attribute_statistics =
+          std::dynamic_pointer_cast<AttributeStatistics<ColumnDataType>>(column_statistics[expression_idx]);
+      if (!attribute_statistics || !attribute_statistics->distinct_count_sketch) {
+        group_count.reset();
+        return;
+      }
+
+      // NULL forms a group of its own.
+      auto distinct_count = attribute_statistics->distinct_count_sketch->estimate_distinct_count();
+      if (attribute_statistics->null_value_ratio && attribute_statistics->null_value_ratio->ratio > 0.0f) {
+        distinct_count += 1.0f;
+      }
+      *group_count *= std::max(distinct_count, Cardinality{1});
+    });
   }
 
-  return std::make_shared<TableStatistics>(std::move(column_statistics), input_table_statistics->row_count);
+  const auto row_count =
+      group_count ? std::min(*group_count, input_table_statistics->row_count) : input_table_statistics->row_count;
+
+  return std::make_shared<TableStatistics>(std::move(column_statistics), row_count);
 }
 
 std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_validate_node(
@@ -545,6 +582,21 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_limit_node(
   }
 }
 
+std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_window_node(
+    const WindowNode& window_node, const std::shared_ptr<TableStatistics>& input_table_statistics) {
+  // WindowNodes forward all input rows and columns. As for the columns newly created by ProjectionNodes, no meaningful
+  // statistics can be generated for the window function's result yet, hence an empty AttributeStatistics object is
+  // created.
+  auto column_statistics = input_table_statistics->column_statistics;
+
+  resolve_data_type(window_node.window_function_expression()->data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    column_statistics.emplace_back(std::make_shared<AttributeStatistics<ColumnDataType>>());
+  });
+
+  return std::make_shared<TableStatistics>(std::move(column_statistics), input_table_statistics->row_count);
+}
+
 std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_operator_scan_predicate(
     const std::shared_ptr<TableStatistics>& input_table_statistics, const OperatorScanPredicate& predicate) {
   /**
@@ -782,11 +834,10 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_inner_equi_join(
   const auto right_data_type = right_input_table_statistics.column_data_type(right_column_id);
 
   // We expect both columns to be of the same type. This allows us to resolve the type only once, reducing the
-  // compile time. For differing column types and/or string columns (which we cannot handle right now), we assume that
-  // all tuples qualify. This is probably a gross overestimation, but we need to return something...
-  // TODO(anybody) - Implement join estimation for differing column data types
-  //               - Implement join estimation for String columns
-  if (left_data_type != right_data_type || left_data_type == DataType::String) {
+  // compile time. For differing column types, we assume that all tuples qualify. This is probably a gross
+  // overestimation, but we need to return something...
+  // TODO(anybody) Implement join estimation for differing column data types
+  if (left_data_type != right_data_type) {
     return estimate_cross_join(left_input_table_statistics, right_input_table_statistics);
   }
 
@@ -802,14 +853,36 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_inner_equi_join(
 
     auto cardinality = Cardinality{0};
     auto join_column_histogram = std::shared_ptr<AbstractHistogram<ColumnDataType>>{};
+    auto join_column_sketch = std::shared_ptr<AbstractStatisticsObject>{};
 
     auto left_histogram = left_input_column_statistics->histogram;
     auto right_histogram = right_input_column_statistics->histogram;
 
-    if (left_histogram && right_histogram) {
+    const auto& left_sketch = left_input_column_statistics->distinct_count_sketch;
+    const auto& right_sketch = right_input_column_statistics->distinct_count_sketch;
+
+    if (left_histogram && right_histogram && left_data_type != DataType::String) {
       // If we have histograms, we use the principle of inclusion to determine the number of matches between two bins.
       join_column_histogram = estimate_inner_equi_join_with_histograms(*left_histogram, *right_histogram);
       cardinality = join_column_histogram->total_count();
+    } else if (left_sketch && right_sketch) {
+      // Without (usable) histograms, we apply the principle of inclusion to the whole columns: each value of the side
+      // with fewer distinct values is assumed to occur on the other side as well. This is the only estimation we have
+      // for String columns, as estimate_inner_equi_join_with_histograms() cannot handle them.
+      const auto left_distinct_count = left_sketch->estimate_distinct_count();
+      const auto right_distinct_count = right_sketch->estimate_distinct_count();
+      const auto max_distinct_count = std::max(left_distinct_count, right_distinct_count);
+      cardinality =
+          max_distinct_count > 0 ? left_sketch->value_count * right_sketch->value_count / max_distinct_count : 0.0f;
+
+      // The join column contains the values of the side with fewer distinct values.
+      const auto& join_input_sketch = left_distinct_count <= right_distinct_count ? left_sketch : right_sketch;
+      join_column_sketch = join_input_sketch->scaled(
+          join_input_sketch->value_count > 0 ? cardinality / join_input_sketch->value_count : 0.0f);
+    } else if (left_data_type == DataType::String) {
+      // TODO(anybody) Implement join estimation for String columns without sketches
+      output_table_statistics = estimate_cross_join(left_input_table_statistics, right_input_table_statistics);
+      return;
     } else {
       // TODO(anybody) If there aren't histograms on both sides, use some other algorithm/statistics to estimate the
       //               Join
@@ -832,6 +905,7 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_inner_equi_join(
 
     const auto join_columns_output_statistics = std::make_shared<AttributeStatistics<ColumnDataType>>();
     join_columns_output_statistics->histogram = join_column_histogram;
+    join_columns_output_statistics->set_statistics_object(join_column_sketch);
     column_statistics[left_column_id] = join_columns_output_statistics;
     column_statistics[left_column_count + right_column_id] = join_columns_output_statistics;
 
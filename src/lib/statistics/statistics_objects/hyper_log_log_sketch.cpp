@@ -0,0 +1,128 @@
+#include "hyper_log_log_sketch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/create_iterable_from_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+uint64_t hyper_log_log_hash(const T& value) {
+  // std::hash is the identity function for integers in libstdc++. HyperLogLog requires the bits of the hash to be
+  // uniformly distributed, so the result is mixed with the finalizer of SplitMix64.
+  auto hash = static_cast<uint64_t>(std::hash<T>{}(value));
+  hash ^= hash >> 30;
+  hash *= 0xbf58476d1ce4e5b9ULL;
+  hash ^= hash >> 27;
+  hash *= 0x94d049bb133111ebULL;
+  hash ^= hash >> 31;
+  return hash;
+}
+
+}  // namespace
+
+namespace opossum {
+
+template <typename T>
+HyperLogLogSketch<T>::HyperLogLogSketch(const Cardinality init_value_count)
+    : AbstractStatisticsObject(data_type_from_type<T>()),
+      value_count(init_value_count),
+      _registers(REGISTER_COUNT, uint8_t{0}) {}
+
+template <typename T>
+HyperLogLogSketch<T>::HyperLogLogSketch(const std::vector<uint8_t>& registers, const Cardinality init_value_count)
+    : AbstractStatisticsObject(data_type_from_type<T>()), value_count(init_value_count), _registers(registers) {
+  Assert(_registers.size() == REGISTER_COUNT, "Unexpected number of registers");
+}
+
+template <typename T>
+void HyperLogLogSketch<T>::add(const T& value) {
+  const auto hash = hyper_log_log_hash(value);
+  const auto register_id = hash >> (64 - PRECISION);
+
+  // Position of the first set bit in the remaining bits. If none is set, the maximum rank is used.
+  const auto remaining_bits = hash << PRECISION;
+  const auto rank =
+      static_cast<uint8_t>(remaining_bits == 0 ? 64 - PRECISION + 1 : __builtin_clzll(remaining_bits) + 1);
+
+  _registers[register_id] = std::max(_registers[register_id], rank);
+}
+
+template <typename T>
+void HyperLogLogSketch<T>::add_segment(const AbstractSegment& segment) {
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+      // The dictionary contains each non-NULL value of the segment exactly once.
+      for (const auto& value : *typed_segment.dictionary()) {
+        add(value);
+      }
+    } else {
+      const auto iterable = create_iterable_from_segment<T>(typed_segment);
+      iterable.for_each([&](const auto& position) {
+        if (position.is_null()) return;
+        add(position.value());
+      });
+    }
+  });
+}
+
+template <typename T>
+void HyperLogLogSketch<T>::merge(const HyperLogLogSketch<T>& other) {
+  for (auto register_id = size_t{0}; register_id < REGISTER_COUNT; ++register_id) {
+    _registers[register_id] = std::max(_registers[register_id], other._registers[register_id]);
+  }
+  value_count += other.value_count;
+}
+
+template <typename T>
+Cardinality HyperLogLogSketch<T>::estimate_distinct_count() const {
+  auto inverse_sum = 0.0;
+  auto zero_register_count = size_t{0};
+  for (const auto rank : _registers) {
+    inverse_sum += std::ldexp(1.0, -static_cast<int>(rank));
+    zero_register_count += rank == 0;
+  }
+
+  const auto register_count = static_cast<double>(REGISTER_COUNT);
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  auto estimate = alpha * register_count * register_count / inverse_sum;
+
+  // For small cardinalities, many registers are still empty. Linear counting is more accurate in this case. As the
+  // hashes have 64 bits, no correction for large cardinalities is required.
+  if (estimate <= 2.5 * register_count && zero_register_count > 0) {
+    estimate = register_count * std::log(register_count / static_cast<double>(zero_register_count));
+  }
+
+  return std::min(static_cast<Cardinality>(estimate), value_count);
+}
+
+template <typename T>
+std::shared_ptr<AbstractStatisticsObject> HyperLogLogSketch<T>::sliced(
+    const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+    const std::optional<AllTypeVariant>& variant_value2) const {
+  return nullptr;
+}
+
+template <typename T>
+std::shared_ptr<AbstractStatisticsObject> HyperLogLogSketch<T>::scaled(const Selectivity selectivity) const {
+  return std::make_shared<HyperLogLogSketch<T>>(_registers, value_count * selectivity);
+}
+
+template <typename T>
+const std::vector<uint8_t>& HyperLogLogSketch<T>::registers() const {
+  return _registers;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(HyperLogLogSketch);
+
+}  // namespace opossum
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "abstract_statistics_object.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+/**
+ * HyperLogLog sketch (Flajolet et al.: "HyperLogLog: the analysis of a near-optimal cardinality estimation algorithm",
+ * 2007) that estimates the number of distinct values of a column.
+ *
+ * Each value is hashed. The first PRECISION bits of the hash select one of the registers, which stores the maximum
+ * number of leading zeros (plus one) seen in the remaining bits. The distinct count is estimated from the harmonic
+ * mean of the registers. With 2^11 one-byte registers, the standard error is about 1.04 / sqrt(2^11) = 2.3%, no
+ * matter how many values are added.
+ *
+ * In contrast to the distinct counts of histogram bins, sketches are composable: the sketch of a union of values is
+ * the register-wise maximum of the sketches of its parts. Thus, sketches are built per segment and merged per table,
+ * and the sketch of the rows written by an Insert can be merged into the table's sketch (see TableStatistics).
+ *
+ * The registers only describe the set of values. For scaling, the sketch also stores the number of (non-NULL) values
+ * that it represents, which has to be set by its creator.
+ */
+template <typename T>
+class HyperLogLogSketch : public AbstractStatisticsObject {
+ public:
+  static constexpr auto PRECISION = uint32_t{11};
+  static constexpr auto REGISTER_COUNT = size_t{1} << PRECISION;
+
+  explicit HyperLogLogSketch(const Cardinality init_value_count = 0.0f);
+  HyperLogLogSketch(const std::vector<uint8_t>& registers, const Cardinality init_value_count);
+
+  void add(const T& value);
+
+  // Adds all non-NULL values of @param segment. For dictionary segments, only the dictionary is read.
+  void add_segment(const AbstractSegment& segment);
+
+  // Adds the values of @param other, including its value count.
+  void merge(const HyperLogLogSketch<T>& other);
+
+  // Returns the estimated number of distinct values, which does not exceed the value count.
+  Cardinality estimate_distinct_count() const;
+
+  // A sketch cannot tell which of its values satisfy a predicate. Thus, it does not survive slicing.
+  std::shared_ptr<AbstractStatisticsObject> sliced(
+      const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+      const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
+
+  // Only the value count is scaled. The distinct count is capped at the scaled value count, similar to histograms.
+  std::shared_ptr<AbstractStatisticsObject> scaled(const Selectivity selectivity) const override;
+
+  const std::vector<uint8_t>& registers() const;
+
+  Cardinality value_count;
+
+ private:
+  std::vector<uint8_t> _registers;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(HyperLogLogSketch);
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#include "statistics_refresher.hpp"
+
+#include <cmath>
+#include <string>
+#include <unordered_map>
+
+#include "hyrise.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "statistics/table_statistics_delta.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+StatisticsRefresher::StatisticsRefresher(const float row_count_change_threshold)
+    : _row_count_change_threshold{row_count_change_threshold} {
+  Assert(row_count_change_threshold >= 0.0f, "Threshold must not be negative");
+}
+
+StatisticsRefresher::~StatisticsRefresher() { stop_background(); }
+
+size_t StatisticsRefresher::refresh() {
+  const auto lock = std::lock_guard<std::mutex>{_refresh_mutex};
+
+  auto refreshed_table_count = size_t{0};
+  auto table_states = std::unordered_map<std::string, TableState>{};
+
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    const auto row_count = table->row_count();
+    const auto table_statistics_delta = table->table_statistics_delta();
+    auto table_state = TableState{table, row_count};
+
+    const auto previous_state_iter = _table_states.find(table_name);
+    if (previous_state_iter != _table_states.end() && previous_state_iter->second.table.lock() == table) {
+      const auto previous_row_count = previous_state_iter->second.row_count;
+      const auto row_count_change = std::abs(static_cast<double>(row_count) - static_cast<double>(previous_row_count));
+
+      if (row_count_change > 0 && row_count_change >= _row_count_change_threshold * previous_row_count) {
+        // The rebuilt statistics cover the rows of the delta. Rows committed while the statistics are rebuilt might be
+        // counted twice, which is acceptable for an estimation.
+        if (table_statistics_delta) table_statistics_delta->take();
+        table->set_table_statistics(
+            TableStatistics::from_table(*table, Hyrise::get().storage_manager.statistics_sampling_config()));
+        ++refreshed_table_count;
+      } else {
+        // Keep the row count of the last rebuild, so that small changes add up.
+        table_state.row_count = previous_row_count;
+      }
+    }
+
+    // Merge the rows committed since the last refresh into the statistics. As only the StatisticsRefresher updates the
+    // statistics of tables in the StorageManager, no concurrent update is lost.
+    const auto table_statistics = table->table_statistics();
+    if (table_statistics && table_statistics_delta) {
+      if (const auto inserted_rows_statistics = table_statistics_delta->take()) {
+        table->set_table_statistics(table_statistics->with_inserted_rows(*inserted_rows_statistics));
+      }
+    }
+
+    generate_chunk_pruning_statistics(table);
+
+    table_states.emplace(table_name, std::move(table_state));
+  }
+
+  // Dropped tables are forgotten.
+  _table_states = std::move(table_states);
+
+  return refreshed_table_count;
+}
+
+void StatisticsRefresher::start_background(const std::chrono::milliseconds interval) {
+  Assert(!_background_thread, "Background refreshes have already been started");
+  _background_thread = std::make_unique<PausableLoopThread>(interval, [this](size_t) { refresh(); });
+}
+
+void StatisticsRefresher::stop_background() { _background_thread.reset(); }
+
+}  // namespace opossum
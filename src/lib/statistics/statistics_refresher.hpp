@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "types.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Keeps the statistics of the tables in the StorageManager useful while the tables are modified.
+ *
+ * Inserts add the rows they commit to the table's TableStatisticsDelta and generate the pruning statistics of the
+ * chunks that they complete (see Insert). refresh() merges the deltas into the table statistics (see
+ * TableStatistics::with_inserted_rows). These incremental updates only approximate the distribution of the inserted
+ * values, though. Thus, refresh() also rebuilds the statistics of all tables whose row count changed by more than
+ * the given fraction since the statistics were last built by the refresher. Furthermore, it generates the missing
+ * pruning statistics of immutable chunks, e.g., of chunks that were finalized by other means than an Insert.
+ *
+ * Tables are tracked from the first call to refresh() on. Their statistics are rebuilt only once they change after
+ * that, as the statistics created by StorageManager::add_table are up to date.
+ */
+class StatisticsRefresher : private Noncopyable {
+ public:
+  explicit StatisticsRefresher(const float row_count_change_threshold = 0.1f);
+  ~StatisticsRefresher();
+
+  // Returns the number of tables whose statistics were rebuilt.
+  size_t refresh();
+
+  /**
+   * Periodically refreshes the statistics in a background thread until stop_background() is called or the
+   * StatisticsRefresher object is destroyed.
+   */
+  void start_background(const std::chrono::milliseconds interval);
+  void stop_background();
+
+ protected:
+  struct TableState {
+    // Used to recognize tables that were dropped and recreated with the same name.
+    std::weak_ptr<const Table> table;
+    uint64_t row_count{0};
+  };
+
+  const float _row_count_change_threshold;
+
+  std::mutex _refresh_mutex;
+
+  // The row count of each table when its statistics were last rebuilt (or when it was first seen).
+  std::unordered_map<std::string, TableState> _table_states;
+
+  std::unique_ptr<PausableLoopThread> _background_thread;
+};
+
+}  // namespace opossum
@@ -1,17 +1,288 @@
 #include "table_statistics.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iterator>
 #include <numeric>
+#include <random>
 #include <thread>
+#include <unordered_map>
 
 #include "attribute_statistics.hpp"
 #include "resolve_type.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/statistics_objects/generic_histogram.hpp"
+#include "statistics/statistics_objects/generic_histogram_builder.hpp"
+#include "statistics/statistics_objects/hyper_log_log_sketch.hpp"
+#include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+std::shared_ptr<AbstractHistogram<T>> histogram_with_inserted_bin(
+    const std::shared_ptr<AbstractHistogram<T>>& histogram, const std::shared_ptr<AbstractHistogram<T>>& inserted) {
+  if (!inserted || inserted->bin_count() == 0) return histogram;
+  if (!histogram || histogram->bin_count() == 0) return inserted;
+
+  DebugAssert(inserted->bin_count() == 1, "Expected the inserted values to be summarized in a single bin");
+  const auto inserted_bin = inserted->bin(BinID{0});
+  const auto bin_count = histogram->bin_count();
+  const auto last_bin_id = BinID{bin_count - 1};
+
+  auto builder = GenericHistogramBuilder<T>{bin_count, histogram->domain()};
+
+  // Inserted values are often larger than all previous ones (e.g., for ascending keys or dates). They are added to the
+  // outer bin, which is widened accordingly. Adding a new bin per delta instead would fill the histogram with tiny bins.
+  if (inserted_bin.min > histogram->bin_maximum(last_bin_id)) {
+    const auto last_bin = histogram->bin(last_bin_id);
+    builder.add_copied_bins(*histogram, BinID{0}, last_bin_id);
+    builder.add_bin(last_bin.min, inserted_bin.max, last_bin.height + inserted_bin.height,
+                    last_bin.distinct_count + inserted_bin.distinct_count);
+    return builder.build();
+  }
+
+  if (inserted_bin.max < histogram->bin_minimum(BinID{0})) {
+    const auto first_bin = histogram->bin(BinID{0});
+    builder.add_bin(inserted_bin.min, first_bin.max, first_bin.height + inserted_bin.height,
+                    first_bin.distinct_count + inserted_bin.distinct_count);
+    builder.add_copied_bins(*histogram, BinID{1}, bin_count);
+    return builder.build();
+  }
+
+  // Otherwise, distribute the inserted values over the existing bins in proportion to their heights and widen the
+  // outer bins so that the histogram covers all inserted values.
+  const auto total_count = histogram->total_count();
+  for (auto bin_id = BinID{0}; bin_id < bin_count; ++bin_id) {
+    const auto bin = histogram->bin(bin_id);
+    const auto share = total_count > 0 ? bin.height / total_count : 1.0f / static_cast<HistogramCountType>(bin_count);
+
+    const auto min = bin_id == 0 ? std::min(bin.min, inserted_bin.min) : bin.min;
+    const auto max = bin_id == last_bin_id ? std::max(bin.max, inserted_bin.max) : bin.max;
+    const auto height = bin.height + inserted_bin.height * share;
+    const auto distinct_count = std::min(height, bin.distinct_count + inserted_bin.distinct_count * share);
+    builder.add_bin(min, max, height, distinct_count);
+  }
+
+  return builder.build();
+}
+
+// The values sampled from one chunk of a column.
+template <typename T>
+struct ChunkSample {
+  std::vector<T> values;
+  size_t non_null_count{0};
+  size_t row_count{0};
+};
+
+template <typename T>
+ChunkSample<T> sample_segment(const AbstractSegment& segment, const ChunkOffset values_per_chunk, const uint32_t seed) {
+  auto sample = ChunkSample<T>{};
+  sample.row_count = segment.size();
+  sample.values.reserve(std::min(static_cast<size_t>(values_per_chunk), sample.row_count));
+
+  // Reservoir sampling (Vitter's Algorithm R): the i-th non-NULL value replaces a random sampled value with a
+  // probability of values_per_chunk / i.
+  auto random_engine = std::mt19937{seed};
+  segment_iterate<T>(segment, [&](const auto& position) {
+    if (position.is_null()) return;
+
+    ++sample.non_null_count;
+    if (sample.values.size() < values_per_chunk) {
+      sample.values.emplace_back(position.value());
+      return;
+    }
+
+    const auto replaced_index = std::uniform_int_distribution<size_t>{0, sample.non_null_count - 1}(random_engine);
+    if (replaced_index < values_per_chunk) {
+      sample.values[replaced_index] = position.value();
+    }
+  });
+
+  return sample;
+}
+
+// Runs @param function for the indices 0..@param count-1 in parallel. Like in TableStatistics::from_table(), threads
+// are used instead of JobTasks so that statistics are built in parallel even without a scheduler.
+template <typename Functor>
+void parallel_for_each_index(const size_t count, const Functor& function) {
+  auto next_index = std::atomic_size_t{0};
+  auto threads = std::vector<std::thread>{};
+  const auto thread_count = std::min(count, static_cast<size_t>(std::thread::hardware_concurrency()) + 1);
+  for (auto thread_id = size_t{0}; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&] {
+      for (auto index = next_index++; index < count; index = next_index++) {
+        function(index);
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+template <typename T>
+std::shared_ptr<AttributeStatistics<T>> sampled_attribute_statistics(const Table& table, const ColumnID column_id,
+                                                                     const std::vector<ChunkID>& sampled_chunk_ids,
+                                                                     const StatisticsSamplingConfig& sampling_config,
+                                                                     const BinID max_bin_count) {
+  auto chunk_samples = std::vector<ChunkSample<T>>(sampled_chunk_ids.size());
+  parallel_for_each_index(sampled_chunk_ids.size(), [&](const size_t sample_id) {
+    const auto chunk_id = sampled_chunk_ids[sample_id];
+    const auto& segment = *table.get_chunk(chunk_id)->get_segment(column_id);
+    chunk_samples[sample_id] = sample_segment<T>(segment, sampling_config.values_per_chunk,
+                                                 sampling_config.seed + static_cast<uint32_t>(chunk_id));
+  });
+
+  const auto output_statistics = std::make_shared<AttributeStatistics<T>>();
+
+  auto sampled_row_count = size_t{0};
+  auto sampled_non_null_count = size_t{0};
+  auto sample_size = size_t{0};
+  for (const auto& chunk_sample : chunk_samples) {
+    sampled_row_count += chunk_sample.row_count;
+    sampled_non_null_count += chunk_sample.non_null_count;
+    sample_size += chunk_sample.values.size();
+  }
+
+  const auto null_value_ratio =
+      sampled_row_count == 0 ? 0.0f : 1.0f - static_cast<float>(sampled_non_null_count) / sampled_row_count;
+  output_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(null_value_ratio));
+
+  if (sample_size == 0) return output_statistics;
+
+  // A sampled value stands for the values of its chunk that were not sampled and for the unsampled chunks.
+  const auto row_scale = static_cast<HistogramCountType>(table.row_count()) / static_cast<float>(sampled_row_count);
+  const auto value_count = static_cast<HistogramCountType>(sampled_non_null_count) * row_scale;
+
+  struct SampledValue {
+    HistogramCountType weight{0};
+    size_t occurrence_count{0};
+  };
+  auto sampled_values = std::unordered_map<T, SampledValue>{};
+  const auto domain = HistogramDomain<T>{};
+  for (const auto& chunk_sample : chunk_samples) {
+    if (chunk_sample.values.empty()) continue;
+
+    const auto weight = static_cast<HistogramCountType>(chunk_sample.non_null_count) /
+                        static_cast<HistogramCountType>(chunk_sample.values.size()) * row_scale;
+    for (const auto& value : chunk_sample.values) {
+      auto& sampled_value = [&]() -> SampledValue& {
+        if constexpr (std::is_same_v<T, pmr_string>) {
+          return sampled_values[domain.string_to_domain(value)];
+        } else {
+          return sampled_values[value];
+        }
+      }();
+      sampled_value.weight += weight;
+      ++sampled_value.occurrence_count;
+    }
+  }
+
+  // Dictionary segments allow for an exact sketch at the cost of reading the dictionaries of all chunks. Otherwise,
+  // the number of distinct values is extrapolated from the sample with the GEE estimator (Charikar et al.: "Towards
+  // Estimation Error Guarantees for Distinct Values", PODS 2000): values seen once in the sample stand for
+  // sqrt(value_count / sample_size) values each, values seen more often are assumed to be found by the sample.
+  const auto chunk_count = table.chunk_count();
+  auto distinct_count_sketch = std::make_shared<HyperLogLogSketch<T>>(value_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count && distinct_count_sketch; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto& segment = chunk->get_segment(column_id);
+    if (std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+      distinct_count_sketch->add_segment(*segment);
+    } else {
+      distinct_count_sketch = nullptr;
+    }
+  }
+
+  const auto sampled_distinct_count = static_cast<HistogramCountType>(sampled_values.size());
+  auto distinct_count = HistogramCountType{0};
+  if (distinct_count_sketch) {
+    output_statistics->set_statistics_object(distinct_count_sketch);
+    distinct_count = std::max(distinct_count_sketch->estimate_distinct_count(), sampled_distinct_count);
+  } else {
+    const auto singleton_count = static_cast<HistogramCountType>(
+        std::count_if(sampled_values.cbegin(), sampled_values.cend(),
+                      [](const auto& sampled_value) { return sampled_value.second.occurrence_count == 1; }));
+    const auto singleton_scale = std::sqrt(value_count / static_cast<HistogramCountType>(sample_size));
+    distinct_count = std::min(value_count, singleton_scale * singleton_count + sampled_distinct_count - singleton_count);
+  }
+  const auto distinct_scale = distinct_count / sampled_distinct_count;
+
+  // As in EqualDistinctCountHistogram::from_column(), the sampled distinct values are split evenly among the bins.
+  auto sorted_values = std::vector<std::pair<T, SampledValue>>{sampled_values.begin(), sampled_values.end()};
+  std::sort(sorted_values.begin(), sorted_values.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+  const auto bin_count = std::min(max_bin_count, static_cast<BinID>(sorted_values.size()));
+  auto builder = GenericHistogramBuilder<T>{bin_count, domain};
+  auto begin_index = size_t{0};
+  for (auto bin_id = BinID{0}; bin_id < bin_count; ++bin_id) {
+    const auto end_index = (bin_id + 1) * sorted_values.size() / bin_count;
+
+    auto height = HistogramCountType{0};
+    for (auto index = begin_index; index < end_index; ++index) {
+      height += sorted_values[index].second.weight;
+    }
+    const auto bin_distinct_count = static_cast<HistogramCountType>(end_index - begin_index) * distinct_scale;
+
+    builder.add_bin(sorted_values[begin_index].first, sorted_values[end_index - 1].first, height,
+                    std::min(height, bin_distinct_count));
+    begin_index = end_index;
+  }
+  output_statistics->set_statistics_object(builder.build());
+
+  return output_statistics;
+}
+
+std::shared_ptr<TableStatistics> sampled_table_statistics(const Table& table,
+                                                          const StatisticsSamplingConfig& sampling_config,
+                                                          const BinID max_bin_count) {
+  auto chunk_ids = std::vector<ChunkID>{};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (chunk && chunk->size() > 0) chunk_ids.emplace_back(chunk_id);
+  }
+
+  const auto sampled_chunk_count = std::min(
+      chunk_ids.size(),
+      std::max(size_t{1}, static_cast<size_t>(std::ceil(sampling_config.chunk_sample_ratio * chunk_ids.size()))));
+  auto sampled_chunk_ids = std::vector<ChunkID>{};
+  sampled_chunk_ids.reserve(sampled_chunk_count);
+  std::sample(chunk_ids.cbegin(), chunk_ids.cend(), std::back_inserter(sampled_chunk_ids), sampled_chunk_count,
+              std::mt19937{sampling_config.seed});
+
+  // The chunks are sampled in parallel. Columns are processed one after another, so that only the sample of a single
+  // column is kept in memory.
+  const auto column_count = table.column_count();
+  auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      column_statistics[column_id] = sampled_attribute_statistics<ColumnDataType>(
+          table, column_id, sampled_chunk_ids, sampling_config, max_bin_count);
+    });
+  }
+
+  return std::make_shared<TableStatistics>(std::move(column_statistics), table.row_count());
+}
+
+}  // namespace
+
 namespace opossum {
 
-std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table) {
+std::shared_ptr<TableStatistics> TableStatistics::from_table(
+    const Table& table, const std::optional<StatisticsSamplingConfig>& sampling_config) {
   std::vector<std::shared_ptr<BaseAttributeStatistics>> column_statistics(table.column_count());
 
   /**
@@ -20,6 +291,10 @@ std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table)
    */
   const auto histogram_bin_count = std::min<size_t>(100, std::max<size_t>(5, table.row_count() / 2'000));
 
+  if (sampling_config && table.row_count() >= sampling_config->min_row_count) {
+    return sampled_table_statistics(table, *sampling_config, static_cast<BinID>(histogram_bin_count));
+  }
+
   auto next_column_id = std::atomic_size_t{0u};
   auto threads = std::vector<std::thread>{};
 
@@ -48,6 +323,17 @@ std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table)
           if (histogram) {
             output_column_statistics->set_statistics_object(histogram);
 
+            // The sketch is built segment by segment, so that dictionary segments only need to hash their dictionary.
+            const auto distinct_count_sketch =
+                std::make_shared<HyperLogLogSketch<ColumnDataType>>(static_cast<Cardinality>(histogram->total_count()));
+            const auto chunk_count = table.chunk_count();
+            for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+              const auto chunk = table.get_chunk(chunk_id);
+              if (!chunk) continue;
+              distinct_count_sketch->add_segment(*chunk->get_segment(my_column_id));
+            }
+            output_column_statistics->set_statistics_object(distinct_count_sketch);
+
             // Use the insight that the histogram will only contain non-null values to generate the NullValueRatio
             // property
             const auto null_value_ratio =
@@ -84,6 +370,61 @@ DataType TableStatistics::column_data_type(const ColumnID column_id) const {
   return column_statistics[column_id]->data_type;
 }
 
+std::shared_ptr<TableStatistics> TableStatistics::with_inserted_rows(
+    const TableStatistics& inserted_rows_statistics) const {
+  const auto column_count = column_statistics.size();
+  Assert(inserted_rows_statistics.column_statistics.size() == column_count, "Column count mismatch");
+
+  const auto inserted_row_count = inserted_rows_statistics.row_count;
+  const auto output_row_count = row_count + inserted_row_count;
+
+  auto output_column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>(column_count);
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    DebugAssert(inserted_rows_statistics.column_data_type(column_id) == column_data_type(column_id),
+                "Data type mismatch");
+
+    resolve_data_type(column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto& attribute_statistics =
+          static_cast<const AttributeStatistics<ColumnDataType>&>(*column_statistics[column_id]);
+      const auto& inserted_attribute_statistics = static_cast<const AttributeStatistics<ColumnDataType>&>(
+          *inserted_rows_statistics.column_statistics[column_id]);
+
+      const auto output_attribute_statistics = std::make_shared<AttributeStatistics<ColumnDataType>>();
+      output_attribute_statistics->set_statistics_object(
+          histogram_with_inserted_bin(attribute_statistics.histogram, inserted_attribute_statistics.histogram));
+
+      // Without a sketch for the existing values, the sketch of the inserted values alone would be misleading.
+      if (const auto& sketch = attribute_statistics.distinct_count_sketch) {
+        const auto output_sketch = std::make_shared<HyperLogLogSketch<ColumnDataType>>(sketch->registers(),
+                                                                                       sketch->value_count);
+        if (inserted_attribute_statistics.distinct_count_sketch) {
+          output_sketch->merge(*inserted_attribute_statistics.distinct_count_sketch);
+        }
+        output_attribute_statistics->set_statistics_object(output_sketch);
+      }
+
+      // Weight the NULL value ratios by the row counts. Missing ratios are treated as "no NULLs".
+      const auto null_value_ratio =
+          attribute_statistics.null_value_ratio ? attribute_statistics.null_value_ratio->ratio : 0.0f;
+      const auto inserted_null_value_ratio =
+          inserted_attribute_statistics.null_value_ratio ? inserted_attribute_statistics.null_value_ratio->ratio : 0.0f;
+      const auto output_null_value_ratio =
+          output_row_count == 0
+              ? 0.0f
+              : (null_value_ratio * row_count + inserted_null_value_ratio * inserted_row_count) / output_row_count;
+      output_attribute_statistics->set_statistics_object(
+          std::make_shared<NullValueRatioStatistics>(output_null_value_ratio));
+
+      output_column_statistics[column_id] = output_attribute_statistics;
+    });
+  }
+
+  return std::make_shared<TableStatistics>(std::move(output_column_statistics), output_row_count);
+}
+
 std::ostream& operator<<(std::ostream& stream, const TableStatistics& table_statistics) {
   stream << "TableStatistics {" << std::endl;
   stream << "  RowCount: " << table_statistics.row_count << "; " << std::endl;
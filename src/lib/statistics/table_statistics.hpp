@@ -14,6 +14,25 @@ namespace opossum {
 class BaseAttributeStatistics;
 class Table;
 
+/**
+ * Configures TableStatistics::from_table() to build the statistics of large tables from a sample instead of all
+ * values. Whole chunks are sampled (block sampling), as skipping chunks is what saves time for encoded segments.
+ * Within each sampled chunk, a uniform sample of at most values_per_chunk values is drawn per column (reservoir
+ * sampling), which bounds the memory used for the sample.
+ */
+struct StatisticsSamplingConfig {
+  // Tables with fewer rows are not sampled.
+  uint64_t min_row_count{10'000'000};
+
+  // Fraction of the chunks that are sampled. At least one chunk is sampled.
+  float chunk_sample_ratio{0.1f};
+
+  ChunkOffset values_per_chunk{10'000};
+
+  // Makes the samples, and thus the statistics, reproducible.
+  uint32_t seed{42};
+};
+
 /**
  * Container for all cardinality estimation statistics gathered about a Table. Also used to represent the estimation of
  * a temporary Table during Optimization.
@@ -22,9 +41,11 @@ class TableStatistics {
  public:
   /**
    * Creates statistics objects for cardinality estimation for all Columns in @param table. See implementation for
-   * which statistics objects are created.
+   * which statistics objects are created. If @param sampling_config is given and the table is large enough, the
+   * statistics are extrapolated from a sample (see StatisticsSamplingConfig).
    */
-  static std::shared_ptr<TableStatistics> from_table(const Table& table);
+  static std::shared_ptr<TableStatistics> from_table(
+      const Table& table, const std::optional<StatisticsSamplingConfig>& sampling_config = std::nullopt);
 
   TableStatistics(std::vector<std::shared_ptr<BaseAttributeStatistics>>&& init_column_statistics,
                   const Cardinality init_row_count);
@@ -34,6 +55,15 @@ class TableStatistics {
    */
   DataType column_data_type(const ColumnID column_id) const;
 
+  /**
+   * Returns a copy of these statistics that additionally covers the rows summarized by @param inserted_rows_statistics
+   * (see TableStatisticsDelta). This is only an approximation: inserted values outside of a histogram's range are
+   * added to the outer bin, all others are distributed over the existing bins in proportion to their heights. To
+   * correct the distribution, the StatisticsRefresher periodically rebuilds the statistics of tables that changed
+   * noticeably.
+   */
+  std::shared_ptr<TableStatistics> with_inserted_rows(const TableStatistics& inserted_rows_statistics) const;
+
   const std::vector<std::shared_ptr<BaseAttributeStatistics>> column_statistics;
   Cardinality row_count;
 };
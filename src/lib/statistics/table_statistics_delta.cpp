@@ -0,0 +1,122 @@
+#include "table_statistics_delta.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+
+#include "attribute_statistics.hpp"
+#include "resolve_type.hpp"
+#include "statistics/statistics_objects/generic_histogram.hpp"
+#include "statistics/statistics_objects/histogram_domain.hpp"
+#include "statistics/statistics_objects/hyper_log_log_sketch.hpp"
+#include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
+#include "storage/chunk.hpp"
+#include "storage/value_segment.hpp"
+#include "table_statistics.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+class TableStatisticsDelta::ColumnDelta : public TableStatisticsDelta::BaseColumnDelta {
+ public:
+  void add_values(const AbstractSegment& segment, const ChunkOffset begin_chunk_offset,
+                  const ChunkOffset end_chunk_offset) override {
+    const auto* value_segment = dynamic_cast<const ValueSegment<T>*>(&segment);
+    Assert(value_segment, "Expected inserted rows to be stored in ValueSegments");
+
+    // The sketch is only allocated once values are added, so that tables without inserts do not pay for it.
+    if (!_distinct_count_sketch) _distinct_count_sketch = std::make_shared<HyperLogLogSketch<T>>();
+
+    const auto& values = value_segment->values();
+    const auto is_nullable = value_segment->is_nullable();
+    for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+      if (is_nullable && value_segment->null_values()[chunk_offset]) continue;
+
+      const auto& value = values[chunk_offset];
+      if (!_min || value < *_min) _min = value;
+      if (!_max || value > *_max) _max = value;
+      _distinct_count_sketch->add(value);
+      ++_value_count;
+    }
+  }
+
+  std::shared_ptr<BaseAttributeStatistics> take(const Cardinality row_count) override {
+    const auto attribute_statistics = std::make_shared<AttributeStatistics<T>>();
+
+    if (_value_count > 0) {
+      auto min = *_min;
+      auto max = *_max;
+
+      // Histograms on strings only store strings that are part of their domain, see EqualDistinctCountHistogram.
+      if constexpr (std::is_same_v<T, pmr_string>) {
+        const auto domain = HistogramDomain<pmr_string>{};
+        min = domain.string_to_domain(min);
+        max = domain.string_to_domain(max);
+      }
+
+      const auto value_count = static_cast<HistogramCountType>(_value_count);
+      _distinct_count_sketch->value_count = value_count;
+      const auto distinct_count = std::min(value_count, _distinct_count_sketch->estimate_distinct_count());
+
+      attribute_statistics->set_statistics_object(
+          GenericHistogram<T>::with_single_bin(min, max, value_count, distinct_count));
+      attribute_statistics->set_statistics_object(std::move(_distinct_count_sketch));
+    }
+
+    const auto null_value_ratio =
+        row_count == 0 ? 0.0f : 1.0f - static_cast<float>(_value_count) / static_cast<float>(row_count);
+    attribute_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(null_value_ratio));
+
+    _min.reset();
+    _max.reset();
+    _value_count = 0;
+    _distinct_count_sketch = nullptr;
+
+    return attribute_statistics;
+  }
+
+ private:
+  std::optional<T> _min;
+  std::optional<T> _max;
+  size_t _value_count{0};
+  std::shared_ptr<HyperLogLogSketch<T>> _distinct_count_sketch;
+};
+
+TableStatisticsDelta::TableStatisticsDelta(const TableColumnDefinitions& column_definitions) {
+  _column_deltas.reserve(column_definitions.size());
+  for (const auto& column_definition : column_definitions) {
+    resolve_data_type(column_definition.data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      _column_deltas.emplace_back(std::make_unique<ColumnDelta<ColumnDataType>>());
+    });
+  }
+}
+
+void TableStatisticsDelta::add_rows(const Chunk& chunk, const ChunkOffset begin_chunk_offset,
+                                    const ChunkOffset end_chunk_offset) {
+  DebugAssert(chunk.column_count() == _column_deltas.size(), "Column count mismatch");
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  for (auto column_id = ColumnID{0}; column_id < _column_deltas.size(); ++column_id) {
+    _column_deltas[column_id]->add_values(*chunk.get_segment(column_id), begin_chunk_offset, end_chunk_offset);
+  }
+  _row_count += end_chunk_offset - begin_chunk_offset;
+}
+
+std::shared_ptr<TableStatistics> TableStatisticsDelta::take() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  if (_row_count == 0) return nullptr;
+
+  const auto row_count = static_cast<Cardinality>(_row_count);
+  auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>{};
+  column_statistics.reserve(_column_deltas.size());
+  for (const auto& column_delta : _column_deltas) {
+    column_statistics.emplace_back(column_delta->take(row_count));
+  }
+  _row_count = 0;
+
+  return std::make_shared<TableStatistics>(std::move(column_statistics), row_count);
+}
+
+}  // namespace opossum
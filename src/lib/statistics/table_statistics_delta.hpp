@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "storage/table_column_definition.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+class BaseAttributeStatistics;
+class Chunk;
+class TableStatistics;
+
+/**
+ * Collects the rows committed by Inserts into a table until the StatisticsRefresher merges them into the table's
+ * statistics (see TableStatistics::with_inserted_rows). Rebuilding histograms on every commit would put expensive work
+ * on the commit path of small transactions. Adding rows to the delta is cheap instead: per column, only the minimum,
+ * the maximum, the number of non-NULL values, and a HyperLogLogSketch are updated.
+ */
+class TableStatisticsDelta : private Noncopyable {
+ public:
+  explicit TableStatisticsDelta(const TableColumnDefinitions& column_definitions);
+
+  // Adds the rows [begin_chunk_offset, end_chunk_offset) of @param chunk, which consists of ValueSegments.
+  void add_rows(const Chunk& chunk, const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset);
+
+  /**
+   * Returns statistics with a single histogram bin, the NullValueRatio, and a HyperLogLogSketch per column that cover
+   * the rows added since the last call, and resets the delta. Returns nullptr if no rows have been added.
+   */
+  std::shared_ptr<TableStatistics> take();
+
+ protected:
+  struct BaseColumnDelta {
+    virtual ~BaseColumnDelta() = default;
+    virtual void add_values(const AbstractSegment& segment, const ChunkOffset begin_chunk_offset,
+                            const ChunkOffset end_chunk_offset) = 0;
+    virtual std::shared_ptr<BaseAttributeStatistics> take(const Cardinality row_count) = 0;
+  };
+
+  template <typename T>
+  class ColumnDelta;
+
+  std::mutex _mutex;
+  uint64_t _row_count{0};
+  std::vector<std::unique_ptr<BaseColumnDelta>> _column_deltas;
+};
+
+}  // namespace opossum
@@ -39,6 +39,7 @@ Chunk::Chunk(Segments segments, const std::shared_ptr<MvccData>& mvcc_data,
   }
 
   if (alloc) _alloc = *alloc;
+  _reserved_row_count = size();
 }
 
 bool Chunk::is_mutable() const { return _is_mutable; }
@@ -67,6 +68,19 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
     DebugAssert(base_value_segment, "Can't append to segment that is not a ValueSegment");
     base_value_segment->append(*value_it);
   }
+
+  ++_reserved_row_count;
+}
+
+std::pair<ChunkOffset, ChunkOffset> Chunk::reserve_rows(const ChunkOffset row_count, const ChunkOffset capacity) {
+  auto begin = _reserved_row_count.load();
+  auto end = begin;
+  do {
+    if (begin >= capacity) return {begin, begin};
+    end = static_cast<ChunkOffset>(std::min(uint64_t{begin} + row_count, uint64_t{capacity}));
+  } while (!_reserved_row_count.compare_exchange_weak(begin, end));
+
+  return {begin, end};
 }
 
 std::shared_ptr<AbstractSegment> Chunk::get_segment(ColumnID column_id) const {
@@ -8,6 +8,7 @@
 #include <optional>
 #include <shared_mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <boost/container/pmr/memory_resource.hpp>
@@ -71,6 +72,14 @@ class Chunk : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
+  /**
+   * Reserves up to row_count rows at the end of this chunk, which holds at most capacity rows. Returns the reserved
+   * range [begin, end) of chunk offsets, which is empty if the chunk is full. Unlike append(), this is thread-safe and
+   * used by concurrent Inserts. The reserved rows only become part of the chunk (i.e., of size()) once the Insert grows
+   * the segments, which Inserts do in the order of their reservations (see Insert::_on_execute).
+   */
+  std::pair<ChunkOffset, ChunkOffset> reserve_rows(ChunkOffset row_count, ChunkOffset capacity);
+
   /**
    * Atomically accesses and returns the segment at a given position
    *
@@ -196,10 +205,13 @@ class Chunk : private Noncopyable {
   std::shared_ptr<MvccData> _mvcc_data;
   Indexes _indexes;
   std::optional<ChunkPruningStatistics> _pruning_statistics;
-  bool _is_mutable = true;
+  std::atomic_bool _is_mutable{true};
   std::vector<SortColumnDefinition> _sorted_by;
   mutable std::atomic<ChunkOffset> _invalid_row_count{0};
 
+  // Number of rows that are either part of the chunk or reserved by an Insert, see reserve_rows()
+  std::atomic<ChunkOffset> _reserved_row_count{0};
+
   // Default value of zero means "not set"
   std::atomic<CommitID> _cleanup_commit_id{0};
   static_assert(std::is_same<uint32_t, CommitID>::value, "Type of _cleanup_commit_id does not match type of CommitID.");
@@ -16,6 +16,8 @@ class AttributeVectorIterable : public PointAccessibleSegmentIterable<AttributeV
         _null_value_id{null_value_id},
         _access_counter(segment.access_counter) {}
 
+  // Sequential iteration uses the iterators of the compressed vector, which decode values in blocks if possible (see
+  // BitPackingIterator). Thus, scans over the codes should prefer this over point access.
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
     resolve_compressed_vector_type(_attribute_vector, [&](const auto& vector) {
@@ -23,12 +23,21 @@ namespace opossum {
 
 namespace hana = boost::hana;
 
-enum class EncodingType : uint8_t { Unencoded, Dictionary, RunLength, FixedStringDictionary, FrameOfReference, LZ4 };
+enum class EncodingType : uint8_t {
+  Unencoded,
+  Dictionary,
+  RunLength,
+  FixedStringDictionary,
+  FrameOfReference,
+  LZ4,
+  FSST
+};
 
 inline static std::vector<EncodingType> encoding_type_enum_values{
     EncodingType::Unencoded,        EncodingType::Dictionary,
     EncodingType::RunLength,        EncodingType::FixedStringDictionary,
-    EncodingType::FrameOfReference, EncodingType::LZ4};
+    EncodingType::FrameOfReference, EncodingType::LZ4,
+    EncodingType::FSST};
 
 /**
  * @brief Maps each encoding type to its supported data types
@@ -44,7 +53,8 @@ constexpr auto supported_data_types_for_encoding_type = hana::make_map(
     hana::make_pair(enum_c<EncodingType, EncodingType::RunLength>, data_types),
     hana::make_pair(enum_c<EncodingType, EncodingType::FixedStringDictionary>, hana::tuple_t<pmr_string>),
     hana::make_pair(enum_c<EncodingType, EncodingType::FrameOfReference>, hana::tuple_t<int32_t>),
-    hana::make_pair(enum_c<EncodingType, EncodingType::LZ4>, data_types));
+    hana::make_pair(enum_c<EncodingType, EncodingType::LZ4>, data_types),
+    hana::make_pair(enum_c<EncodingType, EncodingType::FSST>, hana::tuple_t<pmr_string>));
 
 /**
  * @return an integral constant implicitly convertible to bool
@@ -82,6 +92,7 @@ using ChunkEncodingSpec = std::vector<SegmentEncodingSpec>;
 
 inline constexpr std::array all_encoding_types{EncodingType::Unencoded,        EncodingType::Dictionary,
                                                EncodingType::FrameOfReference, EncodingType::FixedStringDictionary,
-                                               EncodingType::RunLength,        EncodingType::LZ4};
+                                               EncodingType::RunLength,        EncodingType::LZ4,
+                                               EncodingType::FSST};
 
 }  // namespace opossum
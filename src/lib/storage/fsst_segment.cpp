@@ -0,0 +1,104 @@
+#include "fsst_segment.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T, typename U>
+FSSTSegment<T, U>::FSSTSegment(FSSTSymbolTable symbol_table, pmr_vector<uint8_t> compressed_values,
+                               std::unique_ptr<const BaseCompressedVector> offsets,
+                               std::optional<pmr_vector<bool>> null_values)
+    : AbstractEncodedSegment{data_type_from_type<T>()},
+      _symbol_table{std::move(symbol_table)},
+      _compressed_values{std::move(compressed_values)},
+      _offsets{std::move(offsets)},
+      _null_values{std::move(null_values)},
+      _decompressor{_offsets->create_base_decompressor()} {
+  Assert(_offsets->size() > 0, "Expected an offset for the end of the last value");
+  Assert(!_null_values || _null_values->size() == _offsets->size() - 1, "Expected a null flag for each value");
+}
+
+template <typename T, typename U>
+const FSSTSymbolTable& FSSTSegment<T, U>::symbol_table() const {
+  return _symbol_table;
+}
+
+template <typename T, typename U>
+const pmr_vector<uint8_t>& FSSTSegment<T, U>::compressed_values() const {
+  return _compressed_values;
+}
+
+template <typename T, typename U>
+const BaseCompressedVector& FSSTSegment<T, U>::offsets() const {
+  return *_offsets;
+}
+
+template <typename T, typename U>
+const std::optional<pmr_vector<bool>>& FSSTSegment<T, U>::null_values() const {
+  return _null_values;
+}
+
+template <typename T, typename U>
+AllTypeVariant FSSTSegment<T, U>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T, typename U>
+ChunkOffset FSSTSegment<T, U>::size() const {
+  return static_cast<ChunkOffset>(_offsets->size() - 1);
+}
+
+template <typename T, typename U>
+std::shared_ptr<AbstractSegment> FSSTSegment<T, U>::copy_using_allocator(
+    const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_symbol_table = _symbol_table.copy_using_allocator(alloc);
+  auto new_compressed_values = pmr_vector<uint8_t>(_compressed_values, alloc);
+  auto new_offsets = _offsets->copy_using_allocator(alloc);
+
+  std::optional<pmr_vector<bool>> null_values;
+  if (_null_values) {
+    null_values = pmr_vector<bool>(*_null_values, alloc);
+  }
+
+  auto copy = std::make_shared<FSSTSegment>(std::move(new_symbol_table), std::move(new_compressed_values),
+                                            std::move(new_offsets), std::move(null_values));
+  copy->access_counter = access_counter;
+  return copy;
+}
+
+template <typename T, typename U>
+size_t FSSTSegment<T, U>::memory_usage(const MemoryUsageCalculationMode) const {
+  // MemoryUsageCalculationMode ignored since full calculation is efficient.
+  auto segment_size = sizeof(*this) + _symbol_table.data_size() + _compressed_values.capacity() +
+                      _offsets->data_size() + sizeof(_null_values);
+
+  if (_null_values) {
+    segment_size += _null_values->capacity() / CHAR_BIT;
+  }
+
+  return segment_size;
+}
+
+template <typename T, typename U>
+EncodingType FSSTSegment<T, U>::encoding_type() const {
+  return EncodingType::FSST;
+}
+
+template <typename T, typename U>
+std::optional<CompressedVectorType> FSSTSegment<T, U>::compressed_vector_type() const {
+  return _offsets->type();
+}
+
+template class FSSTSegment<pmr_string>;
+
+}  // namespace opossum
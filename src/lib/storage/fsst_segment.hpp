@@ -0,0 +1,90 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include "abstract_encoded_segment.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Segment implementing FSST string compression
+ *
+ * All strings of the segment are compressed with a symbol table that is built from a sample of the segment (see
+ * FSSTSymbolTable). The codes of all strings are stored consecutively. The codes of the string at position i are
+ * found in [offsets[i], offsets[i + 1]), so that the offsets vector holds one more entry than the segment has rows.
+ * The offsets are compressed using vector compression.
+ *
+ * In contrast to the LZ4Segment, each value can be decompressed on its own, which makes point accesses (e.g., after a
+ * selective scan or a join) cheap. Dictionary encoding is still preferable for columns with few distinct values.
+ *
+ * Null values are stored in a separate vector, their offsets denote empty ranges.
+ */
+template <typename T, typename = std::enable_if_t<encoding_supports_data_type(enum_c<EncodingType, EncodingType::FSST>,
+                                                                               hana::type_c<T>)>>
+class FSSTSegment : public AbstractEncodedSegment {
+ public:
+  explicit FSSTSegment(FSSTSymbolTable symbol_table, pmr_vector<uint8_t> compressed_values,
+                       std::unique_ptr<const BaseCompressedVector> offsets,
+                       std::optional<pmr_vector<bool>> null_values);
+
+  const FSSTSymbolTable& symbol_table() const;
+  const pmr_vector<uint8_t>& compressed_values() const;
+  const BaseCompressedVector& offsets() const;
+  const std::optional<pmr_vector<bool>>& null_values() const;
+
+  /**
+   * @defgroup AbstractSegment interface
+   * @{
+   */
+
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const {
+    // performance critical - not in cpp to help with inlining
+    if (_null_values && (*_null_values)[chunk_offset]) {
+      return std::nullopt;
+    }
+    const auto* codes = _compressed_values.data();
+    return _symbol_table.decode(codes + _decompressor->get(chunk_offset), codes + _decompressor->get(chunk_offset + 1));
+  }
+
+  ChunkOffset size() const final;
+
+  std::shared_ptr<AbstractSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t memory_usage(const MemoryUsageCalculationMode) const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup AbstractEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  std::optional<CompressedVectorType> compressed_vector_type() const final;
+
+  /**@}*/
+
+ private:
+  const FSSTSymbolTable _symbol_table;
+  const pmr_vector<uint8_t> _compressed_values;
+  const std::unique_ptr<const BaseCompressedVector> _offsets;
+  const std::optional<pmr_vector<bool>> _null_values;
+  std::unique_ptr<BaseVectorDecompressor> _decompressor;
+};
+
+extern template class FSSTSegment<pmr_string>;
+
+}  // namespace opossum
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "storage/base_segment_encoder.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+class FSSTEncoder : public SegmentEncoder<FSSTEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::FSST>;
+  static constexpr auto _uses_vector_compression = true;  // see base_segment_encoder.hpp for details
+
+  // The symbol table is built from a sample of roughly this many bytes. As in the paper, larger samples barely improve
+  // the compression ratio but make building the table more expensive.
+  static constexpr auto _sample_size = size_t{16384u};
+
+  std::shared_ptr<AbstractEncodedSegment> _on_encode(const AnySegmentIterable<pmr_string> segment_iterable,
+                                                     const PolymorphicAllocator<pmr_string>& allocator) {
+    auto values = std::vector<pmr_string>{};
+    auto null_values = pmr_vector<bool>{allocator};
+    auto segment_contains_null = false;
+    auto total_length = size_t{0};
+
+    segment_iterable.with_iterators([&](auto it, auto end) {
+      const auto segment_size = static_cast<size_t>(std::distance(it, end));
+      values.reserve(segment_size);
+      null_values.reserve(segment_size);
+
+      for (; it != end; ++it) {
+        const auto segment_value = *it;
+        const auto is_null = segment_value.is_null();
+        values.emplace_back(is_null ? pmr_string{} : segment_value.value());
+        null_values.push_back(is_null);
+        segment_contains_null |= is_null;
+        total_length += values.back().size();
+      }
+    });
+
+    // Sample values evenly distributed over the segment.
+    auto sample = std::vector<std::string_view>{};
+    const auto sample_step = std::max(total_length / _sample_size, size_t{1});
+    for (auto value_id = size_t{0}; value_id < values.size(); value_id += sample_step) {
+      sample.emplace_back(values[value_id]);
+    }
+
+    auto symbol_table = FSSTSymbolTable::build(sample, allocator);
+    const auto encoder = FSSTSymbolTable::Encoder{symbol_table};
+
+    auto compressed_values = pmr_vector<uint8_t>{allocator};
+    compressed_values.reserve(total_length);
+    auto offsets = pmr_vector<uint32_t>{allocator};
+    offsets.reserve(values.size() + 1);
+
+    for (const auto& value : values) {
+      offsets.push_back(static_cast<uint32_t>(compressed_values.size()));
+      encoder.encode(value, compressed_values);
+      Assert(compressed_values.size() <= std::numeric_limits<uint32_t>::max(),
+             "Compressed strings exceed the maximum of uint32 in FSST encoding.");
+    }
+    offsets.push_back(static_cast<uint32_t>(compressed_values.size()));
+    compressed_values.shrink_to_fit();
+
+    auto compressed_offsets = compress_vector(offsets, vector_compression_type(), allocator, {offsets.back()});
+
+    auto optional_null_values =
+        segment_contains_null ? std::optional<pmr_vector<bool>>{std::move(null_values)} : std::nullopt;
+
+    return std::make_shared<FSSTSegment<pmr_string>>(std::move(symbol_table), std::move(compressed_values),
+                                                     std::move(compressed_offsets), std::move(optional_null_values));
+  }
+};
+
+}  // namespace opossum
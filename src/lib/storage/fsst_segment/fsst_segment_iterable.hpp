@@ -0,0 +1,157 @@
+#pragma once
+
+#include <type_traits>
+
+#include "storage/abstract_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/segment_iterables.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace opossum {
+
+template <typename T>
+class FSSTSegmentIterable : public PointAccessibleSegmentIterable<FSSTSegmentIterable<T>> {
+ public:
+  using ValueType = T;
+
+  explicit FSSTSegmentIterable(const FSSTSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += _segment.size();
+    resolve_compressed_vector_type(_segment.offsets(), [&](const auto& offsets) {
+      using OffsetDecompressor = std::decay_t<decltype(offsets.create_decompressor())>;
+
+      auto begin = Iterator<OffsetDecompressor>{&_segment.symbol_table(), &_segment.compressed_values(),
+                                                &_segment.null_values(), offsets.create_decompressor(),
+                                                ChunkOffset{0}};
+
+      auto end = Iterator<OffsetDecompressor>{&_segment.symbol_table(), &_segment.compressed_values(),
+                                              &_segment.null_values(), offsets.create_decompressor(),
+                                              static_cast<ChunkOffset>(_segment.size())};
+
+      functor(begin, end);
+    });
+  }
+
+  template <typename Functor, typename PosListType>
+  void _on_with_iterators(const std::shared_ptr<PosListType>& position_filter, const Functor& functor) const {
+    _segment.access_counter[SegmentAccessCounter::access_type(*position_filter)] += position_filter->size();
+    resolve_compressed_vector_type(_segment.offsets(), [&](const auto& offsets) {
+      using OffsetDecompressor = std::decay_t<decltype(offsets.create_decompressor())>;
+      using PosListIteratorType = std::decay_t<decltype(position_filter->cbegin())>;
+
+      auto begin = PointAccessIterator<OffsetDecompressor, PosListIteratorType>{
+          &_segment.symbol_table(), &_segment.compressed_values(), &_segment.null_values(),
+          offsets.create_decompressor(), position_filter->cbegin(), position_filter->cbegin()};
+
+      auto end = PointAccessIterator<OffsetDecompressor, PosListIteratorType>{
+          &_segment.symbol_table(), &_segment.compressed_values(), &_segment.null_values(),
+          offsets.create_decompressor(), position_filter->cbegin(), position_filter->cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  size_t _on_size() const { return _segment.size(); }
+
+ private:
+  const FSSTSegment<T>& _segment;
+
+ private:
+  template <typename OffsetDecompressor>
+  class Iterator : public AbstractSegmentIterator<Iterator<OffsetDecompressor>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = FSSTSegmentIterable<T>;
+
+   public:
+    explicit Iterator(const FSSTSymbolTable* symbol_table, const pmr_vector<uint8_t>* compressed_values,
+                      const std::optional<pmr_vector<bool>>* null_values, OffsetDecompressor offset_decompressor,
+                      ChunkOffset chunk_offset)
+        : _symbol_table{symbol_table},
+          _compressed_values{compressed_values},
+          _null_values{null_values},
+          _offset_decompressor{std::move(offset_decompressor)},
+          _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() { ++_chunk_offset; }
+
+    void decrement() { --_chunk_offset; }
+
+    void advance(std::ptrdiff_t n) { _chunk_offset += n; }
+
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._chunk_offset) - _chunk_offset;
+    }
+
+    SegmentPosition<T> dereference() const {
+      if (*_null_values && (**_null_values)[_chunk_offset]) {
+        return SegmentPosition<T>{T{}, true, _chunk_offset};
+      }
+
+      const auto* codes = _compressed_values->data();
+      const auto begin = _offset_decompressor.get(_chunk_offset);
+      const auto end = _offset_decompressor.get(_chunk_offset + 1);
+      return SegmentPosition<T>{_symbol_table->decode(codes + begin, codes + end), false, _chunk_offset};
+    }
+
+   private:
+    const FSSTSymbolTable* _symbol_table;
+    const pmr_vector<uint8_t>* _compressed_values;
+    const std::optional<pmr_vector<bool>>* _null_values;
+    mutable OffsetDecompressor _offset_decompressor;
+    ChunkOffset _chunk_offset;
+  };
+
+  template <typename OffsetDecompressor, typename PosListIteratorType>
+  class PointAccessIterator
+      : public AbstractPointAccessSegmentIterator<PointAccessIterator<OffsetDecompressor, PosListIteratorType>,
+                                                  SegmentPosition<T>, PosListIteratorType> {
+   public:
+    using ValueType = T;
+    using IterableType = FSSTSegmentIterable<T>;
+
+    PointAccessIterator(const FSSTSymbolTable* symbol_table, const pmr_vector<uint8_t>* compressed_values,
+                        const std::optional<pmr_vector<bool>>* null_values, OffsetDecompressor offset_decompressor,
+                        PosListIteratorType position_filter_begin, PosListIteratorType position_filter_it)
+        : AbstractPointAccessSegmentIterator<PointAccessIterator<OffsetDecompressor, PosListIteratorType>,
+                                             SegmentPosition<T>, PosListIteratorType>{std::move(position_filter_begin),
+                                                                                      std::move(position_filter_it)},
+          _symbol_table{symbol_table},
+          _compressed_values{compressed_values},
+          _null_values{null_values},
+          _offset_decompressor{std::move(offset_decompressor)} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentPosition<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+      const auto current_offset = chunk_offsets.offset_in_referenced_chunk;
+
+      if (*_null_values && (**_null_values)[current_offset]) {
+        return SegmentPosition<T>{T{}, true, chunk_offsets.offset_in_poslist};
+      }
+
+      const auto* codes = _compressed_values->data();
+      const auto begin = _offset_decompressor.get(current_offset);
+      const auto end = _offset_decompressor.get(current_offset + 1);
+      return SegmentPosition<T>{_symbol_table->decode(codes + begin, codes + end), false,
+                                chunk_offsets.offset_in_poslist};
+    }
+
+   private:
+    const FSSTSymbolTable* _symbol_table;
+    const pmr_vector<uint8_t>* _compressed_values;
+    const std::optional<pmr_vector<bool>>* _null_values;
+    mutable OffsetDecompressor _offset_decompressor;
+  };
+};
+
+}  // namespace opossum
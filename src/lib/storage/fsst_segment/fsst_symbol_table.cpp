@@ -0,0 +1,150 @@
+#include "fsst_symbol_table.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+FSSTSymbolTable make_symbol_table(const std::vector<std::string>& symbols, const PolymorphicAllocator<size_t>& alloc) {
+  auto symbol_words = pmr_vector<uint64_t>(symbols.size(), alloc);
+  auto symbol_lengths = pmr_vector<uint8_t>(symbols.size(), alloc);
+  for (auto code = size_t{0}; code < symbols.size(); ++code) {
+    std::memcpy(&symbol_words[code], symbols[code].data(), symbols[code].size());
+    symbol_lengths[code] = static_cast<uint8_t>(symbols[code].size());
+  }
+  return FSSTSymbolTable{std::move(symbol_words), std::move(symbol_lengths)};
+}
+
+}  // namespace
+
+namespace opossum {
+
+FSSTSymbolTable::FSSTSymbolTable(pmr_vector<uint64_t>&& symbols, pmr_vector<uint8_t>&& symbol_lengths)
+    : _symbols(std::move(symbols)), _symbol_lengths(std::move(symbol_lengths)) {
+  Assert(_symbols.size() == _symbol_lengths.size(), "Expected a length for each symbol");
+  Assert(_symbols.size() <= MAX_SYMBOL_COUNT, "Too many symbols, the last code is reserved for escaping");
+}
+
+FSSTSymbolTable FSSTSymbolTable::build(const std::vector<std::string_view>& sample,
+                                       const PolymorphicAllocator<size_t>& allocator) {
+  // The paper found five generations to be sufficient for the symbol table to converge.
+  constexpr auto GENERATION_COUNT = 5;
+
+  auto symbols = std::vector<std::string>{};
+  for (auto generation = 0; generation < GENERATION_COUNT; ++generation) {
+    const auto symbol_table = make_symbol_table(symbols, allocator);
+    const auto encoder = Encoder{symbol_table};
+
+    // Count how often each symbol (or escaped byte) is used when compressing the sample with the current table and how
+    // often each pair of subsequent symbols occurs. The latter are the candidates for longer symbols.
+    auto counts = std::unordered_map<std::string, size_t>{};
+    for (const auto& value : sample) {
+      auto previous_length = size_t{0};
+      auto position = size_t{0};
+      while (position < value.size()) {
+        const auto code = encoder.longest_match(value.substr(position));
+        const auto length = code == ESCAPE_CODE ? size_t{1} : size_t{symbol_table._symbol_lengths[code]};
+
+        ++counts[std::string{value.substr(position, length)}];
+        if (previous_length > 0 && previous_length < MAX_SYMBOL_LENGTH) {
+          const auto concatenation_length = std::min(previous_length + length, MAX_SYMBOL_LENGTH);
+          ++counts[std::string{value.substr(position - previous_length, concatenation_length)}];
+        }
+
+        previous_length = length;
+        position += length;
+      }
+    }
+
+    // The gain of a symbol is the number of bytes of the sample that it covers. Ties are broken by the symbol itself
+    // to make the table deterministic.
+    auto candidates = std::vector<std::pair<size_t, std::string>>{};
+    candidates.reserve(counts.size());
+    for (auto& [symbol, count] : counts) {
+      candidates.emplace_back(count * symbol.size(), symbol);
+    }
+
+    const auto symbol_count = std::min(candidates.size(), MAX_SYMBOL_COUNT);
+    std::partial_sort(candidates.begin(), candidates.begin() + symbol_count, candidates.end(),
+                      [](const auto& lhs, const auto& rhs) {
+                        return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+                      });
+
+    symbols.clear();
+    for (auto candidate_id = size_t{0}; candidate_id < symbol_count; ++candidate_id) {
+      symbols.emplace_back(std::move(candidates[candidate_id].second));
+    }
+  }
+
+  return make_symbol_table(symbols, allocator);
+}
+
+pmr_string FSSTSymbolTable::decode(const uint8_t* begin, const uint8_t* end) const {
+  // Each code produces at most MAX_SYMBOL_LENGTH bytes. Thus, symbols can always be copied as a whole 64-bit word,
+  // which is faster than copying their exact length.
+  auto value = pmr_string(static_cast<size_t>(end - begin) * MAX_SYMBOL_LENGTH, '\0');
+  auto* output = value.data();
+  auto length = size_t{0};
+
+  for (auto code_it = begin; code_it < end; ++code_it) {
+    const auto code = *code_it;
+    if (code == ESCAPE_CODE) {
+      ++code_it;
+      DebugAssert(code_it < end, "Escape code must be followed by a byte");
+      output[length] = static_cast<char>(*code_it);
+      ++length;
+    } else {
+      std::memcpy(output + length, &_symbols[code], MAX_SYMBOL_LENGTH);
+      length += _symbol_lengths[code];
+    }
+  }
+
+  value.resize(length);
+  return value;
+}
+
+const pmr_vector<uint64_t>& FSSTSymbolTable::symbols() const { return _symbols; }
+
+const pmr_vector<uint8_t>& FSSTSymbolTable::symbol_lengths() const { return _symbol_lengths; }
+
+FSSTSymbolTable FSSTSymbolTable::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+  return FSSTSymbolTable{pmr_vector<uint64_t>(_symbols, alloc), pmr_vector<uint8_t>(_symbol_lengths, alloc)};
+}
+
+size_t FSSTSymbolTable::data_size() const {
+  return _symbols.capacity() * sizeof(uint64_t) + _symbol_lengths.capacity() * sizeof(uint8_t);
+}
+
+FSSTSymbolTable::Encoder::Encoder(const FSSTSymbolTable& symbol_table) : _symbol_table(symbol_table) {
+  const auto symbol_count = symbol_table._symbols.size();
+  for (auto code = size_t{0}; code < symbol_count; ++code) {
+    const auto first_byte = static_cast<uint8_t>(symbol_table._symbols[code] & 0xFFu);
+    _codes_by_first_byte[first_byte].emplace_back(static_cast<uint8_t>(code));
+  }
+
+  for (auto& codes : _codes_by_first_byte) {
+    std::stable_sort(codes.begin(), codes.end(), [&](const auto lhs, const auto rhs) {
+      return symbol_table._symbol_lengths[lhs] > symbol_table._symbol_lengths[rhs];
+    });
+  }
+}
+
+uint8_t FSSTSymbolTable::Encoder::longest_match(const std::string_view value) const {
+  DebugAssert(!value.empty(), "Cannot match an empty string");
+  for (const auto code : _codes_by_first_byte[static_cast<uint8_t>(value.front())]) {
+    const auto symbol_length = _symbol_table._symbol_lengths[code];
+    if (symbol_length <= value.size() && std::memcmp(&_symbol_table._symbols[code], value.data(), symbol_length) == 0) {
+      return code;
+    }
+  }
+  return ESCAPE_CODE;
+}
+
+}  // namespace opossum
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Symbol table of the FSST (Fast Static Symbol Table) string compression, see Boncz, Neumann, and Leis: "FSST: Fast
+ * Random Access String Compression" (VLDB 2020).
+ *
+ * A symbol is a sequence of up to eight bytes. Strings are compressed by replacing the longest symbol that matches at
+ * the current position with its one-byte code. Bytes that are not covered by any symbol are written as the escape
+ * code followed by the byte itself. As each string is compressed on its own, single values can be decompressed
+ * without touching their neighbors. Decompression only needs a lookup per code and is therefore very fast.
+ *
+ * The symbols are chosen from a sample of the values in several generations: each generation compresses the sample
+ * with the previous table and picks the most valuable symbols out of the used symbols and their concatenations.
+ */
+class FSSTSymbolTable {
+ public:
+  static constexpr auto MAX_SYMBOL_COUNT = size_t{255};
+  static constexpr auto MAX_SYMBOL_LENGTH = size_t{8};
+  static constexpr auto ESCAPE_CODE = uint8_t{255};
+
+  // Each symbol is stored in the first bytes of a 64-bit word (unused bytes are zero) together with its length.
+  FSSTSymbolTable(pmr_vector<uint64_t>&& symbols, pmr_vector<uint8_t>&& symbol_lengths);
+
+  // Selects the symbols for compressing values similar to those in @param sample.
+  static FSSTSymbolTable build(const std::vector<std::string_view>& sample,
+                               const PolymorphicAllocator<size_t>& allocator = {});
+
+  // Returns the string represented by the codes in [begin, end).
+  pmr_string decode(const uint8_t* begin, const uint8_t* end) const;
+
+  const pmr_vector<uint64_t>& symbols() const;
+  const pmr_vector<uint8_t>& symbol_lengths() const;
+
+  FSSTSymbolTable copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const;
+
+  size_t data_size() const;
+
+  // Compresses strings using the symbols of a table. The lookup structure is only needed while encoding, so that it is
+  // not part of the table itself.
+  class Encoder {
+   public:
+    explicit Encoder(const FSSTSymbolTable& symbol_table);
+
+    // Appends the codes of @param value to @param codes.
+    template <typename Codes>
+    void encode(const std::string_view value, Codes& codes) const;
+
+    // Returns the code of the longest symbol that is a prefix of @param value, or ESCAPE_CODE if there is none.
+    uint8_t longest_match(const std::string_view value) const;
+
+   private:
+    const FSSTSymbolTable& _symbol_table;
+
+    // The codes of the symbols starting with a given byte, longest symbols first.
+    std::array<std::vector<uint8_t>, 256> _codes_by_first_byte;
+  };
+
+ private:
+  pmr_vector<uint64_t> _symbols;
+  pmr_vector<uint8_t> _symbol_lengths;
+};
+
+template <typename Codes>
+void FSSTSymbolTable::Encoder::encode(const std::string_view value, Codes& codes) const {
+  auto position = size_t{0};
+  const auto value_length = value.size();
+  while (position < value_length) {
+    const auto remainder = value.substr(position);
+    const auto code = longest_match(remainder);
+    if (code == ESCAPE_CODE) {
+      codes.push_back(ESCAPE_CODE);
+      codes.push_back(static_cast<uint8_t>(remainder.front()));
+      ++position;
+    } else {
+      codes.push_back(code);
+      position += _symbol_table._symbol_lengths[code];
+    }
+  }
+}
+
+}  // namespace opossum
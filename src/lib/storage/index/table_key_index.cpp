@@ -0,0 +1,204 @@
+#include "table_key_index.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "lossless_cast.hpp"
+#include "resolve_type.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TableKeyIndex::TableKeyIndex(const Table& table, const TableKeyConstraint& key_constraint)
+    : _table{table},
+      _column_ids{key_constraint.columns().cbegin(), key_constraint.columns().cend()},
+      _key_type{key_constraint.key_type()} {
+  Assert(table.type() == TableType::Data, "Key indexes can only be created on data tables");
+  std::sort(_column_ids.begin(), _column_ids.end());
+
+  const auto key_column_count = _column_ids.size();
+  auto key = std::vector<AllTypeVariant>(key_column_count);
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    // Materialize the key columns of the chunk. Accessing the encoded segments value by value would be much slower.
+    const auto chunk_size = chunk->size();
+    auto column_values = std::vector<std::vector<AllTypeVariant>>(key_column_count);
+    for (auto key_column_index = size_t{0}; key_column_index < key_column_count; ++key_column_index) {
+      const auto column_id = _column_ids[key_column_index];
+      auto& values = column_values[key_column_index];
+      values.resize(chunk_size);
+
+      resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+          if (!position.is_null()) {
+            values[position.chunk_offset()] = position.value();
+          }
+        });
+      });
+    }
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      auto key_contains_null = false;
+      for (auto key_column_index = size_t{0}; key_column_index < key_column_count; ++key_column_index) {
+        key[key_column_index] = column_values[key_column_index][chunk_offset];
+        key_contains_null |= variant_is_null(key[key_column_index]);
+      }
+      if (key_contains_null) continue;
+
+      const auto hash = _hash(key);
+      _stripe(hash).entries.emplace(hash, RowID{chunk_id, chunk_offset});
+    }
+  }
+}
+
+const std::vector<ColumnID>& TableKeyIndex::column_ids() const { return _column_ids; }
+
+KeyConstraintType TableKeyIndex::key_type() const { return _key_type; }
+
+std::vector<RowID> TableKeyIndex::lookup(const std::vector<AllTypeVariant>& values) const {
+  Assert(values.size() == _column_ids.size(), "Expected one value per key column");
+
+  auto key = std::vector<AllTypeVariant>(values.size());
+  for (auto key_column_index = size_t{0}; key_column_index < values.size(); ++key_column_index) {
+    if (variant_is_null(values[key_column_index])) return {};
+
+    const auto value =
+        lossless_variant_cast(values[key_column_index], _table.column_data_type(_column_ids[key_column_index]));
+    if (!value) return {};
+    key[key_column_index] = *value;
+  }
+
+  const auto hash = _hash(key);
+  auto& stripe = _stripe(hash);
+  const auto lock = std::lock_guard<std::mutex>{stripe.mutex};
+
+  auto row_ids = std::vector<RowID>{};
+  const auto [entries_begin, entries_end] = stripe.entries.equal_range(hash);
+  for (auto entry_iter = entries_begin; entry_iter != entries_end; ++entry_iter) {
+    if (_row_has_key(entry_iter->second, key)) {
+      row_ids.emplace_back(entry_iter->second);
+    }
+  }
+
+  return row_ids;
+}
+
+bool TableKeyIndex::try_insert(const RowID row_id, const TransactionID transaction_id) {
+  const auto chunk = _table.get_chunk(row_id.chunk_id);
+  Assert(chunk, "Cannot index a row of a physically deleted chunk");
+
+  auto key = std::vector<AllTypeVariant>(_column_ids.size());
+  if (!_read_key(*chunk, row_id.chunk_offset, key)) return true;
+
+  const auto hash = _hash(key);
+  auto& stripe = _stripe(hash);
+  const auto lock = std::lock_guard<std::mutex>{stripe.mutex};
+
+  const auto [entries_begin, entries_end] = stripe.entries.equal_range(hash);
+  for (auto entry_iter = entries_begin; entry_iter != entries_end; ++entry_iter) {
+    if (_row_conflicts(entry_iter->second, transaction_id) && _row_has_key(entry_iter->second, key)) {
+      return false;
+    }
+  }
+
+  stripe.entries.emplace(hash, row_id);
+  return true;
+}
+
+void TableKeyIndex::erase(const RowID row_id) {
+  const auto chunk = _table.get_chunk(row_id.chunk_id);
+  if (!chunk) return;
+
+  auto key = std::vector<AllTypeVariant>(_column_ids.size());
+  if (!_read_key(*chunk, row_id.chunk_offset, key)) return;
+
+  const auto hash = _hash(key);
+  auto& stripe = _stripe(hash);
+  const auto lock = std::lock_guard<std::mutex>{stripe.mutex};
+
+  const auto [entries_begin, entries_end] = stripe.entries.equal_range(hash);
+  const auto entry_iter = std::find_if(entries_begin, entries_end,
+                                       [&](const auto& entry) { return entry.second == row_id; });
+  if (entry_iter != entries_end) {
+    stripe.entries.erase(entry_iter);
+  }
+}
+
+void TableKeyIndex::erase_chunk(const ChunkID chunk_id) {
+  // The keys of the chunk's rows might not be readable anymore, so all entries have to be looked at.
+  for (auto& stripe : _stripes) {
+    const auto lock = std::lock_guard<std::mutex>{stripe.mutex};
+    for (auto entry_iter = stripe.entries.begin(); entry_iter != stripe.entries.end();) {
+      if (entry_iter->second.chunk_id == chunk_id) {
+        entry_iter = stripe.entries.erase(entry_iter);
+      } else {
+        ++entry_iter;
+      }
+    }
+  }
+}
+
+bool TableKeyIndex::_read_key(const Chunk& chunk, const ChunkOffset chunk_offset,
+                              std::vector<AllTypeVariant>& key) const {
+  for (auto key_column_index = size_t{0}; key_column_index < _column_ids.size(); ++key_column_index) {
+    key[key_column_index] = (*chunk.get_segment(_column_ids[key_column_index]))[chunk_offset];
+    if (variant_is_null(key[key_column_index])) return false;
+  }
+  return true;
+}
+
+bool TableKeyIndex::_row_has_key(const RowID row_id, const std::vector<AllTypeVariant>& key) const {
+  const auto chunk = _table.get_chunk(row_id.chunk_id);
+  if (!chunk) return false;
+
+  for (auto key_column_index = size_t{0}; key_column_index < _column_ids.size(); ++key_column_index) {
+    if (!((*chunk->get_segment(_column_ids[key_column_index]))[row_id.chunk_offset] == key[key_column_index])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TableKeyIndex::_row_conflicts(const RowID row_id, const TransactionID transaction_id) const {
+  const auto chunk = _table.get_chunk(row_id.chunk_id);
+  if (!chunk) return false;
+
+  // Without MVCC data, all rows are visible.
+  const auto mvcc_data = chunk->mvcc_data();
+  if (!mvcc_data) return true;
+
+  const auto chunk_offset = row_id.chunk_offset;
+
+  // Deleted or rolled back
+  if (mvcc_data->get_end_cid(chunk_offset) != MvccData::MAX_COMMIT_ID) return false;
+
+  // Inserted by a transaction that has not committed yet (possibly the inserting transaction itself)
+  if (mvcc_data->get_begin_cid(chunk_offset) == MvccData::MAX_COMMIT_ID) return true;
+
+  // Committed row, which does not conflict if the inserting transaction is deleting it.
+  return mvcc_data->get_tid(chunk_offset) != transaction_id;
+}
+
+size_t TableKeyIndex::_hash(const std::vector<AllTypeVariant>& key) {
+  auto hash = size_t{0};
+  for (const auto& value : key) {
+    boost::hash_combine(hash, std::hash<AllTypeVariant>{}(value));
+  }
+  return hash;
+}
+
+TableKeyIndex::Stripe& TableKeyIndex::_stripe(const size_t hash) const { return _stripes[hash % STRIPE_COUNT]; }
+
+}  // namespace opossum
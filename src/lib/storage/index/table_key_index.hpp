@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/table_key_constraint.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+/**
+ * Table-wide hash index on the columns of a TableKeyConstraint. Unlike the chunk indexes (see AbstractIndex), it
+ * covers all chunks of a table, including the mutable ones, and is maintained by the Insert operator. It serves two
+ * purposes: point lookups (see KeyIndexScan) and the enforcement of the key constraint on insert.
+ *
+ * The index maps the hash of a key to the RowIDs of all rows with that hash, the keys themselves are not stored but
+ * read from the table when needed. Entries are not removed when rows are deleted, but only when their chunk is
+ * physically removed from the table (see GarbageCollector). Thus, lookups return all versions of a key, and the caller
+ * has to validate them (i.e., use the Validate operator). Rows with NULL in any of the key columns are not indexed, as
+ * NULLs are never equal to each other.
+ *
+ * Concurrency: The entries are distributed over a fixed number of stripes, each protected by its own mutex, so that
+ * concurrent Inserts only contend if their keys fall into the same stripe.
+ */
+class TableKeyIndex : private Noncopyable {
+ public:
+  // Indexes all existing rows of @param table. Must not run concurrently with Inserts into the table.
+  TableKeyIndex(const Table& table, const TableKeyConstraint& key_constraint);
+
+  // Key columns in ascending order. Keys passed to the index are expected in this order.
+  const std::vector<ColumnID>& column_ids() const;
+  KeyConstraintType key_type() const;
+
+  /**
+   * @return the RowIDs of all rows with the key @param values, regardless of their visibility. The values are cast to
+   *         the data types of the key columns. If that is not possible without loss, no row can match.
+   */
+  std::vector<RowID> lookup(const std::vector<AllTypeVariant>& values) const;
+
+  /**
+   * Adds the row @param row_id, whose values have to be written already, to the index - unless this would violate the
+   * key constraint, in which case false is returned. The insert violates the constraint if another row with the same
+   * key exists that is neither deleted nor rolled back. Rows with that key that are currently being deleted by the
+   * inserting transaction @param transaction_id do not count, which allows Updates to keep the key of a row.
+   * Conflicting rows inserted or deleted by transactions that have not committed yet are treated as if they committed,
+   * i.e., the first writer wins.
+   */
+  bool try_insert(const RowID row_id, const TransactionID transaction_id);
+
+  // Removes the row @param row_id (e.g., when its insert is rolled back). Does nothing if the row is not indexed.
+  void erase(const RowID row_id);
+
+  // Removes all rows of the chunk @param chunk_id, which is being physically removed from the table.
+  void erase_chunk(const ChunkID chunk_id);
+
+ protected:
+  static constexpr auto STRIPE_COUNT = size_t{64};
+
+  struct Stripe {
+    std::mutex mutex;
+    std::unordered_multimap<size_t, RowID> entries;
+  };
+
+  // Reads the key of a row. Returns false if the key contains NULL.
+  bool _read_key(const Chunk& chunk, const ChunkOffset chunk_offset, std::vector<AllTypeVariant>& key) const;
+  bool _row_has_key(const RowID row_id, const std::vector<AllTypeVariant>& key) const;
+  // Whether the row counts as an existing occurrence of its key for an insert by @param transaction_id.
+  bool _row_conflicts(const RowID row_id, const TransactionID transaction_id) const;
+
+  static size_t _hash(const std::vector<AllTypeVariant>& key);
+  Stripe& _stripe(const size_t hash) const;
+
+  const Table& _table;
+  std::vector<ColumnID> _column_ids;
+  KeyConstraintType _key_type;
+
+  mutable std::array<Stripe, STRIPE_COUNT> _stripes;
+};
+
+}  // namespace opossum
@@ -47,6 +47,9 @@ CommitID MvccData::get_end_cid(const ChunkOffset offset) const {
 void MvccData::set_end_cid(const ChunkOffset offset, const CommitID commit_id) {
   DebugAssert(offset < _end_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
   _end_cids[offset] = commit_id;
+
+  auto current_min_end_cid = min_end_cid.load();
+  while (commit_id < current_min_end_cid && !min_end_cid.compare_exchange_weak(current_min_end_cid, commit_id)) {}
 }
 
 TransactionID MvccData::get_tid(const ChunkOffset offset) const {
@@ -68,6 +71,29 @@ bool MvccData::compare_exchange_tid(const ChunkOffset offset, TransactionID expe
   return _tids[offset].compare_exchange_strong(expected_transaction_id, new_transaction_id);
 }
 
+uint32_t MvccData::get_committed_visibility_mask(const ChunkOffset begin_offset,
+                                                 const CommitID snapshot_commit_id) const {
+  DebugAssert(begin_offset + VISIBILITY_MASK_SIZE <= _begin_cids.size(),
+              "offset out of bounds; MvccData insufficently preallocated?");
+
+  const auto* const begin_cids = _begin_cids.data() + begin_offset;
+  const auto* const end_cids = _end_cids.data() + begin_offset;
+
+  auto mask = uint32_t{0};
+
+  // See AbstractTableScanImpl::_simd_scan_with_iterators for how the OpenMP pragma is used.
+  // NOLINTNEXTLINE
+  {}  // clang-format off
+  #pragma omp simd reduction(|:mask) safelen(VISIBILITY_MASK_SIZE)
+  // clang-format on
+  for (auto index = uint32_t{0}; index < VISIBILITY_MASK_SIZE; ++index) {
+    mask |= static_cast<uint32_t>((begin_cids[index] <= snapshot_commit_id) & (snapshot_commit_id < end_cids[index]))
+            << index;
+  }
+
+  return mask;
+}
+
 size_t MvccData::memory_usage() const {
   auto bytes = size_t{0};
   bytes += sizeof(_tids) + sizeof(_begin_cids) + sizeof(_end_cids);  // NOLINT
@@ -23,6 +23,17 @@ struct MvccData {
   // Validate::_on_execute for further details.
   std::optional<CommitID> max_begin_cid;
 
+  // Number of Insert operators that allocated rows in this chunk but have not yet committed or rolled back. The Insert
+  // that brings it to zero for a full chunk finalizes the chunk, see Insert::_finalize_chunk_if_completed.
+  std::atomic<uint32_t> pending_insert_count{0};
+
+  // Lowest end_cid of all rows, maintained by set_end_cid(). If it is greater than a transaction's snapshot commit id,
+  // none of the rows have been deleted (or rolled back) from the transaction's point of view.
+  std::atomic<CommitID> min_end_cid{MAX_COMMIT_ID};
+
+  // Number of rows covered by get_committed_visibility_mask()
+  static constexpr ChunkOffset VISIBILITY_MASK_SIZE = 32;
+
   // Creates MVCC data that supports a maximum of `size` rows. If the underlying chunk has less rows, the extra rows
   // here are ignored. This is to avoid resizing the vectors, which would cause reallocations and require locking.
   explicit MvccData(const size_t size, CommitID begin_commit_id);
@@ -45,6 +56,13 @@ struct MvccData {
   bool compare_exchange_tid(const ChunkOffset offset, TransactionID expected_transaction_id,
                             TransactionID new_transaction_id);
 
+  /**
+   * Returns a mask whose i-th bit is set if the row at begin_offset + i was inserted and not deleted as of
+   * snapshot_commit_id. This is the visibility of the row for a transaction that has not modified any rows itself (see
+   * Validate::is_row_visible). As it only reads the CIDs, the compiler can vectorize the check.
+   */
+  uint32_t get_committed_visibility_mask(const ChunkOffset begin_offset, const CommitID snapshot_commit_id) const;
+
   size_t memory_usage() const;
 
  private:
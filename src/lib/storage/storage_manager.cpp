@@ -18,6 +18,15 @@
 
 namespace opossum {
 
+StorageManager& StorageManager::operator=(StorageManager&& storage_manager) noexcept {
+  _tables = std::move(storage_manager._tables);
+  _table_names = std::move(storage_manager._table_names);
+  _views = std::move(storage_manager._views);
+  _prepared_plans = std::move(storage_manager._prepared_plans);
+  _statistics_sampling_config = std::move(storage_manager._statistics_sampling_config);
+  return *this;
+}
+
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
   const auto table_iter = _tables.find(name);
   const auto view_iter = _views.find(name);
@@ -27,17 +36,24 @@ void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> t
          "Cannot add table " + name + " - a view with the same name already exists");
 
   for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); chunk_id++) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
     // We currently assume that all tables stored in the StorageManager are mutable and, as such, have MVCC data. This
     // way, we do not need to check query plans if they try to update immutable tables. However, this is not a hard
     // limitation and might be changed into more fine-grained assertions if the need arises.
-    Assert(table->get_chunk(chunk_id)->has_mvcc_data(), "Table must have MVCC data.");
+    Assert(chunk->has_mvcc_data(), "Table must have MVCC data.");
   }
 
   // Create table statistics and chunk pruning statistics for added table.
 
-  table->set_table_statistics(TableStatistics::from_table(*table));
+  table->set_table_statistics(TableStatistics::from_table(*table, _statistics_sampling_config));
   generate_chunk_pruning_statistics(table);
 
+  {
+    std::unique_lock<std::shared_mutex> lock(_table_names_mutex);
+    _table_names[table.get()] = name;
+  }
   _tables[name] = std::move(table);
 }
 
@@ -46,6 +62,10 @@ void StorageManager::drop_table(const std::string& name) {
   Assert(table_iter != _tables.end() && table_iter->second, "Error deleting table. No such table named '" + name + "'");
 
   // The concurrent_unordered_map does not support concurrency-safe erasure. Thus, we simply reset the table pointer.
+  {
+    std::unique_lock<std::shared_mutex> lock(_table_names_mutex);
+    _table_names.erase(table_iter->second.get());
+  }
   _tables[name] = nullptr;
 }
 
@@ -91,6 +111,14 @@ std::unordered_map<std::string, std::shared_ptr<Table>> StorageManager::tables()
   return result;
 }
 
+std::string StorageManager::table_name(const Table& table) const {
+  std::shared_lock<std::shared_mutex> lock(_table_names_mutex);
+  const auto table_name_iter = _table_names.find(&table);
+  Assert(table_name_iter != _table_names.end(), "Table is not stored in the StorageManager");
+
+  return table_name_iter->second;
+}
+
 void StorageManager::add_view(const std::string& name, const std::shared_ptr<LQPView>& view) {
   const auto table_iter = _tables.find(name);
   const auto view_iter = _views.find(name);
@@ -194,6 +222,14 @@ std::unordered_map<std::string, std::shared_ptr<PreparedPlan>> StorageManager::p
   return result;
 }
 
+void StorageManager::set_statistics_sampling_config(const std::optional<StatisticsSamplingConfig>& sampling_config) {
+  _statistics_sampling_config = sampling_config;
+}
+
+const std::optional<StatisticsSamplingConfig>& StorageManager::statistics_sampling_config() const {
+  return _statistics_sampling_config;
+}
+
 void StorageManager::export_all_tables_as_csv(const std::string& path) {
   auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
   tasks.reserve(_tables.size());
@@ -5,12 +5,15 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <optional>
 #include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "lqp_view.hpp"
 #include "prepared_plan.hpp"
+#include "statistics/table_statistics.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -32,6 +35,10 @@ class StorageManager : public Noncopyable {
   bool has_table(const std::string& name) const;
   std::vector<std::string> table_names() const;
   std::unordered_map<std::string, std::shared_ptr<Table>> tables() const;
+
+  // Returns the name under which @param table is stored, e.g., to log modifications of the table. Fails if the table
+  // is not stored (anymore).
+  std::string table_name(const Table& table) const;
   /** @} */
 
   /**
@@ -57,6 +64,13 @@ class StorageManager : public Noncopyable {
   std::unordered_map<std::string, std::shared_ptr<PreparedPlan>> prepared_plans() const;
   /** @} */
 
+  /**
+   * If set, the statistics of large tables are built from a sample when the tables are added. Not thread-safe, should
+   * be set before the tables are added.
+   */
+  void set_statistics_sampling_config(const std::optional<StatisticsSamplingConfig>& sampling_config);
+  const std::optional<StatisticsSamplingConfig>& statistics_sampling_config() const;
+
   // For debugging purposes mostly, dump all tables as csv
   void export_all_tables_as_csv(const std::string& path);
 
@@ -64,12 +78,21 @@ class StorageManager : public Noncopyable {
   StorageManager() = default;
   friend class Hyrise;
 
+  // The mutex cannot be moved, so the move assignment used by Hyrise::reset() has to be spelled out.
+  StorageManager& operator=(StorageManager&& storage_manager) noexcept;
+
   // We preallocate maps to prevent costly re-allocation.
   static constexpr size_t _INITIAL_MAP_SIZE = 100;
 
   tbb::concurrent_unordered_map<std::string, std::shared_ptr<Table>> _tables{_INITIAL_MAP_SIZE};
+  // Reverse mapping of _tables. Unlike _tables, entries are erased when tables are dropped, so that a table that is
+  // allocated at the address of a dropped (and freed) table cannot inherit its name. Guarded by _table_names_mutex.
+  std::unordered_map<const Table*, std::string> _table_names;
+  mutable std::shared_mutex _table_names_mutex;
   tbb::concurrent_unordered_map<std::string, std::shared_ptr<LQPView>> _views{_INITIAL_MAP_SIZE};
   tbb::concurrent_unordered_map<std::string, std::shared_ptr<PreparedPlan>> _prepared_plans{_INITIAL_MAP_SIZE};
+
+  std::optional<StatisticsSamplingConfig> _statistics_sampling_config;
 };
 
 std::ostream& operator<<(std::ostream& stream, const StorageManager& storage_manager);
@@ -12,6 +12,8 @@
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/table_statistics.hpp"
+#include "statistics/table_statistics_delta.hpp"
+#include "storage/index/table_key_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -222,6 +224,10 @@ void Table::remove_chunk(ChunkID chunk_id) {
               "Physical delete of chunk prevented: Chunk needs to be fully invalidated before.");
   Assert(_type == TableType::Data, "Removing chunks from other tables than data tables is not intended yet.");
   std::atomic_store(&_chunks[chunk_id], std::shared_ptr<Chunk>(nullptr));
+
+  for (const auto& key_index : _key_indexes) {
+    key_index->erase_chunk(chunk_id);
+  }
 }
 
 void Table::append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvcc_data,  // NOLINT
@@ -313,10 +319,17 @@ std::vector<std::vector<AllTypeVariant>> Table::get_rows() const {
 
 std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
 
-std::shared_ptr<TableStatistics> Table::table_statistics() const { return _table_statistics; }
+std::shared_ptr<TableStatistics> Table::table_statistics() const { return std::atomic_load(&_table_statistics); }
 
 void Table::set_table_statistics(const std::shared_ptr<TableStatistics>& table_statistics) {
-  _table_statistics = table_statistics;
+  if (table_statistics && !table_statistics_delta()) {
+    std::atomic_store(&_table_statistics_delta, std::make_shared<TableStatisticsDelta>(_column_definitions));
+  }
+  std::atomic_store(&_table_statistics, table_statistics);
+}
+
+std::shared_ptr<TableStatisticsDelta> Table::table_statistics_delta() const {
+  return std::atomic_load(&_table_statistics_delta);
 }
 
 std::vector<IndexStatistics> Table::indexes_statistics() const { return _indexes; }
@@ -354,6 +367,28 @@ void Table::add_soft_key_constraint(const TableKeyConstraint& table_key_constrai
   }
 }
 
+void Table::create_key_index(const TableKeyConstraint& table_key_constraint) {
+  Assert(std::find(_table_key_constraints.cbegin(), _table_key_constraints.cend(), table_key_constraint) !=
+             _table_key_constraints.cend(),
+         "Key indexes can only be created for key constraints of the table.");
+  Assert(!key_index({table_key_constraint.columns().cbegin(), table_key_constraint.columns().cend()}),
+         "A key index for the same column set already exists.");
+
+  _key_indexes.emplace_back(std::make_shared<TableKeyIndex>(*this, table_key_constraint));
+}
+
+const std::vector<std::shared_ptr<TableKeyIndex>>& Table::key_indexes() const { return _key_indexes; }
+
+std::shared_ptr<TableKeyIndex> Table::key_index(const std::vector<ColumnID>& column_ids) const {
+  auto sorted_column_ids = column_ids;
+  std::sort(sorted_column_ids.begin(), sorted_column_ids.end());
+
+  for (const auto& key_index : _key_indexes) {
+    if (key_index->column_ids() == sorted_column_ids) return key_index;
+  }
+  return nullptr;
+}
+
 const std::vector<ColumnID>& Table::value_clustered_by() const { return _value_clustered_by; }
 
 void Table::set_value_clustered_by(const std::vector<ColumnID>& value_clustered_by) {
@@ -395,6 +430,16 @@ void Table::set_value_clustered_by(const std::vector<ColumnID>& value_clustered_
   _value_clustered_by = value_clustered_by;
 }
 
+CommitID Table::last_modification_commit_id() const { return _last_modification_commit_id.load(); }
+
+void Table::update_last_modification_commit_id(const CommitID commit_id) const {
+  // Transactions can commit their records concurrently and out of order, so only ever increase the commit id.
+  auto last_modification_commit_id = _last_modification_commit_id.load();
+  while (last_modification_commit_id < commit_id &&
+         !_last_modification_commit_id.compare_exchange_weak(last_modification_commit_id, commit_id)) {
+  }
+}
+
 size_t Table::memory_usage(const MemoryUsageCalculationMode mode) const {
   auto bytes = size_t{sizeof(*this)};
 
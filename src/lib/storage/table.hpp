@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -19,7 +20,9 @@
 
 namespace opossum {
 
+class TableKeyIndex;
 class TableStatistics;
+class TableStatisticsDelta;
 
 /**
  * A Table is partitioned horizontally into a number of chunks.
@@ -178,6 +181,10 @@ class Table : private Noncopyable {
   std::shared_ptr<TableStatistics> table_statistics() const;
 
   void set_table_statistics(const std::shared_ptr<TableStatistics>& table_statistics);
+
+  // Collects the rows committed by Inserts until they are merged into the statistics, see StatisticsRefresher. Created
+  // when statistics are first set, tables without statistics have no delta.
+  std::shared_ptr<TableStatisticsDelta> table_statistics_delta() const;
   /** @} */
 
   std::vector<IndexStatistics> indexes_statistics() const;
@@ -198,12 +205,25 @@ class Table : private Noncopyable {
   }
 
   /**
-   * NOTE: Key constraints are currently NOT ENFORCED and are only used to develop optimization rules.
-   * We call them "soft" key constraints to draw attention to that.
+   * NOTE: Key constraints are NOT ENFORCED unless a key index is created for them (see create_key_index). Without an
+   * index, they are only used to develop optimization rules. We call them "soft" key constraints to draw attention to
+   * that.
    */
   void add_soft_key_constraint(const TableKeyConstraint& table_key_constraint);
   const TableKeyConstraints& soft_key_constraints() const;
 
+  /**
+   * Creates a table-wide hash index (see TableKeyIndex) for the previously added key constraint with the same columns.
+   * The index is maintained by the Insert operator, which from then on enforces the constraint. It is also used for
+   * point lookups by the KeyIndexScan. The existing rows are expected to satisfy the constraint. Like create_index,
+   * this must not be called concurrently with modifications of the table.
+   */
+  void create_key_index(const TableKeyConstraint& table_key_constraint);
+  const std::vector<std::shared_ptr<TableKeyIndex>>& key_indexes() const;
+
+  // Returns the key index on exactly the columns @param column_ids (in any order), or nullptr if there is none.
+  std::shared_ptr<TableKeyIndex> key_index(const std::vector<ColumnID>& column_ids) const;
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Segments)
    */
@@ -222,6 +242,14 @@ class Table : private Noncopyable {
   const std::vector<ColumnID>& value_clustered_by() const;
   void set_value_clustered_by(const std::vector<ColumnID>& value_clustered_by);
 
+  /**
+   * The commit id of the last transaction that inserted or deleted rows of this table, or zero if there was none. It
+   * is updated while the transaction commits, i.e., before its changes become visible to other transactions. The
+   * ResultCache uses it to recognize outdated query results.
+   */
+  CommitID last_modification_commit_id() const;
+  void update_last_modification_commit_id(const CommitID commit_id) const;
+
  protected:
   const TableColumnDefinitions _column_definitions;
   const TableType _type;
@@ -240,14 +268,19 @@ class Table : private Noncopyable {
   tbb::concurrent_vector<std::shared_ptr<Chunk>, tbb::zero_allocator<std::shared_ptr<Chunk>>> _chunks;
 
   TableKeyConstraints _table_key_constraints;
+  std::vector<std::shared_ptr<TableKeyIndex>> _key_indexes;
 
   std::vector<ColumnID> _value_clustered_by;
   std::shared_ptr<TableStatistics> _table_statistics;
+  std::shared_ptr<TableStatisticsDelta> _table_statistics_delta;
   std::unique_ptr<std::mutex> _append_mutex;
   std::vector<IndexStatistics> _indexes;
 
   // For tables with _type==Reference, the row count will not vary. As such, there is no need to iterate over all
   // chunks more than once.
   mutable std::optional<uint64_t> _cached_row_count;
+
+  // Mutable, as rows are deleted from tables that operators only hold as const (see Chunk::_invalid_row_count).
+  mutable std::atomic<CommitID> _last_modification_commit_id{0};
 };
 }  // namespace opossum
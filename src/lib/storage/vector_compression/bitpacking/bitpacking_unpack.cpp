@@ -0,0 +1,70 @@
+#include "bitpacking_unpack.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// compact_vector stores the values least-significant bit first, i.e., value i occupies the bits
+// [i * Bits, (i + 1) * Bits) of the word array. A value may span two words. Instead of branching on that case, the
+// next word is always read and shifted so that it does not contribute if the value fits into the first word. Thus,
+// the loop must not be used for the last block of the vector, for which the next word might not exist.
+static_assert(BITPACKING_BLOCK_SIZE % 64 == 0, "Blocks must start at word boundaries");
+
+template <uint32_t Bits>
+void unpack_block(const uint64_t* __restrict words, uint32_t* __restrict values) {
+  constexpr auto mask = (uint64_t{1} << Bits) - 1;
+
+  // NOLINTNEXTLINE
+  {}  // clang-format off
+  #pragma omp simd
+  // clang-format on
+  for (auto value_index = size_t{0}; value_index < BITPACKING_BLOCK_SIZE; ++value_index) {
+    const auto bit = value_index * Bits;
+    const auto shift = bit % 64;
+    const auto low = words[bit / 64] >> shift;
+    // Shifting twice avoids the undefined shift by 64 bits if shift is zero.
+    const auto high = (words[bit / 64 + 1] << 1) << (63 - shift);
+    values[value_index] = static_cast<uint32_t>((low | high) & mask);
+  }
+}
+
+template <size_t... BitWidthIndexes>
+constexpr auto make_unpack_functions(std::index_sequence<BitWidthIndexes...>) {
+  return std::array<void (*)(const uint64_t*, uint32_t*), sizeof...(BitWidthIndexes)>{
+      &unpack_block<BitWidthIndexes + 1>...};
+}
+
+// unpack_functions[bits - 1] unpacks a block of values that are packed with `bits` bits.
+constexpr auto unpack_functions = make_unpack_functions(std::make_index_sequence<32>{});
+
+}  // namespace
+
+namespace opossum {
+
+void unpack_bitpacking_block(const pmr_compact_vector& data, const size_t block_begin, BitPackingBlock& block) {
+  DebugAssert(block_begin % BITPACKING_BLOCK_SIZE == 0, "Blocks must be aligned");
+  DebugAssert(block_begin < data.size(), "Block begins after the end of the vector");
+
+  const auto bits = data.bits();
+  const auto size = data.size();
+
+  // For all but the last block, the word following the block holds (at least) the first value of the next block.
+  if (block_begin + BITPACKING_BLOCK_SIZE < size) {
+    // As BITPACKING_BLOCK_SIZE is a multiple of 64, the block starts at a word boundary.
+    const auto* words = data.get() + block_begin * bits / 64;
+    unpack_functions[bits - 1](words, block.data());
+    return;
+  }
+
+  const auto block_end = std::min(block_begin + BITPACKING_BLOCK_SIZE, size);
+  for (auto index = block_begin; index < block_end; ++index) {
+    block[index - block_begin] = data[index];
+  }
+}
+
+}  // namespace opossum
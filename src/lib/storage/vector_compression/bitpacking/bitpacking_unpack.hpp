@@ -0,0 +1,23 @@
+#pragma once
+
+#include <array>
+
+#include "bitpacking_vector_type.hpp"
+
+namespace opossum {
+
+/**
+ * Decoding bit-packed values one at a time through the compact_vector requires a number of shifts, masks, and
+ * branches for each value. Sequential readers (see BitPackingIterator) instead decode blocks of consecutive values at
+ * once. A block of 128 values always starts at a word boundary, and the unpacking loop is specialized for each bit
+ * width, so that the compiler can vectorize it.
+ */
+constexpr auto BITPACKING_BLOCK_SIZE = size_t{128};
+
+using BitPackingBlock = std::array<uint32_t, BITPACKING_BLOCK_SIZE>;
+
+// Writes the values [block_begin, block_begin + BITPACKING_BLOCK_SIZE) of @param data to @param block. block_begin
+// must be a multiple of BITPACKING_BLOCK_SIZE. If the vector ends within the block, the remaining values are undefined.
+void unpack_bitpacking_block(const pmr_compact_vector& data, const size_t block_begin, BitPackingBlock& block);
+
+}  // namespace opossum
@@ -7,6 +7,9 @@ namespace opossum {
 
 BitPackingVector::BitPackingVector(pmr_compact_vector data) : _data{std::move(data)} {}
 
+BitPackingVector::BitPackingVector(pmr_compact_vector data, std::shared_ptr<const void> data_owner)
+    : _data_owner{std::move(data_owner)}, _data{std::move(data)} {}
+
 const pmr_compact_vector& BitPackingVector::data() const { return _data; }
 
 size_t BitPackingVector::on_size() const { return _data.size(); }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "bitpacking_decompressor.hpp"
 #include "bitpacking_iterator.hpp"
 #include "bitpacking_vector_type.hpp"
@@ -16,10 +18,13 @@ namespace opossum {
  * represent the maximum value of the sequence. The decoding runtime is only marginally slower than 
  * FixedWidthIntegerVector but the compression rate of BitPacking is significantly better.
  * 
+ * When loaded from a memory-mapped binary file (see BinaryParser), the compact_vector's memory is allocated from the
+ * mapping, which the data owner keeps alive.
  */
 class BitPackingVector : public CompressedVector<BitPackingVector> {
  public:
   explicit BitPackingVector(pmr_compact_vector data);
+  BitPackingVector(pmr_compact_vector data, std::shared_ptr<const void> data_owner);
 
   const pmr_compact_vector& data() const;
 
@@ -35,6 +40,8 @@ class BitPackingVector : public CompressedVector<BitPackingVector> {
   std::unique_ptr<const BaseCompressedVector> on_copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const;
 
  private:
+  // Declared before _data so that it outlives the compact_vector's deallocation
+  const std::shared_ptr<const void> _data_owner;
   const pmr_compact_vector _data;
 };
 
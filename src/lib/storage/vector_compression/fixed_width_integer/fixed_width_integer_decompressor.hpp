@@ -9,35 +9,26 @@ namespace opossum {
 template <typename UnsignedIntType>
 class FixedWidthIntegerDecompressor : public BaseVectorDecompressor {
  public:
-  explicit FixedWidthIntegerDecompressor(const pmr_vector<UnsignedIntType>& data) : _data{data} {}
+  FixedWidthIntegerDecompressor(const UnsignedIntType* values, const size_t size) : _values{values}, _size{size} {}
   FixedWidthIntegerDecompressor(const FixedWidthIntegerDecompressor&) = default;
   FixedWidthIntegerDecompressor(FixedWidthIntegerDecompressor&&) = default;
 
   FixedWidthIntegerDecompressor& operator=(const FixedWidthIntegerDecompressor& other) {
-    DebugAssert(&_data == &other._data, "Cannot reassign FixedWidthIntegerDecompressor");
+    DebugAssert(_values == other._values, "Cannot reassign FixedWidthIntegerDecompressor");
     return *this;
   }
   FixedWidthIntegerDecompressor& operator=(FixedWidthIntegerDecompressor&& other) {
-    DebugAssert(&_data == &other._data, "Cannot reassign FixedWidthIntegerDecompressor");
+    DebugAssert(_values == other._values, "Cannot reassign FixedWidthIntegerDecompressor");
     return *this;
   }
 
-  uint32_t get(size_t i) final {
-    // GCC warns here: _data may be used uninitialized in this function [-Werror=maybe-uninitialized]
-    // Clang does not complain. Also, _data is a reference, so there should be no way of it being uninitialized.
-    // Since gcc's uninitialized-detection is known to be buggy, we ignore that.
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  uint32_t get(size_t i) final { return _values[i]; }
 
-    return _data[i];
-
-#pragma GCC diagnostic pop
-  }
-
-  size_t size() const final { return _data.size(); }
+  size_t size() const final { return _size; }
 
  private:
-  const pmr_vector<UnsignedIntType>& _data;
+  const UnsignedIntType* const _values;
+  const size_t _size;
 };
 
 }  // namespace opossum
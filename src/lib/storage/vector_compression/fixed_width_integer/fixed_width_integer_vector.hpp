@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include <boost/hana/contains.hpp>
@@ -9,6 +10,7 @@
 #include "fixed_width_integer_decompressor.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -18,6 +20,9 @@ namespace hana = boost::hana;
  * @brief Stores values as either uint32_t, uint16_t, or uint8_t
  *
  * This is simplest vector compression scheme. It matches the old FittedAttributeVector
+ *
+ * The values are either owned by the vector or, when loaded from a memory-mapped binary file (see BinaryParser),
+ * reside in memory that is kept alive by a data owner. Copies (see copy_using_allocator) always own their values.
  */
 template <typename UnsignedIntType>
 class FixedWidthIntegerVector : public CompressedVector<FixedWidthIntegerVector<UnsignedIntType>> {
@@ -25,31 +30,41 @@ class FixedWidthIntegerVector : public CompressedVector<FixedWidthIntegerVector<
                 "UnsignedIntType must be any of the three listed unsigned integer types.");
 
  public:
-  explicit FixedWidthIntegerVector(pmr_vector<UnsignedIntType> data) : _data{std::move(data)} {}
+  explicit FixedWidthIntegerVector(pmr_vector<UnsignedIntType> data)
+      : _owned_data{std::move(data)}, _values{_owned_data.data()}, _size{_owned_data.size()} {}
+
+  // References `size` values at `values` without copying them. `data_owner` keeps the memory alive.
+  FixedWidthIntegerVector(const UnsignedIntType* values, const size_t size, std::shared_ptr<const void> data_owner)
+      : _data_owner{std::move(data_owner)}, _values{values}, _size{size} {
+    DebugAssert(reinterpret_cast<uintptr_t>(values) % alignof(UnsignedIntType) == 0, "Values are not aligned");
+  }
 
-  const pmr_vector<UnsignedIntType>& data() const { return _data; }
+  const UnsignedIntType* data() const { return _values; }
 
  public:
-  size_t on_size() const { return _data.size(); }
-  size_t on_data_size() const { return sizeof(UnsignedIntType) * _data.size(); }
+  size_t on_size() const { return _size; }
+  size_t on_data_size() const { return sizeof(UnsignedIntType) * _size; }
 
   auto on_create_base_decompressor() const {
-    return std::make_unique<FixedWidthIntegerDecompressor<UnsignedIntType>>(_data);
+    return std::make_unique<FixedWidthIntegerDecompressor<UnsignedIntType>>(_values, _size);
   }
 
-  auto on_create_decompressor() const { return FixedWidthIntegerDecompressor<UnsignedIntType>(_data); }
+  auto on_create_decompressor() const { return FixedWidthIntegerDecompressor<UnsignedIntType>(_values, _size); }
 
-  auto on_begin() const { return _data.cbegin(); }
+  auto on_begin() const { return _values; }
 
-  auto on_end() const { return _data.cend(); }
+  auto on_end() const { return _values + _size; }
 
   std::unique_ptr<const BaseCompressedVector> on_copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
-    auto data_copy = pmr_vector<UnsignedIntType>{_data, alloc};
+    auto data_copy = pmr_vector<UnsignedIntType>{_values, _values + _size, alloc};
     return std::make_unique<FixedWidthIntegerVector<UnsignedIntType>>(std::move(data_copy));
   }
 
  private:
-  const pmr_vector<UnsignedIntType> _data;
+  const pmr_vector<UnsignedIntType> _owned_data;
+  const std::shared_ptr<const void> _data_owner;
+  const UnsignedIntType* const _values;
+  const size_t _size;
 };
 
 }  // namespace opossum
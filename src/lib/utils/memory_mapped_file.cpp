@@ -0,0 +1,47 @@
+#include "memory_mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MemoryMappedFile::MemoryMappedFile(const std::string& filename, const AccessPattern access_pattern) {
+  const auto file_descriptor = open(filename.c_str(), O_RDONLY);
+  Assert(file_descriptor != -1, "Could not open '" + filename + "': " + std::strerror(errno));
+
+  struct stat file_status {};
+  const auto stat_result = fstat(file_descriptor, &file_status);
+  if (stat_result != 0) close(file_descriptor);
+  Assert(stat_result == 0, "Could not stat '" + filename + "': " + std::strerror(errno));
+  _size = static_cast<size_t>(file_status.st_size);
+
+  // Empty files cannot be mapped.
+  if (_size > 0) {
+    auto* const data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    if (data == MAP_FAILED) close(file_descriptor);
+    Assert(data != MAP_FAILED, "Could not map '" + filename + "': " + std::strerror(errno));
+
+    // For files that are read front to back exactly once, the kernel can read ahead aggressively and drop pages that
+    // have been read.
+    if (access_pattern == AccessPattern::Sequential) madvise(data, _size, MADV_SEQUENTIAL);
+    _data = static_cast<const char*>(data);
+  }
+
+  // The mapping stays valid after the file descriptor has been closed.
+  close(file_descriptor);
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+  if (_data) munmap(const_cast<char*>(_data), _size);
+}
+
+std::string_view MemoryMappedFile::view() const { return std::string_view{_data, _size}; }
+
+}  // namespace opossum
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Maps a file read-only into memory for the lifetime of the object. Pages are loaded on first access and, as they are
+// backed by the file, can be dropped by the kernel under memory pressure. Thus, large files do not need to fit into
+// memory. Empty files result in an empty view.
+class MemoryMappedFile : private Noncopyable {
+ public:
+  enum class AccessPattern { Normal, Sequential };
+
+  explicit MemoryMappedFile(const std::string& filename, const AccessPattern access_pattern = AccessPattern::Normal);
+  ~MemoryMappedFile();
+
+  std::string_view view() const;
+
+ private:
+  const char* _data{nullptr};
+  size_t _size{0};
+};
+
+}  // namespace opossum
@@ -3,8 +3,10 @@
 #include "utils/meta_tables/meta_chunk_sort_orders_table.hpp"
 #include "utils/meta_tables/meta_chunks_table.hpp"
 #include "utils/meta_tables/meta_columns_table.hpp"
+#include "utils/meta_tables/meta_garbage_collection_table.hpp"
 #include "utils/meta_tables/meta_log_table.hpp"
 #include "utils/meta_tables/meta_plugins_table.hpp"
+#include "utils/meta_tables/meta_result_cache_table.hpp"
 #include "utils/meta_tables/meta_segments_accurate_table.hpp"
 #include "utils/meta_tables/meta_segments_table.hpp"
 #include "utils/meta_tables/meta_settings_table.hpp"
@@ -23,6 +25,8 @@ MetaTableManager::MetaTableManager() {
                                                                        std::make_shared<MetaSegmentsTable>(),
                                                                        std::make_shared<MetaSegmentsAccurateTable>(),
                                                                        std::make_shared<MetaPluginsTable>(),
+                                                                       std::make_shared<MetaResultCacheTable>(),
+                                                                       std::make_shared<MetaGarbageCollectionTable>(),
                                                                        std::make_shared<MetaSettingsTable>(),
                                                                        std::make_shared<MetaSystemInformationTable>(),
                                                                        std::make_shared<MetaSystemUtilizationTable>()};
@@ -0,0 +1,34 @@
+#include "meta_garbage_collection_table.hpp"
+
+#include "hyrise.hpp"
+
+namespace opossum {
+
+MetaGarbageCollectionTable::MetaGarbageCollectionTable()
+    : AbstractMetaTable(TableColumnDefinitions{{"table_name", DataType::String, false},
+                                               {"compacted_chunks", DataType::Long, false},
+                                               {"moved_rows", DataType::Long, false},
+                                               {"encoded_chunks", DataType::Long, false},
+                                               {"reclaimed_chunks", DataType::Long, false},
+                                               {"reclaimed_bytes", DataType::Long, false}}) {}
+
+const std::string& MetaGarbageCollectionTable::name() const {
+  static const auto name = std::string{"garbage_collection"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaGarbageCollectionTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  for (const auto& [table_name, statistics] : Hyrise::get().garbage_collector.statistics()) {
+    output_table->append({pmr_string{table_name}, static_cast<int64_t>(statistics.compacted_chunk_count),
+                          static_cast<int64_t>(statistics.moved_row_count),
+                          static_cast<int64_t>(statistics.encoded_chunk_count),
+                          static_cast<int64_t>(statistics.reclaimed_chunk_count),
+                          static_cast<int64_t>(statistics.reclaimed_bytes)});
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
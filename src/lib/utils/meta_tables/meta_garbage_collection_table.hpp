@@ -0,0 +1,21 @@
+#pragma once
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace opossum {
+
+/**
+ * This is a class for showing the work done by the GarbageCollector, with one row per table that it has compacted,
+ * encoded, or reclaimed chunks of.
+ */
+class MetaGarbageCollectionTable : public AbstractMetaTable {
+ public:
+  MetaGarbageCollectionTable();
+
+  const std::string& name() const final;
+
+ protected:
+  std::shared_ptr<Table> _on_generate() const final;
+};
+
+}  // namespace opossum
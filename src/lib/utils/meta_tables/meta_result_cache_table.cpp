@@ -0,0 +1,32 @@
+#include "meta_result_cache_table.hpp"
+
+#include "hyrise.hpp"
+
+namespace opossum {
+
+MetaResultCacheTable::MetaResultCacheTable()
+    : AbstractMetaTable(TableColumnDefinitions{{"entry_count", DataType::Long, false},
+                                               {"size_bytes", DataType::Long, false},
+                                               {"capacity_bytes", DataType::Long, false},
+                                               {"hit_count", DataType::Long, false},
+                                               {"miss_count", DataType::Long, false}}) {}
+
+const std::string& MetaResultCacheTable::name() const {
+  static const auto name = std::string{"result_cache"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaResultCacheTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  const auto& result_cache = Hyrise::get().default_result_cache;
+  if (!result_cache) return output_table;
+
+  output_table->append({static_cast<int64_t>(result_cache->size()), static_cast<int64_t>(result_cache->memory_usage()),
+                        static_cast<int64_t>(result_cache->capacity()), static_cast<int64_t>(result_cache->hit_count()),
+                        static_cast<int64_t>(result_cache->miss_count())});
+
+  return output_table;
+}
+
+}  // namespace opossum
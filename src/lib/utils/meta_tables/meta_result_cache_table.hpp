@@ -0,0 +1,21 @@
+#pragma once
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace opossum {
+
+/**
+ * This is a class for showing the size and the hit/miss counts of the default result cache (see ResultCache). The table
+ * is empty if no default result cache is set.
+ */
+class MetaResultCacheTable : public AbstractMetaTable {
+ public:
+  MetaResultCacheTable();
+
+  const std::string& name() const final;
+
+ protected:
+  std::shared_ptr<Table> _on_generate() const final;
+};
+
+}  // namespace opossum
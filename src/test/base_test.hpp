@@ -100,6 +100,8 @@ const SegmentEncodingSpec all_segment_encoding_specs[]{
     SegmentEncodingSpec{EncodingType::FixedStringDictionary, VectorCompressionType::FixedWidthInteger},
     SegmentEncodingSpec{EncodingType::FixedStringDictionary, VectorCompressionType::BitPacking},
     SegmentEncodingSpec{EncodingType::FrameOfReference},
+    SegmentEncodingSpec{EncodingType::FSST, VectorCompressionType::FixedWidthInteger},
+    SegmentEncodingSpec{EncodingType::FSST, VectorCompressionType::BitPacking},
     SegmentEncodingSpec{EncodingType::LZ4},
     SegmentEncodingSpec{EncodingType::RunLength}};
 }  // namespace opossum
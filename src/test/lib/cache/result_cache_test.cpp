@@ -0,0 +1,157 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "cache/result_cache.hpp"
+#include "hyrise.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class ResultCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_a = load_table("resources/test_data/tbl/int_float.tbl", 2);
+    Hyrise::get().storage_manager.add_table("table_a", _table_a);
+
+    _result_cache = std::make_shared<ResultCache>();
+  }
+
+  // Executes the single statement @param sql and returns whether its result was taken from the cache.
+  bool execute(const std::string& sql, const std::shared_ptr<const Table>& expected_table = nullptr) {
+    auto sql_pipeline = SQLPipelineBuilder{sql}.with_result_cache(_result_cache).create_pipeline();
+    const auto [pipeline_status, result_table] = sql_pipeline.get_result_table();
+    EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+    if (expected_table) {
+      const auto table_difference_message =
+          check_table_equal(result_table, expected_table, OrderSensitivity::No, TypeCmpMode::Strict,
+                            FloatComparisonMode::AbsoluteDifference, IgnoreNullable::No);
+      if (table_difference_message) ADD_FAILURE() << *table_difference_message;
+    }
+    return sql_pipeline.metrics().statement_metrics.at(0)->result_cache_hit;
+  }
+
+  double inflation() const { return _result_cache->_inflation; }
+
+  std::shared_ptr<Table> _table_a;
+  std::shared_ptr<ResultCache> _result_cache;
+};
+
+TEST_F(ResultCacheTest, RepeatedQueryHitsCache) {
+  const auto expected_table = load_table("resources/test_data/tbl/int_float.tbl");
+
+  EXPECT_FALSE(execute("SELECT * FROM table_a", expected_table));
+  EXPECT_EQ(_result_cache->size(), 1);
+  EXPECT_GT(_result_cache->memory_usage(), 0);
+
+  EXPECT_TRUE(execute("SELECT * FROM table_a", expected_table));
+  EXPECT_TRUE(execute("SELECT * FROM table_a", expected_table));
+  EXPECT_EQ(_result_cache->size(), 1);
+  EXPECT_EQ(_result_cache->hit_count(), 2);
+  EXPECT_EQ(_result_cache->miss_count(), 1);
+
+  // A different query is a different entry.
+  EXPECT_FALSE(execute("SELECT a FROM table_a"));
+  EXPECT_EQ(_result_cache->size(), 2);
+}
+
+TEST_F(ResultCacheTest, ModificationsInvalidateEntries) {
+  EXPECT_FALSE(execute("SELECT * FROM table_a WHERE a > 200"));
+  EXPECT_TRUE(execute("SELECT * FROM table_a WHERE a > 200"));
+
+  const auto commit_id_before_insert = _table_a->last_modification_commit_id();
+  EXPECT_FALSE(execute("INSERT INTO table_a VALUES (1000, 1.0)"));
+  EXPECT_GT(_table_a->last_modification_commit_id(), commit_id_before_insert);
+
+  auto expected_table = std::make_shared<Table>(_table_a->column_definitions(), TableType::Data);
+  expected_table->append({12345, 458.7f});
+  expected_table->append({1234, 457.7f});
+  expected_table->append({1000, 1.0f});
+  EXPECT_FALSE(execute("SELECT * FROM table_a WHERE a > 200", expected_table));
+  EXPECT_TRUE(execute("SELECT * FROM table_a WHERE a > 200", expected_table));
+
+  const auto commit_id_before_delete = _table_a->last_modification_commit_id();
+  EXPECT_FALSE(execute("DELETE FROM table_a WHERE a = 1000"));
+  EXPECT_GT(_table_a->last_modification_commit_id(), commit_id_before_delete);
+
+  expected_table = std::make_shared<Table>(_table_a->column_definitions(), TableType::Data);
+  expected_table->append({12345, 458.7f});
+  expected_table->append({1234, 457.7f});
+  EXPECT_FALSE(execute("SELECT * FROM table_a WHERE a > 200", expected_table));
+}
+
+TEST_F(ResultCacheTest, ReplacedTableIsNotHit) {
+  EXPECT_FALSE(execute("SELECT * FROM table_a"));
+
+  // A new table of the same name and with the same last modification commit id must not be confused with the old one.
+  Hyrise::get().storage_manager.drop_table("table_a");
+  Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_float2.tbl", 2));
+  EXPECT_FALSE(execute("SELECT * FROM table_a", load_table("resources/test_data/tbl/int_float2.tbl")));
+}
+
+TEST_F(ResultCacheTest, UncacheableStatements) {
+  // Writing statements, meta tables, and statements within explicit transactions are not cached.
+  EXPECT_FALSE(execute("INSERT INTO table_a VALUES (1, 1.0)"));
+  EXPECT_FALSE(execute("SELECT * FROM meta_tables"));
+  EXPECT_FALSE(execute("SELECT * FROM meta_tables"));
+  EXPECT_EQ(_result_cache->size(), 0);
+
+  auto sql_pipeline = SQLPipelineBuilder{"BEGIN; SELECT * FROM table_a; SELECT * FROM table_a; COMMIT;"}
+                          .with_result_cache(_result_cache)
+                          .create_pipeline();
+  EXPECT_EQ(sql_pipeline.get_result_table().first, SQLPipelineStatus::Success);
+  EXPECT_EQ(_result_cache->size(), 0);
+  EXPECT_EQ(_result_cache->hit_count(), 0);
+}
+
+TEST_F(ResultCacheTest, NoCacheByDefault) {
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_a"}.create_pipeline();
+  EXPECT_EQ(sql_pipeline.result_cache, nullptr);
+  EXPECT_EQ(sql_pipeline.get_result_table().first, SQLPipelineStatus::Success);
+}
+
+TEST_F(ResultCacheTest, EvictionBySize) {
+  EXPECT_FALSE(execute("SELECT * FROM table_a"));
+  const auto entry_size = _result_cache->memory_usage();
+
+  // Results exceeding the capacity are not cached at all.
+  _result_cache->resize(entry_size - 1);
+  EXPECT_EQ(_result_cache->size(), 0);
+  EXPECT_EQ(_result_cache->memory_usage(), 0);
+  EXPECT_FALSE(execute("SELECT * FROM table_a"));
+  EXPECT_EQ(_result_cache->size(), 0);
+
+  // With room for one result only, caching a second result evicts the first one and inflates the priorities.
+  _result_cache->resize(entry_size);
+  EXPECT_FALSE(execute("SELECT * FROM table_a"));
+  EXPECT_TRUE(execute("SELECT * FROM table_a"));
+  EXPECT_FALSE(execute("SELECT * FROM table_a WHERE a > 200"));
+  EXPECT_EQ(_result_cache->size(), 1);
+  EXPECT_LE(_result_cache->memory_usage(), entry_size);
+  EXPECT_GT(inflation(), 0.0);
+  EXPECT_FALSE(execute("SELECT * FROM table_a"));
+
+  _result_cache->clear();
+  EXPECT_EQ(_result_cache->size(), 0);
+  EXPECT_EQ(_result_cache->memory_usage(), 0);
+}
+
+TEST_F(ResultCacheTest, MetaTable) {
+  auto meta_table = Hyrise::get().meta_table_manager.generate_table("result_cache");
+  EXPECT_EQ(meta_table->row_count(), 0);
+
+  Hyrise::get().default_result_cache = _result_cache;
+  EXPECT_FALSE(execute("SELECT * FROM table_a"));
+  EXPECT_TRUE(execute("SELECT * FROM table_a"));
+
+  meta_table = Hyrise::get().meta_table_manager.generate_table("result_cache");
+  ASSERT_EQ(meta_table->row_count(), 1);
+  EXPECT_EQ(meta_table->get_value<int64_t>("entry_count", 0), 1);
+  EXPECT_EQ(meta_table->get_value<int64_t>("size_bytes", 0), static_cast<int64_t>(_result_cache->memory_usage()));
+  EXPECT_EQ(meta_table->get_value<int64_t>("hit_count", 0), 1);
+  EXPECT_EQ(meta_table->get_value<int64_t>("miss_count", 0), 1);
+}
+
+}  // namespace opossum
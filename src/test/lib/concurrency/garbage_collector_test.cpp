@@ -0,0 +1,125 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "concurrency/garbage_collector.hpp"
+#include "hyrise.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class GarbageCollectorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Four chunks of two rows each
+    table = load_table("resources/test_data/tbl/int_int3.tbl", 2);
+    Hyrise::get().storage_manager.add_table("table_a", table);
+
+    Hyrise::get().garbage_collector.set_config({0.5, 0});
+  }
+
+  static void execute_sql(const std::string& sql) {
+    auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    const auto [pipeline_status, table] = pipeline.get_result_table();
+    ASSERT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  }
+
+  static std::shared_ptr<const Table> select_all() {
+    auto pipeline = SQLPipelineBuilder{"SELECT * FROM table_a"}.create_pipeline();
+    return pipeline.get_result_table().second;
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(GarbageCollectorTest, CompactsAndReclaimsChunks) {
+  auto& garbage_collector = Hyrise::get().garbage_collector;
+
+  // Invalidates both rows of chunk 0 and one row of chunk 2.
+  execute_sql("DELETE FROM table_a WHERE a < 5 AND b < 18");
+  const auto expected_table = select_all();
+
+  // Chunks 0 and 2 are compacted. The remaining row of chunk 2 is moved to a new chunk at the end of the table.
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  garbage_collector.run();
+
+  ASSERT_EQ(table->chunk_count(), 5);
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+  EXPECT_FALSE(table->get_chunk(ChunkID{1})->get_cleanup_commit_id());
+  EXPECT_TRUE(table->get_chunk(ChunkID{2})->get_cleanup_commit_id());
+  EXPECT_FALSE(table->get_chunk(ChunkID{3})->get_cleanup_commit_id());
+  EXPECT_EQ(table->get_chunk(ChunkID{4})->size(), 1);
+  EXPECT_TABLE_EQ_UNORDERED(select_all(), expected_table);
+
+  // The transaction that started before the compaction might still need the retired chunks.
+  EXPECT_EQ(garbage_collector.retired_chunk_count(), 2);
+  garbage_collector.run();
+  EXPECT_EQ(garbage_collector.retired_chunk_count(), 2);
+  EXPECT_TRUE(table->get_chunk(ChunkID{0}));
+
+  transaction_context->commit();
+  garbage_collector.run();
+  EXPECT_EQ(garbage_collector.retired_chunk_count(), 0);
+  EXPECT_FALSE(table->get_chunk(ChunkID{0}));
+  EXPECT_TRUE(table->get_chunk(ChunkID{1}));
+  EXPECT_FALSE(table->get_chunk(ChunkID{2}));
+  EXPECT_TABLE_EQ_UNORDERED(select_all(), expected_table);
+
+  const auto statistics = garbage_collector.statistics().at("table_a");
+  EXPECT_EQ(statistics.compacted_chunk_count, 2);
+  EXPECT_EQ(statistics.moved_row_count, 1);
+  EXPECT_EQ(statistics.encoded_chunk_count, 0);
+  EXPECT_EQ(statistics.reclaimed_chunk_count, 2);
+  EXPECT_GT(statistics.reclaimed_bytes, 0);
+
+  const auto meta_table = Hyrise::get().meta_table_manager.generate_table("garbage_collection");
+  ASSERT_EQ(meta_table->row_count(), 1);
+  EXPECT_EQ(meta_table->get_value<pmr_string>(ColumnID{0}, 0), "table_a");
+  EXPECT_EQ(meta_table->get_value<int64_t>(ColumnID{1}, 0), 2);
+  EXPECT_EQ(meta_table->get_value<int64_t>(ColumnID{4}, 0), 2);
+}
+
+TEST_F(GarbageCollectorTest, SkipsRecentlyInvalidatedChunks) {
+  auto& garbage_collector = Hyrise::get().garbage_collector;
+  garbage_collector.set_config({0.5, 2});
+
+  execute_sql("DELETE FROM table_a WHERE a < 5");
+  garbage_collector.run();
+  EXPECT_EQ(garbage_collector.retired_chunk_count(), 0);
+
+  execute_sql("UPDATE table_a SET b = 0 WHERE a = 13");
+  execute_sql("UPDATE table_a SET b = 1 WHERE a = 13");
+  garbage_collector.run();
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+}
+
+TEST_F(GarbageCollectorTest, EncodesCompletedChunks) {
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+  execute_sql("INSERT INTO table_a VALUES (20, 21)");
+  execute_sql("INSERT INTO table_a VALUES (22, 23)");
+  ASSERT_EQ(table->chunk_count(), 5);
+  ASSERT_FALSE(table->get_chunk(ChunkID{4})->is_mutable());
+
+  // Compaction is not needed, the completed chunk is encoded nonetheless.
+  Hyrise::get().garbage_collector.run();
+  const auto segment = table->get_chunk(ChunkID{4})->get_segment(ColumnID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(segment));
+  EXPECT_EQ(Hyrise::get().garbage_collector.statistics().at("table_a").encoded_chunk_count, 1);
+}
+
+TEST_F(GarbageCollectorTest, StartAndStop) {
+  auto& garbage_collector = Hyrise::get().garbage_collector;
+  EXPECT_FALSE(garbage_collector.is_running());
+
+  garbage_collector.start(std::chrono::milliseconds{1});
+  EXPECT_TRUE(garbage_collector.is_running());
+  EXPECT_THROW(garbage_collector.start(), std::logic_error);
+
+  garbage_collector.stop();
+  EXPECT_FALSE(garbage_collector.is_running());
+}
+
+}  // namespace opossum
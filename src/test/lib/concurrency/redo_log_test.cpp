@@ -0,0 +1,161 @@
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "concurrency/garbage_collector.hpp"
+#include "concurrency/redo_log.hpp"
+#include "hyrise.hpp"
+#include "import_export/binary/binary_writer.hpp"
+
+namespace opossum {
+
+class RedoLogTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    std::filesystem::create_directory(checkpoint_directory);
+
+    // Do not finalize the last chunk so that new rows are written into the chunk that is part of the checkpoint.
+    const auto table = load_table("resources/test_data/tbl/int_float.tbl", 2, FinalizeLastChunk::No);
+    BinaryWriter::write(*table, checkpoint_directory + "table_a.bin");
+    Hyrise::get().storage_manager.add_table("table_a", table);
+  }
+
+  void TearDown() override {
+    Hyrise::get().redo_log.disable();
+    std::filesystem::remove_all(checkpoint_directory);
+    std::filesystem::remove(log_file_path);
+  }
+
+  static void execute_sql(const std::string& sql) {
+    auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    const auto [pipeline_status, table] = pipeline.get_result_table();
+    ASSERT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  }
+
+  static std::shared_ptr<const Table> select_all() {
+    auto pipeline = SQLPipelineBuilder{"SELECT * FROM table_a"}.create_pipeline();
+    return pipeline.get_result_table().second;
+  }
+
+  const std::string log_file_path = test_data_path + "redo_log_test.log";
+  const std::string checkpoint_directory = test_data_path + "redo_log_test_checkpoint/";
+};
+
+TEST_F(RedoLogTest, EnableAndDisable) {
+  auto& redo_log = Hyrise::get().redo_log;
+  EXPECT_FALSE(redo_log.is_enabled());
+
+  redo_log.enable(log_file_path);
+  EXPECT_TRUE(redo_log.is_enabled());
+  EXPECT_TRUE(std::filesystem::exists(log_file_path));
+
+  redo_log.disable();
+  EXPECT_FALSE(redo_log.is_enabled());
+}
+
+TEST_F(RedoLogTest, RecoverCommittedChanges) {
+  auto& redo_log = Hyrise::get().redo_log;
+  redo_log.enable(log_file_path);
+
+  execute_sql("INSERT INTO table_a VALUES (1, 1.5)");
+  execute_sql("INSERT INTO table_a VALUES (2, 2.5)");
+  execute_sql("DELETE FROM table_a WHERE a = 123");
+  execute_sql("DELETE FROM table_a WHERE a = 1");
+  execute_sql("UPDATE table_a SET b = 3.5 WHERE a = 2");
+
+  redo_log.flush();
+  EXPECT_EQ(redo_log.record_count(), 5);
+  EXPECT_GE(redo_log.sync_count(), 1);
+  EXPECT_LE(redo_log.sync_count(), 5);
+  redo_log.disable();
+
+  const auto expected_table = select_all();
+
+  Hyrise::reset();
+  EXPECT_EQ(RedoLog::recover(log_file_path, checkpoint_directory), 5);
+  EXPECT_TABLE_EQ_UNORDERED(select_all(), expected_table);
+}
+
+TEST_F(RedoLogTest, RecoverCompactedChunks) {
+  auto& redo_log = Hyrise::get().redo_log;
+  redo_log.enable(log_file_path);
+
+  // Invalidates one of the two rows of the first chunk, which the GarbageCollector then compacts. The compaction is
+  // logged like an Update of the stored table.
+  execute_sql("DELETE FROM table_a WHERE a = 123");
+  auto& garbage_collector = Hyrise::get().garbage_collector;
+  garbage_collector.set_config({0.5, 0});
+  garbage_collector.run();
+
+  const auto table = Hyrise::get().storage_manager.get_table("table_a");
+  ASSERT_TRUE(table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+  EXPECT_EQ(table->last_modification_commit_id(), *table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+
+  redo_log.flush();
+  EXPECT_EQ(redo_log.record_count(), 2);
+  redo_log.disable();
+
+  const auto expected_table = select_all();
+
+  Hyrise::reset();
+  EXPECT_EQ(RedoLog::recover(log_file_path, checkpoint_directory), 2);
+  EXPECT_TABLE_EQ_UNORDERED(select_all(), expected_table);
+}
+
+TEST_F(RedoLogTest, RolledBackTransactionsAreNotLogged) {
+  auto& redo_log = Hyrise::get().redo_log;
+  redo_log.enable(log_file_path);
+
+  execute_sql("BEGIN; INSERT INTO table_a VALUES (1, 1.5); ROLLBACK;");
+
+  redo_log.disable();
+  EXPECT_EQ(std::filesystem::file_size(log_file_path), 0);
+}
+
+TEST_F(RedoLogTest, TransactionsWithoutModifiedRowsAreNotLogged) {
+  auto& redo_log = Hyrise::get().redo_log;
+  redo_log.enable(log_file_path);
+
+  const auto last_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+  execute_sql("DELETE FROM table_a WHERE a = 42");
+  execute_sql("UPDATE table_a SET b = 1.5 WHERE a = 42");
+  EXPECT_EQ(Hyrise::get().transaction_manager.last_commit_id(), last_commit_id + 2);
+
+  redo_log.flush();
+  EXPECT_EQ(redo_log.record_count(), 0);
+  EXPECT_EQ(redo_log.sync_count(), 0);
+  redo_log.disable();
+}
+
+TEST_F(RedoLogTest, StopReplayAtIncompleteRecord) {
+  auto& redo_log = Hyrise::get().redo_log;
+  redo_log.enable(log_file_path);
+  execute_sql("INSERT INTO table_a VALUES (1, 1.5)");
+  redo_log.disable();
+
+  const auto expected_table = select_all();
+
+  // Simulate a crash while writing the next record: its header announces more bytes than have been written.
+  {
+    auto log_file = std::ofstream{log_file_path, std::ios::binary | std::ios::app};
+    const auto payload_size = uint32_t{1000};
+    log_file.write(reinterpret_cast<const char*>(&payload_size), sizeof(uint32_t));
+    log_file.write("garbage", 7);
+  }
+
+  Hyrise::reset();
+  EXPECT_EQ(RedoLog::recover(log_file_path, checkpoint_directory), 1);
+  EXPECT_TABLE_EQ_UNORDERED(select_all(), expected_table);
+}
+
+TEST_F(RedoLogTest, RecoverWithoutLog) {
+  Hyrise::reset();
+  EXPECT_EQ(RedoLog::recover(log_file_path, checkpoint_directory), 0);
+  EXPECT_TRUE(Hyrise::get().storage_manager.has_table("table_a"));
+  EXPECT_EQ(Hyrise::get().storage_manager.get_table("table_a")->row_count(), 3);
+}
+
+}  // namespace opossum
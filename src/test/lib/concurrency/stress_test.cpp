@@ -4,6 +4,8 @@
 #include "base_test.hpp"
 
 #include "hyrise.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 
 namespace opossum {
@@ -210,4 +212,85 @@ TEST_F(StressTest, TestTransactionInsertsPackedNullValues) {
   }
 }
 
+TEST_F(StressTest, TestConcurrentInsertsFillChunks) {
+  // Many threads insert multiple rows each into a table with a small target chunk size. Rows are reserved without
+  // locking the table, so the reservations of concurrent Inserts interleave and often span two chunks. No row must be
+  // lost or reserved twice, and all chunks but the last must be completely filled and finalized.
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, false);
+  column_definitions.emplace_back("b", DataType::Int, true);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 10, UseMvcc::Yes);
+  Hyrise::get().storage_manager.add_table("table_d", table);
+
+  const auto iterations_per_thread = 100;
+  const auto rows_per_insert = 3;
+
+  // Define the work package - each job inserts rows with a=job_id, b=(NULL or 1, depending on the row)
+  std::atomic_int job_id{0};
+  const auto run = [&]() {
+    const auto my_job_id = job_id++;
+
+    const auto values_table = std::make_shared<Table>(column_definitions, TableType::Data);
+    for (auto row = 0; row < rows_per_insert; ++row) {
+      values_table->append({my_job_id, row % 2 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{1}});
+    }
+    const auto values = std::make_shared<TableWrapper>(values_table);
+    values->execute();
+
+    for (auto iteration = 0; iteration < iterations_per_thread; ++iteration) {
+      const auto insert = std::make_shared<Insert>("table_d", values);
+      const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+      insert->set_transaction_context(context);
+      insert->execute();
+      EXPECT_FALSE(insert->execute_failed());
+      context->commit();
+    }
+  };
+
+  // Create the async objects and spawn them asynchronously (i.e., as their own threads)
+  const auto num_threads = 20u;
+  std::vector<std::future<void>> thread_futures;
+  thread_futures.reserve(num_threads);
+
+  for (auto thread_num = 0u; thread_num < num_threads; ++thread_num) {
+    // We want a future to the thread running, so we can kill it after a future.wait(timeout) or the test would freeze
+    thread_futures.emplace_back(std::async(std::launch::async, run));
+  }
+
+  // Wait for completion or timeout (should not occur)
+  for (auto& thread_future : thread_futures) {
+    // We give this a lot of time, not because we usually need that long for 20 threads to finish, but because
+    // sanitizers and other tools like valgrind sometimes bring a high overhead.
+    if (thread_future.wait_for(std::chrono::seconds(600)) == std::future_status::timeout) {
+      ASSERT_TRUE(false) << "At least one thread got stuck and did not commit.";
+    }
+    // Retrieve the future so that exceptions stored in its state are thrown
+    thread_future.get();
+  }
+
+  const auto row_count = num_threads * iterations_per_thread * rows_per_insert;
+  ASSERT_EQ(table->row_count(), row_count);
+
+  const auto chunk_count = table->chunk_count();
+  ASSERT_EQ(chunk_count, (row_count + 9) / 10);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count - 1; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    EXPECT_EQ(chunk->size(), 10);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_EQ(chunk->mvcc_data()->pending_insert_count, 0);
+  }
+
+  // Check that each row was written by exactly one Insert
+  auto pipeline =
+      SQLPipelineBuilder{"SELECT a, COUNT(a), COUNT(b) FROM table_d GROUP BY a ORDER BY a"}.create_pipeline();
+  const auto [_, verification_table] = pipeline.get_result_table();
+  ASSERT_EQ(verification_table->row_count(), num_threads);
+
+  for (auto row = size_t{0}; row < num_threads; ++row) {
+    EXPECT_EQ(*verification_table->get_value<int32_t>(ColumnID{0}, row), row);
+    EXPECT_EQ(*verification_table->get_value<int64_t>(ColumnID{1}, row), iterations_per_thread * rows_per_insert);
+    EXPECT_EQ(*verification_table->get_value<int64_t>(ColumnID{2}, row), iterations_per_thread * 2);
+  }
+}
+
 }  // namespace opossum
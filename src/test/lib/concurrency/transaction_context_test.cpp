@@ -152,6 +152,44 @@ TEST_F(TransactionContextTest, CallbackFiresWhenCommitted) {
   EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
 }
 
+TEST_F(TransactionContextTest, PendingCommitsArePublishedTogether) {
+  auto context_1 = manager().new_transaction_context(AutoCommit::No);
+  auto context_2 = manager().new_transaction_context(AutoCommit::No);
+  auto context_3 = manager().new_transaction_context(AutoCommit::No);
+
+  const auto prev_last_commit_id = manager().last_commit_id();
+
+  auto committed_transaction_ids = std::vector<TransactionID>{};
+  auto last_commit_ids = std::vector<CommitID>{};
+  const auto callback = [&](TransactionID transaction_id) {
+    committed_transaction_ids.emplace_back(transaction_id);
+    last_commit_ids.emplace_back(manager().last_commit_id());
+  };
+
+  // context_2 and context_3 get their commit ids after context_1 and have to wait for it.
+  auto try_commit_contexts_2_and_3 = [&]() {
+    context_2->commit_async(callback);
+    context_3->commit_async(callback);
+
+    EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id);
+    EXPECT_TRUE(committed_transaction_ids.empty());
+  };
+
+  auto commit_op = std::make_shared<CommitFuncOp>(try_commit_contexts_2_and_3);
+  commit_op->set_transaction_context(context_1);
+  commit_op->execute();
+
+  context_1->commit_async(callback);
+
+  // All three commits become visible at once, before any of the callbacks is fired. The callbacks are fired in the
+  // order of the commit ids.
+  EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id + 3);
+  EXPECT_EQ(committed_transaction_ids, std::vector<TransactionID>({context_1->transaction_id(),
+                                                                   context_2->transaction_id(),
+                                                                   context_3->transaction_id()}));
+  EXPECT_EQ(last_commit_ids, std::vector<CommitID>(3, prev_last_commit_id + 3));
+}
+
 TEST_F(TransactionContextTest, CommitWithFailedOperator) {
   auto context = manager().new_transaction_context(AutoCommit::No);
   context->rollback(RollbackReason::Conflict);
@@ -55,6 +55,53 @@ TEST_F(LikeMatcherTest, NotMatching) {
   EXPECT_FALSE(match("Hello", "He_o"));
 }
 
+TEST_F(LikeMatcherTest, GeneralPattern) {
+  EXPECT_TRUE(std::holds_alternative<LikeMatcher::GeneralPattern>(
+      LikeMatcher::pattern_string_to_pattern_variant("%hello%world")));
+
+  // Single-character wildcards in all segments
+  EXPECT_TRUE(match("Hello World", "H_llo%W_rld"));
+  EXPECT_TRUE(match("Hello World", "_ello%_"));
+  EXPECT_TRUE(match("Hello World", "%o_W%"));
+  EXPECT_TRUE(match("Hello World", "___________"));
+  EXPECT_FALSE(match("Hello World", "__________"));
+  EXPECT_FALSE(match("Hello World", "H_llo%W_rld_"));
+
+  // Anchored prefix and suffix must not overlap
+  EXPECT_TRUE(match("abab", "ab%ab"));
+  EXPECT_FALSE(match("aba", "ab%ab"));
+
+  // Leftmost placement of the middle segments, repeated candidates for the anchor
+  EXPECT_TRUE(match("xaaab_aaac_y", "x%aa_c%y"));
+  EXPECT_TRUE(match("special requests", "%e_ial%req%"));
+  EXPECT_FALSE(match("special requests", "%e_ial%req%z"));
+
+  // Patterns that look like MultipleContainsPattern but do not end with '%'
+  EXPECT_TRUE(match("hello world", "%hello%world"));
+  EXPECT_FALSE(match("hello world!", "%hello%world"));
+
+  // The empty pattern only matches the empty string
+  EXPECT_TRUE(match("", ""));
+  EXPECT_FALSE(match("a", ""));
+
+  // Long strings use the vectorized substring search
+  const auto long_value = std::string(200, 'a') + "needle" + std::string(100, 'b') + "thread";
+  EXPECT_TRUE(match(long_value, "a%nee_le%thr%d"));
+  EXPECT_TRUE(match(long_value, "%needle_%_thread"));
+  EXPECT_FALSE(match(long_value, "%needle%needle%"));
+  EXPECT_FALSE(match(long_value, "%thread%b_"));
+}
+
+TEST_F(LikeMatcherTest, Find) {
+  const auto haystack = std::string(100, 'a') + "abc" + std::string(100, 'c') + "abc";
+  EXPECT_EQ(LikeMatcher::find(haystack, "abc"), size_t{100});
+  EXPECT_EQ(LikeMatcher::find(haystack, "bc"), size_t{101});
+  EXPECT_EQ(LikeMatcher::find(haystack, "cab"), size_t{202});
+  EXPECT_EQ(LikeMatcher::find(haystack, "abcd"), std::string_view::npos);
+  EXPECT_EQ(LikeMatcher::find("short", "or"), size_t{2});
+  EXPECT_EQ(LikeMatcher::find("short", "shorter"), std::string_view::npos);
+}
+
 TEST_F(LikeMatcherTest, LowerUpperBound) {
   const auto pattern = pmr_string("Japan%");
   const auto bounds = LikeMatcher::bounds(pattern);
@@ -1,3 +1,5 @@
+#include <cstdio>
+#include <fstream>
 #include <memory>
 #include <string>
 #include <vector>
@@ -6,6 +8,7 @@
 
 #include "hyrise.hpp"
 #include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
 
@@ -252,6 +255,21 @@ TEST_P(BinaryParserMultiEncodingTest, RunNullValues) {
   EXPECT_TABLE_EQ_ORDERED(table, expected_table);
 }
 
+TEST_P(BinaryParserMultiEncodingTest, MemoryMapped) {
+  const auto test_name = std::string{::testing::UnitTest::GetInstance()->current_test_info()->name()};
+  const auto encoding_name = test_name.substr(test_name.find('/') + 1);
+
+  for (const auto& reference_table_name :
+       {"StringSegment", "AllTypesMixColumn", "AllTypesNullValues", "RunNullValues"}) {
+    const auto reference_filename = _reference_filepath + reference_table_name + "/" + encoding_name + ".bin";
+    const auto expected_table = BinaryParser::parse(reference_filename);
+    const auto table = BinaryParser::parse(reference_filename, BinaryParserMode::MemoryMapped);
+
+    EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+    EXPECT_EQ(table->chunk_count(), expected_table->chunk_count());
+  }
+}
+
 TEST_F(BinaryParserTest, LZ4MultipleBlocks) {
   TableColumnDefinitions column_definitions;
   column_definitions.emplace_back("a", DataType::String, false);
@@ -371,6 +389,98 @@ TEST_F(BinaryParserTest, InvalidAttributeVectorWidth) {
 
 TEST_F(BinaryParserTest, FileDoesNotExist) { EXPECT_THROW(BinaryParser::parse("not_existing_file"), std::exception); }
 
+TEST_F(BinaryParserTest, MemoryMappedFixedStringDictionaryAndFrameOfReference) {
+  for (const auto& reference_table_name :
+       {"FixedStringDictionaryMultipleChunks", "MultipleChunksFrameOfReferenceSegment",
+        "NullValuesFrameOfReferenceSegment", "LZ4MultipleBlocks"}) {
+    const auto reference_filename = _reference_filepath + reference_table_name + ".bin";
+    EXPECT_TABLE_EQ_ORDERED(BinaryParser::parse(reference_filename, BinaryParserMode::MemoryMapped),
+                            BinaryParser::parse(reference_filename));
+  }
+}
+
+TEST_F(BinaryParserTest, FSSTSegmentRoundTrip) {
+  const auto filename = test_data_path + "fsst_round_trip.bin";
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, true}}, TableType::Data, 3);
+  table->append({"http://www.hyrise.net"});
+  table->append({opossum::NULL_VALUE});
+  table->append({""});
+  table->append({"http://www.hpi.de"});
+  table->last_chunk()->finalize();
+
+  for (const auto compression_type : {VectorCompressionType::FixedWidthInteger, VectorCompressionType::BitPacking}) {
+    ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::FSST, compression_type});
+    BinaryWriter::write(*table, filename);
+
+    EXPECT_TABLE_EQ_ORDERED(BinaryParser::parse(filename), table);
+    EXPECT_TABLE_EQ_ORDERED(BinaryParser::parse(filename, BinaryParserMode::MemoryMapped), table);
+    const auto segment = BinaryParser::parse(filename)->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+    EXPECT_EQ(std::dynamic_pointer_cast<const AbstractEncodedSegment>(segment)->encoding_type(), EncodingType::FSST);
+  }
+
+  std::remove(filename.c_str());
+}
+
+TEST_F(BinaryParserTest, MemoryMappedVectorsOutliveFile) {
+  const auto filename = test_data_path + "memory_mapped_vectors.bin";
+  auto table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+
+  for (const auto compression_type : {VectorCompressionType::FixedWidthInteger, VectorCompressionType::BitPacking}) {
+    ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary, compression_type});
+    BinaryWriter::write(*table, filename);
+
+    // The attribute vectors reference the mapped file, which stays valid after the file has been removed.
+    const auto parsed_table = BinaryParser::parse(filename, BinaryParserMode::MemoryMapped);
+    std::remove(filename.c_str());
+    EXPECT_TABLE_EQ_ORDERED(parsed_table, table);
+
+    const auto segment = std::dynamic_pointer_cast<const DictionarySegment<int32_t>>(
+        parsed_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+    ASSERT_TRUE(segment);
+    EXPECT_EQ(segment->attribute_vector()->size(), 2);
+  }
+}
+
+TEST_F(BinaryParserTest, MemoryMappedTableSurvivesRewrite) {
+  const auto filename = test_data_path + "memory_mapped_rewrite.bin";
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+  BinaryWriter::write(*table, filename);
+  const auto parsed_table = BinaryParser::parse(filename, BinaryParserMode::MemoryMapped);
+
+  // Writing the file again replaces it instead of truncating the mapped file.
+  const auto other_table = load_table("resources/test_data/tbl/int_float2.tbl", 2);
+  BinaryWriter::write(*other_table, filename);
+  EXPECT_TABLE_EQ_ORDERED(parsed_table, table);
+  EXPECT_TABLE_EQ_ORDERED(BinaryParser::parse(filename, BinaryParserMode::MemoryMapped), other_table);
+
+  std::remove(filename.c_str());
+}
+
+TEST_F(BinaryParserTest, MemoryMappedInvalidFile) {
+  const auto filename = _reference_filepath + "InvalidEncodingType.bin";
+  EXPECT_THROW(BinaryParser::parse(filename, BinaryParserMode::MemoryMapped), std::exception);
+  EXPECT_THROW(BinaryParser::parse("not_existing_file", BinaryParserMode::MemoryMapped), std::exception);
+}
+
+TEST_F(BinaryParserTest, UnsupportedFormatVersion) {
+  const auto filename = test_data_path + "unsupported_format_version.bin";
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+  BinaryWriter::write(*table, filename);
+
+  // Files without a format version (i.e., version 1) start with the chunk size instead.
+  {
+    auto file = std::fstream{filename, std::ios::binary | std::ios::in | std::ios::out};
+    const auto format_version = uint32_t{1};
+    file.write(reinterpret_cast<const char*>(&format_version), sizeof(format_version));
+  }
+
+  EXPECT_THROW(BinaryParser::parse(filename), std::exception);
+  EXPECT_THROW(BinaryParser::parse(filename, BinaryParserMode::MemoryMapped), std::exception);
+
+  std::remove(filename.c_str());
+}
+
 TEST_F(BinaryParserTest, TwoColumnsNoValues) {
   TableColumnDefinitions column_definitions;
   column_definitions.emplace_back("FirstColumn", DataType::Int, false);
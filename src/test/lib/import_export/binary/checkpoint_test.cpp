@@ -0,0 +1,189 @@
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "base_test.hpp"
+
+#include "concurrency/redo_log.hpp"
+#include "hyrise.hpp"
+#include "import_export/binary/checkpoint.hpp"
+
+namespace opossum {
+
+class CheckpointTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Chunk 0 is finalized, chunk 1 (containing one row) is still mutable.
+    const auto table = load_table("resources/test_data/tbl/int_float.tbl", 2, FinalizeLastChunk::No);
+    Hyrise::get().storage_manager.add_table("table_a", table);
+  }
+
+  void TearDown() override {
+    Hyrise::get().redo_log.disable();
+    std::filesystem::remove_all(checkpoint_directory);
+    std::filesystem::remove(log_file_path);
+  }
+
+  static void execute_sql(const std::string& sql,
+                          const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    auto builder = SQLPipelineBuilder{sql};
+    if (transaction_context) builder.with_transaction_context(transaction_context);
+    auto pipeline = builder.create_pipeline();
+    const auto [pipeline_status, table] = pipeline.get_result_table();
+    ASSERT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  }
+
+  static std::shared_ptr<const Table> select_all() {
+    auto pipeline = SQLPipelineBuilder{"SELECT * FROM table_a"}.create_pipeline();
+    return pipeline.get_result_table().second;
+  }
+
+  const std::string checkpoint_directory = test_data_path + "checkpoint_test/";
+  const std::string log_file_path = test_data_path + "checkpoint_test.log";
+};
+
+TEST_F(CheckpointTest, WriteAndLoad) {
+  execute_sql("DELETE FROM table_a WHERE a = 123");
+  execute_sql("INSERT INTO table_a VALUES (1, 1.5)");
+  execute_sql("INSERT INTO table_a VALUES (2, 2.5)");
+  const auto expected_table = select_all();
+
+  auto checkpoint = Checkpoint{checkpoint_directory};
+  const auto snapshot_commit_id = checkpoint.write();
+  EXPECT_EQ(snapshot_commit_id, Hyrise::get().transaction_manager.last_commit_id());
+  EXPECT_TRUE(Checkpoint::exists(checkpoint_directory));
+
+  Hyrise::reset();
+  EXPECT_EQ(Checkpoint::load(checkpoint_directory), snapshot_commit_id);
+
+  // The physical layout is preserved, including the deleted row.
+  const auto table = Hyrise::get().storage_manager.get_table("table_a");
+  EXPECT_EQ(table->chunk_count(), 3);
+  EXPECT_EQ(table->row_count(), 5);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->invalid_row_count(), 1);
+  EXPECT_TABLE_EQ_UNORDERED(select_all(), expected_table);
+}
+
+TEST_F(CheckpointTest, RemovedChunks) {
+  execute_sql("INSERT INTO table_a VALUES (1, 1.5)");
+  execute_sql("INSERT INTO table_a VALUES (2, 2.5)");
+  execute_sql("DELETE FROM table_a WHERE a = 1234 OR a = 1");
+  Hyrise::get().storage_manager.get_table("table_a")->remove_chunk(ChunkID{1});
+  const auto expected_table = select_all();
+
+  auto checkpoint = Checkpoint{checkpoint_directory};
+  checkpoint.write();
+
+  Hyrise::reset();
+  Checkpoint::load(checkpoint_directory);
+
+  // The removed chunk in the middle of the table stays removed, the following chunk keeps its ChunkID.
+  const auto table = Hyrise::get().storage_manager.get_table("table_a");
+  EXPECT_EQ(table->chunk_count(), 3);
+  EXPECT_TRUE(table->get_chunk(ChunkID{0}));
+  EXPECT_FALSE(table->get_chunk(ChunkID{1}));
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->size(), 1);
+  EXPECT_EQ(table->row_count(), 3);
+  EXPECT_TABLE_EQ_UNORDERED(select_all(), expected_table);
+
+  // New rows can be inserted after loading.
+  execute_sql("INSERT INTO table_a VALUES (3, 3.5)");
+  EXPECT_EQ(select_all()->row_count(), 4);
+}
+
+TEST_F(CheckpointTest, UncommittedChangesAreNotIncluded) {
+  const auto expected_table = select_all();
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  execute_sql("INSERT INTO table_a VALUES (1, 1.5)", transaction_context);
+  execute_sql("DELETE FROM table_a WHERE a = 12345", transaction_context);
+
+  auto checkpoint = Checkpoint{checkpoint_directory};
+  checkpoint.write();
+  transaction_context->commit();
+
+  Hyrise::reset();
+  Checkpoint::load(checkpoint_directory);
+  EXPECT_TABLE_EQ_UNORDERED(select_all(), expected_table);
+}
+
+TEST_F(CheckpointTest, OnlyChangedChunksAreWritten) {
+  auto checkpoint = Checkpoint{checkpoint_directory};
+  checkpoint.write();
+  EXPECT_EQ(checkpoint.written_chunk_count(), 2);
+  EXPECT_EQ(checkpoint.reused_chunk_count(), 0);
+
+  checkpoint.write();
+  EXPECT_EQ(checkpoint.written_chunk_count(), 0);
+  EXPECT_EQ(checkpoint.reused_chunk_count(), 2);
+
+  execute_sql("INSERT INTO table_a VALUES (1, 1.5)");
+  checkpoint.write();
+  EXPECT_EQ(checkpoint.written_chunk_count(), 1);
+  EXPECT_EQ(checkpoint.reused_chunk_count(), 1);
+
+  // Deletes only change the meta file.
+  execute_sql("DELETE FROM table_a WHERE a = 123");
+  checkpoint.write();
+  EXPECT_EQ(checkpoint.written_chunk_count(), 0);
+  EXPECT_EQ(checkpoint.reused_chunk_count(), 2);
+
+  // Files of previous checkpoints that are not referenced anymore have been removed.
+  auto file_count = size_t{0};
+  for (const auto& entry : std::filesystem::directory_iterator{checkpoint_directory + "table_a"}) {
+    if (entry.is_regular_file()) ++file_count;
+  }
+  EXPECT_EQ(file_count, 2);
+
+  const auto expected_table = select_all();
+  Hyrise::reset();
+  Checkpoint::load(checkpoint_directory);
+  EXPECT_TABLE_EQ_UNORDERED(select_all(), expected_table);
+}
+
+TEST_F(CheckpointTest, DroppedTablesAreRemoved) {
+  auto checkpoint = Checkpoint{checkpoint_directory};
+  checkpoint.write();
+  EXPECT_TRUE(std::filesystem::exists(checkpoint_directory + "table_a"));
+
+  Hyrise::get().storage_manager.drop_table("table_a");
+  checkpoint.write();
+  EXPECT_FALSE(std::filesystem::exists(checkpoint_directory + "table_a"));
+}
+
+TEST_F(CheckpointTest, BackgroundCheckpoints) {
+  auto checkpoint = Checkpoint{checkpoint_directory};
+  checkpoint.start_background(std::chrono::milliseconds{10});
+  while (!Checkpoint::exists(checkpoint_directory)) std::this_thread::sleep_for(std::chrono::milliseconds{10});
+  checkpoint.stop_background();
+
+  Hyrise::reset();
+  Checkpoint::load(checkpoint_directory);
+  EXPECT_EQ(Hyrise::get().storage_manager.get_table("table_a")->row_count(), 3);
+}
+
+TEST_F(CheckpointTest, TruncateRedoLog) {
+  auto& redo_log = Hyrise::get().redo_log;
+  redo_log.enable(log_file_path);
+
+  execute_sql("INSERT INTO table_a VALUES (1, 1.5)");
+  auto checkpoint = Checkpoint{checkpoint_directory};
+  const auto snapshot_commit_id = checkpoint.write();
+  EXPECT_EQ(std::filesystem::file_size(log_file_path), 0);
+
+  execute_sql("INSERT INTO table_a VALUES (2, 2.5)");
+  execute_sql("DELETE FROM table_a WHERE a = 1");
+  redo_log.disable();
+  const auto expected_table = select_all();
+
+  // Only the records written after the checkpoint are replayed. Afterwards, new transactions continue with commit ids
+  // that are higher than the recovered ones.
+  Hyrise::reset();
+  EXPECT_EQ(RedoLog::recover(log_file_path, checkpoint_directory), 2);
+  EXPECT_TABLE_EQ_UNORDERED(select_all(), expected_table);
+  EXPECT_EQ(Hyrise::get().transaction_manager.last_commit_id(), snapshot_commit_id + 2);
+}
+
+}  // namespace opossum
@@ -1,3 +1,5 @@
+#include <fstream>
+
 #include "base_test.hpp"
 
 #include "hyrise.hpp"
@@ -5,6 +7,7 @@
 #include "scheduler/immediate_execution_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -304,4 +307,47 @@ TEST_F(CsvParserTest, FinalizedChunks) {
   EXPECT_FALSE(table->get_chunk(ChunkID{2})->is_mutable());
 }
 
+TEST_F(CsvParserTest, QuotedValuesSpanningBlocks) {
+  // Field ends are searched for in blocks of 64 bytes. Make sure that quoted values containing separators, delimiters,
+  // and escaped quotes are recognized across block boundaries.
+  const auto long_value = std::string(100, 'x');
+  const auto csv_file = test_data_path + "quoted_values_spanning_blocks.csv";
+  {
+    auto file = std::ofstream{csv_file};
+    file << "1,\"" << long_value << ",\n" << long_value << "\"\n";
+    file << "2,\"" << long_value << "\"\"" << long_value << "\"\n";
+    file << "3," << long_value;
+  }
+
+  auto csv_meta = CsvMeta{};
+  csv_meta.columns = {{"a", "int", false}, {"b", "string", false}};
+  const auto table = CsvParser::parse(csv_file, ChunkOffset{2}, csv_meta);
+
+  TableColumnDefinitions column_definitions{{"a", DataType::Int, false}, {"b", DataType::String, false}};
+  auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  expected_table->append({1, pmr_string{long_value + ",\n" + long_value}});
+  expected_table->append({2, pmr_string{long_value + "\"" + long_value}});
+  expected_table->append({3, pmr_string{long_value}});
+
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+  EXPECT_EQ(table->chunk_count(), 2U);
+  std::remove(csv_file.c_str());
+}
+
+TEST_F(CsvParserTest, EncodeWhileParsing) {
+  const auto chunk_encoding_spec =
+      ChunkEncodingSpec{SegmentEncodingSpec{EncodingType::Dictionary}, SegmentEncodingSpec{EncodingType::Dictionary}};
+  const auto table = CsvParser::parse("resources/test_data/csv/float_int_large.csv", ChunkOffset{40}, std::nullopt,
+                                      chunk_encoding_spec);
+
+  EXPECT_TABLE_EQ_ORDERED(table, CsvParser::parse("resources/test_data/csv/float_int_large.csv", ChunkOffset{40}));
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<float>>(chunk->get_segment(ColumnID{0})));
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk->get_segment(ColumnID{1})));
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_TRUE(chunk->pruning_statistics());
+  }
+}
+
 }  // namespace opossum
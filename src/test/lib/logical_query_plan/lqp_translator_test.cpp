@@ -41,6 +41,7 @@
 #include "operators/join_hash.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
+#include "operators/key_index_scan.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
 #include "operators/maintenance/create_table.hpp"
@@ -593,6 +594,32 @@ TEST_F(LQPTranslatorTest, PredicateNodeIndexScanFailsWhenNotApplicable) {
   EXPECT_THROW(LQPTranslator{}.translate_node(predicate_node2), std::logic_error);
 }
 
+TEST_F(LQPTranslatorTest, PredicateNodeKeyIndexScan) {
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+  const auto a = stored_table_node->get_column("a");
+  const auto b = stored_table_node->get_column("b");
+
+  const auto table = Hyrise::get().storage_manager.get_table("int_float_chunked");
+  table->add_soft_key_constraint({{ColumnID{0}}, KeyConstraintType::UNIQUE});
+  table->create_key_index(table->soft_key_constraints().front());
+
+  auto predicate_node = PredicateNode::make(equals_(123, a));
+  predicate_node->set_left_input(stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+  const auto op = LQPTranslator{}.translate_node(predicate_node);
+
+  const auto key_index_scan_op = std::dynamic_pointer_cast<const KeyIndexScan>(op);
+  ASSERT_TRUE(key_index_scan_op);
+  EXPECT_EQ(key_index_scan_op->left_input()->type(), OperatorType::GetTable);
+  EXPECT_EQ(key_index_scan_op->lqp_node, predicate_node);
+
+  // Predicates that do not cover a key index are translated as usual.
+  auto non_key_predicate_node = PredicateNode::make(and_(equals_(a, 123), equals_(b, 456.7f)));
+  non_key_predicate_node->set_left_input(stored_table_node);
+  non_key_predicate_node->scan_type = ScanType::IndexScan;
+  EXPECT_THROW(LQPTranslator{}.translate_node(non_key_predicate_node), std::logic_error);
+}
+
 TEST_F(LQPTranslatorTest, ProjectionNode) {
   /**
    * Build LQP and translate to PQP
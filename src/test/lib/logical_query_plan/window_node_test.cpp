@@ -0,0 +1,78 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "expression/window_function_expression.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/window_node.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class WindowNodeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _mock_node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Float, "b"}}, "t_a");
+
+    _a = _mock_node->get_column("a");
+    _b = _mock_node->get_column("b");
+
+    _rank = std::make_shared<WindowFunctionExpression>(WindowFunction::Rank, nullptr, expression_vector(_a),
+                                                       expression_vector(_b),
+                                                       std::vector<SortMode>{SortMode::Descending});
+    _window_node = WindowNode::make(_rank, _mock_node);
+  }
+
+  std::shared_ptr<MockNode> _mock_node;
+  std::shared_ptr<LQPColumnExpression> _a, _b;
+  std::shared_ptr<WindowFunctionExpression> _rank;
+  std::shared_ptr<WindowNode> _window_node;
+};
+
+TEST_F(WindowNodeTest, Description) {
+  EXPECT_EQ(_window_node->description(),
+            "[Window] RANK() OVER (PARTITION BY a ORDER BY b DESC RANGE BETWEEN UNBOUNDED PRECEDING AND CURRENT ROW)");
+}
+
+TEST_F(WindowNodeTest, OutputExpressions) {
+  EXPECT_EQ(_window_node->output_expressions(), expression_vector(_a, _b, _rank));
+  EXPECT_EQ(_window_node->window_function_expression(), _rank);
+  EXPECT_EQ(_rank->data_type(), DataType::Long);
+}
+
+TEST_F(WindowNodeTest, Nullability) {
+  EXPECT_FALSE(_window_node->is_column_nullable(ColumnID{2}));
+
+  const auto sum = std::make_shared<WindowFunctionExpression>(WindowFunction::Sum, _b, expression_vector(),
+                                                              expression_vector(), std::vector<SortMode>{});
+  const auto sum_node = WindowNode::make(sum, _mock_node);
+  EXPECT_TRUE(sum_node->is_column_nullable(ColumnID{2}));
+  EXPECT_EQ(sum->data_type(), DataType::Double);
+}
+
+TEST_F(WindowNodeTest, HashingAndEqualityCheck) {
+  EXPECT_EQ(*_window_node, *_window_node);
+
+  const auto same_rank = std::make_shared<WindowFunctionExpression>(
+      WindowFunction::Rank, nullptr, expression_vector(_a), expression_vector(_b),
+      std::vector<SortMode>{SortMode::Descending});
+  const auto same_window_node = WindowNode::make(same_rank, _mock_node);
+  EXPECT_EQ(*_window_node, *same_window_node);
+  EXPECT_EQ(_window_node->hash(), same_window_node->hash());
+
+  const auto different_sort_mode = std::make_shared<WindowFunctionExpression>(
+      WindowFunction::Rank, nullptr, expression_vector(_a), expression_vector(_b),
+      std::vector<SortMode>{SortMode::Ascending});
+  const auto different_partitioning = std::make_shared<WindowFunctionExpression>(
+      WindowFunction::Rank, nullptr, expression_vector(), expression_vector(_a, _b),
+      std::vector<SortMode>{SortMode::Descending, SortMode::Descending});
+  EXPECT_NE(*_window_node, *WindowNode::make(different_sort_mode, _mock_node));
+  EXPECT_NE(*_window_node, *WindowNode::make(different_partitioning, _mock_node));
+}
+
+TEST_F(WindowNodeTest, Copy) { EXPECT_EQ(*_window_node->deep_copy(), *_window_node); }
+
+}  // namespace opossum
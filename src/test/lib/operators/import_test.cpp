@@ -9,7 +9,9 @@
 #include "scheduler/immediate_execution_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/frame_of_reference_segment.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
 
 namespace opossum {
 
@@ -136,4 +138,23 @@ TEST_F(OperatorsImportTest, TargetChunkSize) {
   EXPECT_TABLE_EQ_ORDERED(Hyrise::get().storage_manager.get_table("a"), expected_table);
 }
 
+TEST_F(OperatorsImportTest, TargetEncoding) {
+  const auto filenames =
+      std::vector<std::string>{"resources/test_data/csv/float_int_large.csv", "resources/test_data/tbl/float_int.tbl"};
+  for (const auto& filename : filenames) {
+    auto importer = std::make_shared<Import>(filename, "a", ChunkOffset{20}, FileType::Auto, std::nullopt,
+                                             EncodingType::FrameOfReference);
+    importer->execute();
+
+    const auto table = Hyrise::get().storage_manager.get_table("a");
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      // FrameOfReference does not support floats, so the first column stays unencoded.
+      const auto chunk = table->get_chunk(chunk_id);
+      EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<float>>(chunk->get_segment(ColumnID{0})));
+      EXPECT_TRUE(std::dynamic_pointer_cast<FrameOfReferenceSegment<int32_t>>(chunk->get_segment(ColumnID{1})));
+      EXPECT_TRUE(chunk->pruning_statistics());
+    }
+  }
+}
+
 }  // namespace opossum
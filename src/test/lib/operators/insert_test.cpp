@@ -12,7 +12,13 @@
 #include "operators/projection.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/statistics_refresher.hpp"
+#include "statistics/table_statistics.hpp"
+#include "statistics/table_statistics_delta.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/index/table_key_index.hpp"
 #include "storage/table.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -320,4 +326,113 @@ TEST_F(OperatorsInsertTest, InsertIntoEmptyTable) {
   EXPECT_TABLE_EQ_ORDERED(target_table, table_int_float);
 }
 
+TEST_F(OperatorsInsertTest, FinalizeCompletedChunks) {
+  // 3 Rows, chunk_size = 4
+  const auto table = load_table("resources/test_data/tbl/int.tbl", 4u);
+  Hyrise::get().storage_manager.add_table("target_table", table);
+
+  const auto get_table = std::make_shared<GetTable>("target_table");
+  get_table->execute();
+
+  // Two concurrent Inserts fill up chunk 1. It is finalized once the second one is done.
+  const auto insert_a = std::make_shared<Insert>("target_table", get_table);
+  const auto context_a = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  insert_a->set_transaction_context(context_a);
+  insert_a->execute();
+
+  const auto insert_b = std::make_shared<Insert>("target_table", get_table);
+  const auto context_b = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  insert_b->set_transaction_context(context_b);
+  insert_b->execute();
+
+  ASSERT_EQ(table->chunk_count(), 3u);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->size(), 4u);
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->size(), 2u);
+
+  context_b->commit();
+  EXPECT_TRUE(table->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_FALSE(table->get_chunk(ChunkID{1})->pruning_statistics());
+
+  context_a->rollback(RollbackReason::User);
+  EXPECT_FALSE(table->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_TRUE(table->get_chunk(ChunkID{1})->pruning_statistics());
+  EXPECT_EQ(*table->get_chunk(ChunkID{1})->mvcc_data()->max_begin_cid, context_b->commit_id());
+  EXPECT_TRUE(table->get_chunk(ChunkID{2})->is_mutable());
+}
+
+TEST_F(OperatorsInsertTest, UpdateTableStatistics) {
+  const auto table = load_table("resources/test_data/tbl/int.tbl", 4u);
+  Hyrise::get().storage_manager.add_table("target_table", table);
+
+  const auto values = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/10_ints.tbl"));
+  values->execute();
+
+  const auto insert = std::make_shared<Insert>("target_table", values);
+  const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  insert->set_transaction_context(context);
+  insert->execute();
+
+  // The committed rows are recorded in the delta, which the StatisticsRefresher merges into the statistics.
+  EXPECT_FLOAT_EQ(table->table_statistics()->row_count, 3);
+  context->commit();
+  EXPECT_FLOAT_EQ(table->table_statistics()->row_count, 3);
+
+  StatisticsRefresher{}.refresh();
+  const auto table_statistics = table->table_statistics();
+  EXPECT_FLOAT_EQ(table_statistics->row_count, 13);
+  const auto histogram =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(0))->histogram;
+  EXPECT_FLOAT_EQ(histogram->total_count(), 13);
+
+  // Rolled-back rows are not recorded.
+  const auto rolled_back_insert = std::make_shared<Insert>("target_table", values);
+  const auto rolled_back_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  rolled_back_insert->set_transaction_context(rolled_back_context);
+  rolled_back_insert->execute();
+  rolled_back_context->rollback(RollbackReason::User);
+  EXPECT_FALSE(table->table_statistics_delta()->take());
+}
+
+TEST_F(OperatorsInsertTest, EnforceKeyConstraint) {
+  // Contains the keys 12345, 123, and 1234.
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl", 2u);
+  table->add_soft_key_constraint({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+  table->create_key_index(table->soft_key_constraints().front());
+  Hyrise::get().storage_manager.add_table("target_table", table);
+
+  // Returns whether the rows were inserted.
+  const auto insert_rows = [&](const std::vector<std::vector<AllTypeVariant>>& rows) {
+    const auto values_table = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+    for (const auto& row : rows) {
+      values_table->append(row);
+    }
+    const auto values = std::make_shared<TableWrapper>(values_table);
+    values->execute();
+
+    const auto insert = std::make_shared<Insert>("target_table", values);
+    const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    insert->set_transaction_context(context);
+    insert->execute();
+
+    if (insert->execute_failed()) {
+      context->rollback(RollbackReason::Conflict);
+      return false;
+    }
+    context->commit();
+    return true;
+  };
+
+  EXPECT_TRUE(insert_rows({{1, 1.0f}}));
+  EXPECT_FALSE(insert_rows({{2, 2.0f}, {123, 3.0f}}));
+  EXPECT_FALSE(insert_rows({{3, 3.0f}, {3, 4.0f}}));
+
+  // The rolled back rows were removed from the index, so that their keys can be inserted again.
+  EXPECT_TRUE(insert_rows({{2, 2.0f}, {3, 3.0f}}));
+
+  const auto key_index = table->key_index({ColumnID{0}});
+  EXPECT_EQ(key_index->lookup({2}).size(), 1);
+  EXPECT_EQ(key_index->lookup({3}).size(), 1);
+  EXPECT_EQ(key_index->lookup({123}).size(), 1);
+}
+
 }  // namespace opossum
@@ -0,0 +1,95 @@
+#include "base_test.hpp"
+
+#include "operators/join_hash/bloom_filter.hpp"
+
+namespace opossum {
+
+class BloomFilterTest : public BaseTest {};
+
+TEST_F(BloomFilterTest, DefaultConstructedFilterContainsEverything) {
+  const auto bloom_filter = BloomFilter{};
+  EXPECT_EQ(bloom_filter.bit_count(), 64);
+  for (auto hash = size_t{0}; hash < 1'000; ++hash) {
+    EXPECT_TRUE(bloom_filter.contains(hash));
+  }
+}
+
+TEST_F(BloomFilterTest, BitCountFor) {
+  EXPECT_EQ(BloomFilter::bit_count_for(0), BloomFilter::MIN_BIT_COUNT);
+  EXPECT_EQ(BloomFilter::bit_count_for(10), BloomFilter::MIN_BIT_COUNT);
+  EXPECT_EQ(BloomFilter::bit_count_for(100'000), size_t{1} << 21);
+  EXPECT_EQ(BloomFilter::bit_count_for(1'000'000'000), BloomFilter::MAX_BIT_COUNT);
+
+  EXPECT_THROW(BloomFilter{100}, std::logic_error);
+  EXPECT_THROW(BloomFilter{32}, std::logic_error);
+}
+
+TEST_F(BloomFilterTest, InsertAndContains) {
+  const auto value_count = size_t{100'000};
+  auto bloom_filter = BloomFilter{BloomFilter::bit_count_for(value_count)};
+
+  // Use dense integers, whose std::hash is the identity function, as in the hash join.
+  for (auto hash = size_t{0}; hash < value_count; ++hash) {
+    bloom_filter.insert(hash);
+  }
+
+  for (auto hash = size_t{0}; hash < value_count; ++hash) {
+    EXPECT_TRUE(bloom_filter.contains(hash));
+  }
+
+  auto false_positive_count = size_t{0};
+  for (auto hash = value_count; hash < 2 * value_count; ++hash) {
+    false_positive_count += bloom_filter.contains(hash);
+  }
+  EXPECT_LT(false_positive_count, value_count / 100);
+}
+
+TEST_F(BloomFilterTest, Merge) {
+  auto bloom_filter_a = BloomFilter{BloomFilter::MIN_BIT_COUNT};
+  auto bloom_filter_b = BloomFilter{BloomFilter::MIN_BIT_COUNT};
+  bloom_filter_a.insert(17);
+  bloom_filter_b.insert(42);
+  EXPECT_FALSE(bloom_filter_a.contains(42));
+
+  bloom_filter_a |= bloom_filter_b;
+  EXPECT_TRUE(bloom_filter_a.contains(17));
+  EXPECT_TRUE(bloom_filter_a.contains(42));
+  EXPECT_FALSE(bloom_filter_a == bloom_filter_b);
+
+  auto bloom_filter_c = BloomFilter{BloomFilter::MIN_BIT_COUNT * 2};
+  EXPECT_THROW(bloom_filter_a |= bloom_filter_c, std::logic_error);
+}
+
+TEST_F(BloomFilterTest, AdaptiveBloomFilterKeepsSelectiveFilter) {
+  auto bloom_filter = BloomFilter{BloomFilter::MIN_BIT_COUNT};
+  bloom_filter.insert(1);
+
+  auto is_selective = std::atomic_bool{true};
+  auto adaptive_bloom_filter = AdaptiveBloomFilter{bloom_filter, is_selective};
+  for (auto hash = size_t{0}; hash < 2 * AdaptiveBloomFilter::SAMPLE_SIZE; ++hash) {
+    EXPECT_EQ(adaptive_bloom_filter.contains(hash), hash == 1);
+  }
+  EXPECT_TRUE(is_selective);
+}
+
+TEST_F(BloomFilterTest, AdaptiveBloomFilterDropsNonSelectiveFilter) {
+  auto bloom_filter = BloomFilter{BloomFilter::MIN_BIT_COUNT};
+  for (auto hash = size_t{0}; hash < AdaptiveBloomFilter::SAMPLE_SIZE; ++hash) {
+    bloom_filter.insert(hash);
+  }
+
+  // All sampled values pass the filter. Afterwards, the filter is not checked anymore.
+  auto is_selective = std::atomic_bool{true};
+  auto adaptive_bloom_filter = AdaptiveBloomFilter{bloom_filter, is_selective};
+  for (auto hash = size_t{0}; hash < AdaptiveBloomFilter::SAMPLE_SIZE; ++hash) {
+    EXPECT_TRUE(adaptive_bloom_filter.contains(hash));
+  }
+  EXPECT_FALSE(is_selective);
+  EXPECT_TRUE(adaptive_bloom_filter.contains(100'000));
+
+  // Filters created afterwards do not check the Bloom filter at all.
+  auto other_adaptive_bloom_filter = AdaptiveBloomFilter{bloom_filter, is_selective};
+  EXPECT_TRUE(other_adaptive_bloom_filter.contains(100'000));
+}
+
+}  // namespace opossum
@@ -165,16 +165,21 @@ TEST_F(JoinHashStepsTest, MaterializeOutputBloomFilter) {
     materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0}, histograms, 1,
                                        bloom_filter);
 
-    // For all input values, their position in the bloom filter should be correctly set to true
-    for (auto value : std::vector<int>{0, 6, 7, 9, 13, 18}) {
-      EXPECT_TRUE(bloom_filter[value]);
-
-      // Set to false for easier checking of the values that should be false
-      bloom_filter[value] = false;
+    // The Bloom filter is sized for the input table
+    const auto row_count = _table_with_nulls_and_zeros->get_output()->row_count();
+    EXPECT_EQ(bloom_filter.bit_count(), BloomFilter::bit_count_for(row_count));
+
+    // All input values should be contained in the Bloom filter
+    const auto input_values = std::vector<int>{0, 6, 7, 9, 13, 18};
+    for (auto value : input_values) {
+      EXPECT_TRUE(bloom_filter.contains(std::hash<int>{}(value)));
     }
 
-    // All other slots should be false
-    EXPECT_EQ(bloom_filter, BloomFilter{BLOOM_FILTER_SIZE});
+    // For so few values, there are no false positives
+    for (auto value = 0; value < 100; ++value) {
+      if (std::find(input_values.begin(), input_values.end(), value) != input_values.end()) continue;
+      EXPECT_FALSE(bloom_filter.contains(std::hash<int>{}(value)));
+    }
   }
 }
 
@@ -184,9 +189,9 @@ TEST_F(JoinHashStepsTest, MaterializeInputBloomFilter) {
     BloomFilter output_bloom_filter;
 
     // Fill input_bloom_filter
-    BloomFilter input_bloom_filter(BLOOM_FILTER_SIZE);
+    auto input_bloom_filter = BloomFilter{BloomFilter::MIN_BIT_COUNT};
     for (auto value : std::vector<int>{6, 7, 9}) {
-      input_bloom_filter[value] = true;
+      input_bloom_filter.insert(std::hash<int>{}(value));
     }
 
     auto container = materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0},
@@ -279,14 +284,40 @@ TEST_F(JoinHashStepsTest, RadixClusteringOfNulls) {
   }
 }
 
+TEST_F(JoinHashStepsTest, PartitionByRadixRespectsBloomFilter) {
+  const auto radix_bit_count = size_t{2};
+  std::vector<std::vector<size_t>> histograms;
+  BloomFilter output_bloom_filter;  // Ignored in this test
+
+  auto input_bloom_filter = BloomFilter{BloomFilter::MIN_BIT_COUNT};
+  for (auto value : std::vector<int>{6, 7, 9}) {
+    input_bloom_filter.insert(std::hash<int>{}(value));
+  }
+
+  const auto container = materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0},
+                                                            histograms, radix_bit_count, output_bloom_filter);
+  const auto radix_cluster_result =
+      partition_by_radix<int, int, false>(container, histograms, radix_bit_count, input_bloom_filter);
+  EXPECT_EQ(radix_cluster_result.size(), 4);
+
+  // The gaps left by the skipped values have been removed, the remaining values keep their order.
+  auto partitioned_values = std::vector<int>{};
+  for (const auto& partition : radix_cluster_result) {
+    for (const auto& element : partition.elements) {
+      partitioned_values.emplace_back(element.value);
+    }
+  }
+  EXPECT_EQ(partitioned_values, (std::vector<int>{9, 9, 6, 7, 7, 7}));
+}
+
 TEST_F(JoinHashStepsTest, BuildRespectsBloomFilter) {
   std::vector<std::vector<size_t>> histograms;  // Ignored in this test
   BloomFilter output_bloom_filter;              // Ignored in this test
 
   // Fill input_bloom_filter
-  BloomFilter input_bloom_filter(BLOOM_FILTER_SIZE);
+  auto input_bloom_filter = BloomFilter{BloomFilter::MIN_BIT_COUNT};
   for (auto value : std::vector<int>{6, 7, 9}) {
-    input_bloom_filter[value] = true;
+    input_bloom_filter.insert(std::hash<int>{}(value));
   }
 
   auto container = materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0},
@@ -1,7 +1,10 @@
 #include "base_test.hpp"
 
+#include "hyrise.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_hash/join_hash_steps.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -119,4 +122,35 @@ TEST_F(OperatorsJoinHashTest, RadixBitCalculation) {
             0ul);
 }
 
+TEST_F(OperatorsJoinHashTest, NUMAPlacementOfPartitions) {
+  // Join with radix partitioning on a fake NUMA topology with four nodes. The partitions are distributed across the
+  // nodes and the results are the same as without a scheduler.
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto join_modes = std::vector<JoinMode>{JoinMode::Inner, JoinMode::Left, JoinMode::Semi,
+                                                JoinMode::AntiNullAsFalse};
+
+  auto expected_tables = std::vector<std::shared_ptr<const Table>>{};
+  for (const auto join_mode : join_modes) {
+    const auto join = std::make_shared<JoinHash>(_table_tpch_orders, _table_tpch_lineitems, join_mode,
+                                                 primary_predicate, std::vector<OperatorJoinPredicate>{}, 3);
+    join->execute();
+    expected_tables.emplace_back(join->get_output());
+  }
+  EXPECT_EQ(node_id_for_partition(5), CURRENT_NODE_ID);
+
+  Hyrise::get().topology.use_fake_numa_topology(8, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  EXPECT_EQ(node_id_for_partition(0), NodeID{0});
+  EXPECT_EQ(node_id_for_partition(5), NodeID{1});
+
+  for (auto join_mode_idx = size_t{0}; join_mode_idx < join_modes.size(); ++join_mode_idx) {
+    const auto join = std::make_shared<JoinHash>(_table_tpch_orders, _table_tpch_lineitems, join_modes[join_mode_idx],
+                                                 primary_predicate, std::vector<OperatorJoinPredicate>{}, 3);
+    join->execute();
+    EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_tables[join_mode_idx]);
+  }
+
+  Hyrise::get().scheduler()->finish();
+}
+
 }  // namespace opossum
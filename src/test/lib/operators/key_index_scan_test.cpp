@@ -0,0 +1,106 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "operators/get_table.hpp"
+#include "operators/key_index_scan.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsKeyIndexScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table = load_table("resources/test_data/tbl/int_int_float.tbl", 2u);
+    ChunkEncoder::encode_all_chunks(table);
+    table->add_soft_key_constraint({{ColumnID{0}, ColumnID{2}}, KeyConstraintType::UNIQUE});
+    table->create_key_index(table->soft_key_constraints().front());
+    Hyrise::get().storage_manager.add_table("int_int_float", table);
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(OperatorsKeyIndexScanTest, Lookup) {
+  const auto get_table = std::make_shared<GetTable>("int_int_float");
+  get_table->execute();
+
+  // The order of the key columns does not matter.
+  const auto key_index_scan =
+      std::make_shared<KeyIndexScan>(get_table, std::vector<ColumnID>{ColumnID{2}, ColumnID{0}},
+                                     expression_vector(9.5f, 9));
+  key_index_scan->execute();
+
+  const auto expected_table = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  expected_table->append({9, 10, 9.5f});
+  EXPECT_TABLE_EQ_UNORDERED(key_index_scan->get_output(), expected_table);
+  EXPECT_EQ(key_index_scan->get_output()->type(), TableType::References);
+}
+
+TEST_F(OperatorsKeyIndexScanTest, NoMatch) {
+  const auto get_table = std::make_shared<GetTable>("int_int_float");
+  get_table->execute();
+
+  const auto key_index_scan =
+      std::make_shared<KeyIndexScan>(get_table, std::vector<ColumnID>{ColumnID{0}, ColumnID{2}},
+                                     expression_vector(9, 10.5f));
+  key_index_scan->execute();
+
+  EXPECT_EQ(key_index_scan->get_output()->row_count(), 0);
+  EXPECT_EQ(key_index_scan->get_output()->column_count(), 3);
+}
+
+TEST_F(OperatorsKeyIndexScanTest, PrunedColumns) {
+  const auto get_table = std::make_shared<GetTable>("int_int_float", std::vector<ChunkID>{},
+                                                    std::vector<ColumnID>{ColumnID{0}});
+  get_table->execute();
+
+  const auto key_index_scan =
+      std::make_shared<KeyIndexScan>(get_table, std::vector<ColumnID>{ColumnID{0}, ColumnID{2}},
+                                     expression_vector(10, 10.5f));
+  key_index_scan->execute();
+
+  const auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"b", DataType::Int, false}, {"c", DataType::Float, false}}, TableType::Data);
+  expected_table->append({10, 10.5f});
+  EXPECT_TABLE_EQ_UNORDERED(key_index_scan->get_output(), expected_table);
+}
+
+TEST_F(OperatorsKeyIndexScanTest, CorrelatedParameter) {
+  // Correlated subqueries look up the key of every outer row by setting the parameter before executing their plan.
+  const auto a = PQPColumnExpression::from_table(*table, "a");
+  const auto lookup = [&](const AllTypeVariant& parameter_value) {
+    const auto get_table = std::make_shared<GetTable>("int_int_float");
+    const auto key_index_scan =
+        std::make_shared<KeyIndexScan>(get_table, std::vector<ColumnID>{ColumnID{0}, ColumnID{2}},
+                                       expression_vector(correlated_parameter_(ParameterID{0}, a), 11.5f));
+    key_index_scan->set_parameters({{ParameterID{0}, parameter_value}});
+    get_table->execute();
+    key_index_scan->execute();
+    return key_index_scan->get_output();
+  };
+
+  const auto expected_table = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  expected_table->append({11, 10, 11.5f});
+  EXPECT_TABLE_EQ_UNORDERED(lookup(11), expected_table);
+  EXPECT_EQ(lookup(10)->row_count(), 0);
+  EXPECT_EQ(lookup(NULL_VALUE)->row_count(), 0);
+}
+
+TEST_F(OperatorsKeyIndexScanTest, FailsWithoutKeyIndex) {
+  const auto get_table = std::make_shared<GetTable>("int_int_float");
+  get_table->execute();
+
+  const auto key_index_scan = std::make_shared<KeyIndexScan>(get_table, std::vector<ColumnID>{ColumnID{0}},
+                                                             expression_vector(9));
+  EXPECT_THROW(key_index_scan->execute(), std::logic_error);
+}
+
+}  // namespace opossum
@@ -16,6 +16,7 @@
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_scan/column_between_table_scan_impl.hpp"
+#include "operators/table_scan/column_in_table_scan_impl.hpp"
 #include "operators/table_scan/column_is_null_table_scan_impl.hpp"
 #include "operators/table_scan/column_like_table_scan_impl.hpp"
 #include "operators/table_scan/column_vs_column_table_scan_impl.hpp"
@@ -952,8 +953,11 @@ TEST_P(OperatorsTableScanTest, GetImpl) {
   EXPECT_TRUE(dynamic_cast<ColumnVsColumnTableScanImpl*>(TableScan{get_int_float_op(), equals_(column_b, column_a)}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ColumnLikeTableScanImpl*>(TableScan{get_int_string_op(), like_(column_s, "%s%")}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_string_op(), like_("hello", "%s%")}.create_impl().get()));  // NOLINT
-  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), in_(column_a, list_(1, 2, 3))}.create_impl().get()));  // NOLINT
-  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), in_(column_a, list_(1, 2, 3))}.create_impl().get()));  // NOLINT
+  EXPECT_TRUE(dynamic_cast<ColumnInTableScanImpl*>(TableScan{get_int_float_op(), in_(column_a, list_(1, 2, 3))}.create_impl().get()));  // NOLINT
+  EXPECT_TRUE(dynamic_cast<ColumnInTableScanImpl*>(TableScan{get_int_float_op(), in_(column_a, list_(1, NullValue{}, 3.0f))}.create_impl().get()));  // NOLINT
+  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), in_(column_a, list_(1, 2.5f, 3))}.create_impl().get()));  // NOLINT
+  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), not_in_(column_a, list_(1, 2, 3))}.create_impl().get()));  // NOLINT
+  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), in_(column_a, list_(1, column_b))}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), and_(greater_than_(column_a, 5), less_than_(column_b, 6))}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), greater_than_(column_a, 5.5f)}.create_impl().get()));  // NOLINT
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(TableScan{get_int_float_op(), greater_than_(column_b, 1e40)}.create_impl().get()));  // NOLINT
@@ -1122,6 +1126,84 @@ TEST_P(OperatorsTableScanTest, TwoBigScans) {
   }
 }
 
+TEST_P(OperatorsTableScanTest, InScan) {
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+
+  // int_float_with_null.tbl: a = 12345, 123, NULL, 1234 (chunk size 2). 9 and NULL never match.
+  const auto scan = std::make_shared<TableScan>(get_int_float_with_null_op(),
+                                                in_(column_a, list_(12345, 9, NullValue{}, 1234.0f)));
+  scan->execute();
+  ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, {12345, 1234});
+
+  const auto scan_none = std::make_shared<TableScan>(get_int_float_with_null_op(), in_(column_a, list_(1, 2, 3, 4)));
+  scan_none->execute();
+  EXPECT_EQ(scan_none->get_output()->row_count(), 0);
+
+  // Scan a ReferenceSegment
+  const auto scan_not_null = std::make_shared<TableScan>(get_int_float_with_null_op(), is_not_null_(column_a));
+  scan_not_null->execute();
+  const auto scan_referenced = std::make_shared<TableScan>(scan_not_null, in_(column_a, list_(1234, 1, 2, 3)));
+  scan_referenced->execute();
+  ASSERT_COLUMN_EQ(scan_referenced->get_output(), ColumnID{0}, {1234});
+}
+
+TEST_P(OperatorsTableScanTest, BigScansOnAllVectorCompressionTypes) {
+  // Dictionary segments are scanned on their compressed value ids in blocks of 64 rows if there is no position filter.
+  // Use chunks that end with a partial block and test each vector compression type. For each seventh row, a is NULL.
+  const auto row_count = 1'000;
+  const auto chunk_size = ChunkOffset{500};
+  const auto value_of_row = [](const auto row) { return (row * 37) % 101; };
+
+  auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}};
+  auto data = std::vector<std::optional<int32_t>>{};
+  for (auto row = 0; row < row_count; ++row) {
+    data.emplace_back(row % 7 == 6 ? std::nullopt : std::optional<int32_t>{value_of_row(row)});
+  }
+
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+  const auto predicates_and_conditions =
+      std::vector<std::pair<std::shared_ptr<AbstractExpression>, std::function<bool(int32_t)>>>{
+          {equals_(column_a, 42), [](const auto value) { return value == 42; }},
+          {not_equals_(column_a, 42), [](const auto value) { return value != 42; }},
+          {less_than_(column_a, 50), [](const auto value) { return value < 50; }},
+          {less_than_equals_(column_a, 50), [](const auto value) { return value <= 50; }},
+          {greater_than_(column_a, 50), [](const auto value) { return value > 50; }},
+          {greater_than_equals_(column_a, 0), [](const auto value) { return value >= 0; }},
+          {between_inclusive_(column_a, 10, 20), [](const auto value) { return value >= 10 && value <= 20; }},
+          {between_inclusive_(column_a, -10, 200), [](const auto /*value*/) { return true; }},
+          {in_(column_a, list_(1, 3, 5, 100, 1000)),
+           [](const auto value) { return value == 1 || value == 3 || value == 5 || value == 100; }}};
+
+  for (const auto vector_compression_type :
+       {VectorCompressionType::FixedWidthInteger, VectorCompressionType::BitPacking}) {
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, chunk_size);
+    for (const auto& value : data) {
+      table->append({value ? AllTypeVariant{*value} : AllTypeVariant{NullValue{}}});
+    }
+    table->last_chunk()->finalize();
+
+    auto segment_encoding_spec = SegmentEncodingSpec{_encoding_type};
+    if (_encoding_type == EncodingType::Dictionary) {
+      segment_encoding_spec = SegmentEncodingSpec{_encoding_type, vector_compression_type};
+    }
+    ChunkEncoder::encode_all_chunks(table, segment_encoding_spec);
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    for (const auto& [predicate, condition] : predicates_and_conditions) {
+      auto expected = std::vector<AllTypeVariant>{};
+      for (const auto& value : data) {
+        if (value && condition(*value)) expected.emplace_back(*value);
+      }
+
+      const auto scan = std::make_shared<TableScan>(table_wrapper, predicate);
+      scan->execute();
+      ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, expected);
+    }
+  }
+}
+
 /**
  * Tests for sorted_by flag forwarding.
  */
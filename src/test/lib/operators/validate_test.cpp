@@ -183,6 +183,7 @@ TEST_F(OperatorsValidateTest, ChunkNotEntirelyVisibleWithInvalidRows) {
   vs_int->append(4);
 
   auto chunk = std::make_shared<Chunk>(Segments{vs_int}, std::make_shared<MvccData>(1, begin_cid));
+  chunk->mvcc_data()->set_end_cid(0, snapshot_cid);
   chunk->increase_invalid_row_count(1);
   chunk->finalize();
 
@@ -191,6 +192,25 @@ TEST_F(OperatorsValidateTest, ChunkNotEntirelyVisibleWithInvalidRows) {
   EXPECT_FALSE(forward_is_entire_chunk_visible(validate, chunk, snapshot_cid));
 }
 
+TEST_F(OperatorsValidateTest, ChunkEntirelyVisibleWithRowsInvalidatedAfterSnapshot) {
+  auto snapshot_cid = CommitID{1};
+  auto begin_cid = CommitID{0};
+  auto vs_int = std::make_shared<ValueSegment<int32_t>>();
+  vs_int->append(4);
+  vs_int->append(5);
+
+  // The second row is deleted by a transaction that committed after the snapshot was taken.
+  auto chunk = std::make_shared<Chunk>(Segments{vs_int}, std::make_shared<MvccData>(2, begin_cid));
+  chunk->mvcc_data()->set_end_cid(1, CommitID{2});
+  chunk->increase_invalid_row_count(1);
+  chunk->finalize();
+
+  auto validate = std::make_shared<Validate>(nullptr);
+
+  EXPECT_TRUE(forward_is_entire_chunk_visible(validate, chunk, snapshot_cid));
+  EXPECT_FALSE(forward_is_entire_chunk_visible(validate, chunk, CommitID{2}));
+}
+
 TEST_F(OperatorsValidateTest, ChunkEntirelyVisible) {
   auto snapshot_cid = CommitID{1};
   auto begin_cid = CommitID{0};
@@ -204,6 +224,42 @@ TEST_F(OperatorsValidateTest, ChunkEntirelyVisible) {
   EXPECT_TRUE(forward_is_entire_chunk_visible(validate, chunk, snapshot_cid));
 }
 
+TEST_F(OperatorsValidateTest, ValidateBlocksOfRows) {
+  // Without own modifications, the rows of data chunks are checked in blocks. Use a mutable chunk that spans multiple
+  // blocks and a remainder, with blocks that are fully visible, partially visible, and not visible at all.
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{100}, UseMvcc::Yes);
+  for (auto row = int32_t{0}; row < 100; ++row) {
+    table->append({row});
+  }
+
+  const auto snapshot_cid = CommitID{3};
+  const auto& mvcc_data = table->get_chunk(ChunkID{0})->mvcc_data();
+  for (auto chunk_offset = ChunkOffset{32}; chunk_offset < 64; ++chunk_offset) {
+    mvcc_data->set_begin_cid(chunk_offset, chunk_offset % 3 == 0 ? CommitID{4} : CommitID{2});
+    mvcc_data->set_end_cid(chunk_offset, chunk_offset % 5 == 0 ? CommitID{3} : MvccData::MAX_COMMIT_ID);
+  }
+  for (auto chunk_offset = ChunkOffset{64}; chunk_offset < 96; ++chunk_offset) {
+    mvcc_data->set_begin_cid(chunk_offset, MvccData::MAX_COMMIT_ID);
+  }
+  mvcc_data->set_end_cid(ChunkOffset{98}, CommitID{1});
+
+  const auto expected_table = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  for (auto row = int32_t{0}; row < 100; ++row) {
+    const auto is_visible = row < 32 || (row < 64 && row % 3 != 0 && row % 5 != 0) || (row >= 96 && row != 98);
+    if (is_visible) expected_table->append({row});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto validate = std::make_shared<Validate>(table_wrapper);
+  validate->set_transaction_context(std::make_shared<TransactionContext>(1u, snapshot_cid, AutoCommit::No));
+  validate->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(validate->get_output(), expected_table);
+}
+
 TEST_F(OperatorsValidateTest, ValidateReferenceSegmentWithMultipleChunks) {
   // If Validate has a reference table as input, it can usually optimize the evaluation of the MVCC data.
   // This optimization is possible if a PosList of a reference segment references only one chunk.
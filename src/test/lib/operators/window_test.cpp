@@ -0,0 +1,140 @@
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "expression/window_function_expression.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/window.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsWindowTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Small chunks, so that the window partitions span multiple chunks
+    const auto table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}, {"c", DataType::Int, true}},
+        TableType::Data, ChunkOffset{2});
+    table->append({1, 3, 10});
+    table->append({2, 1, 5});
+    table->append({1, 1, 20});
+    table->append({1, 3, NULL_VALUE});
+    table->append({2, 2, 7});
+    table->append({1, 2, 30});
+
+    table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->never_clear_output();
+    table_wrapper->execute();
+
+    a = PQPColumnExpression::from_table(*table, "a");
+    b = PQPColumnExpression::from_table(*table, "b");
+    c = PQPColumnExpression::from_table(*table, "c");
+  }
+
+  template <typename T>
+  std::vector<std::optional<T>> execute_window(const std::shared_ptr<AbstractOperator>& input_operator,
+                                               const std::shared_ptr<WindowFunctionExpression>& expression) {
+    const auto window = std::make_shared<Window>(input_operator, expression);
+    window->execute();
+
+    const auto& output_table = *window->get_output();
+    EXPECT_EQ(output_table.column_count(), 4);
+    EXPECT_EQ(output_table.column_data_type(ColumnID{3}), expression->data_type());
+
+    auto values = std::vector<std::optional<T>>{};
+    for (auto row = size_t{0}; row < output_table.row_count(); ++row) {
+      values.emplace_back(output_table.get_value<T>(ColumnID{3}, row));
+    }
+    return values;
+  }
+
+  std::shared_ptr<TableWrapper> table_wrapper;
+  std::shared_ptr<PQPColumnExpression> a, b, c;
+};
+
+TEST_F(OperatorsWindowTest, OperatorName) {
+  const auto expression = std::make_shared<WindowFunctionExpression>(
+      WindowFunction::RowNumber, nullptr, expression_vector(a), expression_vector(b),
+      std::vector<SortMode>{SortMode::Ascending});
+  const auto window = std::make_shared<Window>(table_wrapper, expression);
+  EXPECT_EQ(window->name(), "Window");
+}
+
+TEST_F(OperatorsWindowTest, RankingFunctions) {
+  const auto row_number = std::make_shared<WindowFunctionExpression>(
+      WindowFunction::RowNumber, nullptr, expression_vector(a), expression_vector(b),
+      std::vector<SortMode>{SortMode::Ascending});
+  EXPECT_EQ(execute_window<int64_t>(table_wrapper, row_number),
+            (std::vector<std::optional<int64_t>>{3, 1, 1, 4, 2, 2}));
+
+  const auto rank = std::make_shared<WindowFunctionExpression>(WindowFunction::Rank, nullptr, expression_vector(a),
+                                                               expression_vector(b),
+                                                               std::vector<SortMode>{SortMode::Ascending});
+  EXPECT_EQ(execute_window<int64_t>(table_wrapper, rank), (std::vector<std::optional<int64_t>>{3, 1, 1, 3, 2, 2}));
+
+  const auto dense_rank_descending = std::make_shared<WindowFunctionExpression>(
+      WindowFunction::DenseRank, nullptr, expression_vector(a), expression_vector(b),
+      std::vector<SortMode>{SortMode::Descending});
+  EXPECT_EQ(execute_window<int64_t>(table_wrapper, dense_rank_descending),
+            (std::vector<std::optional<int64_t>>{1, 2, 3, 1, 1, 2}));
+}
+
+TEST_F(OperatorsWindowTest, RunningSumIncludesPeers) {
+  // The default frame is RANGE BETWEEN UNBOUNDED PRECEDING AND CURRENT ROW, so rows with the same value of b share
+  // their result.
+  const auto sum = std::make_shared<WindowFunctionExpression>(WindowFunction::Sum, c, expression_vector(a),
+                                                              expression_vector(b),
+                                                              std::vector<SortMode>{SortMode::Ascending});
+  EXPECT_EQ(execute_window<int64_t>(table_wrapper, sum), (std::vector<std::optional<int64_t>>{60, 5, 20, 60, 12, 50}));
+}
+
+TEST_F(OperatorsWindowTest, SlidingFrame) {
+  // ROWS BETWEEN 1 PRECEDING AND CURRENT ROW is evaluated using the segment tree.
+  const auto frame = FrameDescription{FrameType::Rows, FrameBound{1, FrameBoundType::Preceding, false},
+                                      FrameBound{0, FrameBoundType::CurrentRow, false}};
+  const auto max = std::make_shared<WindowFunctionExpression>(WindowFunction::Max, c, expression_vector(a),
+                                                              expression_vector(b),
+                                                              std::vector<SortMode>{SortMode::Ascending}, frame);
+  EXPECT_EQ(execute_window<int32_t>(table_wrapper, max), (std::vector<std::optional<int32_t>>{30, 5, 20, 10, 7, 30}));
+
+  // The frame of a single NULL value results in NULL.
+  const auto current_row = FrameDescription{FrameType::Rows, FrameBound{0, FrameBoundType::CurrentRow, false},
+                                            FrameBound{0, FrameBoundType::CurrentRow, false}};
+  const auto min = std::make_shared<WindowFunctionExpression>(WindowFunction::Min, c, expression_vector(a),
+                                                              expression_vector(b),
+                                                              std::vector<SortMode>{SortMode::Ascending}, current_row);
+  EXPECT_EQ(execute_window<int32_t>(table_wrapper, min),
+            (std::vector<std::optional<int32_t>>{10, 5, 20, std::nullopt, 7, 30}));
+}
+
+TEST_F(OperatorsWindowTest, CountWithoutOrderBy) {
+  const auto count = std::make_shared<WindowFunctionExpression>(WindowFunction::Count, c, expression_vector(a),
+                                                                expression_vector(), std::vector<SortMode>{});
+  EXPECT_EQ(execute_window<int64_t>(table_wrapper, count), (std::vector<std::optional<int64_t>>{3, 2, 3, 3, 2, 3}));
+
+  const auto count_star = std::make_shared<WindowFunctionExpression>(WindowFunction::Count, nullptr,
+                                                                     expression_vector(), expression_vector(),
+                                                                     std::vector<SortMode>{});
+  EXPECT_EQ(execute_window<int64_t>(table_wrapper, count_star),
+            (std::vector<std::optional<int64_t>>{6, 6, 6, 6, 6, 6}));
+}
+
+TEST_F(OperatorsWindowTest, ReferenceInput) {
+  // The window function is only evaluated on the rows of the input, i.e., those with b > 1.
+  const auto table_scan = create_table_scan(table_wrapper, ColumnID{1}, PredicateCondition::GreaterThan, 1);
+  table_scan->execute();
+
+  const auto avg = std::make_shared<WindowFunctionExpression>(WindowFunction::Avg, c, expression_vector(a),
+                                                              expression_vector(), std::vector<SortMode>{});
+  EXPECT_EQ(execute_window<double>(table_scan, avg), (std::vector<std::optional<double>>{20.0, 20.0, 7.0, 20.0}));
+}
+
+}  // namespace opossum
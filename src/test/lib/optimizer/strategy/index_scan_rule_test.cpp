@@ -14,6 +14,7 @@
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
 #include "optimizer/strategy/index_scan_rule.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/table_statistics.hpp"
@@ -22,6 +23,7 @@
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_key_index.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -161,6 +163,65 @@ TEST_F(IndexScanRuleTest, IndexScanWithIndexPrunedColumn) {
   EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
 }
 
+TEST_F(IndexScanRuleTest, KeyIndexScanForKeyLookup) {
+  table->add_soft_key_constraint({{ColumnID{1}, ColumnID{0}}, KeyConstraintType::UNIQUE});
+  table->create_key_index(table->soft_key_constraints().front());
+
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(equals_(4, b),
+    PredicateNode::make(greater_than_(c, 3),
+      ValidateNode::make(
+        PredicateNode::make(equals_(a, 5),
+          stored_table_node))));
+  // clang-format on
+
+  // The expected LQP is built afterwards, as the rule only considers StoredTableNodes with a single output.
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, input_lqp);
+
+  // clang-format off
+  const auto expected_lqp =
+  PredicateNode::make(greater_than_(c, 3),
+    ValidateNode::make(
+      PredicateNode::make(and_(equals_(a, 5), equals_(4, b)),
+        stored_table_node)));
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+
+  const auto key_predicate_node = std::dynamic_pointer_cast<PredicateNode>(actual_lqp->left_input()->left_input());
+  ASSERT_TRUE(key_predicate_node);
+  EXPECT_EQ(key_predicate_node->scan_type, ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, KeyIndexScanForCorrelatedParameter) {
+  table->add_soft_key_constraint({{ColumnID{0}}, KeyConstraintType::UNIQUE});
+  table->create_key_index(table->soft_key_constraints().front());
+
+  // Within a correlated subquery, the key is given by a parameter that is set for every outer row.
+  const auto input_lqp = PredicateNode::make(equals_(a, correlated_parameter_(ParameterID{0}, b)), stored_table_node);
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, input_lqp);
+  EXPECT_EQ(std::static_pointer_cast<PredicateNode>(actual_lqp)->scan_type, ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, NoKeyIndexScanForPartialKey) {
+  table->add_soft_key_constraint({{ColumnID{0}, ColumnID{1}}, KeyConstraintType::UNIQUE});
+  table->create_key_index(table->soft_key_constraints().front());
+
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(equals_(a, 5),
+    PredicateNode::make(less_than_(b, 4),
+      stored_table_node));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  EXPECT_EQ(std::static_pointer_cast<PredicateNode>(actual_lqp)->scan_type, ScanType::TableScan);
+}
+
 TEST_F(IndexScanRuleTest, IndexScanOnlyOnOutputOfStoredTableNode) {
   table->create_index<GroupKeyIndex>({ColumnID{2}});
 
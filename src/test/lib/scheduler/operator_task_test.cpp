@@ -1,4 +1,5 @@
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -10,6 +11,7 @@
 #include "operators/abstract_join_operator.hpp"
 #include "operators/get_table.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/union_positions.hpp"
 #include "scheduler/operator_task.hpp"
@@ -73,6 +75,105 @@ TEST_F(OperatorTaskTest, DoubleDependencyTasksFromOperatorTest) {
   EXPECT_TABLE_EQ_UNORDERED(expected_result, join->get_output());
 }
 
+TEST_F(OperatorTaskTest, PipelineTableScans) {
+  auto gt = std::make_shared<GetTable>("table_a");
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto b = PQPColumnExpression::from_table(*_test_table_a, "b");
+  auto scan_a = std::make_shared<TableScan>(gt, greater_than_equals_(a, 1234));
+  auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(b, 458));
+
+  // scan_a is executed as part of scan_b's pipeline and does not get a task of its own.
+  const auto& [tasks, root_operator_task] = OperatorTask::make_tasks_from_operator(scan_b);
+  ASSERT_EQ(tasks.size(), 2u);
+  EXPECT_TRUE(scan_b->pipelines_left_input());
+  EXPECT_FALSE(scan_a->pipelines_left_input());
+  EXPECT_EQ(root_operator_task, scan_b->get_or_create_operator_task());
+
+  using TaskVector = std::vector<std::shared_ptr<AbstractTask>>;
+  EXPECT_EQ(gt->get_or_create_operator_task()->successors(), TaskVector{root_operator_task});
+
+  for (auto& task : tasks) {
+    task->schedule();
+    // We don't have to wait here, because we are running the task tests without a scheduler
+  }
+
+  auto expected_result = load_table("resources/test_data/tbl/int_float_filtered.tbl", 2);
+  EXPECT_TABLE_EQ_UNORDERED(expected_result, scan_b->get_output());
+
+  // The pipelined scan never holds an output, but reports how many rows passed it.
+  EXPECT_EQ(scan_a->state(), OperatorState::ExecutedAndCleared);
+  EXPECT_EQ(scan_a->performance_data->output_row_count, 2);
+  EXPECT_EQ(scan_a->performance_data->output_chunk_count, 2);
+}
+
+TEST_F(OperatorTaskTest, PipelineProjection) {
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto b = PQPColumnExpression::from_table(*_test_table_a, "b");
+
+  // The first projection forwards b, so that a + 1 is referenced through a projection result table. The second one
+  // forwards nothing and outputs a data table.
+  for (const auto& expressions : {expression_vector(add_(a, 1), b), expression_vector(add_(a, 1))}) {
+    auto gt = std::make_shared<GetTable>("table_a");
+    auto scan = std::make_shared<TableScan>(gt, greater_than_equals_(a, 1234));
+    auto projection = std::make_shared<Projection>(scan, expressions);
+
+    const auto& [tasks, root_operator_task] = OperatorTask::make_tasks_from_operator(projection);
+    ASSERT_EQ(tasks.size(), 2u);
+    EXPECT_TRUE(projection->pipelines_left_input());
+
+    // A projection that evaluates expressions only knows the nullability of its output columns after the last morsel
+    // and can thus not stream its output.
+    EXPECT_FALSE(projection->try_stream_output([](const auto&) {}));
+
+    for (auto& task : tasks) {
+      task->schedule();
+    }
+
+    // Operators that are executed directly are not pipelined.
+    auto reference_gt = std::make_shared<GetTable>("table_a");
+    auto reference_scan = std::make_shared<TableScan>(reference_gt, greater_than_equals_(a, 1234));
+    auto reference_projection = std::make_shared<Projection>(reference_scan, expressions);
+    execute_all({reference_gt, reference_scan, reference_projection});
+    EXPECT_FALSE(reference_projection->pipelines_left_input());
+
+    EXPECT_EQ(projection->get_output()->type(), reference_projection->get_output()->type());
+    EXPECT_TABLE_EQ_UNORDERED(projection->get_output(), reference_projection->get_output());
+    EXPECT_EQ(scan->performance_data->output_row_count, 2);
+  }
+}
+
+TEST_F(OperatorTaskTest, StreamPipelineOutput) {
+  auto gt = std::make_shared<GetTable>("table_a");
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto b = PQPColumnExpression::from_table(*_test_table_a, "b");
+  auto scan_a = std::make_shared<TableScan>(gt, greater_than_equals_(a, 1234));
+  auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(b, 458));
+
+  const auto& [tasks, root_operator_task] = OperatorTask::make_tasks_from_operator(scan_b);
+
+  auto streamed_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  auto streamed_chunks_mutex = std::mutex{};
+  EXPECT_TRUE(scan_b->try_stream_output([&](const std::shared_ptr<const Table>& chunk_table) {
+    ASSERT_EQ(chunk_table->chunk_count(), 1);
+    const auto lock = std::lock_guard<std::mutex>{streamed_chunks_mutex};
+    streamed_chunks.emplace_back(std::const_pointer_cast<Chunk>(chunk_table->get_chunk(ChunkID{0})));
+  }));
+
+  for (auto& task : tasks) {
+    task->schedule();
+  }
+
+  // The output chunks were passed to the consumer instead of becoming part of the output table.
+  EXPECT_EQ(scan_b->get_output()->chunk_count(), 0);
+  const auto streamed_table = std::make_shared<Table>(_test_table_a->column_definitions(), TableType::References,
+                                                      std::move(streamed_chunks));
+  auto expected_result = load_table("resources/test_data/tbl/int_float_filtered.tbl", 2);
+  EXPECT_TABLE_EQ_UNORDERED(expected_result, streamed_table);
+
+  // Executed operators cannot stream their output anymore.
+  EXPECT_FALSE(scan_b->try_stream_output([](const auto&) {}));
+}
+
 TEST_F(OperatorTaskTest, MakeDiamondShape) {
   auto gt_a = std::make_shared<GetTable>("table_a");
   auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
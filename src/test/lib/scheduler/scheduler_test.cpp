@@ -290,4 +290,37 @@ TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   Hyrise::get().scheduler()->finish();
 }
 
+TEST_F(SchedulerTest, ManyShortTasksSpawnedByWorkers) {
+  // Jobs scheduled by a worker are pushed into its deque and stolen by the other workers, including those of the other
+  // node. Nested jobs make the workers pop their own jobs while others steal from them.
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  constexpr auto JOB_COUNT = 100;
+  constexpr auto SUBJOB_COUNT = 100;
+
+  std::atomic_uint32_t counter{0};
+  auto task = std::make_shared<JobTask>([&counter]() {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto job_id = 0; job_id < JOB_COUNT; ++job_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&counter]() {
+        auto subjobs = std::vector<std::shared_ptr<AbstractTask>>{};
+        for (auto subjob_id = 0; subjob_id < SUBJOB_COUNT; ++subjob_id) {
+          subjobs.emplace_back(std::make_shared<JobTask>([&counter]() { ++counter; }));
+          subjobs.back()->schedule();
+        }
+        Hyrise::get().scheduler()->wait_for_tasks(subjobs);
+      }));
+      jobs.back()->schedule();
+    }
+    Hyrise::get().scheduler()->wait_for_tasks(jobs);
+  });
+
+  task->schedule();
+  Hyrise::get().scheduler()->wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+  EXPECT_EQ(counter, 10'000u);
+
+  Hyrise::get().scheduler()->finish();
+}
+
 }  // namespace opossum
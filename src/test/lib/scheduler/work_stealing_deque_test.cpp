@@ -0,0 +1,90 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "scheduler/work_stealing_deque.hpp"
+
+namespace opossum {
+
+class WorkStealingDequeTest : public BaseTest {};
+
+TEST_F(WorkStealingDequeTest, PopIsLifoAndStealIsFifo) {
+  auto deque = WorkStealingDeque<int>{};
+  EXPECT_TRUE(deque.empty());
+  EXPECT_FALSE(deque.pop());
+  EXPECT_FALSE(deque.steal());
+
+  for (auto item = 0; item < 4; ++item) {
+    deque.push(item);
+  }
+  EXPECT_EQ(deque.size(), 4);
+
+  EXPECT_EQ(deque.pop(), 3);
+  EXPECT_EQ(deque.steal(), 0);
+  EXPECT_EQ(deque.pop(), 2);
+  EXPECT_EQ(deque.steal(), 1);
+  EXPECT_TRUE(deque.empty());
+  EXPECT_FALSE(deque.pop());
+  EXPECT_FALSE(deque.steal());
+}
+
+TEST_F(WorkStealingDequeTest, Grow) {
+  auto deque = WorkStealingDeque<int>{2};
+  EXPECT_THROW(WorkStealingDeque<int>{3}, std::logic_error);
+
+  // Move the top away from zero so that the items wrap around in the circular buffer before it grows.
+  deque.push(-1);
+  EXPECT_EQ(deque.steal(), -1);
+
+  for (auto item = 0; item < 100; ++item) {
+    deque.push(item);
+  }
+  EXPECT_EQ(deque.size(), 100);
+  EXPECT_EQ(deque.steal(), 0);
+  for (auto item = 99; item > 0; --item) {
+    EXPECT_EQ(deque.pop(), item);
+  }
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST_F(WorkStealingDequeTest, ConcurrentSteals) {
+  // The owner pushes and pops items while several thieves steal from the deque. Every item has to be taken exactly once.
+  constexpr auto ITEM_COUNT = 100'000;
+  constexpr auto THIEF_COUNT = 4;
+
+  auto deque = WorkStealingDeque<int>{};
+  auto taken = std::vector<std::atomic_uint32_t>(ITEM_COUNT);
+  auto owner_done = std::atomic_bool{false};
+
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_id = 0; thief_id < THIEF_COUNT; ++thief_id) {
+    thieves.emplace_back([&]() {
+      while (!owner_done || !deque.empty()) {
+        const auto item = deque.steal();
+        if (item) ++taken[*item];
+      }
+    });
+  }
+
+  for (auto item = 0; item < ITEM_COUNT; ++item) {
+    deque.push(item);
+    if (item % 3 == 0) {
+      const auto popped_item = deque.pop();
+      if (popped_item) ++taken[*popped_item];
+    }
+  }
+  owner_done = true;
+
+  for (auto& thief : thieves) {
+    thief.join();
+  }
+
+  // The thieves stop as soon as the deque is empty. Items that the owner did not pop have been stolen by then.
+  for (auto item = 0; item < ITEM_COUNT; ++item) {
+    EXPECT_EQ(taken[item], 1) << "Item " << item;
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,108 @@
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "server/admission_control.hpp"
+
+namespace opossum {
+
+class AdmissionControlTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    Hyrise::get().topology.use_fake_numa_topology(8, 4);
+    Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  }
+
+  void TearDown() override { Hyrise::get().scheduler()->finish(); }
+};
+
+TEST_F(AdmissionControlTest, LimitsConcurrentRequests) {
+  auto admission_control = AdmissionControl{2};
+  EXPECT_EQ(admission_control.max_concurrent_requests(), 2);
+
+  auto release = std::atomic_bool{false};
+  auto running_count = std::atomic_size_t{0};
+  auto max_running_count = std::atomic_size_t{0};
+  auto finished_count = std::atomic_size_t{0};
+
+  const auto request_count = size_t{6};
+  for (auto request_id = size_t{0}; request_id < request_count; ++request_id) {
+    admission_control.submit([&]() {
+      const auto current_running_count = ++running_count;
+      auto previous_max = max_running_count.load();
+      while (previous_max < current_running_count &&
+             !max_running_count.compare_exchange_weak(previous_max, current_running_count)) {}
+
+      while (!release) {
+        std::this_thread::yield();
+      }
+      --running_count;
+      ++finished_count;
+    });
+  }
+
+  while (running_count < 2) {
+    std::this_thread::yield();
+  }
+  EXPECT_EQ(admission_control.running_request_count(), 2);
+  EXPECT_EQ(admission_control.queued_request_count(), 4);
+
+  release = true;
+  while (finished_count < request_count) {
+    std::this_thread::yield();
+  }
+  Hyrise::get().scheduler()->wait_for_all_tasks();
+
+  EXPECT_EQ(max_running_count, 2);
+  EXPECT_EQ(admission_control.running_request_count(), 0);
+  EXPECT_EQ(admission_control.queued_request_count(), 0);
+}
+
+TEST_F(AdmissionControlTest, ProcessesQueuedRequestsInOrder) {
+  auto admission_control = AdmissionControl{1};
+
+  auto release = std::atomic_bool{false};
+  auto order_mutex = std::mutex{};
+  auto order = std::vector<size_t>{};
+
+  for (auto request_id = size_t{0}; request_id < 5; ++request_id) {
+    admission_control.submit([&, request_id]() {
+      while (!release) {
+        std::this_thread::yield();
+      }
+      const auto lock = std::lock_guard<std::mutex>{order_mutex};
+      order.emplace_back(request_id);
+    });
+  }
+
+  EXPECT_EQ(admission_control.queued_request_count(), 4);
+  release = true;
+  Hyrise::get().scheduler()->wait_for_all_tasks();
+
+  EXPECT_EQ(order, (std::vector<size_t>{0, 1, 2, 3, 4}));
+}
+
+TEST_F(AdmissionControlTest, UnlimitedRequests) {
+  auto admission_control = AdmissionControl{};
+  EXPECT_FALSE(admission_control.max_concurrent_requests());
+
+  auto finished_count = std::atomic_size_t{0};
+  for (auto request_id = size_t{0}; request_id < 100; ++request_id) {
+    admission_control.submit([&]() { ++finished_count; });
+    EXPECT_EQ(admission_control.queued_request_count(), 0);
+  }
+
+  Hyrise::get().scheduler()->wait_for_all_tasks();
+  EXPECT_EQ(finished_count, 100);
+}
+
+TEST_F(AdmissionControlTest, InvalidLimit) {
+  EXPECT_THROW(AdmissionControl{0}, std::logic_error);
+}
+
+}  // namespace opossum
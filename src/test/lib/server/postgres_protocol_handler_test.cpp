@@ -23,16 +23,18 @@ TEST_F(PostgresProtocolHandlerTest, ReadStartupMessage) {
   // No SSL request, just length (8 Byte) and no SSL (0)
   // Values must be converted to network byte order
   _mocked_socket->write(std::string{'\0', '\0', '\0', '\b', '\0', '\0', '\0', '\0'});
-  EXPECT_EQ(_protocol_handler->read_startup_packet_header(), 0);
+  EXPECT_EQ(_protocol_handler->read_startup_packet_header(), 0u);
 
   // SSL request contains length (8 B) and SSL request code 80877103
   _mocked_socket->write(std::string{'\0', '\0', '\0', '\b', '\x04', '\xd2', '\x16', '\x2f'});
-  // Server will wait for new message with authentication details. Message contains length (12 B), protocol (0) and
-  // body (4 B). No body provided here, since we throw it away anyway.
-  _mocked_socket->write(std::string{'\0', '\0', '\0', '\f', '\0', '\0', '\0', '\0'});
-  EXPECT_EQ(_protocol_handler->read_startup_packet_header(), 4);
+  EXPECT_EQ(_protocol_handler->read_startup_packet_header(), std::nullopt);
   const std::string file_content = _mocked_socket->read();
   EXPECT_EQ(file_content.back(), 'N');
+
+  // Client sends new message with authentication details. Message contains length (12 B), protocol (0) and body
+  // (4 B). No body provided here, since we throw it away anyway.
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\f', '\0', '\0', '\0', '\0'});
+  EXPECT_EQ(_protocol_handler->read_startup_packet_header(), 4u);
 }
 
 TEST_F(PostgresProtocolHandlerTest, DiscardStartupPacketBody) {
@@ -225,7 +227,7 @@ TEST_F(PostgresProtocolHandlerTest, ReadBindPacket) {
   const std::string portal = "test_portal";
   const std::string statement_name = "test_statement";
 
-  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x31'});
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x33'});
   _mocked_socket->write(portal);
   _mocked_socket->write(std::string{"\0", 1});
   _mocked_socket->write(statement_name);
@@ -240,15 +242,17 @@ TEST_F(PostgresProtocolHandlerTest, ReadBindPacket) {
   _mocked_socket->write(std::string{'\0', '\0', '\0', '\x04'});
   // Set parameter to value "test"
   _mocked_socket->write("test");
-  // Assuming one result column
-  _mocked_socket->write(std::string{'\0', '\x01'});
-  // Also format code 0: text format
+  // Assuming two result columns
+  _mocked_socket->write(std::string{'\0', '\x02'});
+  // Format code 0 (text format) for the first column, 1 (binary format) for the second one
   _mocked_socket->write(std::string{"\0", 2});
+  _mocked_socket->write(std::string{'\0', '\x01'});
 
   const auto& statement_information = _protocol_handler->read_bind_packet();
   EXPECT_EQ(statement_information.portal, portal);
   EXPECT_EQ(statement_information.statement_name, statement_name);
   EXPECT_EQ(statement_information.parameters, std::vector<AllTypeVariant>{"test"});
+  EXPECT_EQ(statement_information.result_format_codes, std::vector<FormatCode>({FormatCode::Text, FormatCode::Binary}));
 }
 
 TEST_F(PostgresProtocolHandlerTest, ReadExecutePacket) {
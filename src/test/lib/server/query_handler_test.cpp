@@ -78,4 +78,15 @@ TEST_F(QueryHandlerTest, CorrectlyInvalidateStatements) {
   EXPECT_FALSE(Hyrise::get().storage_manager.has_prepared_plan(""));
 }
 
+TEST_F(QueryHandlerTest, BuildCopyToStdoutQuery) {
+  EXPECT_EQ(QueryHandler::build_copy_to_stdout_query("COPY table_a TO STDOUT;"), "SELECT * FROM table_a");
+  EXPECT_EQ(QueryHandler::build_copy_to_stdout_query("copy table_a (b, a) to stdout"), "SELECT b, a FROM table_a");
+  EXPECT_EQ(QueryHandler::build_copy_to_stdout_query("COPY (SELECT a FROM table_a WHERE a > 1) TO STDOUT"),
+            "SELECT a FROM table_a WHERE a > 1");
+
+  EXPECT_EQ(QueryHandler::build_copy_to_stdout_query("SELECT * FROM table_a"), std::nullopt);
+  EXPECT_EQ(QueryHandler::build_copy_to_stdout_query("COPY table_a TO 'table_a.csv'"), std::nullopt);
+  EXPECT_EQ(QueryHandler::build_copy_to_stdout_query("COPY table_a FROM STDIN"), std::nullopt);
+}
+
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #include "base_test.hpp"
 #include "mock_socket.hpp"
 
+#include "lossy_cast.hpp"
 #include "server/postgres_protocol_handler.hpp"
 #include "server/result_serializer.hpp"
 
@@ -43,6 +44,113 @@ TEST_F(ResultSerializerTest, QueryResponse) {
   EXPECT_EQ(std::count(file_content.begin(), file_content.end(), 'D'), _test_table->row_count());
 }
 
+TEST_F(ResultSerializerTest, QueryResponseBinaryFormat) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"i", DataType::Int, true},
+                                                              {"l", DataType::Long, false},
+                                                              {"d", DataType::Double, false},
+                                                              {"s", DataType::String, false}},
+                                       TableType::Data);
+  table->append({NULL_VALUE, int64_t{-2}, 1.5, "abc"});
+
+  ResultSerializer::send_query_response(table, _protocol_handler, {FormatCode::Binary});
+  _protocol_handler->force_flush();
+  const std::string file_content = _mocked_socket->read();
+
+  // Message type, length, and number of values
+  EXPECT_EQ(static_cast<PostgresMessageType>(file_content.front()), PostgresMessageType::DataRow);
+  EXPECT_EQ(NetworkConversionHelper::get_message_length(file_content.cbegin() + 1), file_content.size() - 1);
+  EXPECT_EQ(NetworkConversionHelper::get_small_int(file_content.cbegin() + 5), 4);
+  auto position = file_content.cbegin() + 7;
+
+  // NULL is represented by a length of -1 in both formats
+  EXPECT_EQ(static_cast<int32_t>(NetworkConversionHelper::get_message_length(position)), -1);
+  position += 4;
+
+  // Long: 8 bytes in network byte order
+  EXPECT_EQ(NetworkConversionHelper::get_message_length(position), 8);
+  position += 4;
+  EXPECT_EQ(std::string(position, position + 8), std::string(7, '\xff') + '\xfe');
+  position += 8;
+
+  // Double: IEEE 754 representation (1.5 is 0x3FF8000000000000) in network byte order
+  EXPECT_EQ(NetworkConversionHelper::get_message_length(position), 8);
+  position += 4;
+  EXPECT_EQ(std::string(position, position + 8), std::string({'\x3f', '\xf8', '\0', '\0', '\0', '\0', '\0', '\0'}));
+  position += 8;
+
+  // Strings are sent as they are
+  EXPECT_EQ(NetworkConversionHelper::get_message_length(position), 3);
+  position += 4;
+  EXPECT_EQ(std::string(position, file_content.cend()), "abc");
+}
+
+TEST_F(ResultSerializerTest, QueryResponseTextFormat) {
+  auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"i", DataType::Int, false}, {"f", DataType::Float, false}}, TableType::Data);
+  table->append({-17, 458.7f});
+
+  ResultSerializer::send_query_response(table, _protocol_handler);
+  _protocol_handler->force_flush();
+  const std::string file_content = _mocked_socket->read();
+
+  // Values are formatted like lossy_variant_cast<pmr_string> does
+  const auto expected_int = std::string{*lossy_variant_cast<pmr_string>(AllTypeVariant{-17})};
+  const auto expected_float = std::string{*lossy_variant_cast<pmr_string>(AllTypeVariant{458.7f})};
+  auto position = file_content.cbegin() + 7;
+  EXPECT_EQ(NetworkConversionHelper::get_message_length(position), expected_int.size());
+  position += 4;
+  EXPECT_EQ(std::string(position, position + expected_int.size()), expected_int);
+  position += expected_int.size();
+  EXPECT_EQ(NetworkConversionHelper::get_message_length(position), expected_float.size());
+  position += 4;
+  EXPECT_EQ(std::string(position, file_content.cend()), expected_float);
+}
+
+TEST_F(ResultSerializerTest, TableDescriptionWithFormatCodes) {
+  // Mismatching number of format codes
+  EXPECT_THROW(ResultSerializer::send_table_description(_test_table, _protocol_handler,
+                                                        {FormatCode::Binary, FormatCode::Text}),
+               InvalidInputException);
+
+  ResultSerializer::send_table_description(_test_table, _protocol_handler, {FormatCode::Binary});
+  _protocol_handler->force_flush();
+  const std::string file_content = _mocked_socket->read();
+
+  // The format code is the last field of each column description
+  EXPECT_EQ(NetworkConversionHelper::get_small_int(file_content.cend() - 2), 1);
+}
+
+TEST_F(ResultSerializerTest, CopyData) {
+  auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}}, TableType::Data, 1);
+  table->append({1, "x\ty"});
+  table->append({2, NULL_VALUE});
+
+  _protocol_handler->send_copy_out_response(static_cast<uint16_t>(table->column_count()));
+  ResultSerializer::send_copy_data(table, _protocol_handler);
+  _protocol_handler->send_copy_done();
+  _protocol_handler->force_flush();
+  const std::string file_content = _mocked_socket->read();
+
+  // CopyOutResponse: type, length, overall format, column count, and two column formats
+  EXPECT_EQ(static_cast<PostgresMessageType>(file_content.front()), PostgresMessageType::CopyOutResponse);
+  EXPECT_EQ(NetworkConversionHelper::get_message_length(file_content.cbegin() + 1), 11);
+  EXPECT_EQ(NetworkConversionHelper::get_small_int(file_content.cbegin() + 6), 2);
+
+  // One CopyData message per row, with tabs escaped and NULL written as \N
+  auto position = file_content.cbegin() + 12;
+  EXPECT_EQ(static_cast<PostgresMessageType>(*position), PostgresMessageType::CopyData);
+  EXPECT_EQ(NetworkConversionHelper::get_message_length(position + 1), 4 + 7);
+  EXPECT_EQ(std::string(position + 5, position + 12), "1\tx\\ty\n");
+  position += 12;
+  EXPECT_EQ(static_cast<PostgresMessageType>(*position), PostgresMessageType::CopyData);
+  EXPECT_EQ(std::string(position + 5, position + 10), "2\t\\N\n");
+  position += 10;
+
+  EXPECT_EQ(static_cast<PostgresMessageType>(*position), PostgresMessageType::CopyDone);
+  EXPECT_EQ(position + 5, file_content.cend());
+}
+
 TEST_F(ResultSerializerTest, CommandCompleteMessage) {
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Insert, 1), "INSERT 0 1");
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Update, 1), "UPDATE -1");
@@ -53,8 +53,10 @@ class ServerTestRunner : public BaseTest {
     std::remove((_export_filename + ".csv.json").c_str());
   }
 
-  std::unique_ptr<Server> _server = std::make_unique<Server>(
-      boost::asio::ip::address(), 0, SendExecutionInfo::No);  // Port 0 to select random open port
+  // Port 0 to select random open port. Multiple network threads and a limit of concurrent requests make the tests cover
+  // the queueing of requests.
+  std::unique_ptr<Server> _server =
+      std::make_unique<Server>(boost::asio::ip::address(), 0, SendExecutionInfo::No, 2, 4);
   std::unique_ptr<std::thread> _server_thread;
   std::string _connection_string;
 
@@ -287,6 +289,23 @@ TEST_F(ServerTestRunner, TestMultipleConnections) {
   EXPECT_EQ(result3.size(), expected_num_rows);
 }
 
+TEST_F(ServerTestRunner, TestManyIdleConnections) {
+  // Sessions do not occupy a thread while waiting for messages. Hence, the server handles more open connections than it
+  // has network threads and workers.
+  const auto connection_count = 64;
+  auto connections = std::vector<std::unique_ptr<pqxx::connection>>{};
+  for (auto connection_id = 0; connection_id < connection_count; ++connection_id) {
+    connections.emplace_back(std::make_unique<pqxx::connection>(_connection_string));
+  }
+
+  const auto expected_num_rows = _table_a->row_count();
+  for (auto connection_id = connection_count - 1; connection_id >= 0; --connection_id) {
+    pqxx::nontransaction transaction{*connections[connection_id]};
+    const auto result = transaction.exec("SELECT * FROM table_a;");
+    EXPECT_EQ(result.size(), expected_num_rows);
+  }
+}
+
 TEST_F(ServerTestRunner, TestSimpleInsertSelect) {
   pqxx::connection connection{_connection_string};
   pqxx::nontransaction transaction{connection};
@@ -0,0 +1,138 @@
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include "base_test.hpp"
+
+#include "server/session_stream.hpp"
+
+namespace opossum {
+
+class SessionStreamTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto acceptor = boost::asio::ip::tcp::acceptor{
+        _io_service, boost::asio::ip::tcp::endpoint{boost::asio::ip::address_v4::loopback(), 0}};
+    _stream = std::make_shared<SessionStream>(_io_service);
+    _client_socket.connect(acceptor.local_endpoint());
+    acceptor.accept(*_stream->socket());
+  }
+
+  // Waits for the next message and returns whether it has been received, or std::nullopt if the handler has not been
+  // called after processing all handlers that are ready.
+  std::optional<bool> _receive_message(const bool is_startup_message) {
+    _is_received = std::nullopt;
+    _stream->async_receive_message(is_startup_message, [&](const bool is_received) { _is_received = is_received; });
+    _io_service.restart();
+    _io_service.poll();
+    return _is_received;
+  }
+
+  std::string _read_message() {
+    auto data = std::array<char, 64>{};
+    auto error_code = boost::system::error_code{};
+    const auto bytes_read =
+        boost::asio::read(*_stream, boost::asio::buffer(data), boost::asio::transfer_all(), error_code);
+    EXPECT_EQ(error_code, boost::asio::error::eof);
+    return std::string(data.data(), bytes_read);
+  }
+
+  boost::asio::io_service _io_service;
+  Socket _client_socket{_io_service};
+  std::shared_ptr<SessionStream> _stream;
+  std::optional<bool> _is_received;
+};
+
+TEST_F(SessionStreamTest, ReceiveCompleteMessages) {
+  // Query message: type, length (8 B including the length field), and query
+  const auto message = std::string{'Q', '\0', '\0', '\0', '\b', 'a', 'b', 'c', '\0'};
+  boost::asio::write(_client_socket, boost::asio::buffer(message.substr(0, 3)));
+  EXPECT_EQ(_receive_message(false), std::nullopt);
+
+  boost::asio::write(_client_socket, boost::asio::buffer(message.substr(3)));
+  _io_service.restart();
+  _io_service.run();
+  EXPECT_EQ(_is_received, true);
+  EXPECT_EQ(_read_message(), message);
+
+  // Startup messages begin with their length
+  const auto startup_message = std::string{'\0', '\0', '\0', '\b', '\0', '\0', '\0', '\0'};
+  boost::asio::write(_client_socket, boost::asio::buffer(startup_message));
+  EXPECT_EQ(_receive_message(true), true);
+  EXPECT_EQ(_read_message(), startup_message);
+}
+
+TEST_F(SessionStreamTest, DiscardUnreadData) {
+  // Sync messages only consist of their type and length. Both are sent at once.
+  const auto message = std::string{'S', '\0', '\0', '\0', '\4'};
+  boost::asio::write(_client_socket, boost::asio::buffer(message + message));
+
+  EXPECT_EQ(_receive_message(false), true);
+  auto type = char{};
+  boost::asio::read(*_stream, boost::asio::buffer(&type, sizeof(type)));
+  EXPECT_EQ(type, 'S');
+
+  // The unread length field of the first message is skipped
+  EXPECT_EQ(_receive_message(false), true);
+  EXPECT_EQ(_read_message(), message);
+}
+
+TEST_F(SessionStreamTest, RejectMalformedMessages) {
+  // The length of a message includes the length field and must thus be at least 4 B
+  boost::asio::write(_client_socket, boost::asio::buffer(std::string{'Q', '\0', '\0', '\0', '\3'}));
+  EXPECT_EQ(_receive_message(false), false);
+}
+
+TEST_F(SessionStreamTest, RejectLongStartupMessages) {
+  // Startup messages of more than 10'000 B (here: 1 GiB) are rejected before any data of the message body arrives
+  boost::asio::write(_client_socket, boost::asio::buffer(std::string{'\x40', '\0', '\0', '\0'}));
+  EXPECT_EQ(_receive_message(true), false);
+}
+
+TEST_F(SessionStreamTest, RejectClosedConnections) {
+  _client_socket.close();
+  EXPECT_EQ(_receive_message(false), false);
+}
+
+TEST_F(SessionStreamTest, SendQueuedData) {
+  boost::asio::write(*_stream, boost::asio::buffer(std::string{"Hello, "}));
+  boost::asio::write(*_stream, boost::asio::buffer(std::string{"client"}));
+  _io_service.restart();
+  _io_service.run();
+
+  auto data = std::array<char, 13>{};
+  boost::asio::read(_client_socket, boost::asio::buffer(data));
+  EXPECT_EQ(std::string(data.data(), data.size()), "Hello, client");
+}
+
+TEST_F(SessionStreamTest, DeferDataWhileQueueIsFull) {
+  EXPECT_TRUE(_stream->queue_data(std::string(SessionStream::MAX_QUEUED_BYTES, 'a')));
+
+  // The serialization is deferred until the data queued before has been sent.
+  auto is_serialized = false;
+  EXPECT_TRUE(_stream->queue_deferred_data([&]() {
+    is_serialized = true;
+    return std::string{"b"};
+  }));
+  EXPECT_FALSE(is_serialized);
+
+  // The next message is only received once the client has received the queued data.
+  boost::asio::write(_client_socket, boost::asio::buffer(std::string{'S', '\0', '\0', '\0', '\4'}));
+  EXPECT_EQ(_receive_message(false), std::nullopt);
+  EXPECT_FALSE(is_serialized);
+
+  auto data = std::string(SessionStream::MAX_QUEUED_BYTES + 1, '\0');
+  auto client_thread = std::thread{[&]() { boost::asio::read(_client_socket, boost::asio::buffer(data)); }};
+  _io_service.restart();
+  _io_service.run();
+  client_thread.join();
+
+  EXPECT_TRUE(is_serialized);
+  EXPECT_EQ(data.front(), 'a');
+  EXPECT_EQ(data.back(), 'b');
+  EXPECT_EQ(_is_received, true);
+}
+
+}  // namespace opossum
@@ -1,6 +1,9 @@
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base_test.hpp"
 
@@ -710,6 +713,61 @@ TEST_F(SQLPipelineStatementTest, MetaTableNoCaching) {
   EXPECT_FALSE(_pqp_cache->has(meta_table_query));
 }
 
+TEST_F(SQLPipelineStatementTest, ResultChunkConsumer) {
+  struct QueryExpectation {
+    std::string query;
+    std::optional<OperatorType> streaming_root_operator_type;
+    ColumnCount column_count;
+    std::vector<AllTypeVariant> values;
+  };
+
+  // The root operator streams its result if it is a TableScan or a Projection that only forwards columns. All other
+  // root operators pass their result table to the consumer after the execution.
+  const auto query_expectations = std::vector<QueryExpectation>{
+      {"SELECT * FROM table_a WHERE a > 1000", OperatorType::TableScan, ColumnCount{2},
+       {int32_t{1234}, int32_t{12345}}},
+      {"SELECT a FROM table_a WHERE a > 1000", OperatorType::Projection, ColumnCount{1},
+       {int32_t{1234}, int32_t{12345}}},
+      {"SELECT * FROM table_a ORDER BY a", std::nullopt, ColumnCount{2}, {int32_t{123}, int32_t{1234}, int32_t{12345}}}};
+
+  for (const auto& [query, streaming_root_operator_type, column_count, expected_values] : query_expectations) {
+    SCOPED_TRACE(query);
+
+    auto passed_row_count = size_t{0};
+    auto passed_values = std::vector<AllTypeVariant>{};
+    auto passed_values_mutex = std::mutex{};
+    // Without MVCC, no Validate is placed above the TableScan.
+    auto sql_pipeline = SQLPipelineBuilder{query}
+                            .disable_mvcc()
+                            .with_result_chunk_consumer([&](const std::shared_ptr<const Table>& chunk_table) {
+                              EXPECT_EQ(chunk_table->chunk_count(), 1);
+                              EXPECT_EQ(chunk_table->column_count(), column_count);
+                              const auto lock = std::lock_guard<std::mutex>{passed_values_mutex};
+                              passed_row_count += chunk_table->row_count();
+                              for (auto row = size_t{0}; row < chunk_table->row_count(); ++row) {
+                                passed_values.emplace_back(chunk_table->get_value<int32_t>(ColumnID{0}, row).value());
+                              }
+                            })
+                            .create_pipeline();
+    const auto [pipeline_status, result_table] = sql_pipeline.get_result_table();
+    EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+    EXPECT_EQ(result_table->column_count(), column_count);
+
+    const auto& root_operator = get_sql_pipeline_statements(sql_pipeline).at(0)->get_physical_plan();
+    if (streaming_root_operator_type) {
+      // The result was streamed during the execution, so the chunks never became part of the result table.
+      EXPECT_EQ(root_operator->type(), *streaming_root_operator_type);
+      EXPECT_EQ(result_table->chunk_count(), 0);
+      EXPECT_EQ(result_table->row_count(), 0);
+    } else {
+      EXPECT_EQ(result_table->row_count(), passed_row_count);
+    }
+
+    std::sort(passed_values.begin(), passed_values.end());
+    EXPECT_EQ(passed_values, expected_values);
+  }
+}
+
 TEST_F(SQLPipelineStatementTest, SQLTranslationInfo) {
   {
     auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_a"}.create_pipeline();
@@ -1,4 +1,5 @@
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "base_test.hpp"
@@ -30,6 +31,7 @@
 #include "statistics/cardinality_estimator.hpp"
 #include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram.hpp"
+#include "statistics/statistics_objects/hyper_log_log_sketch.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/table_column_definition.hpp"
 #include "utils/load_table.hpp"
@@ -164,6 +166,41 @@ TEST_F(CardinalityEstimatorTest, Aggregate) {
   EXPECT_TRUE(result_table_statistics->column_statistics.at(2));
 }
 
+TEST_F(CardinalityEstimatorTest, AggregateWithDistinctCountSketches) {
+  const auto create_sketch = [](const auto distinct_count, const auto value_count) {
+    const auto sketch = std::make_shared<HyperLogLogSketch<int32_t>>(value_count);
+    for (auto value = int32_t{0}; value < distinct_count; ++value) {
+      sketch->add(value);
+    }
+    return sketch;
+  };
+
+  const auto node = create_mock_node_with_statistics({{DataType::Int, "a"}, {DataType::Int, "b"}}, 1000,
+                                                     {create_sketch(10, 1000.0f), create_sketch(20, 1000.0f)});
+  const auto column_a = node->get_column("a");
+  const auto column_b = node->get_column("b");
+
+  // The number of groups is the product of the distinct counts of the group-by columns ...
+  const auto single_column_lqp = AggregateNode::make(expression_vector(column_a), expression_vector(sum_(column_b)),
+                                                     node);
+  EXPECT_NEAR(estimator.estimate_statistics(single_column_lqp)->row_count, 10.0f, 1.5f);
+
+  const auto two_column_lqp = AggregateNode::make(expression_vector(column_a, column_b), expression_vector(), node);
+  EXPECT_NEAR(estimator.estimate_statistics(two_column_lqp)->row_count, 200.0f, 30.0f);
+
+  // ... capped at the number of input rows.
+  const auto small_node = create_mock_node_with_statistics({{DataType::Int, "a"}, {DataType::Int, "b"}}, 100,
+                                                           {create_sketch(50, 100.0f), create_sketch(40, 100.0f)});
+  const auto capped_lqp = AggregateNode::make(
+      expression_vector(small_node->get_column("a"), small_node->get_column("b")), expression_vector(), small_node);
+  EXPECT_FLOAT_EQ(estimator.estimate_statistics(capped_lqp)->row_count, 100.0f);
+
+  // Without sketches for all group-by columns, the input row count is forwarded.
+  const auto expression_lqp =
+      AggregateNode::make(expression_vector(column_a, add_(column_a, column_b)), expression_vector(), node);
+  EXPECT_FLOAT_EQ(estimator.estimate_statistics(expression_lqp)->row_count, 1000.0f);
+}
+
 TEST_F(CardinalityEstimatorTest, Alias) {
   // clang-format off
   const auto input_lqp =
@@ -269,6 +306,42 @@ TEST_F(CardinalityEstimatorTest, JoinEquiInnerDifferentDataTypes) {
   ASSERT_EQ(result_statistics->column_statistics.size(), 4u);
 }
 
+TEST_F(CardinalityEstimatorTest, JoinStringEquiInnerWithDistinctCountSketches) {
+  const auto create_sketch = [](const auto distinct_count, const auto value_count) {
+    const auto sketch = std::make_shared<HyperLogLogSketch<pmr_string>>(value_count);
+    for (auto value = 0; value < distinct_count; ++value) {
+      sketch->add(pmr_string{"value" + std::to_string(value)});
+    }
+    return sketch;
+  };
+
+  const auto left_node = create_mock_node_with_statistics({{DataType::String, "a"}}, 100, {create_sketch(40, 100.0f)});
+  const auto right_node = create_mock_node_with_statistics({{DataType::String, "a"}}, 50, {create_sketch(20, 50.0f)});
+
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(left_node->get_column("a"), right_node->get_column("a")),
+    left_node,
+    right_node);
+  // clang-format on
+
+  // Each of the 20 distinct values of the right side matches 100 / 40 rows on the left side.
+  const auto result_statistics = estimator.estimate_statistics(input_lqp);
+  EXPECT_NEAR(result_statistics->row_count, 125.0f, 5.0f);
+  ASSERT_EQ(result_statistics->column_statistics.size(), 2u);
+
+  const auto join_column_statistics =
+      std::dynamic_pointer_cast<AttributeStatistics<pmr_string>>(result_statistics->column_statistics.at(0));
+  ASSERT_TRUE(join_column_statistics);
+  ASSERT_TRUE(join_column_statistics->distinct_count_sketch);
+  EXPECT_FLOAT_EQ(join_column_statistics->distinct_count_sketch->value_count, result_statistics->row_count);
+  EXPECT_NEAR(join_column_statistics->distinct_count_sketch->estimate_distinct_count(), 20.0f, 1.5f);
+
+  // Without sketches on both sides, String joins are estimated as cross joins.
+  const auto cross_lqp = JoinNode::make(JoinMode::Inner, equals_(g_a, left_node->get_column("a")), node_g, left_node);
+  EXPECT_FLOAT_EQ(estimator.estimate_statistics(cross_lqp)->row_count, 100.0f * 100.0f);
+}
+
 TEST_F(CardinalityEstimatorTest, JoinCross) {
   // clang-format off
   const auto input_lqp =
@@ -0,0 +1,94 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "statistics/statistics_objects/hyper_log_log_sketch.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class HyperLogLogSketchTest : public BaseTest {};
+
+TEST_F(HyperLogLogSketchTest, EstimateDistinctCount) {
+  // Small cardinalities are estimated (almost) exactly by linear counting.
+  auto small_sketch = HyperLogLogSketch<int32_t>{100};
+  for (auto value = int32_t{0}; value < 100; ++value) {
+    small_sketch.add(value);
+    small_sketch.add(value);
+  }
+  EXPECT_NEAR(small_sketch.estimate_distinct_count(), 100.0f, 3.0f);
+
+  // The standard error is about 2.3%, larger deviations are very unlikely.
+  auto large_sketch = HyperLogLogSketch<int64_t>{1'000'000};
+  for (auto value = int64_t{0}; value < 100'000; ++value) {
+    large_sketch.add(value * 7);
+  }
+  EXPECT_NEAR(large_sketch.estimate_distinct_count(), 100'000.0f, 7'000.0f);
+
+  auto string_sketch = HyperLogLogSketch<pmr_string>{10'000};
+  for (auto value = 0; value < 10'000; ++value) {
+    string_sketch.add(pmr_string{"value" + std::to_string(value)});
+  }
+  EXPECT_NEAR(string_sketch.estimate_distinct_count(), 10'000.0f, 700.0f);
+}
+
+TEST_F(HyperLogLogSketchTest, EstimateIsCappedAtValueCount) {
+  auto sketch = HyperLogLogSketch<int32_t>{1000};
+  for (auto value = int32_t{0}; value < 1000; ++value) {
+    sketch.add(value);
+  }
+
+  const auto scaled_sketch = std::dynamic_pointer_cast<HyperLogLogSketch<int32_t>>(sketch.scaled(0.1f));
+  ASSERT_TRUE(scaled_sketch);
+  EXPECT_FLOAT_EQ(scaled_sketch->value_count, 100.0f);
+  EXPECT_FLOAT_EQ(scaled_sketch->estimate_distinct_count(), 100.0f);
+  EXPECT_EQ(scaled_sketch->registers(), sketch.registers());
+
+  EXPECT_FALSE(sketch.sliced(PredicateCondition::Equals, 5));
+}
+
+TEST_F(HyperLogLogSketchTest, Merge) {
+  auto sketch_a = HyperLogLogSketch<float>{2000};
+  auto sketch_b = HyperLogLogSketch<float>{2000};
+  auto sketch_all = HyperLogLogSketch<float>{4000};
+  for (auto value = 0; value < 2000; ++value) {
+    sketch_a.add(static_cast<float>(value));
+    sketch_b.add(static_cast<float>(value + 1000));
+    sketch_all.add(static_cast<float>(value));
+    sketch_all.add(static_cast<float>(value + 1000));
+  }
+
+  // Merging is lossless: the merged sketch equals the sketch of the union.
+  sketch_a.merge(sketch_b);
+  EXPECT_EQ(sketch_a.registers(), sketch_all.registers());
+  EXPECT_FLOAT_EQ(sketch_a.value_count, 4000.0f);
+  EXPECT_NEAR(sketch_a.estimate_distinct_count(), 3000.0f, 210.0f);
+}
+
+TEST_F(HyperLogLogSketchTest, AddSegment) {
+  const auto value_segment = std::make_shared<ValueSegment<int32_t>>(true);
+  for (auto value = int32_t{0}; value < 500; ++value) {
+    value_segment->append(value % 50);
+  }
+  value_segment->append(NULL_VALUE);
+
+  const auto dictionary_segment =
+      ChunkEncoder::encode_segment(value_segment, DataType::Int, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  auto expected_sketch = HyperLogLogSketch<int32_t>{};
+  for (auto value = int32_t{0}; value < 50; ++value) {
+    expected_sketch.add(value);
+  }
+
+  auto value_segment_sketch = HyperLogLogSketch<int32_t>{};
+  value_segment_sketch.add_segment(*value_segment);
+  EXPECT_EQ(value_segment_sketch.registers(), expected_sketch.registers());
+
+  auto dictionary_segment_sketch = HyperLogLogSketch<int32_t>{};
+  dictionary_segment_sketch.add_segment(*dictionary_segment);
+  EXPECT_EQ(dictionary_segment_sketch.registers(), expected_sketch.registers());
+}
+
+}  // namespace opossum
@@ -0,0 +1,119 @@
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/statistics_refresher.hpp"
+#include "statistics/table_statistics.hpp"
+
+namespace opossum {
+
+class StatisticsRefresherTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Chunk 0 is finalized, chunk 1 (containing one row) is still mutable.
+    _table = load_table("resources/test_data/tbl/int_float.tbl", 2, FinalizeLastChunk::No);
+    Hyrise::get().storage_manager.add_table("table_a", _table);
+  }
+
+  static void execute_sql(const std::string& sql) {
+    auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    const auto [pipeline_status, table] = pipeline.get_result_table();
+    ASSERT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StatisticsRefresherTest, RebuildsStatisticsOfChangedTables) {
+  auto refresher = StatisticsRefresher{0.5f};
+
+  // The statistics created by the StorageManager are up to date.
+  EXPECT_EQ(refresher.refresh(), 0u);
+
+  // One row more than before is below the threshold. The row is merged into the statistics instead.
+  execute_sql("INSERT INTO table_a VALUES (100, 1.5)");
+  EXPECT_EQ(refresher.refresh(), 0u);
+
+  // The changes add up until they exceed the threshold.
+  execute_sql("INSERT INTO table_a VALUES (200, 2.5)");
+  const auto incremental_statistics = _table->table_statistics();
+  EXPECT_FLOAT_EQ(incremental_statistics->row_count, 4);
+
+  EXPECT_EQ(refresher.refresh(), 1u);
+  const auto rebuilt_statistics = _table->table_statistics();
+  EXPECT_NE(rebuilt_statistics, incremental_statistics);
+  EXPECT_FLOAT_EQ(rebuilt_statistics->row_count, 5);
+
+  const auto histogram =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(rebuilt_statistics->column_statistics.at(0))->histogram;
+  EXPECT_EQ(histogram->bin_maximum(histogram->bin_count() - 1), 200);
+
+  EXPECT_EQ(refresher.refresh(), 0u);
+}
+
+TEST_F(StatisticsRefresherTest, MergesInsertedRows) {
+  // The threshold is high enough for the statistics not to be rebuilt.
+  auto refresher = StatisticsRefresher{1.0f};
+  refresher.refresh();
+
+  const auto get_histogram = [&]() {
+    return std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(_table->table_statistics()->column_statistics.at(0))
+        ->histogram;
+  };
+  const auto bin_count = get_histogram()->bin_count();
+
+  // Inserts only record their rows in the delta, the statistics are updated by the refresher.
+  execute_sql("INSERT INTO table_a VALUES (20000, 1.5)");
+  EXPECT_FLOAT_EQ(_table->table_statistics()->row_count, 3);
+
+  EXPECT_EQ(refresher.refresh(), 0u);
+  EXPECT_FLOAT_EQ(_table->table_statistics()->row_count, 4);
+
+  // Ascending values widen the last bin instead of adding new bins.
+  const auto histogram = get_histogram();
+  EXPECT_EQ(histogram->bin_count(), bin_count);
+  EXPECT_EQ(histogram->bin_maximum(bin_count - 1), 20000);
+  EXPECT_FLOAT_EQ(histogram->total_count(), 4);
+}
+
+TEST_F(StatisticsRefresherTest, GeneratesMissingPruningStatistics) {
+  const auto chunk = _table->get_chunk(ChunkID{1});
+  EXPECT_FALSE(chunk->pruning_statistics());
+
+  chunk->finalize();
+  auto refresher = StatisticsRefresher{};
+  refresher.refresh();
+  EXPECT_TRUE(chunk->pruning_statistics());
+}
+
+TEST_F(StatisticsRefresherTest, RecreatedTable) {
+  auto refresher = StatisticsRefresher{};
+  refresher.refresh();
+
+  // A recreated table is tracked from scratch, as the StorageManager has created new statistics for it.
+  Hyrise::get().storage_manager.drop_table("table_a");
+  Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 1));
+  EXPECT_EQ(refresher.refresh(), 0u);
+}
+
+TEST_F(StatisticsRefresherTest, BackgroundRefreshes) {
+  const auto chunk = _table->get_chunk(ChunkID{1});
+  chunk->finalize();
+
+  // The pruning statistics are only checked while the background thread is stopped, as they are not written
+  // atomically.
+  auto refresher = StatisticsRefresher{};
+  while (!chunk->pruning_statistics()) {
+    refresher.start_background(std::chrono::milliseconds{10});
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    refresher.stop_background();
+  }
+}
+
+}  // namespace opossum
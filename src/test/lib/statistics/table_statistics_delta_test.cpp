@@ -0,0 +1,49 @@
+#include "base_test.hpp"
+
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/table_statistics.hpp"
+#include "statistics/table_statistics_delta.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class TableStatisticsDeltaTest : public BaseTest {};
+
+TEST_F(TableStatisticsDeltaTest, AddRowsAndTake) {
+  const auto table = load_table("resources/test_data/tbl/int_with_nulls_large.tbl", 20);
+
+  auto delta = TableStatisticsDelta{table->column_definitions()};
+  EXPECT_FALSE(delta.take());
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    // Add each chunk in two parts, as multiple Inserts would.
+    delta.add_rows(*chunk, ChunkOffset{0}, ChunkOffset{5});
+    delta.add_rows(*chunk, ChunkOffset{5}, chunk->size());
+  }
+
+  const auto table_statistics = delta.take();
+  ASSERT_TRUE(table_statistics);
+  ASSERT_EQ(table_statistics->row_count, 200u);
+  ASSERT_EQ(table_statistics->column_statistics.size(), 2u);
+
+  const auto column_statistics_a =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(0));
+  ASSERT_TRUE(column_statistics_a);
+  ASSERT_TRUE(column_statistics_a->histogram);
+  ASSERT_TRUE(column_statistics_a->null_value_ratio);
+
+  EXPECT_EQ(column_statistics_a->histogram->bin_count(), 1u);
+  EXPECT_FLOAT_EQ(column_statistics_a->histogram->total_count(), 200 - 27);
+  EXPECT_NEAR(column_statistics_a->histogram->total_distinct_count(), 10, 1.5);
+  EXPECT_FLOAT_EQ(column_statistics_a->null_value_ratio->ratio, 27.0f / 200.0f);
+
+  ASSERT_TRUE(column_statistics_a->distinct_count_sketch);
+  EXPECT_FLOAT_EQ(column_statistics_a->distinct_count_sketch->value_count, 200 - 27);
+
+  // The delta has been reset.
+  EXPECT_FALSE(delta.take());
+}
+
+}  // namespace opossum
@@ -3,7 +3,10 @@
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/generate_pruning_statistics.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/statistics_objects/generic_histogram.hpp"
+#include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "utils/load_table.hpp"
 
 namespace opossum {
@@ -29,6 +32,11 @@ TEST_F(TableStatisticsTest, FromTable) {
   EXPECT_FLOAT_EQ(histogram_a->total_count(), 200 - 27);
   EXPECT_FLOAT_EQ(histogram_a->total_distinct_count(), 10);
 
+  const auto& sketch_a = column_statistics_a->distinct_count_sketch;
+  ASSERT_TRUE(sketch_a);
+  EXPECT_FLOAT_EQ(sketch_a->value_count, 200 - 27);
+  EXPECT_NEAR(sketch_a->estimate_distinct_count(), 10, 1.5);
+
   const auto column_statistics_b =
       std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(1));
   ASSERT_TRUE(column_statistics_b);
@@ -41,4 +49,111 @@ TEST_F(TableStatisticsTest, FromTable) {
   EXPECT_FLOAT_EQ(histogram_b->total_distinct_count(), 190);
 }
 
+TEST_F(TableStatisticsTest, FromTableWithSampling) {
+  // 10 chunks with 1'000 rows each. Every tenth value is NULL, the others are 0..499.
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data,
+                                             ChunkOffset{1'000}, UseMvcc::Yes);
+  for (auto row = 0; row < 10'000; ++row) {
+    table->append({row % 10 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{row % 500}});
+  }
+  table->last_chunk()->finalize();
+
+  auto sampling_config = StatisticsSamplingConfig{};
+  sampling_config.min_row_count = 5'000;
+  sampling_config.chunk_sample_ratio = 0.3f;
+  sampling_config.values_per_chunk = 200;
+
+  const auto get_attribute_statistics = [](const std::shared_ptr<TableStatistics>& table_statistics) {
+    return std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(0));
+  };
+
+  // The row count and the null value ratio are extrapolated from the three sampled chunks, the distinct count from
+  // the 600 sampled values.
+  const auto sampled_statistics = TableStatistics::from_table(*table, sampling_config);
+  EXPECT_FLOAT_EQ(sampled_statistics->row_count, 10'000);
+
+  const auto sampled_attribute_statistics = get_attribute_statistics(sampled_statistics);
+  ASSERT_TRUE(sampled_attribute_statistics->histogram);
+  ASSERT_TRUE(sampled_attribute_statistics->null_value_ratio);
+  EXPECT_FALSE(sampled_attribute_statistics->distinct_count_sketch);
+  EXPECT_NEAR(sampled_attribute_statistics->null_value_ratio->ratio, 0.1f, 0.001f);
+  EXPECT_NEAR(sampled_attribute_statistics->histogram->total_count(), 9'000, 1.0f);
+  EXPECT_GT(sampled_attribute_statistics->histogram->total_distinct_count(), 300);
+  EXPECT_LT(sampled_attribute_statistics->histogram->total_distinct_count(), 1'500);
+  EXPECT_GE(sampled_attribute_statistics->histogram->bin_minimum(BinID{0}), 1);
+  EXPECT_LE(sampled_attribute_statistics->histogram->bin_maximum(
+                sampled_attribute_statistics->histogram->bin_count() - 1),
+            499);
+
+  // For dictionary-encoded tables, the distinct count is taken from sketches that are built from the dictionaries.
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+  const auto dictionary_attribute_statistics =
+      get_attribute_statistics(TableStatistics::from_table(*table, sampling_config));
+  ASSERT_TRUE(dictionary_attribute_statistics->distinct_count_sketch);
+  EXPECT_NEAR(dictionary_attribute_statistics->histogram->total_distinct_count(), 450, 25);
+
+  // Smaller tables are not sampled.
+  sampling_config.min_row_count = 10'001;
+  const auto full_attribute_statistics = get_attribute_statistics(TableStatistics::from_table(*table, sampling_config));
+  EXPECT_FLOAT_EQ(full_attribute_statistics->histogram->total_distinct_count(), 450);
+}
+
+TEST_F(TableStatisticsTest, WithInsertedRows) {
+  const auto make_statistics = [](const std::shared_ptr<GenericHistogram<int32_t>>& histogram,
+                                  const float null_value_ratio, const Cardinality row_count) {
+    const auto attribute_statistics = std::make_shared<AttributeStatistics<int32_t>>();
+    attribute_statistics->set_statistics_object(histogram);
+    attribute_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(null_value_ratio));
+    return TableStatistics{{attribute_statistics}, row_count};
+  };
+
+  const auto get_histogram = [](const std::shared_ptr<TableStatistics>& table_statistics) {
+    return std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(0))
+        ->histogram;
+  };
+
+  const auto table_statistics = make_statistics(
+      std::make_shared<GenericHistogram<int32_t>>(std::vector<int32_t>{1, 11}, std::vector<int32_t>{10, 20},
+                                                  std::vector<HistogramCountType>{30, 10},
+                                                  std::vector<HistogramCountType>{10, 5}),
+      0.2f, 50);
+
+  // Values larger than all previous ones are added to the last bin, which is widened.
+  const auto appended_statistics = table_statistics.with_inserted_rows(
+      make_statistics(GenericHistogram<int32_t>::with_single_bin(25, 30, 10, 6), 0.0f, 10));
+  EXPECT_FLOAT_EQ(appended_statistics->row_count, 60);
+  const auto appended_histogram = get_histogram(appended_statistics);
+  ASSERT_EQ(appended_histogram->bin_count(), 2u);
+  EXPECT_EQ(appended_histogram->bin(BinID{0}), HistogramBin<int32_t>(1, 10, 30, 10));
+  EXPECT_EQ(appended_histogram->bin(BinID{1}), HistogramBin<int32_t>(11, 30, 20, 11));
+
+  // The same holds for values smaller than all previous ones and the first bin.
+  const auto prepended_histogram = get_histogram(table_statistics.with_inserted_rows(
+      make_statistics(GenericHistogram<int32_t>::with_single_bin(-5, -1, 4, 4), 0.0f, 4)));
+  ASSERT_EQ(prepended_histogram->bin_count(), 2u);
+  EXPECT_EQ(prepended_histogram->bin(BinID{0}), HistogramBin<int32_t>(-5, 10, 34, 14));
+  EXPECT_EQ(prepended_histogram->bin(BinID{1}), HistogramBin<int32_t>(11, 20, 10, 5));
+  const auto appended_null_value_ratio =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(appended_statistics->column_statistics.at(0))
+          ->null_value_ratio;
+  EXPECT_FLOAT_EQ(appended_null_value_ratio->ratio, 10.0f / 60.0f);
+
+  // Overlapping values are distributed over the existing bins, whose bounds are widened if necessary.
+  const auto merged_statistics = table_statistics.with_inserted_rows(
+      make_statistics(GenericHistogram<int32_t>::with_single_bin(0, 15, 8, 4), 0.5f, 16));
+  EXPECT_FLOAT_EQ(merged_statistics->row_count, 66);
+  const auto merged_histogram = get_histogram(merged_statistics);
+  ASSERT_EQ(merged_histogram->bin_count(), 2u);
+  EXPECT_EQ(merged_histogram->bin(BinID{0}), HistogramBin<int32_t>(0, 10, 36, 13));
+  EXPECT_EQ(merged_histogram->bin(BinID{1}), HistogramBin<int32_t>(11, 20, 12, 6));
+  EXPECT_FLOAT_EQ(merged_histogram->total_count(), 48);
+
+  // Inserting rows with NULLs only does not change the histogram.
+  const auto null_statistics = std::make_shared<AttributeStatistics<int32_t>>();
+  null_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(1.0f));
+  const auto nulls_inserted_statistics = table_statistics.with_inserted_rows(TableStatistics{{null_statistics}, 10});
+  EXPECT_EQ(get_histogram(nulls_inserted_statistics)->bin_count(), 2u);
+  EXPECT_FLOAT_EQ(get_histogram(nulls_inserted_statistics)->total_count(), 40);
+}
+
 }  // namespace opossum
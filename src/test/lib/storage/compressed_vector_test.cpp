@@ -124,4 +124,26 @@ TEST_P(CompressedVectorTest, DecodeSequenceOfZerosUsingDecompressor) {
   }
 }
 
+TEST_P(CompressedVectorTest, DecodeAllBitWidthsUsingIterators) {
+  // BitPackingIterators decode blocks of values at once. Cover each bit width as well as vectors that end within a
+  // block and at a block boundary.
+  for (auto bit_width = uint32_t{1}; bit_width <= 32; ++bit_width) {
+    const auto max_value = static_cast<uint32_t>((uint64_t{1} << bit_width) - 1);
+    for (const auto size : {size_t{1}, size_t{127}, size_t{256}, size_t{1'000}}) {
+      auto sequence = pmr_vector<uint32_t>(size);
+      for (auto index = size_t{0}; index < size; ++index) {
+        sequence[index] = static_cast<uint32_t>(index * 2'654'435'761u) & max_value;
+      }
+      sequence.back() = max_value;
+
+      const auto encoded_sequence_base = compress_vector(sequence, GetParam(), {}, {max_value});
+      resolve_compressed_vector_type(*encoded_sequence_base, [&](auto& encoded_sequence) {
+        EXPECT_TRUE(std::equal(encoded_sequence.cbegin(), encoded_sequence.cend(), sequence.cbegin(), sequence.cend()))
+            << "bit width " << bit_width << ", size " << size;
+        if (size > 1) compare_using_iterator(encoded_sequence, sequence);
+      });
+    }
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,133 @@
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFSSTSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<FSSTSegment<pmr_string>> compress(const std::shared_ptr<ValueSegment<pmr_string>>& segment) {
+    const auto encoded_segment =
+        ChunkEncoder::encode_segment(segment, DataType::String, SegmentEncodingSpec{EncodingType::FSST});
+    return std::dynamic_pointer_cast<FSSTSegment<pmr_string>>(encoded_segment);
+  }
+
+  std::shared_ptr<ValueSegment<pmr_string>> vs_str = std::make_shared<ValueSegment<pmr_string>>(true);
+};
+
+TEST_F(StorageFSSTSegmentTest, SymbolTableRoundTrip) {
+  const auto sample = std::vector<std::string_view>{"http://www.hyrise.net/", "http://www.hpi.de/", "https://hyrise.de/"};
+  const auto symbol_table = FSSTSymbolTable::build(sample);
+  EXPECT_GT(symbol_table.symbols().size(), 0);
+  EXPECT_LE(symbol_table.symbols().size(), FSSTSymbolTable::MAX_SYMBOL_COUNT);
+  for (const auto symbol_length : symbol_table.symbol_lengths()) {
+    EXPECT_GE(symbol_length, 1);
+    EXPECT_LE(symbol_length, FSSTSymbolTable::MAX_SYMBOL_LENGTH);
+  }
+
+  const auto encoder = FSSTSymbolTable::Encoder{symbol_table};
+
+  // Values that are not part of the sample (and bytes that are not covered by any symbol) must be escaped.
+  for (const auto& value : {std::string{"http://www.hyrise.net/"}, std::string{"ftp://unseen.org"}, std::string{},
+                           std::string{"\xFF\x00\x01", 3}}) {
+    auto codes = std::vector<uint8_t>{};
+    encoder.encode(value, codes);
+    EXPECT_EQ(symbol_table.decode(codes.data(), codes.data() + codes.size()), pmr_string{value});
+  }
+
+  // Strings from the sample should be compressed.
+  auto codes = std::vector<uint8_t>{};
+  encoder.encode(sample.front(), codes);
+  EXPECT_LT(codes.size(), sample.front().size());
+}
+
+TEST_F(StorageFSSTSegmentTest, EmptySymbolTable) {
+  const auto symbol_table = FSSTSymbolTable::build({});
+  EXPECT_TRUE(symbol_table.symbols().empty());
+
+  auto codes = std::vector<uint8_t>{};
+  FSSTSymbolTable::Encoder{symbol_table}.encode("abc", codes);
+  EXPECT_EQ(codes.size(), 6);
+  EXPECT_EQ(symbol_table.decode(codes.data(), codes.data() + codes.size()), "abc");
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressNullableStringSegment) {
+  vs_str->append("Alex");
+  vs_str->append("Peter");
+  vs_str->append(NULL_VALUE);
+  vs_str->append("");
+  vs_str->append("Anna");
+
+  const auto fsst_segment = compress(vs_str);
+  ASSERT_TRUE(fsst_segment);
+  EXPECT_EQ(fsst_segment->size(), 5);
+  EXPECT_EQ(fsst_segment->offsets().size(), 6);
+  ASSERT_TRUE(fsst_segment->null_values());
+  EXPECT_EQ(*fsst_segment->null_values(), (pmr_vector<bool>{false, false, true, false, false}));
+
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{0}), "Alex");
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{1}), "Peter");
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{2}), std::nullopt);
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{3}), "");
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{4}), "Anna");
+  EXPECT_TRUE(variant_is_null((*fsst_segment)[ChunkOffset{2}]));
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressSegmentWithoutNulls) {
+  auto vs_str_not_nullable = std::make_shared<ValueSegment<pmr_string>>(false);
+  vs_str_not_nullable->append("Hasso");
+  vs_str_not_nullable->append("Plattner");
+
+  const auto fsst_segment = compress(vs_str_not_nullable);
+  EXPECT_FALSE(fsst_segment->null_values());
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{1}), "Plattner");
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressEmptySegment) {
+  const auto fsst_segment = compress(vs_str);
+  EXPECT_EQ(fsst_segment->size(), 0);
+  EXPECT_TRUE(fsst_segment->compressed_values().empty());
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressionRatio) {
+  auto total_length = size_t{0};
+  for (auto index = 0; index < 10'000; ++index) {
+    const auto value = pmr_string{"https://www.example.com/products/category_"} + pmr_string(std::to_string(index % 97)) +
+                       "/item?id=" + pmr_string(std::to_string(index));
+    total_length += value.size();
+    vs_str->append(value);
+  }
+
+  const auto fsst_segment = compress(vs_str);
+  EXPECT_LT(fsst_segment->compressed_values().size(), total_length / 2);
+  EXPECT_LT(fsst_segment->memory_usage(MemoryUsageCalculationMode::Full),
+            vs_str->memory_usage(MemoryUsageCalculationMode::Full));
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 10'000; chunk_offset += 997) {
+    EXPECT_EQ(fsst_segment->get_typed_value(chunk_offset), vs_str->get_typed_value(chunk_offset));
+  }
+}
+
+TEST_F(StorageFSSTSegmentTest, CopyUsingAllocator) {
+  vs_str->append("Alex");
+  vs_str->append(NULL_VALUE);
+  vs_str->append("Alexander");
+
+  const auto fsst_segment = compress(vs_str);
+  const auto copy = std::dynamic_pointer_cast<FSSTSegment<pmr_string>>(fsst_segment->copy_using_allocator({}));
+  ASSERT_TRUE(copy);
+  EXPECT_SEGMENT_EQ_ORDERED(fsst_segment, copy);
+  EXPECT_EQ(copy->compressed_vector_type(), fsst_segment->compressed_vector_type());
+}
+
+}  // namespace opossum
@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/index/table_key_index.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class TableKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Chunks of four rows, the first one contains (2, "test2"), (4, "test4"), (6, "test6"), (8, "test8").
+    table = load_table("resources/test_data/tbl/int_string.tbl", 4u);
+    table->add_soft_key_constraint({{ColumnID{1}, ColumnID{0}}, KeyConstraintType::UNIQUE});
+    table->create_key_index(table->soft_key_constraints().front());
+    key_index = table->key_index({ColumnID{0}, ColumnID{1}});
+  }
+
+  // Appends a row that is being inserted by @param transaction_id and returns its RowID.
+  RowID append_row(const int32_t a, const pmr_string& b, const TransactionID transaction_id) {
+    table->append({a, b});
+    const auto chunk_id = ChunkID{table->chunk_count() - 1};
+    const auto chunk_offset = ChunkOffset{table->get_chunk(chunk_id)->size() - 1};
+    table->get_chunk(chunk_id)->mvcc_data()->set_tid(chunk_offset, transaction_id);
+    return RowID{chunk_id, chunk_offset};
+  }
+
+  std::shared_ptr<Table> table;
+  std::shared_ptr<TableKeyIndex> key_index;
+};
+
+TEST_F(TableKeyIndexTest, ColumnIDsAreSorted) {
+  ASSERT_TRUE(key_index);
+  EXPECT_EQ(key_index->column_ids(), std::vector<ColumnID>({ColumnID{0}, ColumnID{1}}));
+  EXPECT_EQ(key_index->key_type(), KeyConstraintType::UNIQUE);
+  EXPECT_EQ(table->key_index({ColumnID{1}, ColumnID{0}}), key_index);
+  EXPECT_FALSE(table->key_index({ColumnID{0}}));
+}
+
+TEST_F(TableKeyIndexTest, Lookup) {
+  EXPECT_EQ(key_index->lookup({4, pmr_string{"test4"}}), std::vector<RowID>({RowID{ChunkID{0}, ChunkOffset{1}}}));
+  EXPECT_EQ(key_index->lookup({18, pmr_string{"test18"}}), std::vector<RowID>({RowID{ChunkID{2}, ChunkOffset{0}}}));
+  EXPECT_TRUE(key_index->lookup({4, pmr_string{"test6"}}).empty());
+
+  // Values are cast to the column data types if this is possible without loss.
+  EXPECT_EQ(key_index->lookup({int64_t{6}, pmr_string{"test6"}}),
+            std::vector<RowID>({RowID{ChunkID{0}, ChunkOffset{2}}}));
+  EXPECT_TRUE(key_index->lookup({6.5f, pmr_string{"test6"}}).empty());
+  EXPECT_TRUE(key_index->lookup({NULL_VALUE, pmr_string{"test6"}}).empty());
+}
+
+TEST_F(TableKeyIndexTest, InsertConflictsWithVisibleRow) {
+  const auto row_id = append_row(4, "test4", TransactionID{5});
+  EXPECT_FALSE(key_index->try_insert(row_id, TransactionID{5}));
+
+  // A new key does not conflict.
+  const auto other_row_id = append_row(4, "test5", TransactionID{5});
+  EXPECT_TRUE(key_index->try_insert(other_row_id, TransactionID{5}));
+  EXPECT_EQ(key_index->lookup({4, pmr_string{"test5"}}), std::vector<RowID>({other_row_id}));
+}
+
+TEST_F(TableKeyIndexTest, InsertDoesNotConflictWithRowDeletedBySameTransaction) {
+  // The inserting transaction deletes the existing row, e.g., as part of an Update.
+  table->get_chunk(ChunkID{0})->mvcc_data()->set_tid(ChunkOffset{1}, TransactionID{5});
+
+  // Other transactions still conflict with the row.
+  const auto other_transaction_row_id = append_row(4, "test4", TransactionID{6});
+  EXPECT_FALSE(key_index->try_insert(other_transaction_row_id, TransactionID{6}));
+
+  const auto row_id = append_row(4, "test4", TransactionID{5});
+  EXPECT_TRUE(key_index->try_insert(row_id, TransactionID{5}));
+  auto row_ids = key_index->lookup({4, pmr_string{"test4"}});
+  std::sort(row_ids.begin(), row_ids.end());
+  EXPECT_EQ(row_ids, std::vector<RowID>({RowID{ChunkID{0}, ChunkOffset{1}}, row_id}));
+}
+
+TEST_F(TableKeyIndexTest, InsertConflictsWithPendingInsert) {
+  const auto row_id = append_row(3, "test3", TransactionID{5});
+  EXPECT_TRUE(key_index->try_insert(row_id, TransactionID{5}));
+
+  const auto other_row_id = append_row(3, "test3", TransactionID{6});
+  EXPECT_FALSE(key_index->try_insert(other_row_id, TransactionID{6}));
+
+  // Once the first insert is rolled back and removed from the index, the key can be inserted.
+  table->get_chunk(row_id.chunk_id)->mvcc_data()->set_end_cid(row_id.chunk_offset, CommitID{0});
+  key_index->erase(row_id);
+  EXPECT_TRUE(key_index->lookup({3, pmr_string{"test3"}}).empty());
+  EXPECT_TRUE(key_index->try_insert(other_row_id, TransactionID{6}));
+  EXPECT_EQ(key_index->lookup({3, pmr_string{"test3"}}), std::vector<RowID>({other_row_id}));
+}
+
+TEST_F(TableKeyIndexTest, InsertDoesNotConflictWithDeletedRow) {
+  table->get_chunk(ChunkID{0})->mvcc_data()->set_end_cid(ChunkOffset{1}, CommitID{1});
+
+  const auto row_id = append_row(4, "test4", TransactionID{5});
+  EXPECT_TRUE(key_index->try_insert(row_id, TransactionID{5}));
+
+  // Both versions are returned, Validate has to filter them.
+  EXPECT_EQ(key_index->lookup({4, pmr_string{"test4"}}).size(), 2);
+}
+
+}  // namespace opossum
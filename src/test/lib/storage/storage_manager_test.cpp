@@ -86,6 +86,20 @@ TEST_F(StorageManagerTest, DropTable) {
   EXPECT_TRUE(sm.has_table("first_table"));
 }
 
+TEST_F(StorageManagerTest, TableName) {
+  auto& sm = Hyrise::get().storage_manager;
+  const auto first_table = sm.get_table("first_table");
+  EXPECT_EQ(sm.table_name(*first_table), "first_table");
+  EXPECT_EQ(sm.table_name(*sm.get_table("second_table")), "second_table");
+  EXPECT_THROW(sm.table_name(Table{TableColumnDefinitions{}, TableType::Data}), std::exception);
+
+  sm.drop_table("first_table");
+  EXPECT_THROW(sm.table_name(*first_table), std::exception);
+
+  sm.add_table("third_table", first_table);
+  EXPECT_EQ(sm.table_name(*first_table), "third_table");
+}
+
 TEST_F(StorageManagerTest, DoesNotHaveTable) {
   auto& sm = Hyrise::get().storage_manager;
   EXPECT_EQ(sm.has_table("third_table"), false);
@@ -89,8 +89,9 @@ TEST_F(ChunkCompressionTaskTest, CompressionWithAbortedInsert) {
 
   ASSERT_EQ(table->chunk_count(), 4u);
 
-  table->get_chunk(ChunkID{2})->finalize();
-  table->get_chunk(ChunkID{3})->finalize();
+  // The rolled-back Insert has filled up both chunks and finalized them.
+  EXPECT_FALSE(table->get_chunk(ChunkID{2})->is_mutable());
+  EXPECT_FALSE(table->get_chunk(ChunkID{3})->is_mutable());
 
   auto compression = std::make_shared<ChunkCompressionTask>(
       "table_insert", std::vector<ChunkID>{ChunkID{0}, ChunkID{1}, ChunkID{2}, ChunkID{3}});